@@ -58,6 +58,7 @@ constexpr uint16_t kOptionUserConsentState          = 'u';
 constexpr uint16_t kOptionIgnoreQueryImage          = 'x';
 constexpr uint16_t kOptionIgnoreApplyUpdate         = 'y';
 constexpr uint16_t kOptionPollInterval              = 'P';
+constexpr uint16_t kOptionMaxConcurrentTransfers    = 'T';
 
 NamedPipeCommands sChipNamedPipeCommands;
 OtaProviderAppCommandDelegate sOtaProviderAppCommandDelegate;
@@ -77,6 +78,7 @@ static uint32_t gIgnoreQueryImageCount               = 0;
 static uint32_t gIgnoreApplyUpdateCount              = 0;
 static uint32_t gPollInterval                        = 0;
 static std::optional<uint16_t> gMaxBDXBlockSize      = std::nullopt;
+static uint32_t gMaxConcurrentTransfers              = 0;
 
 // Parses the JSON filepath and extracts DeviceSoftwareVersionModel parameters
 static bool ParseJsonFileAndPopulateCandidates(const char * filepath,
@@ -263,6 +265,14 @@ bool HandleOptions(const char * aProgram, OptionSet * aOptions, int aIdentifier,
         }
         break;
     }
+    case kOptionMaxConcurrentTransfers:
+        gMaxConcurrentTransfers = static_cast<uint32_t>(strtoul(aValue, nullptr, 0));
+        if (gMaxConcurrentTransfers == 0)
+        {
+            PrintArgError("%s: ERROR: Invalid maxConcurrentTransfers parameter: %s\n", aProgram, aValue);
+            retval = false;
+        }
+        break;
 
     default:
         PrintArgError("%s: INTERNAL ERROR: Unhandled option: %s\n", aProgram, aName);
@@ -287,6 +297,7 @@ OptionDef cmdLineOptionsDef[] = {
     { "ignoreApplyUpdate", chip::ArgParser::kArgumentRequired, kOptionIgnoreApplyUpdate },
     { "pollInterval", chip::ArgParser::kArgumentRequired, kOptionPollInterval },
     { "maxBDXBlockSize", chip::ArgParser::kArgumentRequired, kOptionMaxBDXBlockSize },
+    { "maxConcurrentTransfers", chip::ArgParser::kArgumentRequired, kOptionMaxConcurrentTransfers },
     {},
 };
 
@@ -330,7 +341,10 @@ OptionSet cmdLineOptions = { HandleOptions, cmdLineOptionsDef, "PROGRAM OPTIONS"
                              "  -y, --ignoreApplyUpdate <ignore count>\n"
                              "        The number of times to ignore the ApplyUpdateRequest Command and not send a response.\n"
                              "  -P, --pollInterval <time in milliseconds>\n"
-                             "        Poll interval for the BDX transfer \n" };
+                             "        Poll interval for the BDX transfer \n"
+                             "  -T, --maxConcurrentTransfers <count>\n"
+                             "        Maximum number of BDX transfers served at the same time. Requestors beyond\n"
+                             "        this limit are told the provider is busy and are served in order of arrival.\n" };
 
 OptionSet * allOptions[] = { &cmdLineOptions, nullptr };
 
@@ -388,6 +402,11 @@ void ApplicationInit()
         GetOtaProviderExample().SetMaxBDXBlockSize(*gMaxBDXBlockSize);
     }
 
+    if (gMaxConcurrentTransfers != 0)
+    {
+        bdxOtaSender->SetMaxConcurrentTransfers(gMaxConcurrentTransfers);
+    }
+
     ChipLogDetail(SoftwareUpdate, "Using ImageList file: %s", gOtaImageListFilepath ? gOtaImageListFilepath : "(none)");
 
     if (gOtaImageListFilepath != nullptr)
@@ -22,46 +22,42 @@
 #include <lib/support/CHIPMemString.h>
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
+#include <protocols/bdx/BdxMessages.h>
 #include <protocols/bdx/BdxTransferSession.h>
+#include <system/SystemClock.h>
+#include <transport/Session.h>
 
-#include <fstream>
+#include <algorithm>
 
 using chip::bdx::StatusCode;
 using chip::bdx::TransferControlFlags;
 using chip::bdx::TransferSession;
 
-BdxOtaSender::BdxOtaSender()
+BdxOtaTransfer::BdxOtaTransfer(const std::unordered_map<std::string, std::string> & fileDesignatorMap) :
+    mFileDesignatorMap(fileDesignatorMap)
 {
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
 }
 
-CHIP_ERROR BdxOtaSender::InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId)
+void BdxOtaTransfer::Reserve(const chip::ScopedNodeId & requestor, chip::System::Clock::Timestamp now)
 {
-    if (mInitialized)
+    mRequestor   = requestor;
+    mReservedAt  = now;
+    mInitialized = true;
+}
+
+bool BdxOtaTransfer::IsStale(chip::System::Clock::Timestamp now, chip::System::Clock::Timeout reservationTimeout) const
+{
+    VerifyOrReturnValue(mInitialized, false);
+    if (mStarted)
     {
-        // Reset stale connection from the Same Node if exists
-        if ((mFabricIndex.HasValue() && mFabricIndex.Value() == fabricIndex) && (mNodeId.HasValue() && mNodeId.Value() == nodeId))
-        {
-            Reset();
-        }
-        // Prevent a new node connection since another is active
-        else if ((mFabricIndex.HasValue() && mFabricIndex.Value() != fabricIndex) ||
-                 (mNodeId.HasValue() && mNodeId.Value() != nodeId))
-        {
-            return CHIP_ERROR_BUSY;
-        }
-        else
-        {
-            return CHIP_ERROR_INTERNAL;
-        }
+        // The exchange is only dropped once the transfer can no longer continue (e.g. the requestor stopped responding).
+        return mExchangeCtx == nullptr;
     }
-    mFabricIndex.SetValue(fabricIndex);
-    mNodeId.SetValue(nodeId);
-    mInitialized = true;
-    return CHIP_NO_ERROR;
+    return (now - mReservedAt) >= reservationTimeout;
 }
 
-void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & event)
+void BdxOtaTransfer::HandleTransferSessionOutput(TransferSession::OutputEvent & event)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
 
@@ -90,8 +86,10 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
         {
             if (!sendFlags.Has(chip::Messaging::SendMessageFlags::kExpectResponse))
             {
-                // After sending the StatusReport, exchange context gets closed so, set mExchangeCtx to null
+                // After sending the StatusReport, exchange context gets closed so, set mExchangeCtx to null. The transfer is over:
+                // release it so that another requestor can be served.
                 mExchangeCtx = nullptr;
+                Reset();
             }
         }
         else
@@ -131,6 +129,16 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
             return;
         }
 
+        // Transfers of the same image share one mapping of the file.
+        mImage = OtaImageMapping::Acquire(entry->second);
+        if (mImage == nullptr)
+        {
+            VerifyOrReturn(mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown) == CHIP_NO_ERROR,
+                           ChipLogError(BDX, "AbortTransfer failed"));
+            return;
+        }
+        mStarted = true;
+
         break;
     }
     case TransferSession::OutputEventType::kQueryReceived:
@@ -153,50 +161,31 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
             bytesToRead = static_cast<uint16_t>(mTransfer.GetTransferLength() - seekOffset);
         }
 
-        chip::System::PacketBufferHandle blockBuf = chip::System::PacketBufferHandle::New(bytesToRead);
-        if (blockBuf.IsNull())
-        {
-            // TODO(#13981): AbortTransfer() needs to support GeneralStatusCode failures as well as BDX specific errors.
-            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kUnknown);
-            return;
-        }
-
-        const auto entry = mFileDesignatorMap.find(mFileDesignator);
-        if (entry == mFileDesignatorMap.cend())
+        if (mImage == nullptr)
         {
             VerifyOrReturn(mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown) == CHIP_NO_ERROR,
                            ChipLogError(BDX, "AbortTransfer failed"));
             return;
         }
-        std::ifstream otaFile(entry->second.c_str(), std::ifstream::in | std::ios::binary);
-        if (!otaFile.good())
-        {
-            ChipLogError(BDX, "OTA file open failed");
-            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
-            return;
-        }
 
-        if (seekOffset > static_cast<uint64_t>(std::numeric_limits<std::streamoff>::max()))
+        // PrepareBlock() copies the data into the outgoing message, so the block is read straight from the mapped image.
+        chip::ByteSpan image = mImage->GetData();
+        if (seekOffset > image.size())
         {
-            ChipLogError(BDX, "Seek offset too large");
-            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kLengthTooLarge);
-            return;
-        }
-        otaFile.seekg(static_cast<std::streamoff>(seekOffset));
-        otaFile.read(reinterpret_cast<char *>(blockBuf->Start()), bytesToRead);
-        if (!(otaFile.good() || otaFile.eof()))
-        {
-            ChipLogError(BDX, "OTA file read failed");
-            TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kFileDesignatorUnknown);
+            ChipLogError(BDX, "Seek offset past the end of the OTA file");
+            VerifyOrReturn(mTransfer.AbortTransfer(StatusCode::kLengthTooLarge) == CHIP_NO_ERROR,
+                           ChipLogError(BDX, "AbortTransfer failed"));
             return;
         }
+        size_t offset         = static_cast<size_t>(seekOffset);
+        size_t bytesAvailable = image.size() - offset;
 
-        blockData.Data   = blockBuf->Start();
-        blockData.Length = static_cast<size_t>(otaFile.gcount());
+        blockData.Data   = image.data() + offset;
+        blockData.Length = std::min(static_cast<size_t>(bytesToRead), bytesAvailable);
         blockData.IsEof  = (blockData.Length < blockSize) ||
-            (seekOffset + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength() || (otaFile.peek() == EOF));
+            (seekOffset + static_cast<uint64_t>(blockData.Length) == mTransfer.GetTransferLength()) ||
+            (blockData.Length == bytesAvailable);
         mNumBytesSent = static_cast<uint32_t>(seekOffset + blockData.Length);
-        otaFile.close();
 
         err = mTransfer.PrepareBlock(blockData);
         if (err != CHIP_NO_ERROR)
@@ -237,10 +226,9 @@ void BdxOtaSender::HandleTransferSessionOutput(TransferSession::OutputEvent & ev
  * will call HandleTransferSessionOutput() with event TransferSession::OutputEventType::kNone.
  * Since we are ignoring kNone events so, it is okay HandleTransferSessionOutput() being called with event kNone
  */
-void BdxOtaSender::Reset()
+void BdxOtaTransfer::Reset()
 {
-    mFabricIndex.ClearValue();
-    mNodeId.ClearValue();
+    mRequestor = chip::ScopedNodeId();
     ResetTransfer();
     if (mExchangeCtx != nullptr)
     {
@@ -249,15 +237,166 @@ void BdxOtaSender::Reset()
     }
 
     mInitialized  = false;
+    mStarted      = false;
     mNumBytesSent = 0;
+    mImage.reset();
     memset(mFileDesignator, 0, chip::bdx::kMaxFileDesignatorLen);
 }
 
-void BdxOtaSender::AbortTransfer()
+void BdxOtaTransfer::AbortTransfer()
 {
     if (mInitialized)
     {
         TEMPORARY_RETURN_IGNORED mTransfer.AbortTransfer(StatusCode::kUnknown);
         PollForOutput();
     }
+
+    // A transfer the requestor never started has no exchange to report the abort on.
+    if (mInitialized)
+    {
+        Reset();
+    }
+}
+
+CHIP_ERROR BdxOtaSender::InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId)
+{
+    const chip::System::Clock::Timestamp now = chip::System::SystemClock().GetMonotonicTimestamp();
+    const chip::ScopedNodeId requestor(nodeId, fabricIndex);
+
+    mPendingTransfer = nullptr;
+
+    // Reset stale connection from the Same Node if exists
+    BdxOtaTransfer * transfer = FindTransfer(requestor);
+    if (transfer != nullptr)
+    {
+        transfer->Reset();
+        transfer->Reserve(requestor, now);
+        mPendingTransfer = transfer;
+        return CHIP_NO_ERROR;
+    }
+
+    // Forget requestors that stopped asking.
+    auto expired = [now](const QueuedRequestor & entry) { return (now - entry.lastQueried) >= kQueuedRequestorTimeout; };
+    mQueue.erase(std::remove_if(mQueue.begin(), mQueue.end(), expired), mQueue.end());
+
+    auto queued = std::find_if(mQueue.begin(), mQueue.end(),
+                               [&requestor](const QueuedRequestor & entry) { return entry.requestor == requestor; });
+    const size_t position = static_cast<size_t>(queued - mQueue.begin());
+
+    // Free transfers go to the requestors that have been waiting the longest.
+    if (position < ReclaimTransfers(now))
+    {
+        if (queued != mQueue.end())
+        {
+            mQueue.erase(queued);
+        }
+        transfer = AllocateTransfer();
+        transfer->Reserve(requestor, now);
+        mPendingTransfer = transfer;
+        return CHIP_NO_ERROR;
+    }
+
+    if (queued != mQueue.end())
+    {
+        queued->lastQueried = now;
+    }
+    else
+    {
+        mQueue.push_back({ requestor, now });
+    }
+
+    ChipLogProgress(BDX, "%u OTA transfers in progress, requestor queued at position %u",
+                    static_cast<unsigned>(GetActiveTransferCount()), static_cast<unsigned>(position + 1));
+    return CHIP_ERROR_BUSY;
+}
+
+CHIP_ERROR BdxOtaSender::PrepareForTransfer(chip::System::Layer * layer, chip::bdx::TransferRole role,
+                                            chip::BitFlags<TransferControlFlags> xferControlOpts, uint16_t maxBlockSize,
+                                            chip::System::Clock::Timeout timeout, chip::System::Clock::Timeout pollFreq)
+{
+    VerifyOrReturnError(mPendingTransfer != nullptr, CHIP_ERROR_INCORRECT_STATE);
+
+    BdxOtaTransfer * transfer = mPendingTransfer;
+    mPendingTransfer          = nullptr;
+    mReservationTimeout       = timeout;
+
+    CHIP_ERROR err = transfer->PrepareForTransfer(layer, role, xferControlOpts, maxBlockSize, timeout, pollFreq);
+    if (err != CHIP_NO_ERROR)
+    {
+        transfer->Reset();
+    }
+    return err;
+}
+
+void BdxOtaSender::AbortTransfer()
+{
+    for (auto & transfer : mTransfers)
+    {
+        transfer->AbortTransfer();
+    }
+    mQueue.clear();
+    mPendingTransfer = nullptr;
+}
+
+size_t BdxOtaSender::GetActiveTransferCount() const
+{
+    return static_cast<size_t>(std::count_if(mTransfers.begin(), mTransfers.end(),
+                                             [](const std::unique_ptr<BdxOtaTransfer> & transfer) { return transfer->IsInUse(); }));
+}
+
+CHIP_ERROR BdxOtaSender::OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader,
+                                                      const chip::SessionHandle & session,
+                                                      chip::Messaging::ExchangeDelegate *& newDelegate)
+{
+    // Only a ReceiveInit starts a transfer; every later message of the transfer arrives on its exchange.
+    VerifyOrReturnError(payloadHeader.HasMessageType(chip::bdx::MessageType::ReceiveInit), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(session->IsSecureSession(), CHIP_ERROR_INCORRECT_STATE);
+
+    BdxOtaTransfer * transfer = FindTransfer(session->GetPeer());
+    VerifyOrReturnError(transfer != nullptr && !transfer->HasStarted(), CHIP_ERROR_INCORRECT_STATE,
+                        ChipLogError(BDX, "No OTA transfer reserved for requestor " ChipLogFormatScopedNodeId,
+                                     ChipLogValueScopedNodeId(session->GetPeer())));
+
+    newDelegate = transfer;
+    return CHIP_NO_ERROR;
+}
+
+BdxOtaTransfer * BdxOtaSender::FindTransfer(const chip::ScopedNodeId & requestor)
+{
+    for (auto & transfer : mTransfers)
+    {
+        if (transfer->IsReservedFor(requestor))
+        {
+            return transfer.get();
+        }
+    }
+    return nullptr;
+}
+
+size_t BdxOtaSender::ReclaimTransfers(chip::System::Clock::Timestamp now)
+{
+    size_t inUse = 0;
+    for (auto & transfer : mTransfers)
+    {
+        if (transfer->IsStale(now, mReservationTimeout))
+        {
+            ChipLogProgress(BDX, "Releasing stale OTA transfer");
+            transfer->Reset();
+        }
+        inUse += transfer->IsInUse() ? 1 : 0;
+    }
+    return (inUse < mMaxConcurrentTransfers) ? (mMaxConcurrentTransfers - inUse) : 0;
+}
+
+BdxOtaTransfer * BdxOtaSender::AllocateTransfer()
+{
+    for (auto & transfer : mTransfers)
+    {
+        if (!transfer->IsInUse())
+        {
+            return transfer.get();
+        }
+    }
+    mTransfers.push_back(std::make_unique<BdxOtaTransfer>(mFileDesignatorMap));
+    return mTransfers.back().get();
 }
@@ -15,40 +15,129 @@
  *    limitations under the License.
  */
 
+#include <lib/core/ScopedNodeId.h>
+#include <messaging/ExchangeDelegate.h>
+#include <ota-provider-common/OtaImageMapping.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <protocols/bdx/TransferFacilitator.h>
+#include <system/SystemClock.h>
 
+#include <deque>
+#include <memory>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #pragma once
 
-class BdxOtaSender : public chip::bdx::Responder
+/**
+ * Serves an OTA image to a single requestor over BDX.
+ *
+ * Blocks are sent straight from the shared read-only mapping of the image file (see OtaImageMapping), so
+ * concurrent transfers of the same image do not each open, seek and read the file for every block.
+ */
+class BdxOtaTransfer : public chip::bdx::Responder
 {
 public:
-    BdxOtaSender();
+    explicit BdxOtaTransfer(const std::unordered_map<std::string, std::string> & fileDesignatorMap);
 
-    // Initializes BDX transfer-related metadata. Should always be called first.
-    CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
+    // Reserves this transfer for the given requestor. PrepareForTransfer() should be called next.
+    void Reserve(const chip::ScopedNodeId & requestor, chip::System::Clock::Timestamp now);
+
+    bool IsInUse() const { return mInitialized; }
+    bool IsReservedFor(const chip::ScopedNodeId & requestor) const { return mInitialized && mRequestor == requestor; }
+    bool HasStarted() const { return mStarted; }
+
+    // Whether the transfer is reserved but can no longer make progress: the requestor did not start it within
+    // `reservationTimeout`, or its exchange is gone.
+    bool IsStale(chip::System::Clock::Timestamp now, chip::System::Clock::Timeout reservationTimeout) const;
 
     void AbortTransfer();
 
-    void SetFileDesignatorMap(const std::unordered_map<std::string, std::string> & map) { mFileDesignatorMap = map; }
+    // Releases the transfer without notifying the requestor.
+    void Reset();
 
 private:
     // Inherited from bdx::TransferFacilitator
     void HandleTransferSessionOutput(chip::bdx::TransferSession::OutputEvent & event) override;
 
-    void Reset();
-
     // Null-terminated string representing file designator
     char mFileDesignator[chip::bdx::kMaxFileDesignatorLen];
-    std::unordered_map<std::string, std::string> mFileDesignatorMap;
+    const std::unordered_map<std::string, std::string> & mFileDesignatorMap;
+    std::shared_ptr<const OtaImageMapping> mImage;
     uint32_t mNumBytesSent = 0;
 
     bool mInitialized = false;
+    bool mStarted     = false;
+
+    chip::ScopedNodeId mRequestor;
+    chip::System::Clock::Timestamp mReservedAt = chip::System::Clock::kZero;
+};
+
+/**
+ * Dispatches BDX transfers of OTA images to a bounded set of BdxOtaTransfer objects, one per requestor.
+ *
+ * At most GetMaxConcurrentTransfers() transfers run at the same time. Requestors that cannot be served
+ * right away are told to retry (InitializeTransfer() returns CHIP_ERROR_BUSY) and are queued: when a
+ * transfer slot frees up it goes to the requestors that have been waiting the longest.
+ */
+class BdxOtaSender : public chip::Messaging::UnsolicitedMessageHandler
+{
+public:
+    static constexpr size_t kDefaultMaxConcurrentTransfers = 4;
+
+    // How long a transfer stays reserved for a requestor that has not sent its ReceiveInit yet. PrepareForTransfer() replaces it
+    // with the transfer timeout.
+    static constexpr chip::System::Clock::Timeout kDefaultReservationTimeout = chip::System::Clock::Seconds16(5 * 60);
 
-    chip::Optional<chip::FabricIndex> mFabricIndex;
+    // Queued requestors that do not ask again within this time give up their place in the queue.
+    static constexpr chip::System::Clock::Timeout kQueuedRequestorTimeout = chip::System::Clock::Seconds16(10 * 60);
 
-    chip::Optional<chip::NodeId> mNodeId;
+    BdxOtaSender() = default;
+
+    // Reserves a transfer for the given requestor. Should always be called first. Returns CHIP_ERROR_BUSY and queues the requestor
+    // when all transfers are in use, or when the free ones are owed to requestors queued ahead of it.
+    CHIP_ERROR InitializeTransfer(chip::FabricIndex fabricIndex, chip::NodeId nodeId);
+
+    // Prepares the transfer reserved by the last successful InitializeTransfer() call to respond to the requestor's ReceiveInit.
+    CHIP_ERROR PrepareForTransfer(chip::System::Layer * layer, chip::bdx::TransferRole role,
+                                  chip::BitFlags<chip::bdx::TransferControlFlags> xferControlOpts, uint16_t maxBlockSize,
+                                  chip::System::Clock::Timeout timeout, chip::System::Clock::Timeout pollFreq);
+
+    // Aborts every transfer in progress.
+    void AbortTransfer();
+
+    void SetFileDesignatorMap(const std::unordered_map<std::string, std::string> & map) { mFileDesignatorMap = map; }
+
+    // Transfers already running are not interrupted when the limit is lowered.
+    void SetMaxConcurrentTransfers(size_t maxTransfers) { mMaxConcurrentTransfers = (maxTransfers > 0) ? maxTransfers : 1; }
+    size_t GetMaxConcurrentTransfers() const { return mMaxConcurrentTransfers; }
+
+    size_t GetActiveTransferCount() const;
+    size_t GetQueuedRequestorCount() const { return mQueue.size(); }
+
+private:
+    struct QueuedRequestor
+    {
+        chip::ScopedNodeId requestor;
+        chip::System::Clock::Timestamp lastQueried;
+    };
+
+    using chip::Messaging::UnsolicitedMessageHandler::OnUnsolicitedMessageReceived;
+    CHIP_ERROR OnUnsolicitedMessageReceived(const chip::PayloadHeader & payloadHeader, const chip::SessionHandle & session,
+                                            chip::Messaging::ExchangeDelegate *& newDelegate) override;
+
+    BdxOtaTransfer * FindTransfer(const chip::ScopedNodeId & requestor);
+
+    // Releases stale transfers and returns how many more can be started without exceeding the limit.
+    size_t ReclaimTransfers(chip::System::Clock::Timestamp now);
+
+    BdxOtaTransfer * AllocateTransfer();
+
+    std::unordered_map<std::string, std::string> mFileDesignatorMap;
+    std::vector<std::unique_ptr<BdxOtaTransfer>> mTransfers;
+    std::deque<QueuedRequestor> mQueue;
+    BdxOtaTransfer * mPendingTransfer                = nullptr;
+    chip::System::Clock::Timeout mReservationTimeout = kDefaultReservationTimeout;
+    size_t mMaxConcurrentTransfers                   = kDefaultMaxConcurrentTransfers;
 };
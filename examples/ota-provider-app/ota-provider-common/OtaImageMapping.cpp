@@ -0,0 +1,104 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <ota-provider-common/OtaImageMapping.h>
+
+#include <lib/support/logging/CHIPLogging.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <unordered_map>
+
+namespace {
+
+// Mappings currently in use, by path. Only accessed from the Matter thread.
+std::unordered_map<std::string, std::weak_ptr<const OtaImageMapping>> gMappings;
+
+} // namespace
+
+OtaImageMapping::~OtaImageMapping()
+{
+    munmap(const_cast<uint8_t *>(mData), mSize);
+}
+
+std::shared_ptr<const OtaImageMapping> OtaImageMapping::Acquire(const std::string & path)
+{
+    struct stat st;
+    if (stat(path.c_str(), &st) != 0)
+    {
+        ChipLogError(BDX, "Cannot stat OTA file %s: %s", path.c_str(), strerror(errno));
+        return nullptr;
+    }
+
+    FileIdentity identity = { st.st_dev, st.st_ino, st.st_size, st.st_mtim.tv_sec, st.st_mtim.tv_nsec };
+
+    auto entry = gMappings.find(path);
+    if (entry != gMappings.end())
+    {
+        std::shared_ptr<const OtaImageMapping> mapping = entry->second.lock();
+        if (mapping && mapping->mIdentity == identity)
+        {
+            return mapping;
+        }
+    }
+
+    int fd = open(path.c_str(), O_RDONLY | O_CLOEXEC);
+    if (fd < 0)
+    {
+        ChipLogError(BDX, "Cannot open OTA file %s: %s", path.c_str(), strerror(errno));
+        return nullptr;
+    }
+
+    // Take the identity from the descriptor actually mapped, in case the file was replaced since stat().
+    if (fstat(fd, &st) != 0 || st.st_size <= 0)
+    {
+        ChipLogError(BDX, "OTA file %s is empty or unreadable", path.c_str());
+        close(fd);
+        return nullptr;
+    }
+    identity = { st.st_dev, st.st_ino, st.st_size, st.st_mtim.tv_sec, st.st_mtim.tv_nsec };
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    void * data       = mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+        ChipLogError(BDX, "Cannot map OTA file %s: %s", path.c_str(), strerror(errno));
+        return nullptr;
+    }
+
+    // Requestors download at their own pace from different offsets: ask for the whole image up front rather
+    // than relying on sequential read-ahead. This is only a hint.
+    madvise(data, size, MADV_WILLNEED);
+
+    std::shared_ptr<const OtaImageMapping> mapping(new OtaImageMapping(static_cast<const uint8_t *>(data), size, identity));
+
+    // Drop registry entries whose mapping has been released before adding this one.
+    for (auto it = gMappings.begin(); it != gMappings.end();)
+    {
+        it = it->second.expired() ? gMappings.erase(it) : std::next(it);
+    }
+    gMappings[path] = mapping;
+
+    ChipLogDetail(BDX, "Mapped OTA file %s (%u bytes)", path.c_str(), static_cast<unsigned>(size));
+    return mapping;
+}
@@ -0,0 +1,79 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/support/Span.h>
+
+#include <stddef.h>
+#include <sys/types.h>
+
+#include <memory>
+#include <string>
+
+/**
+ * A read-only memory mapping of an OTA image file.
+ *
+ * Mappings are shared: every transfer serving the same file holds a reference to the same mapping, so
+ * the image is paged in once no matter how many requestors download it at the same time. The mapping
+ * is released when the last transfer using it drops its reference.
+ *
+ * If the file is replaced (renamed over, or otherwise changes identity, size or modification time),
+ * the next Acquire() maps the new file while transfers already in progress keep reading the old one.
+ * Images must not be rewritten in place while they are being served.
+ */
+class OtaImageMapping
+{
+public:
+    ~OtaImageMapping();
+
+    OtaImageMapping(const OtaImageMapping &)             = delete;
+    OtaImageMapping & operator=(const OtaImageMapping &) = delete;
+
+    /**
+     * Return the mapping of the file at `path`, mapping it if no transfer currently uses it.
+     * Returns nullptr if the file cannot be opened or mapped, or is empty.
+     */
+    static std::shared_ptr<const OtaImageMapping> Acquire(const std::string & path);
+
+    chip::ByteSpan GetData() const { return chip::ByteSpan(mData, mSize); }
+    size_t GetSize() const { return mSize; }
+
+private:
+    struct FileIdentity
+    {
+        dev_t device;
+        ino_t inode;
+        off_t size;
+        time_t modifiedSec;
+        long modifiedNsec;
+
+        bool operator==(const FileIdentity & other) const
+        {
+            return device == other.device && inode == other.inode && size == other.size && modifiedSec == other.modifiedSec &&
+                modifiedNsec == other.modifiedNsec;
+        }
+    };
+
+    OtaImageMapping(const uint8_t * data, size_t size, const FileIdentity & identity) :
+        mData(data), mSize(size), mIdentity(identity)
+    {}
+
+    const uint8_t * mData;
+    size_t mSize;
+    FileIdentity mIdentity;
+};
@@ -150,6 +150,7 @@
 #endif // CHIP_DEVICE_LAYER_TARGET_DARWIN
 
 #if CHIP_DEVICE_LAYER_TARGET_LINUX
+#include <platform/Linux/CHIPLinuxEventLogStore.h>
 #include <platform/Linux/NetworkCommissioningDriver.h>
 #endif // CHIP_DEVICE_LAYER_TARGET_LINUX
 
@@ -193,6 +194,8 @@ DeviceLayer::NetworkCommissioning::LinuxWiFiDriver sWiFiDriver;
 
 #define CHIP_APP_MAIN_HAS_ETHERNET_DRIVER 1
 DeviceLayer::NetworkCommissioning::LinuxEthernetDriver sEthernetDriver;
+
+DeviceLayer::Internal::ChipLinuxEventLogStore sEventLogStore;
 #endif // CHIP_DEVICE_LAYER_TARGET_LINUX
 
 #if CHIP_DEVICE_LAYER_TARGET_DARWIN
@@ -999,6 +1002,29 @@ void ChipLinuxAppMainLoop(chip::ServerInitParams & initParams, AppMainLoopImplem
     // the provider during cluster construction.
     SetDeviceAttestationCredentialsProvider(LinuxDeviceOptions::GetInstance().dacProvider);
 
+#if CHIP_DEVICE_LAYER_TARGET_LINUX
+    // Persist logged events when asked to, so that they can still be read after a restart.
+    const char * eventLogDir = LinuxDeviceOptions::GetInstance().EventLog;
+#if CHIP_CONFIG_EVENT_LOG_PERSISTENT
+    if (eventLogDir == nullptr)
+    {
+        eventLogDir = CHIP_CONFIG_EVENT_LOG_STORE_PATH;
+    }
+#endif // CHIP_CONFIG_EVENT_LOG_PERSISTENT
+    if (eventLogDir != nullptr)
+    {
+        CHIP_ERROR eventLogErr = sEventLogStore.Init(eventLogDir);
+        if (eventLogErr == CHIP_NO_ERROR)
+        {
+            initParams.eventLogStore = &sEventLogStore;
+        }
+        else
+        {
+            ChipLogError(AppServer, "Failed to open event log %s: %" CHIP_ERROR_FORMAT, eventLogDir, eventLogErr.Format());
+        }
+    }
+#endif // CHIP_DEVICE_LAYER_TARGET_LINUX
+
     // Init ZCL Data Model and CHIP App Server
     CHIP_ERROR err = Server::GetInstance().Init(initParams);
     if (err != CHIP_NO_ERROR)
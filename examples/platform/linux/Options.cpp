@@ -93,6 +93,7 @@ enum
     kDeviceOption_Command,
     kDeviceOption_PICS,
     kDeviceOption_KVS,
+    kDeviceOption_EventLog,
     kDeviceOption_InterfaceId,
     kDeviceOption_AppPipe,
     kDeviceOption_AppPipeOut,
@@ -213,6 +214,7 @@ OptionDef sDeviceOptionDefs[] = {
     { "command", kArgumentRequired, kDeviceOption_Command },
     { "PICS", kArgumentRequired, kDeviceOption_PICS },
     { "KVS", kArgumentRequired, kDeviceOption_KVS },
+    { "event-log", kArgumentRequired, kDeviceOption_EventLog },
     { "interface-id", kArgumentRequired, kDeviceOption_InterfaceId },
     { "app-pipe", kArgumentRequired, kDeviceOption_AppPipe },
     { "app-pipe-out", kArgumentRequired, kDeviceOption_AppPipeOut },
@@ -384,6 +386,9 @@ const char * sDeviceOptionHelp =
     "  --KVS <filepath>\n"
     "       A file to store Key Value Store items.\n"
     "\n"
+    "  --event-log <dirpath>\n"
+    "       A directory to persist logged events in, when the platform supports it.\n"
+    "\n"
     "  --interface-id <interface>\n"
     "       A interface id to advertise on.\n"
     "\n"
@@ -762,6 +767,10 @@ bool HandleOption(const char * aProgram, OptionSet * aOptions, int aIdentifier,
         LinuxDeviceOptions::GetInstance().KVS = aValue;
         break;
 
+    case kDeviceOption_EventLog:
+        LinuxDeviceOptions::GetInstance().EventLog = aValue;
+        break;
+
     case kDeviceOption_AppPipe:
         LinuxDeviceOptions::GetInstance().app_pipe = aValue;
         break;
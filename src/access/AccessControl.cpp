@@ -23,7 +23,12 @@
 
 #include "AccessControl.h"
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+#include "AccessControlDecisionCache.h"
+#endif
+
 #include <lib/core/Global.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/TypeTraits.h>
 
 #include <credentials/GroupDataProvider.h>
@@ -52,27 +57,6 @@ static_assert(((unsigned(Privilege::kAdminister) & unsigned(Privilege::kManage))
                   ((unsigned(Privilege::kView) & unsigned(Privilege::kProxyView)) == 0),
               "Privilege bits must be unique");
 
-bool CheckRequestPrivilegeAgainstEntryPrivilege(Privilege requestPrivilege, Privilege entryPrivilege)
-{
-    switch (entryPrivilege)
-    {
-    case Privilege::kView:
-        return requestPrivilege == Privilege::kView;
-    case Privilege::kProxyView:
-        return requestPrivilege == Privilege::kProxyView || requestPrivilege == Privilege::kView;
-    case Privilege::kOperate:
-        return requestPrivilege == Privilege::kOperate || requestPrivilege == Privilege::kView;
-    case Privilege::kManage:
-        return requestPrivilege == Privilege::kManage || requestPrivilege == Privilege::kOperate ||
-            requestPrivilege == Privilege::kView;
-    case Privilege::kAdminister:
-        return requestPrivilege == Privilege::kAdminister || requestPrivilege == Privilege::kManage ||
-            requestPrivilege == Privilege::kOperate || requestPrivilege == Privilege::kView ||
-            requestPrivilege == Privilege::kProxyView;
-    }
-    return false;
-}
-
 constexpr bool IsValidCaseNodeId(NodeId aNodeId)
 {
     if (IsOperationalNodeId(aNodeId))
@@ -225,6 +209,15 @@ CHIP_ERROR AccessControl::Init(AccessControl::Delegate * delegate, DeviceTypeRes
     {
         mDelegate           = delegate;
         mDeviceTypeResolver = &deviceTypeResolver;
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+        // Without a cache, checks fall back to iterating the entries.
+        mDecisionCache = Platform::New<AccessControlDecisionCache>();
+        if (mDecisionCache != nullptr)
+        {
+            AddEntryListener(*mDecisionCache);
+        }
+#endif
     }
 
     return retval;
@@ -236,6 +229,7 @@ void AccessControl::Finish()
     ChipLogProgress(DataManagement, "AccessControl: finishing");
     mDelegate->Finish();
     mDelegate = nullptr;
+    FinishDecisionCache();
 
     if (IsGroupAuxiliaryDelegateRegistered())
     {
@@ -347,6 +341,28 @@ void AccessControl::RemoveEntryListener(EntryListener & listener)
     }
 }
 
+void AccessControl::InvalidateDecisionCache()
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    if (mDecisionCache != nullptr)
+    {
+        mDecisionCache->Invalidate();
+    }
+#endif
+}
+
+void AccessControl::FinishDecisionCache()
+{
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    if (mDecisionCache != nullptr)
+    {
+        RemoveEntryListener(*mDecisionCache);
+        Platform::Delete(mDecisionCache);
+        mDecisionCache = nullptr;
+    }
+#endif
+}
+
 bool AccessControl::IsAccessRestrictionListSupported() const
 {
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
@@ -439,6 +455,26 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
         return CHIP_NO_ERROR;
     }
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    if (mDecisionCache != nullptr)
+    {
+        CHIP_ERROR result = mDecisionCache->Check(*this, *mDeviceTypeResolver, subjectDescriptor, requestPath, requestPrivilege);
+        if (result == CHIP_NO_ERROR)
+        {
+#if CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            ChipLogProgress(DataManagement, "AccessControl: allowed");
+#endif // CHIP_CONFIG_ACCESS_CONTROL_POLICY_LOGGING_VERBOSITY > 0
+            return result;
+        }
+        if (result == CHIP_ERROR_ACCESS_DENIED)
+        {
+            ChipLogProgress(DataManagement, "AccessControl: denied");
+            return result;
+        }
+        // Entries could not be compiled: iterate them below, which also reports why.
+    }
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
     EntryIterator iterator;
     ReturnErrorOnFailure(Entries(iterator, &subjectDescriptor.fabricIndex));
 
@@ -456,7 +492,7 @@ CHIP_ERROR AccessControl::CheckACL(const SubjectDescriptor & subjectDescriptor,
 
         Privilege privilege = Privilege::kView;
         ReturnErrorOnFailure(entry.GetPrivilege(privilege));
-        if (!CheckRequestPrivilegeAgainstEntryPrivilege(requestPrivilege, privilege))
+        if (!EntryPrivilegeGrants(privilege, requestPrivilege))
         {
             continue;
         }
@@ -39,6 +39,10 @@
 namespace chip {
 namespace Access {
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+class AccessControlDecisionCache;
+#endif
+
 class AccessControl
 {
 public:
@@ -438,6 +442,8 @@ public:
         {
             mDelegate->Release();
         }
+
+        FinishDecisionCache();
     }
 
     /**
@@ -525,6 +531,7 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateDecisionCache();
         return mDelegate->CreateEntry(index, entry, fabricIndex);
     }
 
@@ -575,6 +582,7 @@ public:
     {
         VerifyOrReturnError(entry.IsValid(), CHIP_ERROR_INVALID_ARGUMENT);
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateDecisionCache();
         return mDelegate->UpdateEntry(index, entry, fabricIndex);
     }
 
@@ -596,6 +604,7 @@ public:
     CHIP_ERROR DeleteEntry(size_t index, const FabricIndex * fabricIndex = nullptr)
     {
         VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+        InvalidateDecisionCache();
         return mDelegate->DeleteEntry(index, fabricIndex);
     }
 
@@ -662,6 +671,12 @@ public:
         return mGroupAuxDelegate->AuxiliaryEntries(iterator, &fabricIndex);
     }
 
+    /**
+     * Drops cached access control decisions. Entry changes made through this class invalidate the
+     * cache already; this is only needed if the delegate's entries change behind its back.
+     */
+    void InvalidateDecisionCache();
+
     // Adds a listener to the end of the listener list, if not already in the list.
     void AddEntryListener(EntryListener & listener);
 
@@ -738,6 +753,8 @@ public:
 private:
     bool IsInitialized() const { return (mDelegate != nullptr); }
 
+    void FinishDecisionCache();
+
     void NotifyEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index, const Entry * entry,
                             EntryListener::ChangeType changeType);
 
@@ -770,6 +787,10 @@ private:
 
     EntryListener * mEntryListener = nullptr;
 
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+    AccessControlDecisionCache * mDecisionCache = nullptr;
+#endif
+
 #if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
     AccessRestrictionProvider * mAccessRestrictionProvider;
 #endif
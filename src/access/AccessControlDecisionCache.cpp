@@ -0,0 +1,402 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <lib/core/CHIPConfig.h>
+
+#if CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
+
+#include "AccessControlDecisionCache.h"
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TypeTraits.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace chip {
+namespace Access {
+
+namespace {
+
+constexpr Privilege kAllPrivileges[] = { Privilege::kView, Privilege::kProxyView, Privilege::kOperate, Privilege::kManage,
+                                         Privilege::kAdminister };
+
+uint8_t GrantedRequestPrivileges(Privilege entryPrivilege)
+{
+    uint8_t granted = 0;
+    for (Privilege requestPrivilege : kAllPrivileges)
+    {
+        if (EntryPrivilegeGrants(entryPrivilege, requestPrivilege))
+        {
+            granted = static_cast<uint8_t>(granted | to_underlying(requestPrivilege));
+        }
+    }
+    return granted;
+}
+
+/// Same subject rules as AccessControl::CheckACL, which reports entries that break them as errors.
+bool IsSubjectValidForAuthMode(NodeId subject, AuthMode authMode)
+{
+    if (IsOperationalNodeId(subject) || IsCASEAuthTag(subject))
+    {
+        return authMode == AuthMode::kCase;
+    }
+    if (IsGroupId(subject))
+    {
+        return authMode == AuthMode::kGroup;
+    }
+    return false;
+}
+
+} // namespace
+
+CHIP_ERROR AccessControlDecisionCache::Check(const AccessControl & accessControl,
+                                             AccessControl::DeviceTypeResolver & deviceTypeResolver,
+                                             const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                             Privilege requestPrivilege)
+{
+    uint8_t granted = 0;
+
+    Decision * decision = FindDecision(subjectDescriptor, requestPath);
+    if (decision != nullptr)
+    {
+        granted = decision->grantedPrivileges;
+    }
+    else
+    {
+        CompiledFabric * compiled = GetCompiledFabric(accessControl, subjectDescriptor.fabricIndex);
+        VerifyOrReturnError(compiled != nullptr && compiled->valid, CHIP_ERROR_NOT_IMPLEMENTED);
+
+        bool usedDeviceType = false;
+        granted             = compiled->GrantedPrivileges(deviceTypeResolver, subjectDescriptor, requestPath, usedDeviceType);
+        if (!usedDeviceType)
+        {
+            StoreDecision(subjectDescriptor, requestPath, granted);
+        }
+    }
+
+    return (granted & to_underlying(requestPrivilege)) ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+}
+
+void AccessControlDecisionCache::Invalidate()
+{
+    if (++mGeneration != 0)
+    {
+        return;
+    }
+
+    // Generation wrapped around: make sure no old entry can match again
+    mGeneration = 1;
+    for (auto & decision : mDecisions)
+    {
+        decision.generation = 0;
+    }
+    for (auto & fabric : mFabrics)
+    {
+        fabric.generation = 0;
+    }
+}
+
+bool AccessControlDecisionCache::Decision::Matches(const SubjectDescriptor & subjectDescriptor,
+                                                   const RequestPath & requestPath) const
+{
+    return (fabricIndex == subjectDescriptor.fabricIndex) && (authMode == subjectDescriptor.authMode) &&
+        (subject == subjectDescriptor.subject) && (cluster == requestPath.cluster) && (endpoint == requestPath.endpoint) &&
+        (cats.values == subjectDescriptor.cats.values);
+}
+
+size_t AccessControlDecisionCache::SetIndex(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath)
+{
+    uint64_t hash = subjectDescriptor.subject ^ (static_cast<uint64_t>(subjectDescriptor.fabricIndex) << 56);
+    hash ^= (static_cast<uint64_t>(requestPath.endpoint) << 32) | requestPath.cluster;
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    return static_cast<size_t>(hash % kSets);
+}
+
+AccessControlDecisionCache::Decision * AccessControlDecisionCache::FindDecision(const SubjectDescriptor & subjectDescriptor,
+                                                                                const RequestPath & requestPath)
+{
+    Decision * set = &mDecisions[SetIndex(subjectDescriptor, requestPath) * kWays];
+    for (size_t i = 0; i < kWays; i++)
+    {
+        if ((set[i].generation == mGeneration) && set[i].Matches(subjectDescriptor, requestPath))
+        {
+            set[i].lastUsed = ++mUseCounter;
+            return &set[i];
+        }
+    }
+    return nullptr;
+}
+
+void AccessControlDecisionCache::StoreDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                               uint8_t grantedPrivileges)
+{
+    // Replace an outdated decision if there is one, the least recently used one otherwise
+    Decision * set    = &mDecisions[SetIndex(subjectDescriptor, requestPath) * kWays];
+    Decision * oldest = &set[0];
+    for (size_t i = 0; i < kWays; i++)
+    {
+        if (set[i].generation != mGeneration)
+        {
+            oldest = &set[i];
+            break;
+        }
+        if (set[i].lastUsed < oldest->lastUsed)
+        {
+            oldest = &set[i];
+        }
+    }
+
+    oldest->generation        = mGeneration;
+    oldest->lastUsed          = ++mUseCounter;
+    oldest->subject           = subjectDescriptor.subject;
+    oldest->cats              = subjectDescriptor.cats;
+    oldest->cluster           = requestPath.cluster;
+    oldest->endpoint          = requestPath.endpoint;
+    oldest->fabricIndex       = subjectDescriptor.fabricIndex;
+    oldest->authMode          = subjectDescriptor.authMode;
+    oldest->grantedPrivileges = grantedPrivileges;
+}
+
+AccessControlDecisionCache::CompiledFabric * AccessControlDecisionCache::GetCompiledFabric(const AccessControl & accessControl,
+                                                                                           FabricIndex fabricIndex)
+{
+    CompiledFabric * slot = nullptr;
+    for (auto & fabric : mFabrics)
+    {
+        if (fabric.fabricIndex == fabricIndex)
+        {
+            slot = &fabric;
+            break;
+        }
+        if ((slot == nullptr) || (fabric.lastUsed < slot->lastUsed))
+        {
+            slot = &fabric;
+        }
+    }
+    VerifyOrReturnValue(slot != nullptr, nullptr);
+
+    slot->lastUsed = ++mUseCounter;
+    if ((slot->fabricIndex != fabricIndex) || (slot->generation != mGeneration))
+    {
+        slot->fabricIndex = fabricIndex;
+        slot->valid       = (Compile(accessControl, fabricIndex, *slot) == CHIP_NO_ERROR);
+        // Failures may be transient (e.g. no entry delegate available), so compile again next time
+        slot->generation = slot->valid ? mGeneration : 0;
+    }
+    return slot;
+}
+
+CHIP_ERROR AccessControlDecisionCache::Compile(const AccessControl & accessControl, FabricIndex fabricIndex,
+                                               CompiledFabric & compiled)
+{
+    CHIP_ERROR err      = CHIP_NO_ERROR;
+    size_t entryCount   = 0;
+    size_t subjectCount = 0;
+    size_t targetCount  = 0;
+
+    // First pass: size the arrays
+    {
+        AccessControl::EntryIterator iterator;
+        AccessControl::Entry entry;
+        ReturnErrorOnFailure(accessControl.Entries(iterator, &fabricIndex));
+        while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+        {
+            size_t count = 0;
+            ReturnErrorOnFailure(entry.GetSubjectCount(count));
+            subjectCount += count;
+            ReturnErrorOnFailure(entry.GetTargetCount(count));
+            targetCount += count;
+            entryCount++;
+        }
+        VerifyOrReturnError(err == CHIP_ERROR_SENTINEL, err);
+    }
+
+    constexpr size_t kMaxCount = std::numeric_limits<uint16_t>::max();
+    VerifyOrReturnError(entryCount <= kMaxCount && subjectCount <= kMaxCount && targetCount <= kMaxCount, CHIP_ERROR_NO_MEMORY);
+
+    // Allocate at least one element of each, so that empty access control lists are valid too
+    compiled.entries.Calloc(std::max<size_t>(entryCount, 1));
+    compiled.subjects.Calloc(std::max<size_t>(subjectCount, 1));
+    compiled.targets.Calloc(std::max<size_t>(targetCount, 1));
+    compiled.byCluster.Calloc(std::max<size_t>(targetCount, 1));
+    compiled.anyCluster.Calloc(std::max<size_t>(entryCount, 1));
+    VerifyOrReturnError(compiled.entries && compiled.subjects && compiled.targets && compiled.byCluster && compiled.anyCluster,
+                        CHIP_ERROR_NO_MEMORY);
+    compiled.byClusterCount  = 0;
+    compiled.anyClusterCount = 0;
+
+    // Second pass: copy the entries
+    AccessControl::EntryIterator iterator;
+    AccessControl::Entry entry;
+    ReturnErrorOnFailure(accessControl.Entries(iterator, &fabricIndex));
+
+    size_t entryIndex   = 0;
+    size_t subjectIndex = 0;
+    size_t targetIndex  = 0;
+    while ((err = iterator.Next(entry)) == CHIP_NO_ERROR)
+    {
+        VerifyOrReturnError(entryIndex < entryCount, CHIP_ERROR_INCORRECT_STATE);
+        CompiledEntry & compiledEntry = compiled.entries[entryIndex];
+
+        Privilege privilege = Privilege::kView;
+        ReturnErrorOnFailure(entry.GetAuthMode(compiledEntry.authMode));
+        ReturnErrorOnFailure(entry.GetPrivilege(privilege));
+        VerifyOrReturnError(compiledEntry.authMode == AuthMode::kCase || compiledEntry.authMode == AuthMode::kGroup,
+                            CHIP_ERROR_INCORRECT_STATE);
+        compiledEntry.grantedPrivileges = GrantedRequestPrivileges(privilege);
+
+        size_t count = 0;
+        ReturnErrorOnFailure(entry.GetSubjectCount(count));
+        VerifyOrReturnError(count <= subjectCount - subjectIndex, CHIP_ERROR_INCORRECT_STATE);
+        compiledEntry.firstSubject = static_cast<uint16_t>(subjectIndex);
+        compiledEntry.subjectCount = static_cast<uint16_t>(count);
+        for (size_t i = 0; i < count; i++)
+        {
+            NodeId & subject = compiled.subjects[subjectIndex++];
+            ReturnErrorOnFailure(entry.GetSubject(i, subject));
+            VerifyOrReturnError(IsSubjectValidForAuthMode(subject, compiledEntry.authMode), CHIP_ERROR_INCORRECT_STATE);
+        }
+
+        ReturnErrorOnFailure(entry.GetTargetCount(count));
+        VerifyOrReturnError(count <= targetCount - targetIndex, CHIP_ERROR_INCORRECT_STATE);
+        compiledEntry.firstTarget = static_cast<uint16_t>(targetIndex);
+        compiledEntry.targetCount = static_cast<uint16_t>(count);
+
+        bool allTargetsHaveCluster = (count > 0);
+        for (size_t i = 0; i < count; i++)
+        {
+            AccessControl::Entry::Target & target = compiled.targets[targetIndex++];
+            ReturnErrorOnFailure(entry.GetTarget(i, target));
+            allTargetsHaveCluster = allTargetsHaveCluster && (target.flags & AccessControl::Entry::Target::kCluster);
+        }
+
+        if (allTargetsHaveCluster)
+        {
+            for (size_t i = 0; i < count; i++)
+            {
+                compiled.byCluster[compiled.byClusterCount++] = { compiled.targets[compiledEntry.firstTarget + i].cluster,
+                                                                  static_cast<uint16_t>(entryIndex) };
+            }
+        }
+        else
+        {
+            compiled.anyCluster[compiled.anyClusterCount++] = static_cast<uint16_t>(entryIndex);
+        }
+
+        entryIndex++;
+    }
+    VerifyOrReturnError(err == CHIP_ERROR_SENTINEL, err);
+    VerifyOrReturnError(entryIndex == entryCount, CHIP_ERROR_INCORRECT_STATE);
+
+    std::sort(compiled.byCluster.Get(), compiled.byCluster.Get() + compiled.byClusterCount,
+              [](const ClusterIndexItem & a, const ClusterIndexItem & b) { return a.cluster < b.cluster; });
+
+    return CHIP_NO_ERROR;
+}
+
+uint8_t AccessControlDecisionCache::CompiledFabric::GrantedPrivileges(AccessControl::DeviceTypeResolver & deviceTypeResolver,
+                                                                      const SubjectDescriptor & subjectDescriptor,
+                                                                      const RequestPath & requestPath, bool & usedDeviceType) const
+{
+    uint8_t granted = 0;
+
+    auto visit = [&](uint16_t index) {
+        const CompiledEntry & entry = entries[index];
+        // Entries that cannot grant anything new do not need to be matched at all
+        if ((entry.authMode != subjectDescriptor.authMode) || ((granted | entry.grantedPrivileges) == granted))
+        {
+            return;
+        }
+        if (SubjectMatches(entry, subjectDescriptor) && TargetMatches(entry, deviceTypeResolver, requestPath, usedDeviceType))
+        {
+            granted = static_cast<uint8_t>(granted | entry.grantedPrivileges);
+        }
+    };
+
+    for (size_t i = 0; i < anyClusterCount; i++)
+    {
+        visit(anyCluster[i]);
+    }
+
+    const ClusterIndexItem * begin = byCluster.Get();
+    const ClusterIndexItem * end   = begin + byClusterCount;
+    for (const ClusterIndexItem * item = std::lower_bound(
+             begin, end, requestPath.cluster, [](const ClusterIndexItem & a, ClusterId cluster) { return a.cluster < cluster; });
+         (item != end) && (item->cluster == requestPath.cluster); item++)
+    {
+        visit(item->entry);
+    }
+
+    return granted;
+}
+
+bool AccessControlDecisionCache::CompiledFabric::SubjectMatches(const CompiledEntry & entry,
+                                                                const SubjectDescriptor & subjectDescriptor) const
+{
+    VerifyOrReturnValue(entry.subjectCount > 0, true);
+
+    for (size_t i = entry.firstSubject; i < entry.firstSubject + entry.subjectCount; i++)
+    {
+        const NodeId subject = subjects[i];
+        const bool matched   = IsCASEAuthTag(subject) ? subjectDescriptor.cats.CheckSubjectAgainstCATs(subject)
+                                                      : (subject == subjectDescriptor.subject);
+        if (matched)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+bool AccessControlDecisionCache::CompiledFabric::TargetMatches(const CompiledEntry & entry,
+                                                               AccessControl::DeviceTypeResolver & deviceTypeResolver,
+                                                               const RequestPath & requestPath, bool & usedDeviceType) const
+{
+    VerifyOrReturnValue(entry.targetCount > 0, true);
+
+    for (size_t i = entry.firstTarget; i < entry.firstTarget + entry.targetCount; i++)
+    {
+        const AccessControl::Entry::Target & target = targets[i];
+        if ((target.flags & AccessControl::Entry::Target::kCluster) && target.cluster != requestPath.cluster)
+        {
+            continue;
+        }
+        if ((target.flags & AccessControl::Entry::Target::kEndpoint) && target.endpoint != requestPath.endpoint)
+        {
+            continue;
+        }
+        if (target.flags & AccessControl::Entry::Target::kDeviceType)
+        {
+            usedDeviceType = true;
+            if (!deviceTypeResolver.IsDeviceTypeOnEndpoint(target.deviceType, requestPath.endpoint))
+            {
+                continue;
+            }
+        }
+        return true;
+    }
+    return false;
+}
+
+} // namespace Access
+} // namespace chip
+
+#endif // CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE > 0
@@ -0,0 +1,158 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include "AccessControl.h"
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+
+namespace chip {
+namespace Access {
+
+/**
+ * Remembers the privileges that the access control list grants to a subject on a cluster
+ * instance, so that repeated checks (e.g. for every attribute of a wildcard read) do not
+ * iterate the access control list through its delegate.
+ *
+ * The entries of a fabric are first compiled into flat arrays, with entries indexed by the
+ * clusters their targets name. Decisions are computed from the compiled entries and cached per
+ * (fabric, auth mode, subject, CATs, endpoint, cluster).
+ *
+ * Both compiled entries and decisions are tagged with a generation that `Invalidate` bumps,
+ * so any change to the access control list drops everything at once. AccessControl registers
+ * the cache as an entry listener and invalidates it on changes that do not notify listeners.
+ *
+ * Decisions that depend on device type targets are not cached, since device types on an
+ * endpoint may change without the access control list changing.
+ */
+class AccessControlDecisionCache : public AccessControl::EntryListener
+{
+public:
+    static constexpr size_t kWays = 4;
+    static constexpr size_t kSets = CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE / kWays;
+
+    static_assert(kSets > 0 && CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE % kWays == 0,
+                  "CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE must be a positive multiple of 4");
+
+    AccessControlDecisionCache() = default;
+
+    AccessControlDecisionCache(const AccessControlDecisionCache &)             = delete;
+    AccessControlDecisionCache & operator=(const AccessControlDecisionCache &) = delete;
+
+    /**
+     * Checks the access control entries of `accessControl` for whether access (by a CASE or group
+     * subject descriptor, to a request path, requiring a privilege) should be allowed or denied.
+     *
+     * @retval #CHIP_NO_ERROR if allowed.
+     * @retval #CHIP_ERROR_ACCESS_DENIED if denied.
+     * @retval #CHIP_ERROR_NOT_IMPLEMENTED if the entries could not be compiled (e.g. they are
+     *         inconsistent or memory is short): the caller must check the entries itself.
+     */
+    CHIP_ERROR Check(const AccessControl & accessControl, AccessControl::DeviceTypeResolver & deviceTypeResolver,
+                     const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, Privilege requestPrivilege);
+
+    /**
+     * Drops all decisions and compiled entries.
+     */
+    void Invalidate();
+
+    void OnEntryChanged(const SubjectDescriptor * subjectDescriptor, FabricIndex fabric, size_t index,
+                        const AccessControl::Entry * entry, ChangeType changeType) override
+    {
+        Invalidate();
+    }
+
+private:
+    struct CompiledEntry
+    {
+        AuthMode authMode;
+        uint8_t grantedPrivileges; // bitmap of the request privileges that the entry privilege grants
+        uint16_t firstSubject;
+        uint16_t subjectCount;
+        uint16_t firstTarget;
+        uint16_t targetCount;
+    };
+
+    struct ClusterIndexItem
+    {
+        ClusterId cluster;
+        uint16_t entry;
+    };
+
+    /**
+     * Access control entries of a fabric. Entries whose targets all name a cluster are only
+     * reachable through `byCluster` (sorted by cluster), the others are listed in `anyCluster`.
+     */
+    struct CompiledFabric
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        uint32_t generation     = 0;
+        uint32_t lastUsed       = 0;
+        bool valid              = false; // false if the entries could not be compiled
+
+        Platform::ScopedMemoryBuffer<CompiledEntry> entries;
+        Platform::ScopedMemoryBuffer<NodeId> subjects;
+        Platform::ScopedMemoryBuffer<AccessControl::Entry::Target> targets;
+        Platform::ScopedMemoryBuffer<ClusterIndexItem> byCluster;
+        Platform::ScopedMemoryBuffer<uint16_t> anyCluster;
+        size_t byClusterCount  = 0;
+        size_t anyClusterCount = 0;
+
+        uint8_t GrantedPrivileges(AccessControl::DeviceTypeResolver & deviceTypeResolver,
+                                  const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath,
+                                  bool & usedDeviceType) const;
+
+        bool SubjectMatches(const CompiledEntry & entry, const SubjectDescriptor & subjectDescriptor) const;
+        bool TargetMatches(const CompiledEntry & entry, AccessControl::DeviceTypeResolver & deviceTypeResolver,
+                           const RequestPath & requestPath, bool & usedDeviceType) const;
+    };
+
+    struct Decision
+    {
+        uint32_t generation = 0; // 0 for unused slots
+        uint32_t lastUsed   = 0;
+        NodeId subject      = kUndefinedNodeId;
+        CATValues cats;
+        ClusterId cluster         = kInvalidClusterId;
+        EndpointId endpoint       = kInvalidEndpointId;
+        FabricIndex fabricIndex   = kUndefinedFabricIndex;
+        AuthMode authMode         = AuthMode::kNone;
+        uint8_t grantedPrivileges = 0;
+
+        bool Matches(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath) const;
+    };
+
+    static size_t SetIndex(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath);
+
+    Decision * FindDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath);
+    void StoreDecision(const SubjectDescriptor & subjectDescriptor, const RequestPath & requestPath, uint8_t grantedPrivileges);
+
+    CompiledFabric * GetCompiledFabric(const AccessControl & accessControl, FabricIndex fabricIndex);
+    CHIP_ERROR Compile(const AccessControl & accessControl, FabricIndex fabricIndex, CompiledFabric & compiled);
+
+    uint32_t mGeneration = 1;
+    uint32_t mUseCounter = 0;
+
+    Decision mDecisions[kSets * kWays];
+    CompiledFabric mFabrics[CHIP_CONFIG_MAX_FABRICS];
+};
+
+} // namespace Access
+} // namespace chip
@@ -64,6 +64,32 @@ constexpr bool IsValidPrivilege(Access::Privilege privilege)
         ((privilegeValue & (privilegeValue - 1)) == 0);
 }
 
+/*
+ * Checks if an access control entry with `entryPrivilege` grants a request requiring `requestPrivilege`.
+ *
+ * Privileges grant the lower ones, except ProxyView which is only granted by itself and Administer.
+ */
+constexpr bool EntryPrivilegeGrants(Privilege entryPrivilege, Privilege requestPrivilege)
+{
+    switch (entryPrivilege)
+    {
+    case Privilege::kView:
+        return requestPrivilege == Privilege::kView;
+    case Privilege::kProxyView:
+        return requestPrivilege == Privilege::kProxyView || requestPrivilege == Privilege::kView;
+    case Privilege::kOperate:
+        return requestPrivilege == Privilege::kOperate || requestPrivilege == Privilege::kView;
+    case Privilege::kManage:
+        return requestPrivilege == Privilege::kManage || requestPrivilege == Privilege::kOperate ||
+            requestPrivilege == Privilege::kView;
+    case Privilege::kAdminister:
+        return requestPrivilege == Privilege::kAdminister || requestPrivilege == Privilege::kManage ||
+            requestPrivilege == Privilege::kOperate || requestPrivilege == Privilege::kView ||
+            requestPrivilege == Privilege::kProxyView;
+    }
+    return false;
+}
+
 static_assert(IsValidPrivilege(Privilege::kView));
 static_assert(IsValidPrivilege(Privilege::kProxyView));
 static_assert(IsValidPrivilege(Privilege::kOperate));
@@ -448,7 +448,14 @@ constexpr DeviceTypeId invalidDeviceTypes[] = {
 class DeviceTypeResolver : public AccessControl::DeviceTypeResolver
 {
 public:
-    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override { return false; }
+    bool IsDeviceTypeOnEndpoint(DeviceTypeId deviceType, EndpointId endpoint) override
+    {
+        return deviceType == mDeviceType && endpoint == mEndpoint;
+    }
+
+    // Only this device type is on this endpoint
+    DeviceTypeId mDeviceType = 0;
+    EndpointId mEndpoint     = kInvalidEndpointId;
 } testDeviceTypeResolver;
 
 // For testing, supports one subject and target, allows any value (valid or invalid)
@@ -1990,6 +1997,114 @@ TEST_F(TestAccessControl, TestCheck)
     }
 }
 
+TEST_F(TestAccessControl, TestCheckRepeated)
+{
+    // Checks are answered from cached decisions the second time around, in any order.
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, entryData1, entryData1Count));
+    for (int pass = 0; pass < 3; ++pass)
+    {
+        for (size_t i = 0; i < MATTER_ARRAY_SIZE(checkData1); ++i)
+        {
+            const auto & checkData    = checkData1[(pass == 1) ? MATTER_ARRAY_SIZE(checkData1) - 1 - i : i];
+            CHIP_ERROR expectedResult = checkData.allow ? CHIP_NO_ERROR : CHIP_ERROR_ACCESS_DENIED;
+            auto requestPath          = checkData.requestPath;
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+            requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+            EXPECT_EQ(accessControl.Check(checkData.subjectDescriptor, requestPath, checkData.privilege), expectedResult);
+        }
+    }
+}
+
+TEST_F(TestAccessControl, TestCheckAfterEntryChanges)
+{
+    SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    RequestPath requestPath             = { .cluster = kOnOffCluster, .endpoint = 1 };
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+
+    EntryData data = { .fabricIndex = 1,
+                       .privilege   = Privilege::kOperate,
+                       .authMode    = AuthMode::kCase,
+                       .subjects    = { kOperationalNodeId1 },
+                       .targets     = { { .flags = Target::kCluster, .cluster = kOnOffCluster } } };
+
+    // Entries must not be held across checks, which need one to iterate the access control list
+    auto updateEntry = [&](bool notify) -> CHIP_ERROR {
+        Entry entry;
+        ReturnErrorOnFailure(accessControl.PrepareEntry(entry));
+        ReturnErrorOnFailure(LoadEntry(entry, data));
+        return notify ? accessControl.UpdateEntry(nullptr, 1, 0, entry) : accessControl.UpdateEntry(0, entry);
+    };
+
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    // Creating an entry grants access
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, &data, 1));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kManage), CHIP_ERROR_ACCESS_DENIED);
+
+    // Updating an entry, with or without notifying listeners, changes the privileges granted
+    data.privilege = Privilege::kManage;
+    EXPECT_SUCCESS(updateEntry(false));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kManage), CHIP_NO_ERROR);
+
+    data.privilege = Privilege::kView;
+    EXPECT_SUCCESS(updateEntry(true));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_NO_ERROR);
+
+    // Targeting another cluster revokes access
+    data.targets[0].cluster = kLevelControlCluster;
+    EXPECT_SUCCESS(updateEntry(false));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    // Deleting an entry, with or without notifying listeners, revokes access
+    data.targets[0].cluster = kOnOffCluster;
+    EXPECT_SUCCESS(updateEntry(false));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_NO_ERROR);
+    EXPECT_SUCCESS(accessControl.DeleteEntry(nullptr, 1, 0));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, &data, 1));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_NO_ERROR);
+    EXPECT_SUCCESS(accessControl.DeleteEntry(0));
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kView), CHIP_ERROR_ACCESS_DENIED);
+}
+
+TEST_F(TestAccessControl, TestCheckDeviceTypeTarget)
+{
+    constexpr DeviceTypeId kDeviceType = 0x0000'0100;
+
+    SubjectDescriptor subjectDescriptor = { .fabricIndex = 1, .authMode = AuthMode::kCase, .subject = kOperationalNodeId1 };
+    RequestPath requestPath             = { .cluster = kOnOffCluster, .endpoint = 1 };
+#if CHIP_CONFIG_USE_ACCESS_RESTRICTIONS
+    requestPath.requestType = Access::RequestType::kAttributeReadRequest;
+#endif
+
+    const EntryData data = { .fabricIndex = 1,
+                             .privilege   = Privilege::kOperate,
+                             .authMode    = AuthMode::kCase,
+                             .subjects    = { kOperationalNodeId1 },
+                             .targets     = { { .flags = Target::kDeviceType, .deviceType = kDeviceType } } };
+    EXPECT_SUCCESS(LoadAccessControl(accessControl, &data, 1));
+
+    // Device types on an endpoint may change without the access control list changing
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+    testDeviceTypeResolver.mDeviceType = kDeviceType;
+    testDeviceTypeResolver.mEndpoint   = 1;
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_NO_ERROR);
+
+    testDeviceTypeResolver.mEndpoint = 2;
+    EXPECT_EQ(accessControl.Check(subjectDescriptor, requestPath, Privilege::kOperate), CHIP_ERROR_ACCESS_DENIED);
+
+    testDeviceTypeResolver.mDeviceType = 0;
+    testDeviceTypeResolver.mEndpoint   = kInvalidEndpointId;
+}
+
 TEST_F(TestAccessControl, TestCreateReadEntry)
 {
     for (size_t i = 0; i < entryData1Count; ++i)
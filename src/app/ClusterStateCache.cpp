@@ -47,10 +47,25 @@ uint32_t SizeOfStatusIB(const StatusIB & aStatus)
     return size;
 }
 
+// Red-black tree nodes of the common standard libraries hold three pointers and a colour next to the value.
+constexpr size_t kMapNodeOverhead = 4 * sizeof(void *);
+
+template <typename Key, typename Value>
+size_t ContainerBytes(const std::map<Key, Value> & container)
+{
+    return container.size() * (sizeof(typename std::map<Key, Value>::value_type) + kMapNodeOverhead);
+}
+
+template <typename Key, typename Value>
+size_t ContainerBytes(const detail::SortedVectorMap<Key, Value> & container)
+{
+    return container.capacity() * sizeof(typename detail::SortedVectorMap<Key, Value>::value_type);
+}
+
 } // anonymous namespace
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::GetElementTLVSize(TLV::TLVReader * apData, uint32_t & aSize)
 {
     Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
     TLV::TLVReader reader;
@@ -65,12 +80,13 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetElementTLVSize(TLV::TLVR
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                                 const StatusIB & aStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::UpdateCache(const ConcreteDataAttributePath & aPath,
+                                                                          TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     AttributeState state;
-    bool endpointIsNew = false;
+    bool endpointIsNew   = false;
+    uint32_t elementSize = 0;
 
     if (mCache.find(aPath.mEndpointId) == mCache.end())
     {
@@ -84,21 +100,25 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
 
     if (apData)
     {
-        uint32_t elementSize = 0;
         ReturnErrorOnFailure(GetElementTLVSize(apData, elementSize));
 
         if constexpr (CanEnableDataCaching)
         {
             if (mCacheData)
             {
-                Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
-                backingBuffer.Calloc(elementSize);
-                VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
-                TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
-                ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
-                ReturnErrorOnFailure(writer.Finalize(backingBuffer));
-
-                state.template Set<AttributeData>(std::move(backingBuffer));
+                // With flat storage, the data is copied into the payload arena of the cluster further down, once the
+                // cluster state is known to exist.
+                if constexpr (!kFlatStorage)
+                {
+                    Platform::ScopedMemoryBufferWithSize<uint8_t> backingBuffer;
+                    backingBuffer.Calloc(elementSize);
+                    VerifyOrReturnError(backingBuffer.Get() != nullptr, CHIP_ERROR_NO_MEMORY);
+                    TLV::ScopedBufferTLVWriter writer(std::move(backingBuffer), elementSize);
+                    ReturnErrorOnFailure(writer.CopyElement(TLV::AnonymousTag(), *apData));
+                    ReturnErrorOnFailure(writer.Finalize(backingBuffer));
+
+                    state.template Set<AttributeData>(std::move(backingBuffer));
+                }
             }
             else
             {
@@ -168,7 +188,37 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
         mAddedEndpoints.push_back(aPath.mEndpointId);
     }
 
-    mCache[aPath.mEndpointId][aPath.mClusterId].mAttributes[aPath.mAttributeId] = std::move(state);
+    auto & clusterState = mCache[aPath.mEndpointId][aPath.mClusterId];
+
+    if constexpr (CanEnableDataCaching && kFlatStorage)
+    {
+        if (apData && mCacheData)
+        {
+            AttributeData payload;
+            uint8_t * buffer = clusterState.mPayloads.Allocate(elementSize, payload);
+            VerifyOrReturnError(buffer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+            TLV::TLVWriter writer;
+            writer.Init(buffer, elementSize);
+            CHIP_ERROR err = writer.CopyElement(TLV::AnonymousTag(), *apData);
+            if (err == CHIP_NO_ERROR)
+            {
+                err = writer.Finalize();
+            }
+            if (err != CHIP_NO_ERROR)
+            {
+                clusterState.mPayloads.Release(payload);
+                return err;
+            }
+
+            state.template Set<AttributeData>(payload);
+        }
+    }
+
+    auto & attributeState = clusterState.mAttributes[aPath.mAttributeId];
+    ReleaseAttributeData(clusterState, attributeState);
+    attributeState = std::move(state);
+    CompactPayloadsIfNeeded(clusterState);
 
     if (mCacheData)
     {
@@ -178,9 +228,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateCache(const ConcreteD
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                                      const StatusIB * apStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::UpdateEventCache(const EventHeader & aEventHeader,
+                                                                               TLV::TLVReader * apData, const StatusIB * apStatus)
 {
     if (apData)
     {
@@ -227,14 +277,14 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::UpdateEventCache(const Even
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::NotifySubscriptionStillActive(const ReadClient & aReadClient)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::NotifySubscriptionStillActive(const ReadClient & aReadClient)
 {
     mCallback.NotifySubscriptionStillActive(aReadClient);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::OnReportBegin()
 {
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
     mChangedAttributeSet.clear();
@@ -242,8 +292,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportBegin()
     mCallback.OnReportBegin();
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::CommitPendingDataVersion()
 {
     if (!mLastReportDataPath.IsValidConcreteClusterPath())
     {
@@ -258,8 +308,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::CommitPendingDataVersion()
     }
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::OnReportEnd()
 {
     CommitPendingDataVersion();
     mLastReportDataPath = ConcreteClusterPath(kInvalidEndpointId, kInvalidClusterId);
@@ -288,35 +338,40 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnReportEnd()
     mCallback.OnReportEnd();
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
 {
-    CHIP_ERROR err;
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
-
-    if (attributeState->template Is<StatusIB>())
+    if constexpr (CanEnableDataCaching)
     {
-        return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
-    }
+        CHIP_ERROR err;
+        auto clusterState = GetClusterState(path.mEndpointId, path.mClusterId, err);
+        ReturnErrorOnFailure(err);
+
+        auto attributeIter = clusterState->mAttributes.find(path.mAttributeId);
+        VerifyOrReturnError(attributeIter != clusterState->mAttributes.end(), CHIP_ERROR_KEY_NOT_FOUND);
+        const AttributeState & attributeState = attributeIter->second;
 
-    if (!attributeState->template Is<AttributeData>())
+        if (attributeState.template Is<StatusIB>())
+        {
+            return CHIP_ERROR_IM_STATUS_CODE_RECEIVED;
+        }
+
+        if (!attributeState.template Is<AttributeData>())
+        {
+            return CHIP_ERROR_KEY_NOT_FOUND;
+        }
+
+        reader.Init(GetAttributeData(*clusterState, attributeState));
+        return reader.Next();
+    }
+    else
     {
         return CHIP_ERROR_KEY_NOT_FOUND;
     }
-
-    reader.Init(attributeState->template Get<AttributeData>().Get(), attributeState->template Get<AttributeData>().AllocatedSize());
-    return reader.Next();
-}
-
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::Get(const ConcreteAttributePath & path, TLV::TLVReader & reader) const
-{
-    return CHIP_ERROR_KEY_NOT_FOUND;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::Get(EventNumber eventNumber, TLV::TLVReader & reader) const
 {
     CHIP_ERROR err;
 
@@ -332,9 +387,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::Get(EventNumber eventNumber
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EndpointState *
-ClusterStateCacheT<CanEnableDataCaching>::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+const typename ClusterStateCacheT<CanEnableDataCaching, Storage>::EndpointState *
+ClusterStateCacheT<CanEnableDataCaching, Storage>::GetEndpointState(EndpointId endpointId, CHIP_ERROR & err) const
 {
     auto endpointIter = mCache.find(endpointId);
     if (endpointIter == mCache.end())
@@ -347,9 +402,10 @@ ClusterStateCacheT<CanEnableDataCaching>::GetEndpointState(EndpointId endpointId
     return &endpointIter->second;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::ClusterState *
-ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId, ClusterId clusterId, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+const typename ClusterStateCacheT<CanEnableDataCaching, Storage>::ClusterState *
+ClusterStateCacheT<CanEnableDataCaching, Storage>::GetClusterState(EndpointId endpointId, ClusterId clusterId,
+                                                                   CHIP_ERROR & err) const
 {
     auto endpointState = GetEndpointState(endpointId, err);
     if (err != CHIP_NO_ERROR)
@@ -368,10 +424,10 @@ ClusterStateCacheT<CanEnableDataCaching>::GetClusterState(EndpointId endpointId,
     return &clusterState->second;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::AttributeState *
-ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointId, ClusterId clusterId, AttributeId attributeId,
-                                                            CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+const typename ClusterStateCacheT<CanEnableDataCaching, Storage>::AttributeState *
+ClusterStateCacheT<CanEnableDataCaching, Storage>::GetAttributeState(EndpointId endpointId, ClusterId clusterId,
+                                                                     AttributeId attributeId, CHIP_ERROR & err) const
 {
     auto clusterState = GetClusterState(endpointId, clusterId, err);
     if (err != CHIP_NO_ERROR)
@@ -390,9 +446,59 @@ ClusterStateCacheT<CanEnableDataCaching>::GetAttributeState(EndpointId endpointI
     return &attributeState->second;
 }
 
-template <bool CanEnableDataCaching>
-const typename ClusterStateCacheT<CanEnableDataCaching>::EventData *
-ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+ByteSpan ClusterStateCacheT<CanEnableDataCaching, Storage>::GetAttributeData(const ClusterState & clusterState,
+                                                                             const AttributeState & attributeState)
+{
+    if constexpr (!CanEnableDataCaching)
+    {
+        return ByteSpan();
+    }
+    else if constexpr (kFlatStorage)
+    {
+        return clusterState.mPayloads.Get(attributeState.template Get<AttributeData>());
+    }
+    else
+    {
+        const AttributeData & data = attributeState.template Get<AttributeData>();
+        return ByteSpan(data.Get(), data.AllocatedSize());
+    }
+}
+
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::ReleaseAttributeData(ClusterState & clusterState,
+                                                                             const AttributeState & attributeState)
+{
+    if constexpr (CanEnableDataCaching && kFlatStorage)
+    {
+        if (attributeState.template Is<AttributeData>())
+        {
+            clusterState.mPayloads.Release(attributeState.template Get<AttributeData>());
+        }
+    }
+}
+
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::CompactPayloadsIfNeeded(ClusterState & clusterState)
+{
+    if constexpr (CanEnableDataCaching && kFlatStorage)
+    {
+        VerifyOrReturn(clusterState.mPayloads.NeedsCompaction());
+        clusterState.mPayloads.Compact([&clusterState](auto && relocate) {
+            for (auto & attributeIter : clusterState.mAttributes)
+            {
+                if (attributeIter.second.template Is<AttributeData>())
+                {
+                    relocate(attributeIter.second.template Get<AttributeData>());
+                }
+            }
+        });
+    }
+}
+
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+const typename ClusterStateCacheT<CanEnableDataCaching, Storage>::EventData *
+ClusterStateCacheT<CanEnableDataCaching, Storage>::GetEventData(EventNumber eventNumber, CHIP_ERROR & err) const
 {
     EventData compareKey;
 
@@ -408,9 +514,9 @@ ClusterStateCacheT<CanEnableDataCaching>::GetEventData(EventNumber eventNumber,
     return &(*eventData);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDataAttributePath & aPath, TLV::TLVReader * apData,
-                                                               const StatusIB & aStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::OnAttributeData(const ConcreteDataAttributePath & aPath,
+                                                                        TLV::TLVReader * apData, const StatusIB & aStatus)
 {
     //
     // Since the cache itself is a ReadClient::Callback, it may be incorrectly passed in directly when registering with the
@@ -440,9 +546,9 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnAttributeData(const ConcreteDat
     mCallback.OnAttributeData(aPath, apData ? &dataSnapshot : nullptr, aStatus);
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetVersion(const ConcreteClusterPath & aPath,
-                                                                Optional<DataVersion> & aVersion) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::GetVersion(const ConcreteClusterPath & aPath,
+                                                                         Optional<DataVersion> & aVersion) const
 {
     VerifyOrReturnError(aPath.IsValidConcreteClusterPath(), CHIP_ERROR_INVALID_ARGUMENT);
     CHIP_ERROR err;
@@ -452,9 +558,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetVersion(const ConcreteCl
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData,
-                                                           const StatusIB * apStatus)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::OnEventData(const EventHeader & aEventHeader, TLV::TLVReader * apData,
+                                                                    const StatusIB * apStatus)
 {
     VerifyOrDie(apData != nullptr || apStatus != nullptr);
 
@@ -468,31 +574,32 @@ void ClusterStateCacheT<CanEnableDataCaching>::OnEventData(const EventHeader & a
     mCallback.OnEventData(aEventHeader, apData ? &dataSnapshot : nullptr, apStatus);
 }
 
-template <>
-CHIP_ERROR ClusterStateCacheT<true>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
 {
-    CHIP_ERROR err;
+    if constexpr (CanEnableDataCaching)
+    {
+        CHIP_ERROR err;
 
-    auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
-    ReturnErrorOnFailure(err);
+        auto attributeState = GetAttributeState(path.mEndpointId, path.mClusterId, path.mAttributeId, err);
+        ReturnErrorOnFailure(err);
+
+        if (!attributeState->template Is<StatusIB>())
+        {
+            return CHIP_ERROR_INVALID_ARGUMENT;
+        }
 
-    if (!attributeState->template Is<StatusIB>())
+        status = attributeState->template Get<StatusIB>();
+        return CHIP_NO_ERROR;
+    }
+    else
     {
         return CHIP_ERROR_INVALID_ARGUMENT;
     }
-
-    status = attributeState->template Get<StatusIB>();
-    return CHIP_NO_ERROR;
-}
-
-template <>
-CHIP_ERROR ClusterStateCacheT<false>::GetStatus(const ConcreteAttributePath & path, StatusIB & status) const
-{
-    return CHIP_ERROR_INVALID_ARGUMENT;
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEventPath & path, StatusIB & status) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::GetStatus(const ConcreteEventPath & path, StatusIB & status) const
 {
     auto statusIter = mEventStatusCache.find(path);
     if (statusIter == mEventStatusCache.end())
@@ -504,8 +611,9 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetStatus(const ConcreteEve
     return CHIP_NO_ERROR;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::GetSortedFilters(
+    std::vector<std::pair<DataVersionFilter, size_t>> & aVector) const
 {
     for (auto const & endpointIter : mCache)
     {
@@ -536,8 +644,7 @@ void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std:
                     {
                         VerifyOrDie(attributeIter.second.template Is<AttributeData>());
                         TLV::TLVReader bufReader;
-                        bufReader.Init(attributeIter.second.template Get<AttributeData>().Get(),
-                                       attributeIter.second.template Get<AttributeData>().AllocatedSize());
+                        bufReader.Init(GetAttributeData(clusterIter.second, attributeIter.second));
                         ReturnOnFailure(bufReader.Next());
                         // Skip to the end of the element.
                         ReturnOnFailure(bufReader.Skip());
@@ -571,8 +678,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::GetSortedFilters(std::vector<std:
               });
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::OnUpdateDataVersionFilterList(
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::OnUpdateDataVersionFilterList(
     DataVersionFilterIBs::Builder & aDataVersionFilterIBsBuilder, const Span<AttributePathParams> & aAttributePaths,
     bool & aEncodedDataVersionList)
 {
@@ -646,14 +753,14 @@ exit:
     return err;
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(EndpointId endpointId)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::ClearAttributes(EndpointId endpointId)
 {
     mCache.erase(endpointId);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClusterPath & cluster)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::ClearAttributes(const ConcreteClusterPath & cluster)
 {
     // Can't use GetEndpointState here, since that only handles const things.
     auto endpointIter = mCache.find(cluster.mEndpointId);
@@ -666,8 +773,8 @@ void ClusterStateCacheT<CanEnableDataCaching>::ClearAttributes(const ConcreteClu
     endpointState.erase(cluster.mClusterId);
 }
 
-template <bool CanEnableDataCaching>
-void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttributePath & attribute)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+void ClusterStateCacheT<CanEnableDataCaching, Storage>::ClearAttribute(const ConcreteAttributePath & attribute)
 {
     // Can't use GetClusterState here, since that only handles const things.
     auto endpointIter = mCache.find(attribute.mEndpointId);
@@ -684,11 +791,19 @@ void ClusterStateCacheT<CanEnableDataCaching>::ClearAttribute(const ConcreteAttr
     }
 
     auto & clusterState = clusterIter->second;
+    auto attributeIter  = clusterState.mAttributes.find(attribute.mAttributeId);
+    if (attributeIter == clusterState.mAttributes.end())
+    {
+        return;
+    }
+
+    ReleaseAttributeData(clusterState, attributeIter->second);
     clusterState.mAttributes.erase(attribute.mAttributeId);
+    CompactPayloadsIfNeeded(clusterState);
 }
 
-template <bool CanEnableDataCaching>
-CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(ConcreteClusterPath & aPath)
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching, Storage>::GetLastReportDataPath(ConcreteClusterPath & aPath)
 {
     if (mLastReportDataPath.IsValidConcreteClusterPath())
     {
@@ -698,9 +813,52 @@ CHIP_ERROR ClusterStateCacheT<CanEnableDataCaching>::GetLastReportDataPath(Concr
     return CHIP_ERROR_INCORRECT_STATE;
 }
 
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage>
+typename ClusterStateCacheT<CanEnableDataCaching, Storage>::AttributeMemoryUsage
+ClusterStateCacheT<CanEnableDataCaching, Storage>::GetAttributeMemoryUsage() const
+{
+    AttributeMemoryUsage usage;
+    usage.mEndpointCount = mCache.size();
+    usage.mTotalBytes    = ContainerBytes(mCache);
+
+    for (const auto & [endpointId, endpointState] : mCache)
+    {
+        usage.mClusterCount += endpointState.size();
+        usage.mTotalBytes += ContainerBytes(endpointState);
+
+        for (const auto & [clusterId, clusterState] : endpointState)
+        {
+            usage.mAttributeCount += clusterState.mAttributes.size();
+            usage.mTotalBytes += ContainerBytes(clusterState.mAttributes);
+
+            if constexpr (CanEnableDataCaching && kFlatStorage)
+            {
+                usage.mPayloadBytes += clusterState.mPayloads.Size();
+                usage.mTotalBytes += clusterState.mPayloads.Capacity();
+            }
+            else if constexpr (CanEnableDataCaching)
+            {
+                for (const auto & attributeIter : clusterState.mAttributes)
+                {
+                    if (attributeIter.second.template Is<AttributeData>())
+                    {
+                        size_t payloadSize = attributeIter.second.template Get<AttributeData>().AllocatedSize();
+                        usage.mPayloadBytes += payloadSize;
+                        usage.mTotalBytes += payloadSize;
+                    }
+                }
+            }
+        }
+    }
+
+    return usage;
+}
+
 // Ensure that our out-of-line template methods actually get compiled.
 template class ClusterStateCacheT<true>;
 template class ClusterStateCacheT<false>;
+template class ClusterStateCacheT<true, ClusterStateCacheStorage::kFlat>;
+template class ClusterStateCacheT<false, ClusterStateCacheStorage::kFlat>;
 
 } // namespace app
 } // namespace chip
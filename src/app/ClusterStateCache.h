@@ -24,10 +24,12 @@
 #include <app/AppConfig.h>
 #include <app/AttributePathParams.h>
 #include <app/BufferedReadCallback.h>
+#include <app/ClusterStateCacheStorage.h>
 #include <app/ConcreteAttributePath.h>
 #include <app/ReadClient.h>
 #include <app/data-model/DecodableList.h>
 #include <app/data-model/Decode.h>
+#include <lib/support/Compiler.h>
 #include <lib/support/Variant.h>
 #include <list>
 #include <map>
@@ -66,8 +68,12 @@ namespace app {
  * 1. This already includes the BufferedReadCallback, so there is no need to add that to the ReadClient callback chain.
  * 2. The same cache cannot be used by multiple subscribe/read interactions at the same time.
  *
+ * The Storage parameter selects how attribute state is laid out in memory; see ClusterStateCacheStorage. kFlat trades
+ * a shorter lifetime of the TLV buffers handed out by Get() (see below) for a smaller and more cache-friendly footprint,
+ * which matters for controllers that keep whole large nodes resident.
+ *
  */
-template <bool CanEnableDataCaching>
+template <bool CanEnableDataCaching, ClusterStateCacheStorage Storage = ClusterStateCacheStorage::kMap>
 class ClusterStateCacheT : protected ReadClient::Callback
 {
 public:
@@ -262,7 +268,8 @@ public:
      * right at the attribute value.
      *
      * The underlying TLV buffer only remains valid until the cached value for that path is updated, so it must
-     * not be held across any async call boundaries.
+     * not be held across any async call boundaries. With ClusterStateCacheStorage::kFlat, the buffer is shared by all
+     * the attributes of the cluster and only remains valid until any attribute of that cluster is updated or cleared.
      *
      * Notable return values:
      *      - If neither data nor status for the specified path exist in the cache, CHIP_ERROR_KEY_NOT_FOUND
@@ -466,7 +473,7 @@ public:
     CHIP_ERROR ForEachCluster(EndpointId endpointId, IteratorFunc func) const
     {
         auto endpointIter = mCache.find(endpointId);
-        if (endpointIter->first == endpointId)
+        if (endpointIter != mCache.end())
         {
             for (auto & clusterIter : endpointIter->second)
             {
@@ -577,7 +584,34 @@ public:
      */
     CHIP_ERROR GetLastReportDataPath(ConcreteClusterPath & aPath);
 
+    /*
+     * Summary of the memory held by the attribute part of the cache.
+     */
+    struct AttributeMemoryUsage
+    {
+        size_t mEndpointCount  = 0;
+        size_t mClusterCount   = 0;
+        size_t mAttributeCount = 0;
+
+        // Bytes used by cached attribute TLV payloads, including replaced payloads that have not been compacted yet.
+        size_t mPayloadBytes = 0;
+
+        // Estimate of all the memory held for attributes: container nodes or arrays, spare capacity and payloads. Heap
+        // allocator overhead is not included.
+        size_t mTotalBytes = 0;
+    };
+
+    /*
+     * Walks the cached attribute state and reports how much memory it uses.
+     */
+    AttributeMemoryUsage GetAttributeMemoryUsage() const;
+
 private:
+    static constexpr bool kFlatStorage = (Storage == ClusterStateCacheStorage::kFlat);
+
+    template <typename Key, typename Value>
+    using Container = std::conditional_t<kFlatStorage, detail::SortedVectorMap<Key, Value>, std::map<Key, Value>>;
+
     // An attribute state can be one of three things:
     // * If we got a path-specific error for the attribute, the corresponding
     //   status.
@@ -590,8 +624,12 @@ private:
     // The data for a single attribute is not going to be gigabytes in size, so
     // using uint32_t for the size is fine; on 64-bit systems this can save
     // quite a bit of space.
-    using AttributeData  = Platform::ScopedMemoryBufferWithSize<uint8_t>;
+    //
+    // With flat storage, the data lives in the payload arena of the cluster and the state only records where.
+    using AttributeData  = std::conditional_t<kFlatStorage, detail::ArenaPayload, Platform::ScopedMemoryBufferWithSize<uint8_t>>;
     using AttributeState = std::conditional_t<CanEnableDataCaching, Variant<StatusIB, AttributeData, uint32_t>, uint32_t>;
+    using PayloadArena   = std::conditional_t<kFlatStorage, detail::AttributePayloadArena, detail::NoAttributePayloadArena>;
+
     // mPendingDataVersion represents a tentative data version for a cluster that we have gotten some reports for.
     //
     // mCurrentDataVersion represents a known data version for a cluster.  In order for this to have a
@@ -599,12 +637,14 @@ private:
     // and we must not be in the middle of receiving reports for that cluster.
     struct ClusterState
     {
-        std::map<AttributeId, AttributeState> mAttributes;
+        Container<AttributeId, AttributeState> mAttributes;
         Optional<DataVersion> mPendingDataVersion;
         Optional<DataVersion> mCommittedDataVersion;
+        // TLV of the attributes that hold AttributeData, with flat storage only.
+        CHIP_NO_UNIQUE_ADDRESS PayloadArena mPayloads;
     };
-    using EndpointState = std::map<ClusterId, ClusterState>;
-    using NodeState     = std::map<EndpointId, EndpointState>;
+    using EndpointState = Container<ClusterId, ClusterState>;
+    using NodeState     = Container<EndpointId, EndpointState>;
 
     struct Comparator
     {
@@ -647,6 +687,14 @@ private:
 
     const EventData * GetEventData(EventNumber number, CHIP_ERROR & err) const;
 
+    // Returns the TLV of an attribute whose state holds AttributeData.
+    static ByteSpan GetAttributeData(const ClusterState & clusterState, const AttributeState & attributeState);
+
+    // With flat storage, marks the arena space of the data held by attributeState as free before it is replaced or
+    // removed, and compacts the arena of the cluster once most of it is free space.
+    static void ReleaseAttributeData(ClusterState & clusterState, const AttributeState & attributeState);
+    static void CompactPayloadsIfNeeded(ClusterState & clusterState);
+
     /*
      * Updates the state of an attribute in the cache given a reader. If the reader is null, the state is updated
      * with the provided status.
@@ -732,8 +780,10 @@ private:
     const bool mCacheData                   = CanEnableDataCaching;
 };
 
-using ClusterStateCache       = ClusterStateCacheT<true>;
-using ClusterStateCacheNoData = ClusterStateCacheT<false>;
+using ClusterStateCache           = ClusterStateCacheT<true>;
+using ClusterStateCacheNoData     = ClusterStateCacheT<false>;
+using FlatClusterStateCache       = ClusterStateCacheT<true, ClusterStateCacheStorage::kFlat>;
+using FlatClusterStateCacheNoData = ClusterStateCacheT<false, ClusterStateCacheStorage::kFlat>;
 
 };     // namespace app
 };     // namespace chip
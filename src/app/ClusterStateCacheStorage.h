@@ -0,0 +1,191 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/Span.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+namespace chip {
+namespace app {
+
+/*
+ * How a ClusterStateCacheT stores the attribute state it has received.
+ */
+enum class ClusterStateCacheStorage : uint8_t
+{
+    // Nested std::map instances keyed by endpoint, cluster and attribute, with a separate heap buffer holding the TLV
+    // of every attribute.
+    kMap,
+
+    // Sorted vectors keyed by endpoint, cluster and attribute, with the TLV of all the attributes of a cluster packed
+    // into a single buffer owned by that cluster. This avoids a heap allocation per node and per attribute value, which
+    // makes caches of large nodes noticeably smaller and faster to iterate, at the cost of O(n) insertion of new keys.
+    kFlat,
+};
+
+namespace detail {
+
+/*
+ * A map over a vector of (key, value) pairs sorted by key.
+ *
+ * This implements the subset of the std::map interface used by ClusterStateCacheT. Unlike std::map, inserting or
+ * erasing an element invalidates iterators and references to every other element.
+ */
+template <typename Key, typename Value>
+class SortedVectorMap
+{
+public:
+    using value_type     = std::pair<Key, Value>;
+    using iterator       = typename std::vector<value_type>::iterator;
+    using const_iterator = typename std::vector<value_type>::const_iterator;
+
+    iterator begin() { return mEntries.begin(); }
+    iterator end() { return mEntries.end(); }
+    const_iterator begin() const { return mEntries.begin(); }
+    const_iterator end() const { return mEntries.end(); }
+
+    size_t size() const { return mEntries.size(); }
+    bool empty() const { return mEntries.empty(); }
+    size_t capacity() const { return mEntries.capacity(); }
+    void clear() { mEntries.clear(); }
+
+    iterator find(const Key & key)
+    {
+        auto iter = LowerBound(mEntries, key);
+        return (iter != mEntries.end() && iter->first == key) ? iter : mEntries.end();
+    }
+
+    const_iterator find(const Key & key) const
+    {
+        auto iter = LowerBound(mEntries, key);
+        return (iter != mEntries.end() && iter->first == key) ? iter : mEntries.end();
+    }
+
+    Value & operator[](const Key & key)
+    {
+        auto iter = LowerBound(mEntries, key);
+        if (iter == mEntries.end() || iter->first != key)
+        {
+            iter = mEntries.emplace(iter, key, Value());
+        }
+        return iter->second;
+    }
+
+    size_t erase(const Key & key)
+    {
+        auto iter = find(key);
+        VerifyOrReturnValue(iter != mEntries.end(), 0);
+        mEntries.erase(iter);
+        return 1;
+    }
+
+private:
+    template <typename Entries>
+    static auto LowerBound(Entries & entries, const Key & key)
+    {
+        return std::lower_bound(entries.begin(), entries.end(), key,
+                                [](const value_type & entry, const Key & value) { return entry.first < value; });
+    }
+
+    std::vector<value_type> mEntries;
+};
+
+/*
+ * Location of an attribute TLV payload within the AttributePayloadArena of its cluster.
+ */
+struct ArenaPayload
+{
+    uint32_t mOffset = 0;
+    uint32_t mSize   = 0;
+};
+
+/*
+ * A single growable buffer holding the TLV payloads of all the attributes of one cluster.
+ *
+ * Payloads are appended; replacing or removing an attribute only marks its old payload as stale. Once stale bytes
+ * make up most of the buffer, the owner calls Compact() to copy the live payloads into a right-sized buffer.
+ */
+class AttributePayloadArena
+{
+public:
+    /*
+     * Reserves aSize bytes at the end of the arena for a new payload. The returned pointer is only valid until the
+     * arena is modified again.
+     */
+    uint8_t * Allocate(uint32_t aSize, ArenaPayload & aPayload)
+    {
+        VerifyOrReturnValue(aSize <= std::numeric_limits<uint32_t>::max() - mBytes.size(), nullptr);
+        aPayload.mOffset = static_cast<uint32_t>(mBytes.size());
+        aPayload.mSize   = aSize;
+        mBytes.resize(mBytes.size() + aSize);
+        return mBytes.data() + aPayload.mOffset;
+    }
+
+    void Release(const ArenaPayload & aPayload) { mStaleBytes += aPayload.mSize; }
+
+    ByteSpan Get(const ArenaPayload & aPayload) const { return ByteSpan(mBytes.data() + aPayload.mOffset, aPayload.mSize); }
+
+    bool NeedsCompaction() const { return mStaleBytes >= kMinCompactionBytes && mStaleBytes * 2 > mBytes.size(); }
+
+    /*
+     * Moves all live payloads into a new buffer without stale bytes. forEachPayload(fn) must call fn(ArenaPayload &)
+     * for every live payload of the arena; the payload locations are updated in place.
+     */
+    template <typename ForEachPayload>
+    void Compact(ForEachPayload && forEachPayload)
+    {
+        std::vector<uint8_t> compacted;
+        compacted.reserve(mBytes.size() - mStaleBytes);
+        forEachPayload([&](ArenaPayload & payload) {
+            auto start      = mBytes.begin() + payload.mOffset;
+            payload.mOffset = static_cast<uint32_t>(compacted.size());
+            compacted.insert(compacted.end(), start, start + payload.mSize);
+        });
+        mBytes.swap(compacted);
+        mStaleBytes = 0;
+    }
+
+    // Bytes of payload data held by the arena, including stale payloads.
+    size_t Size() const { return mBytes.size(); }
+    size_t Capacity() const { return mBytes.capacity(); }
+
+private:
+    // Avoid copying a cluster's payloads around for a handful of replaced small values.
+    static constexpr size_t kMinCompactionBytes = 256;
+
+    std::vector<uint8_t> mBytes;
+    size_t mStaleBytes = 0;
+};
+
+// Stand-in for AttributePayloadArena when attribute payloads are stored in their own buffers.
+struct NoAttributePayloadArena
+{
+};
+
+} // namespace detail
+} // namespace app
+} // namespace chip
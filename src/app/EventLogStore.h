@@ -0,0 +1,76 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <lib/core/TLVUtilities.h>
+#include <lib/support/Span.h>
+
+namespace chip {
+namespace app {
+
+/**
+ *   Interface for persistent storage of logged events, that EventManagement can use in addition
+ *   to its in-memory event buffers.
+ *
+ *   Every numbered event is appended to the store when it is logged. Events that were dropped
+ *   from the event buffers are read back from the store, so the store keeps the event history
+ *   across restarts and beyond the size of the event buffers.
+ *
+ *   EventManagement calls the store with the Matter stack lock held.
+ */
+class EventLogStore
+{
+public:
+    virtual ~EventLogStore() = default;
+
+    /**
+     *  Store a logged event. Events are appended in increasing event number order.
+     *
+     * @param[in] aEventNumber  The number of the event.
+     * @param[in] aFabricIndex  The fabric the event is scoped to, kUndefinedFabricIndex if it is not fabric-scoped.
+     * @param[in] aEvent        The EventReportIB element of the event, as held in the event buffers.
+     */
+    virtual CHIP_ERROR AppendEvent(EventNumber aEventNumber, FabricIndex aFabricIndex, const ByteSpan & aEvent) = 0;
+
+    /**
+     *  Call aHandler, in event number order, with a reader positioned on the EventReportIB element
+     *  of every stored event numbered from aEventMin up to, but not including, aEventMax. Events of
+     *  removed fabrics are skipped.
+     *
+     * @retval #CHIP_NO_ERROR once all the events have been handled.
+     * @retval other the first error returned by aHandler, which stops the iteration.
+     */
+    virtual CHIP_ERROR ForEachEvent(EventNumber aEventMin, EventNumber aEventMax, TLV::Utilities::IterateHandler aHandler,
+                                    void * apContext) = 0;
+
+    /**
+     *  Stop returning the events scoped to a removed fabric.
+     */
+    virtual CHIP_ERROR FabricRemoved(FabricIndex aFabricIndex) = 0;
+
+    /**
+     *  Return the number following the last stored event, or 0 if no event was stored.
+     */
+    virtual EventNumber GetNextEventNumber() const = 0;
+};
+
+} // namespace app
+} // namespace chip
@@ -21,12 +21,16 @@
 #include <access/SubjectDescriptor.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
+#include <app/MessageDef/EventReportIB.h>
 #include <lib/core/TLVUtilities.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
+#include <platform/PlatformManager.h>
 
+#include <algorithm>
 #include <cassert>
 #include <cinttypes>
+#include <cstring>
 
 using namespace chip::TLV;
 
@@ -34,6 +38,12 @@ namespace chip {
 namespace app {
 EventManagement EventManagement::sInstance;
 
+#if CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+namespace {
+EventStagingQueue sStagingQueue;
+} // namespace
+#endif // CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+
 /**
  * @brief
  *   A TLVReader backed by CircularEventBuffer
@@ -66,6 +76,7 @@ struct ReclaimEventCtx
 {
     CircularEventBuffer * mpEventBuffer = nullptr;
     size_t mSpaceNeededForMovedEvent    = 0;
+    EventNumber mEventNumber            = 0; ///< Event number of the evicted event
 };
 
 /**
@@ -124,7 +135,7 @@ CHIP_ERROR EventManagement::Init(Messaging::ExchangeManager * apExchangeManager,
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer)
+CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber)
 {
     CircularTLVWriter writer;
     CircularTLVReader reader;
@@ -139,6 +150,7 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     // Set up the next buffer s.t. it fails if needs to evict an element
     nextBuffer->mProcessEvictedElement = AlwaysFail;
 
+    const uint8_t * eventStart = nextBuffer->QueueTail();
     writer.Init(*nextBuffer);
 
     // Set up the reader s.t. it is positioned to read the head event
@@ -153,6 +165,8 @@ CHIP_ERROR EventManagement::CopyToNextBuffer(CircularEventBuffer * apEventBuffer
     err = writer.Finalize();
     SuccessOrExit(err);
 
+    nextBuffer->IndexEvent(aEventNumber, eventStart);
+
     ChipLogDetail(EventLogging, "Copy Event to next buffer with priority %u", static_cast<unsigned>(nextBuffer->GetPriority()));
 exit:
     if (err != CHIP_NO_ERROR)
@@ -197,7 +211,7 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
 
             eventBuffer->mProcessEvictedElement = EvictEvent;
             eventBuffer->mAppData               = &ctx;
-            err                                 = eventBuffer->EvictHead();
+            err                                 = eventBuffer->EvictHeadEvent();
 
             // one of two things happened: either the element was evicted immediately if the head's priority is same as current
             // buffer(final one), or we figured out how much space we need to evict it into the next buffer, the check happens in
@@ -215,11 +229,11 @@ CHIP_ERROR EventManagement::EnsureSpaceInCircularBuffer(size_t aRequiredSpace, P
                     // Since we're calling CopyElement and we've checked
                     // that there is space in the next buffer, we don't expect
                     // this to fail.
-                    err = CopyToNextBuffer(eventBuffer);
+                    err = CopyToNextBuffer(eventBuffer, ctx.mEventNumber);
                     SuccessOrExit(err);
                     // success; evict head unconditionally
                     eventBuffer->mProcessEvictedElement = nullptr;
-                    err                                 = eventBuffer->EvictHead();
+                    err                                 = eventBuffer->EvictHeadEvent();
                     // if unconditional eviction failed, this
                     // means that we have no way of further
                     // clearing the buffer.  fail out and let the
@@ -356,6 +370,27 @@ void EventManagement::DestroyEventManagement()
     sInstance.mState        = EventManagementStates::Shutdown;
     sInstance.mpEventBuffer = nullptr;
     sInstance.mpExchangeMgr = nullptr;
+    // Drop the events still staged, they cannot be logged anymore.
+    sInstance.DrainStagedEvents();
+    sInstance.mpEventLogStore = nullptr;
+}
+
+CHIP_ERROR EventManagement::SetEventLogStore(EventLogStore * apEventLogStore)
+{
+    VerifyOrReturnError(mState != EventManagementStates::Shutdown, CHIP_ERROR_INCORRECT_STATE);
+
+    mpEventLogStore = apEventLogStore;
+    VerifyOrReturnError(mpEventLogStore != nullptr, CHIP_NO_ERROR);
+
+    const EventNumber nextEventNumber = mpEventLogStore->GetNextEventNumber();
+    if (nextEventNumber > mLastEventNumber)
+    {
+        ChipLogProgress(EventLogging, "Advancing event number to 0x" ChipLogFormatX64 " past the stored events",
+                        ChipLogValueX64(nextEventNumber));
+        ReturnErrorOnFailure(mpEventNumberCounter->AdvanceBy(nextEventNumber - mLastEventNumber));
+        mLastEventNumber = mpEventNumberCounter->GetValue();
+    }
+    return CHIP_NO_ERROR;
 }
 
 CircularEventBuffer * EventManagement::GetPriorityBuffer(PriorityLevel aPriority) const
@@ -380,14 +415,16 @@ CHIP_ERROR EventManagement::CopyAndAdjustDeltaTime(const TLVReader & aReader, si
         // Does not go on the wire.
         return CHIP_NO_ERROR;
     }
-    if ((aReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kSystemTimestamp)) && !(ctx->mpContext->mFirst) &&
-        (ctx->mpContext->mCurrentTime.mType == ctx->mpContext->mPreviousTime.mType))
+    // Events read from an EventLogStore may come from an earlier boot, only encode deltas that are not negative.
+    const bool canUseDelta = !(ctx->mpContext->mFirst) &&
+        (ctx->mpContext->mCurrentTime.mType == ctx->mpContext->mPreviousTime.mType) &&
+        (ctx->mpContext->mCurrentTime.mValue >= ctx->mpContext->mPreviousTime.mValue);
+    if ((aReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kSystemTimestamp)) && canUseDelta)
     {
         return ctx->mpWriter->Put(TLV::ContextTag(EventDataIB::Tag::kDeltaSystemTimestamp),
                                   ctx->mpContext->mCurrentTime.mValue - ctx->mpContext->mPreviousTime.mValue);
     }
-    if ((aReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kEpochTimestamp)) && !(ctx->mpContext->mFirst) &&
-        (ctx->mpContext->mCurrentTime.mType == ctx->mpContext->mPreviousTime.mType))
+    if ((aReader.GetTag() == TLV::ContextTag(EventDataIB::Tag::kEpochTimestamp)) && canUseDelta)
     {
         return ctx->mpWriter->Put(TLV::ContextTag(EventDataIB::Tag::kDeltaEpochTimestamp),
                                   ctx->mpContext->mCurrentTime.mValue - ctx->mpContext->mPreviousTime.mValue);
@@ -415,11 +452,101 @@ CHIP_ERROR EventManagement::LogEvent(EventLoggingDelegate * apDelegate, const Ev
 {
     assertChipStackLockedByCurrentThread();
     VerifyOrReturnError(mState != EventManagementStates::Shutdown, CHIP_ERROR_INCORRECT_STATE);
-    return LogEventPrivate(apDelegate, aEventOptions, aEventNumber);
+    // Events staged earlier by other threads come first.
+    DrainStagedEvents();
+    return LogEventPrivate(apDelegate, aEventOptions, GetCurrentTimestamp(), aEventNumber);
+}
+
+CHIP_ERROR EventManagement::LogEventFromAnyThread(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions)
+{
+#if CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+    VerifyOrReturnError(apDelegate != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    ReturnErrorOnFailure(sStagingQueue.Stage(*apDelegate, aEventOptions, GetCurrentTimestamp()));
+
+    if (sStagingQueue.RequestDrain())
+    {
+        CHIP_ERROR err = DeviceLayer::PlatformMgr().ScheduleWork(DrainStagedEventsWork);
+        if (err != CHIP_NO_ERROR)
+        {
+            // The event stays staged until the next event is logged.
+            ChipLogError(EventLogging, "Failed to schedule logging of staged events: %" CHIP_ERROR_FORMAT, err.Format());
+            sStagingQueue.StartDrain();
+        }
+    }
+    return CHIP_NO_ERROR;
+#else
+    return CHIP_ERROR_NOT_IMPLEMENTED;
+#endif // CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+}
+
+void EventManagement::DrainStagedEventsWork(intptr_t)
+{
+    GetInstance().DrainStagedEvents();
+}
+
+void EventManagement::DrainStagedEvents()
+{
+#if CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+    // Log at most as many events as the queues hold, events staged meanwhile are left for another drain.
+    constexpr size_t kMaxBatchSize = CHIP_CONFIG_EVENT_STAGING_QUEUES * EventStagingQueue::kQueueSize;
+
+    sStagingQueue.StartDrain();
+    for (size_t i = 0; i < kMaxBatchSize; i++)
+    {
+        EventStagingQueue::StagedEvent * event = sStagingQueue.Front();
+        if (event == nullptr)
+        {
+            return;
+        }
+
+        bool logged = false;
+        if (mState != EventManagementStates::Shutdown)
+        {
+            // Events are numbered in the order they are logged, keep their timestamps in the same order.
+            Timestamp timestamp = event->GetTimestamp();
+            if (timestamp.mType == mLastEventTimestamp.mType && timestamp.mValue < mLastEventTimestamp.mValue)
+            {
+                timestamp.mValue = mLastEventTimestamp.mValue;
+            }
+
+            EventNumber eventNumber;
+            logged = (LogEventPrivate(event, event->GetOptions(), timestamp, eventNumber) == CHIP_NO_ERROR);
+        }
+        sStagingQueue.PopFront(logged);
+    }
+
+    if (sStagingQueue.Front() != nullptr && sStagingQueue.RequestDrain() &&
+        DeviceLayer::PlatformMgr().ScheduleWork(DrainStagedEventsWork) != CHIP_NO_ERROR)
+    {
+        sStagingQueue.StartDrain();
+    }
+#endif // CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+}
+
+EventStagingStats EventManagement::GetStagingStats() const
+{
+#if CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+    return sStagingQueue.GetStats();
+#else
+    return EventStagingStats();
+#endif // CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+}
+
+Timestamp EventManagement::GetCurrentTimestamp() const
+{
+#if CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
+    System::Clock::Milliseconds64 utc_time;
+    if (System::SystemClock().GetClock_RealTimeMS(utc_time) == CHIP_NO_ERROR)
+    {
+        return Timestamp::Epoch(utc_time);
+    }
+#endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
+    auto systemTimeMs = System::SystemClock().GetMonotonicMilliseconds64() - mMonotonicStartupTime;
+    return Timestamp::System(systemTimeMs);
 }
 
 CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions,
-                                            EventNumber & aEventNumber)
+                                            Timestamp aTimestamp, EventNumber & aEventNumber)
 {
     CircularTLVWriter writer;
     CHIP_ERROR err               = CHIP_NO_ERROR;
@@ -427,23 +554,11 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     aEventNumber                 = 0;
     CircularTLVWriter checkpoint = writer;
     EventLoadOutContext ctxt     = EventLoadOutContext(writer, aEventOptions.mPriority, mLastEventNumber);
+    const uint8_t * eventStart   = nullptr;
+    uint32_t eventLength         = 0;
+    const Timestamp timestamp    = aTimestamp;
     InternalEventOptions opts;
 
-    Timestamp timestamp;
-#if CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
-    System::Clock::Milliseconds64 utc_time;
-    err = System::SystemClock().GetClock_RealTimeMS(utc_time);
-    if (err == CHIP_NO_ERROR)
-    {
-        timestamp = Timestamp::Epoch(utc_time);
-    }
-    else
-#endif // CHIP_DEVICE_CONFIG_EVENT_LOGGING_UTC_TIMESTAMPS
-    {
-        auto systemTimeMs = System::SystemClock().GetMonotonicMilliseconds64() - mMonotonicStartupTime;
-        timestamp         = Timestamp::System(systemTimeMs);
-    }
-
     opts = InternalEventOptions(timestamp);
     // Start the event container (anonymous structure) in the circular buffer
     writer.Init(*mpEventBuffer);
@@ -465,10 +580,14 @@ CHIP_ERROR EventManagement::LogEventPrivate(EventLoggingDelegate * apDelegate, c
     err = EnsureSpaceInCircularBuffer(requestSize, aEventOptions.mPriority);
     SuccessOrExit(err);
 
-    err = ConstructEvent(&ctxt, apDelegate, &opts);
+    eventStart = mpEventBuffer->QueueTail();
+    err        = ConstructEvent(&ctxt, apDelegate, &opts);
     SuccessOrExit(err);
 
-    mBytesWritten += writer.GetLengthWritten();
+    mpEventBuffer->IndexEvent(ctxt.mCurrentEventNumber, eventStart);
+
+    eventLength = writer.GetLengthWritten();
+    mBytesWritten += eventLength;
 
 exit:
     if (err != CHIP_NO_ERROR)
@@ -481,6 +600,7 @@ exit:
         aEventNumber = mLastEventNumber;
         VendEventNumber();
         mLastEventTimestamp = timestamp;
+        StoreEvent(eventStart, eventLength, aEventNumber, opts.mFabricIndex);
 #if CHIP_CONFIG_EVENT_LOGGING_VERBOSE_DEBUG_LOGS
         ChipLogDetail(EventLogging,
                       "LogEvent event number: 0x" ChipLogFormatX64 " priority: %u, endpoint id:  0x%x"
@@ -664,11 +784,35 @@ CHIP_ERROR EventManagement::FetchEventsSince(TLVWriter & aWriter, const SingleLi
     CircularEventBufferWrapper bufWrapper;
     EventLoadOutContext context(aWriter, PriorityLevel::Invalid, aEventMin);
 
+    Optional<EventNumber> lastSkippedEventNumber;
+
     context.mSubjectDescriptor     = aSubjectDescriptor;
     context.mpInterestedEventPaths = apEventPathList;
-    err                            = GetEventReader(reader, PriorityLevel::Critical, &bufWrapper);
+    err                            = GetEventReaderSince(reader, aEventMin, &bufWrapper, lastSkippedEventNumber);
     SuccessOrExit(err);
 
+    // Skipped events would have been iterated over without being copied, keep track of them the same way.
+    if (lastSkippedEventNumber.HasValue())
+    {
+        context.mCurrentEventNumber = lastSkippedEventNumber.Value();
+    }
+
+    // Events dropped from the event buffers can only be read from the event log store, and only events older than
+    // the oldest one of the lowest priority buffer can have been dropped. Copy those from the store along with the
+    // buffered ones that come before them, the remaining buffered events are copied below.
+    if (mpEventLogStore != nullptr)
+    {
+        const EventNumber oldestBufferedEventNumber = GetOldestBufferedEventNumber();
+        if (aEventMin < oldestBufferedEventNumber)
+        {
+            StoredEventsContext storedContext{ &context, &reader };
+            err = NextBufferedEvent(storedContext);
+            SuccessOrExit(err);
+            err = mpEventLogStore->ForEachEvent(aEventMin, oldestBufferedEventNumber, CopyStoredEventsSince, &storedContext);
+            SuccessOrExit(err);
+        }
+    }
+
     err = TLV::Utilities::Iterate(reader, CopyEventsSince, &context, recurse);
     if (err == CHIP_END_OF_TLV)
     {
@@ -740,6 +884,11 @@ CHIP_ERROR EventManagement::FabricRemoved(FabricIndex aFabricIndex)
     TLVReader reader;
     CircularEventBufferWrapper bufWrapper;
 
+    if (mpEventLogStore != nullptr)
+    {
+        ReturnErrorOnFailure(mpEventLogStore->FabricRemoved(aFabricIndex));
+    }
+
     ReturnErrorOnFailure(GetEventReader(reader, PriorityLevel::Critical, &bufWrapper));
     CHIP_ERROR err = TLV::Utilities::Iterate(reader, FabricRemovedCB, &aFabricIndex, recurse);
     if (err == CHIP_END_OF_TLV)
@@ -762,6 +911,115 @@ CHIP_ERROR EventManagement::GetEventReader(TLVReader & aReader, PriorityLevel aP
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR EventManagement::GetEventReaderSince(TLVReader & aReader, EventNumber aEventMin,
+                                                CircularEventBufferWrapper * apBufWrapper,
+                                                Optional<EventNumber> & aLastSkippedEventNumber)
+{
+    CircularEventBuffer * buffer = GetPriorityBuffer(PriorityLevel::Critical);
+    VerifyOrReturnError(buffer != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Buffers of higher priority hold older events, so skip the buffers whose events are all older than aEventMin.
+    uint32_t offset = buffer->FindEventOffset(aEventMin, aLastSkippedEventNumber);
+    while (offset == buffer->DataLength() && buffer->GetPreviousCircularEventBuffer() != nullptr)
+    {
+        buffer = buffer->GetPreviousCircularEventBuffer();
+        offset = buffer->FindEventOffset(aEventMin, aLastSkippedEventNumber);
+    }
+
+    apBufWrapper->mpCurrent    = buffer;
+    apBufWrapper->mStartOffset = offset;
+
+    CircularEventReader reader;
+    reader.Init(apBufWrapper);
+    aReader.Init(reader);
+
+    return CHIP_NO_ERROR;
+}
+
+EventNumber EventManagement::GetOldestBufferedEventNumber()
+{
+    CircularEventBufferWrapper bufWrapper;
+    CircularEventReader circularReader;
+    TLVReader reader;
+    EventReportIB::Parser report;
+    EventDataIB::Parser eventData;
+    EventNumber eventNumber;
+
+    // The lowest priority buffer is the first one, reading it does not move on to other buffers.
+    bufWrapper.mpCurrent = mpEventBuffer;
+    circularReader.Init(&bufWrapper);
+    reader.Init(circularReader);
+
+    VerifyOrReturnValue(reader.Next() == CHIP_NO_ERROR, mLastEventNumber);
+    VerifyOrReturnValue(report.Init(reader) == CHIP_NO_ERROR, mLastEventNumber);
+    VerifyOrReturnValue(report.GetEventData(&eventData) == CHIP_NO_ERROR, mLastEventNumber);
+    VerifyOrReturnValue(eventData.GetEventNumber(&eventNumber) == CHIP_NO_ERROR, mLastEventNumber);
+    return eventNumber;
+}
+
+CHIP_ERROR EventManagement::CopyStoredEventsSince(const TLVReader & aReader, size_t aDepth, void * apContext)
+{
+    StoredEventsContext * const storedContext = static_cast<StoredEventsContext *>(apContext);
+    EventReportIB::Parser report;
+    EventDataIB::Parser eventData;
+    EventNumber storedEventNumber;
+    ReturnErrorOnFailure(report.Init(aReader));
+    ReturnErrorOnFailure(report.GetEventData(&eventData));
+    ReturnErrorOnFailure(eventData.GetEventNumber(&storedEventNumber));
+
+    // Buffered events are copied first, in place of their stored copy.
+    bool isBuffered = false;
+    while (storedContext->mHasBufferedEvent && storedContext->mBufferedEventNumber <= storedEventNumber)
+    {
+        isBuffered = isBuffered || (storedContext->mBufferedEventNumber == storedEventNumber);
+        ReturnErrorOnFailure(CopyEventsSince(*storedContext->mpBufferReader, aDepth, storedContext->mpLoadOutContext));
+        ReturnErrorOnFailure(NextBufferedEvent(*storedContext));
+    }
+    VerifyOrReturnError(!isBuffered, CHIP_NO_ERROR);
+    return CopyEventsSince(aReader, aDepth, storedContext->mpLoadOutContext);
+}
+
+CHIP_ERROR EventManagement::NextBufferedEvent(StoredEventsContext & aContext)
+{
+    EventReportIB::Parser report;
+    EventDataIB::Parser eventData;
+    CHIP_ERROR err             = aContext.mpBufferReader->Next();
+    aContext.mHasBufferedEvent = (err == CHIP_NO_ERROR);
+    VerifyOrReturnError(err != CHIP_END_OF_TLV, CHIP_NO_ERROR);
+    ReturnErrorOnFailure(err);
+
+    ReturnErrorOnFailure(report.Init(*aContext.mpBufferReader));
+    ReturnErrorOnFailure(report.GetEventData(&eventData));
+    return eventData.GetEventNumber(&aContext.mBufferedEventNumber);
+}
+
+void EventManagement::StoreEvent(const uint8_t * apEventStart, uint32_t aEventLength, EventNumber aEventNumber,
+                                 FabricIndex aFabricIndex)
+{
+    VerifyOrReturn(mpEventLogStore != nullptr);
+
+    // Events are at most kMaxEventSizeReserve long, copy the ones that wrap around the end of the buffer.
+    uint8_t event[kMaxEventSizeReserve];
+    const uint8_t * const bufferEnd = mpEventBuffer->GetQueue() + mpEventBuffer->GetTotalDataLength();
+    ByteSpan eventSpan(apEventStart, aEventLength);
+    if (aEventLength > static_cast<size_t>(bufferEnd - apEventStart))
+    {
+        VerifyOrReturn(aEventLength <= sizeof(event));
+        const size_t firstPart = static_cast<size_t>(bufferEnd - apEventStart);
+        memcpy(event, apEventStart, firstPart);
+        memcpy(event + firstPart, mpEventBuffer->GetQueue(), aEventLength - firstPart);
+        eventSpan = ByteSpan(event, aEventLength);
+    }
+
+    // The event is logged in the event buffers either way.
+    CHIP_ERROR err = mpEventLogStore->AppendEvent(aEventNumber, aFabricIndex, eventSpan);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(EventLogging, "Failed to store event 0x" ChipLogFormatX64 ": %" CHIP_ERROR_FORMAT,
+                     ChipLogValueX64(aEventNumber), err.Format());
+    }
+}
+
 CHIP_ERROR EventManagement::FetchEventParameters(const TLVReader & aReader, size_t, void * apContext)
 {
     EventEnvelopeContext * const envelope = static_cast<EventEnvelopeContext *>(apContext);
@@ -842,6 +1100,7 @@ CHIP_ERROR EventManagement::EvictEvent(TLVCircularBuffer & apBuffer, void * apAp
 
     ReclaimEventCtx * const ctx             = static_cast<ReclaimEventCtx *>(apAppData);
     CircularEventBuffer * const eventBuffer = ctx->mpEventBuffer;
+    ctx->mEventNumber                       = context.mEventNumber;
     if (eventBuffer->IsFinalDestinationForPriority(imp))
     {
         ChipLogProgress(EventLogging,
@@ -887,6 +1146,108 @@ void CircularEventBuffer::Init(uint8_t * apBuffer, uint32_t aBufferLength, Circu
     mpPrev    = apPrev;
     mpNext    = apNext;
     mPriority = aPriorityLevel;
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    ResetIndex();
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+}
+
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+void CircularEventBuffer::ResetIndex()
+{
+    mIndexStart   = 0;
+    mIndexCount   = 0;
+    mHeadPosition = 0;
+    mIndexedHead  = QueueHead();
+}
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+
+void CircularEventBuffer::IndexEvent(EventNumber aEventNumber, const uint8_t * apEventStart)
+{
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    if (mIndexedHead != QueueHead())
+    {
+        // The head moved without EvictHeadEvent, positions of the indexed events are unknown.
+        ResetIndex();
+    }
+
+    const uint32_t size   = GetTotalDataLength();
+    const uint32_t offset = static_cast<uint32_t>(apEventStart - GetQueue() + size - (QueueHead() - GetQueue())) % size;
+    VerifyOrReturn(offset < DataLength());
+
+    if (mIndexCount == CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE)
+    {
+        // Forget the oldest event, fetches since it will scan from the head.
+        mIndexStart = (mIndexStart + 1) % CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE;
+        mIndexCount--;
+    }
+
+    IndexEntry & entry = mIndex[(mIndexStart + mIndexCount) % CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE];
+    entry.mEventNumber = aEventNumber;
+    entry.mPosition    = mHeadPosition + offset;
+    mIndexCount++;
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+}
+
+CHIP_ERROR CircularEventBuffer::EvictHeadEvent()
+{
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    const uint32_t dataLength = DataLength();
+    const bool indexed        = (mIndexedHead == QueueHead());
+
+    ReturnErrorOnFailure(EvictHead());
+
+    if (!indexed)
+    {
+        ResetIndex();
+        return CHIP_NO_ERROR;
+    }
+
+    mHeadPosition += dataLength - DataLength();
+    mIndexedHead = QueueHead();
+    // Positions wrap around, compare them by distance.
+    while (mIndexCount > 0 && static_cast<int32_t>(GetIndexEntry(0).mPosition - mHeadPosition) < 0)
+    {
+        mIndexStart = (mIndexStart + 1) % CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE;
+        mIndexCount--;
+    }
+    return CHIP_NO_ERROR;
+#else
+    return EvictHead();
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+}
+
+uint32_t CircularEventBuffer::FindEventOffset(EventNumber aEventNumber, Optional<EventNumber> & aLastSkippedEventNumber) const
+{
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    VerifyOrReturnValue(mIndexedHead == QueueHead() && mIndexCount > 0, 0);
+    // Events before the oldest indexed one may be of interest.
+    VerifyOrReturnValue(aEventNumber > GetIndexEntry(0).mEventNumber, 0);
+
+    // Find the first indexed event with an event number of at least aEventNumber.
+    size_t low  = 1;
+    size_t high = mIndexCount;
+    while (low < high)
+    {
+        const size_t middle = low + (high - low) / 2;
+        if (GetIndexEntry(middle).mEventNumber < aEventNumber)
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+
+    aLastSkippedEventNumber.SetValue(GetIndexEntry(low - 1).mEventNumber);
+    if (low == mIndexCount)
+    {
+        return DataLength();
+    }
+    return GetIndexEntry(low).mPosition - mHeadPosition;
+#else
+    return 0;
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
 }
 
 bool CircularEventBuffer::IsFinalDestinationForPriority(PriorityLevel aPriority) const
@@ -912,9 +1273,12 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
     if (apBufWrapper->mpCurrent == nullptr)
         return;
 
-    TEMPORARY_RETURN_IGNORED TLVReader::Init(*apBufWrapper, apBufWrapper->mpCurrent->DataLength());
-    mMaxLen = apBufWrapper->mpCurrent->DataLength();
-    for (prev = apBufWrapper->mpCurrent->GetPreviousCircularEventBuffer(); prev != nullptr;
+    // Initializing the reader moves the wrapper past empty buffers, count the data from the starting buffer on.
+    CircularEventBuffer * const start = apBufWrapper->mpCurrent;
+    const uint32_t dataLength         = start->DataLength() - apBufWrapper->mStartOffset;
+    TEMPORARY_RETURN_IGNORED TLVReader::Init(*apBufWrapper, dataLength);
+    mMaxLen = dataLength;
+    for (prev = start->GetPreviousCircularEventBuffer(); prev != nullptr;
          prev = prev->GetPreviousCircularEventBuffer())
     {
         CircularEventBufferWrapper bufWrapper;
@@ -926,8 +1290,20 @@ void CircularEventReader::Init(CircularEventBufferWrapper * apBufWrapper)
 CHIP_ERROR CircularEventBufferWrapper::GetNextBuffer(TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen)
 {
     CHIP_ERROR err = CHIP_NO_ERROR;
-    TEMPORARY_RETURN_IGNORED mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
-    SuccessOrExit(err);
+    if (mStartOffset != 0)
+    {
+        // Start reading in the middle of the current buffer, up to its tail or the end of its storage.
+        const uint32_t size  = mpCurrent->GetTotalDataLength();
+        const uint32_t start = static_cast<uint32_t>(mpCurrent->QueueHead() - mpCurrent->GetQueue() + mStartOffset) % size;
+        aBufStart            = mpCurrent->GetQueue() + start;
+        aBufLen              = std::min(mpCurrent->DataLength() - mStartOffset, size - start);
+        mStartOffset         = 0;
+    }
+    else
+    {
+        TEMPORARY_RETURN_IGNORED mpCurrent->GetNextBuffer(aReader, aBufStart, aBufLen);
+        SuccessOrExit(err);
+    }
 
     if ((aBufLen == 0) && (mpCurrent->GetPreviousCircularEventBuffer() != nullptr))
     {
@@ -28,12 +28,16 @@
 
 #include "EventLoggingDelegate.h"
 #include <access/SubjectDescriptor.h>
+#include <app/EventLogStore.h>
 #include <app/EventLoggingTypes.h>
 #include <app/EventReporter.h>
+#include <app/EventStagingQueue.h>
 #include <app/MessageDef/EventDataIB.h>
 #include <app/MessageDef/StatusIB.h>
 #include <app/data-model-provider/EventsGenerator.h>
 #include <app/util/basic-types.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/Optional.h>
 #include <lib/core/TLVCircularBuffer.h>
 #include <lib/support/CHIPCounter.h>
 #include <lib/support/LinkedList.h>
@@ -130,9 +134,59 @@ public:
     void SetRequiredSpaceforEvicted(size_t aRequiredSpace) { mRequiredSpaceForEvicted = aRequiredSpace; }
     size_t GetRequiredSpaceforEvicted() const { return mRequiredSpaceForEvicted; }
 
+    /**
+     * @brief
+     *   Record the event number of an event that was just written to the buffer.
+     *
+     * @param[in] aEventNumber  The event number of the event.
+     * @param[in] apEventStart  Where the event starts in the buffer, i.e. the queue tail before it was written.
+     */
+    void IndexEvent(EventNumber aEventNumber, const uint8_t * apEventStart);
+
+    /**
+     * @brief
+     *   Evict the head event, like EvictHead, keeping the event number index in sync.
+     */
+    CHIP_ERROR EvictHeadEvent();
+
+    /**
+     * @brief
+     *   Find where to start reading the buffer to get the events with an event number of at least
+     *   aEventNumber, using the event number index.
+     *
+     * @param[in]  aEventNumber              The smallest event number of interest.
+     * @param[out] aLastSkippedEventNumber   Set to the event number of the last event before the returned
+     *                                       offset, if any event is skipped.
+     *
+     * @return The offset from the head of the buffer: 0 if the index does not cover aEventNumber, and
+     *         DataLength() if all events in the buffer are older than aEventNumber.
+     */
+    uint32_t FindEventOffset(EventNumber aEventNumber, Optional<EventNumber> & aLastSkippedEventNumber) const;
+
     ~CircularEventBuffer() override = default;
 
 private:
+#if CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+    struct IndexEntry
+    {
+        EventNumber mEventNumber;
+        uint32_t mPosition; ///< Logical position of the event, which does not change as the queue head moves
+    };
+
+    const IndexEntry & GetIndexEntry(size_t aIndex) const
+    {
+        return mIndex[(mIndexStart + aIndex) % CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE];
+    }
+    void ResetIndex();
+
+    // Ring of the most recent events of the buffer, in increasing event number order.
+    IndexEntry mIndex[CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE];
+    size_t mIndexStart           = 0;
+    size_t mIndexCount           = 0;
+    uint32_t mHeadPosition       = 0;       ///< Position of the queue head
+    const uint8_t * mIndexedHead = nullptr; ///< Queue head the index was last synced with
+#endif // CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE > 0
+
     CircularEventBuffer * mpPrev = nullptr; ///< A pointer CircularEventBuffer storing events less important events
     CircularEventBuffer * mpNext = nullptr; ///< A pointer CircularEventBuffer storing events more important events
 
@@ -157,6 +211,7 @@ class CircularEventBufferWrapper : public TLV::TLVCircularBuffer
 public:
     CircularEventBufferWrapper() : TLVCircularBuffer(nullptr, 0), mpCurrent(nullptr){};
     CircularEventBuffer * mpCurrent;
+    uint32_t mStartOffset = 0; ///< Offset from the head of mpCurrent at which reading starts
 
 private:
     CHIP_ERROR GetNextBuffer(chip::TLV::TLVReader & aReader, const uint8_t *& aBufStart, uint32_t & aBufLen) override;
@@ -279,6 +334,18 @@ public:
 
     static void DestroyEventManagement();
 
+    /**
+     * @brief
+     *   Set the persistent store that logged events are also written to, or nullptr for none.
+     *
+     * Must be called after Init. If the store holds events numbered at or above the event number
+     * counter, for example because the counter was not persisted, the counter is advanced past
+     * them so that event numbers are never reused.
+     *
+     * @param[in] apEventLogStore  The store, which must outlive its use by EventManagement.
+     */
+    CHIP_ERROR SetEventLogStore(EventLogStore * apEventLogStore);
+
     /**
      * @brief
      *   Log an event via a EventLoggingDelegate, with options.
@@ -309,6 +376,38 @@ public:
      */
     CHIP_ERROR LogEvent(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions, EventNumber & aEventNumber);
 
+    /**
+     * @brief
+     *   Log an event from any thread, without holding the Matter stack lock.
+     *
+     * The event data is serialized by `apDelegate` and the event is timestamped before this
+     * function returns. The event is written to the log, and gets its event number, when the
+     * Matter thread drains the staging queues, which this function schedules. Events are logged
+     * in the order they were staged, and before any event logged afterwards with LogEvent.
+     *
+     * @param[in] apDelegate     The EventLoggingDelegate to serialize the event data
+     * @param[in] aEventOptions  The options for the event metadata.
+     *
+     * @retval #CHIP_NO_ERROR                 The event was staged.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL   The event data is larger than CHIP_CONFIG_EVENT_STAGING_MAX_PAYLOAD_SIZE.
+     * @retval #CHIP_ERROR_NO_MEMORY          The staging queue of the calling thread is full, or no queue is left for it.
+     * @retval #CHIP_ERROR_NOT_IMPLEMENTED    CHIP_CONFIG_EVENT_STAGING_QUEUES is 0.
+     */
+    CHIP_ERROR LogEventFromAnyThread(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions);
+
+    /**
+     * @brief
+     *   Log the events staged by LogEventFromAnyThread. Must be called on the Matter thread; this
+     *   happens automatically after events are staged.
+     */
+    void DrainStagedEvents();
+
+    /**
+     * @brief
+     *   Get the counters of the events logged with LogEventFromAnyThread. May be called from any thread.
+     */
+    EventStagingStats GetStagingStats() const;
+
     /**
      * @brief
      *   A helper method to get tlv reader along with buffer has data from particular priority
@@ -453,15 +552,22 @@ private:
                               const InternalEventOptions * apOptions);
 
     // Internal function to log event
-    CHIP_ERROR LogEventPrivate(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions, EventNumber & aEventNumber);
+    CHIP_ERROR LogEventPrivate(EventLoggingDelegate * apDelegate, const EventOptions & aEventOptions, Timestamp aTimestamp,
+                               EventNumber & aEventNumber);
+
+    // The timestamp of an event logged now
+    Timestamp GetCurrentTimestamp() const;
+
+    static void DrainStagedEventsWork(intptr_t aArg);
 
     /**
      * @brief copy the event outright to next buffer with higher priority
      *
      * @param[in] apEventBuffer  CircularEventBuffer
+     * @param[in] aEventNumber   The event number of the head event of apEventBuffer
      *
      */
-    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer);
+    CHIP_ERROR CopyToNextBuffer(CircularEventBuffer * apEventBuffer, EventNumber aEventNumber);
 
     /**
      * @brief Ensure that:
@@ -479,6 +585,64 @@ private:
      */
     CHIP_ERROR EnsureSpaceInCircularBuffer(size_t aRequiredSpace, PriorityLevel aPriority);
 
+    /**
+     * @brief
+     *   Like GetEventReader for PriorityLevel::Critical, but skips the events that the event number
+     *   indexes of the buffers show to be older than aEventMin.
+     *
+     * @param[out] aReader                  A reference to the reader that will be initialized.
+     * @param[in]  aEventMin                The smallest event number of interest.
+     * @param[in]  apBufWrapper             CircularEventBufferWrapper
+     * @param[out] aLastSkippedEventNumber  Set to the event number of the last skipped event, if any.
+     */
+    CHIP_ERROR GetEventReaderSince(TLV::TLVReader & aReader, EventNumber aEventMin, CircularEventBufferWrapper * apBufWrapper,
+                                   Optional<EventNumber> & aLastSkippedEventNumber);
+
+    /**
+     * @brief
+     *   Get the number of the oldest event of the lowest priority buffer. Every event logged since is
+     *   still in that buffer, only older events may have been dropped from the event buffers.
+     *
+     * @return The event number, or the next event number to be vended if the buffer is empty.
+     */
+    EventNumber GetOldestBufferedEventNumber();
+
+    /**
+     * @brief
+     *   The state of FetchEventsSince while it merges the stored events with the buffered ones.
+     */
+    struct StoredEventsContext
+    {
+        EventLoadOutContext * mpLoadOutContext;
+        TLV::TLVReader * mpBufferReader;          ///< Reads the buffered events
+        bool mHasBufferedEvent           = false; ///< Whether mpBufferReader is on a buffered event not copied yet
+        EventNumber mBufferedEventNumber = 0;     ///< The number of that event
+    };
+
+    /**
+     * @brief
+     *   Copy an event read from the event log store, after the buffered events that come before it.
+     *   Takes a StoredEventsContext.
+     */
+    static CHIP_ERROR CopyStoredEventsSince(const TLV::TLVReader & aReader, size_t aDepth, void * apContext);
+
+    /**
+     * @brief
+     *   Move the buffer reader of aContext to the next buffered event.
+     */
+    static CHIP_ERROR NextBufferedEvent(StoredEventsContext & aContext);
+
+    /**
+     * @brief
+     *   Append an event just written to the lowest priority buffer to the event log store.
+     *
+     * @param[in] apEventStart  The start of the event in the buffer.
+     * @param[in] aEventLength  The length of the event, which may wrap around the end of the buffer.
+     * @param[in] aEventNumber  The number of the event.
+     * @param[in] aFabricIndex  The fabric the event is scoped to.
+     */
+    void StoreEvent(const uint8_t * apEventStart, uint32_t aEventLength, EventNumber aEventNumber, FabricIndex aFabricIndex);
+
     /**
      * @brief Iterate the event elements inside event tlv and mark the fabric index as kUndefinedFabricIndex if
      * it matches the FabricIndex apFabricIndex points to.
@@ -580,6 +744,7 @@ private:
     System::Clock::Milliseconds64 mMonotonicStartupTime{};
 
     EventReporter * mpEventReporter = nullptr;
+    EventLogStore * mpEventLogStore = nullptr;
 };
 
 } // namespace app
@@ -0,0 +1,193 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/EventStagingQueue.h>
+
+#if CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace {
+
+// The staging ring claimed by the current thread, released when the thread exits.
+struct ThreadRing
+{
+    const EventStagingQueue * mpQueue = nullptr;
+    std::atomic<bool> * mpClaimed     = nullptr;
+    size_t mIndex                     = 0;
+
+    void Release()
+    {
+        if (mpClaimed != nullptr)
+        {
+            mpClaimed->store(false, std::memory_order_release);
+        }
+        mpQueue   = nullptr;
+        mpClaimed = nullptr;
+    }
+
+    ~ThreadRing() { Release(); }
+};
+
+thread_local ThreadRing tThreadRing;
+
+} // namespace
+
+CHIP_ERROR EventStagingQueue::StagedEvent::WriteEvent(TLV::TLVWriter & aWriter)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType containerType;
+    reader.Init(mPayload, mPayloadLength);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()));
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(reader.Next());
+    return aWriter.CopyElement(reader);
+}
+
+EventStagingQueue::~EventStagingQueue()
+{
+    if (tThreadRing.mpQueue == this)
+    {
+        tThreadRing.mpQueue   = nullptr;
+        tThreadRing.mpClaimed = nullptr;
+    }
+}
+
+EventStagingQueue::Ring * EventStagingQueue::ClaimRing()
+{
+    if (tThreadRing.mpQueue == this)
+    {
+        return &mRings[tThreadRing.mIndex];
+    }
+
+    // The thread stages into another queue for the first time: give up the ring it had.
+    tThreadRing.Release();
+    for (size_t i = 0; i < CHIP_CONFIG_EVENT_STAGING_QUEUES; i++)
+    {
+        bool claimed = false;
+        // Acquire what the previous owner of the ring produced.
+        if (mRings[i].mClaimed.compare_exchange_strong(claimed, true, std::memory_order_acq_rel))
+        {
+            tThreadRing.mpQueue   = this;
+            tThreadRing.mpClaimed = &mRings[i].mClaimed;
+            tThreadRing.mIndex    = i;
+            return &mRings[i];
+        }
+    }
+    return nullptr;
+}
+
+CHIP_ERROR EventStagingQueue::Stage(EventLoggingDelegate & aDelegate, const EventOptions & aOptions, Timestamp aTimestamp)
+{
+    Ring * const ring = ClaimRing();
+    if (ring == nullptr)
+    {
+        mDroppedNoQueue.fetch_add(1, std::memory_order_relaxed);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    const uint32_t tail = ring->mTail.load(std::memory_order_relaxed);
+    if (tail - ring->mHead.load(std::memory_order_acquire) == kQueueSize)
+    {
+        mDroppedQueueFull.fetch_add(1, std::memory_order_relaxed);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    StagedEvent & event = ring->mSlots[tail % kQueueSize];
+    TLV::TLVWriter writer;
+    TLV::TLVType containerType;
+    writer.Init(event.mPayload, sizeof(event.mPayload));
+
+    // Delegates write the event data inside the EventDataIB structure, so stage it inside a structure too.
+    CHIP_ERROR err = writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType);
+    SuccessOrExit(err);
+    err = aDelegate.WriteEvent(writer);
+    SuccessOrExit(err);
+    err = writer.EndContainer(containerType);
+    SuccessOrExit(err);
+    err = writer.Finalize();
+    SuccessOrExit(err);
+
+    event.mOptions       = aOptions;
+    event.mTimestamp     = aTimestamp;
+    event.mPayloadLength = writer.GetLengthWritten();
+    event.mSequence      = mNextSequence.fetch_add(1, std::memory_order_relaxed);
+    ring->mTail.store(tail + 1, std::memory_order_release);
+    mStaged.fetch_add(1, std::memory_order_relaxed);
+
+exit:
+    if (err == CHIP_ERROR_BUFFER_TOO_SMALL || err == CHIP_ERROR_NO_MEMORY)
+    {
+        mDroppedTooLarge.fetch_add(1, std::memory_order_relaxed);
+        err = CHIP_ERROR_BUFFER_TOO_SMALL;
+    }
+    return err;
+}
+
+EventStagingQueue::StagedEvent * EventStagingQueue::Front()
+{
+    StagedEvent * front = nullptr;
+    mpFrontRing         = nullptr;
+
+    for (auto & ring : mRings)
+    {
+        const uint32_t head = ring.mHead.load(std::memory_order_relaxed);
+        if (head == ring.mTail.load(std::memory_order_acquire))
+        {
+            continue;
+        }
+
+        StagedEvent & event = ring.mSlots[head % kQueueSize];
+        if (front == nullptr || event.mSequence < front->mSequence)
+        {
+            front       = &event;
+            mpFrontRing = &ring;
+        }
+    }
+    return front;
+}
+
+void EventStagingQueue::PopFront(bool aLogged)
+{
+    VerifyOrReturn(mpFrontRing != nullptr);
+
+    mpFrontRing->mHead.store(mpFrontRing->mHead.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    mpFrontRing = nullptr;
+    (aLogged ? mLogged : mDroppedLogFailed).fetch_add(1, std::memory_order_relaxed);
+}
+
+EventStagingStats EventStagingQueue::GetStats() const
+{
+    EventStagingStats stats;
+    stats.mStaged           = mStaged.load(std::memory_order_relaxed);
+    stats.mLogged           = mLogged.load(std::memory_order_relaxed);
+    stats.mDroppedQueueFull = mDroppedQueueFull.load(std::memory_order_relaxed);
+    stats.mDroppedTooLarge  = mDroppedTooLarge.load(std::memory_order_relaxed);
+    stats.mDroppedNoQueue   = mDroppedNoQueue.load(std::memory_order_relaxed);
+    stats.mDroppedLogFailed = mDroppedLogFailed.load(std::memory_order_relaxed);
+    return stats;
+}
+
+} // namespace app
+} // namespace chip
+
+#endif // CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
@@ -0,0 +1,163 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/EventLoggingDelegate.h>
+#include <app/EventLoggingTypes.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+/**
+ * Counters of the events logged with EventManagement::LogEventFromAnyThread.
+ */
+struct EventStagingStats
+{
+    uint64_t mStaged           = 0; ///< Events serialized into a staging queue
+    uint64_t mLogged           = 0; ///< Staged events written to the event log
+    uint64_t mDroppedQueueFull = 0; ///< Events dropped because the staging queue of their thread was full
+    uint64_t mDroppedTooLarge  = 0; ///< Events dropped because their data did not fit in a staging queue slot
+    uint64_t mDroppedNoQueue   = 0; ///< Events dropped because all staging queues were claimed by other threads
+    uint64_t mDroppedLogFailed = 0; ///< Staged events that could not be written to the event log
+};
+
+#if CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+
+/**
+ * Holds events logged outside of the Matter thread until the Matter thread writes them to the
+ * event log.
+ *
+ * Every thread that stages events claims one of CHIP_CONFIG_EVENT_STAGING_QUEUES single-producer,
+ * single-consumer rings until it exits, so staging never waits for other threads or for the
+ * Matter thread. The event data is serialized when the event is staged. The Matter thread takes
+ * events out of all rings in the order they were staged.
+ *
+ * The queue must outlive the threads that stage events into it, except for the thread that
+ * destroys it.
+ */
+class EventStagingQueue
+{
+public:
+    static constexpr size_t kQueueSize      = CHIP_CONFIG_EVENT_STAGING_QUEUE_SIZE;
+    static constexpr size_t kMaxPayloadSize = CHIP_CONFIG_EVENT_STAGING_MAX_PAYLOAD_SIZE;
+
+    static_assert(kQueueSize > 0 && (kQueueSize & (kQueueSize - 1)) == 0,
+                  "CHIP_CONFIG_EVENT_STAGING_QUEUE_SIZE must be a power of 2");
+
+    /**
+     * An event waiting in a staging queue. Logging it as an EventLoggingDelegate writes the
+     * event data captured when it was staged.
+     */
+    class StagedEvent : public EventLoggingDelegate
+    {
+    public:
+        CHIP_ERROR WriteEvent(TLV::TLVWriter & aWriter) override;
+
+        const EventOptions & GetOptions() const { return mOptions; }
+        Timestamp GetTimestamp() const { return mTimestamp; }
+
+    private:
+        friend class EventStagingQueue;
+
+        EventOptions mOptions;
+        Timestamp mTimestamp;
+        uint64_t mSequence      = 0;
+        uint32_t mPayloadLength = 0;
+        uint8_t mPayload[kMaxPayloadSize];
+    };
+
+    EventStagingQueue() = default;
+    ~EventStagingQueue();
+
+    EventStagingQueue(const EventStagingQueue &)             = delete;
+    EventStagingQueue & operator=(const EventStagingQueue &) = delete;
+
+    /**
+     * Serialize an event into the staging queue of the calling thread. May be called from any thread.
+     *
+     * @retval #CHIP_NO_ERROR on success.
+     * @retval #CHIP_ERROR_BUFFER_TOO_SMALL if the event data does not fit in a slot.
+     * @retval #CHIP_ERROR_NO_MEMORY if the queue of the calling thread is full, or if all queues are
+     *         claimed by other threads.
+     * @retval other errors returned by aDelegate.
+     */
+    CHIP_ERROR Stage(EventLoggingDelegate & aDelegate, const EventOptions & aOptions, Timestamp aTimestamp);
+
+    /**
+     * Returns the event that was staged first among the events in all queues, or nullptr if there
+     * is none. Only the consuming thread may call this.
+     */
+    StagedEvent * Front();
+
+    /**
+     * Removes the event returned by the last call to Front. Only the consuming thread may call this.
+     *
+     * @param[in] aLogged  Whether the event was written to the event log, for the statistics.
+     */
+    void PopFront(bool aLogged);
+
+    /**
+     * Marks that draining the queues is pending. Returns true if it was not already, in which case
+     * the caller must arrange for the consuming thread to drain the queues.
+     */
+    bool RequestDrain() { return !mDrainRequested.exchange(true, std::memory_order_acq_rel); }
+
+    /**
+     * Called by the consuming thread before it drains the queues, so that events staged from then
+     * on request another drain.
+     */
+    void StartDrain() { mDrainRequested.store(false, std::memory_order_seq_cst); }
+
+    EventStagingStats GetStats() const;
+
+private:
+    struct Ring
+    {
+        std::atomic<bool> mClaimed{ false };
+        std::atomic<uint32_t> mHead{ 0 }; ///< Next slot to consume, written by the consumer
+        std::atomic<uint32_t> mTail{ 0 }; ///< Next slot to produce, written by the producer
+        StagedEvent mSlots[kQueueSize];
+    };
+
+    Ring * ClaimRing();
+
+    Ring mRings[CHIP_CONFIG_EVENT_STAGING_QUEUES];
+    Ring * mpFrontRing = nullptr;
+
+    std::atomic<uint64_t> mNextSequence{ 0 };
+    std::atomic<bool> mDrainRequested{ false };
+
+    std::atomic<uint64_t> mStaged{ 0 };
+    std::atomic<uint64_t> mLogged{ 0 };
+    std::atomic<uint64_t> mDroppedQueueFull{ 0 };
+    std::atomic<uint64_t> mDroppedTooLarge{ 0 };
+    std::atomic<uint64_t> mDroppedNoQueue{ 0 };
+    std::atomic<uint64_t> mDroppedLogFailed{ 0 };
+};
+
+#endif // CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+
+} // namespace app
+} // namespace chip
@@ -119,6 +119,8 @@ void ReadHandler::OnSubscriptionResumed(const SessionHandle & sessionHandle,
         }
     }
 
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReadHandlerAttributePathsSet(*this);
+
     mSessionHandle.Grab(sessionHandle);
 
     SetStateFlag(ReadHandlerFlags::ActiveSubscription);
@@ -159,6 +161,7 @@ ReadHandler::~ReadHandler()
     {
         mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReportConfirm();
     }
+    mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReadHandlerAttributePathsReleased(*this);
     mManagementCallback.GetInteractionModelEngine()->ReleaseAttributePathList(mpAttributePathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseEventPathList(mpEventPathList);
     mManagementCallback.GetInteractionModelEngine()->ReleaseDataVersionFilterList(mpDataVersionFilterList);
@@ -528,6 +531,7 @@ CHIP_ERROR ReadHandler::ProcessAttributePaths(AttributePathIBs::Parser & aAttrib
     if (CHIP_END_OF_TLV == err)
     {
         mManagementCallback.GetInteractionModelEngine()->RemoveDuplicateConcreteAttributePath(mpAttributePathList);
+        mManagementCallback.GetInteractionModelEngine()->GetReportingEngine().OnReadHandlerAttributePathsSet(*this);
         mAttributePathExpandPosition = AttributePathExpandIterator::Position::StartIterating(mpAttributePathList);
         err                          = CHIP_NO_ERROR;
     }
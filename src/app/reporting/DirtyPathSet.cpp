@@ -0,0 +1,326 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyPathSet.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+DirtyPathSet::~DirtyPathSet()
+{
+    mEntries.ReleaseAll();
+    if (mBuckets != mInlineBuckets)
+    {
+        Platform::MemoryFree(mBuckets);
+    }
+}
+
+size_t DirtyPathSet::BucketIndex(EndpointId aEndpointId, ClusterId aClusterId) const
+{
+    // Cluster ids carry most of their entropy in the low bits (or in the vendor prefix for MEIs), and endpoint ids are
+    // small, so mix both before masking.
+    uint32_t hash = aClusterId ^ (static_cast<uint32_t>(aEndpointId) * 0x9E3779B1u);
+    hash ^= hash >> 15;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    return hash & (mBucketCount - 1);
+}
+
+DirtyPathSet::Entry *& DirtyPathSet::ChainFor(const AttributePathParams & aPath)
+{
+    if (!IsIndexed(aPath))
+    {
+        return mWildcardEntries;
+    }
+    return mBuckets[BucketIndex(aPath.mEndpointId, aPath.mClusterId)];
+}
+
+void DirtyPathSet::Link(Entry * apEntry)
+{
+    Entry *& head          = ChainFor(*apEntry);
+    apEntry->mpNextInChain = head;
+    head                   = apEntry;
+}
+
+void DirtyPathSet::Unlink(Entry * apEntry)
+{
+    for (Entry ** link = &ChainFor(*apEntry); *link != nullptr; link = &(*link)->mpNextInChain)
+    {
+        if (*link == apEntry)
+        {
+            *link                  = apEntry->mpNextInChain;
+            apEntry->mpNextInChain = nullptr;
+            return;
+        }
+    }
+    VerifyOrDie(false);
+}
+
+void DirtyPathSet::UpdatePath(Entry * apEntry, const AttributePathParams & aPath)
+{
+    Unlink(apEntry);
+    static_cast<AttributePathParams &>(*apEntry) = aPath;
+    Link(apEntry);
+}
+
+void DirtyPathSet::GrowIfNeeded()
+{
+    // Keep the average chain length at most 2. Fixed-size pools never get here, since the inline table is sized for them.
+    VerifyOrReturn(mEntries.Allocated() > 2 * mBucketCount && mBucketCount < kMaxBucketCount);
+
+    size_t newCount = mBucketCount * 4;
+    auto newBuckets = static_cast<Entry **>(Platform::MemoryCalloc(newCount, sizeof(Entry *)));
+    // Running with longer chains is still correct, just slower.
+    VerifyOrReturn(newBuckets != nullptr);
+
+    if (mBuckets != mInlineBuckets)
+    {
+        Platform::MemoryFree(mBuckets);
+    }
+    mBuckets     = newBuckets;
+    mBucketCount = newCount;
+
+    mEntries.ForEachActiveObject([&](Entry * entry) {
+        if (IsIndexed(*entry))
+        {
+            Entry *& head        = mBuckets[BucketIndex(entry->mEndpointId, entry->mClusterId)];
+            entry->mpNextInChain = head;
+            head                 = entry;
+        }
+        return Loop::Continue;
+    });
+}
+
+DirtyPathSet::Entry * DirtyPathSet::Insert(const AttributePathParams & aPath, AttributeGeneration aGeneration)
+{
+    Entry * entry = mEntries.CreateObject(aPath);
+    VerifyOrReturnValue(entry != nullptr, nullptr);
+    entry->mGeneration = aGeneration;
+    Link(entry);
+    GrowIfNeeded();
+    return entry;
+}
+
+void DirtyPathSet::Release(Entry * apEntry)
+{
+    Unlink(apEntry);
+    mEntries.ReleaseObject(apEntry);
+}
+
+void DirtyPathSet::ReleaseAll()
+{
+    mEntries.ReleaseAll();
+    for (size_t i = 0; i < mBucketCount; i++)
+    {
+        mBuckets[i] = nullptr;
+    }
+    mWildcardEntries = nullptr;
+}
+
+bool DirtyPathSet::MergeOverlapped(const AttributePathParams & aPath, AttributeGeneration aGeneration)
+{
+    // Only a wildcard entry can cover a path in another chain.
+    for (Entry * entry = mWildcardEntries; entry != nullptr; entry = entry->mpNextInChain)
+    {
+        if (entry->IsAttributePathSupersetOf(aPath))
+        {
+            entry->mGeneration = aGeneration;
+            return true;
+        }
+    }
+
+    if (IsIndexed(aPath))
+    {
+        Entry *& head = ChainFor(aPath);
+        for (Entry * entry = head; entry != nullptr; entry = entry->mpNextInChain)
+        {
+            if (entry->IsAttributePathSupersetOf(aPath))
+            {
+                entry->mGeneration = aGeneration;
+                return true;
+            }
+        }
+
+        // A concrete (endpoint, cluster) path can only cover entries of the same chain; those keep their chain when widened.
+        Entry * merged = nullptr;
+        for (Entry ** link = &head; *link != nullptr;)
+        {
+            Entry * entry = *link;
+            if (!aPath.IsAttributePathSupersetOf(*entry))
+            {
+                link = &entry->mpNextInChain;
+                continue;
+            }
+            if (merged == nullptr)
+            {
+                merged                                     = entry;
+                static_cast<AttributePathParams &>(*entry) = aPath;
+                entry->mGeneration                         = aGeneration;
+                link                                       = &entry->mpNextInChain;
+                continue;
+            }
+            *link = entry->mpNextInChain;
+            mEntries.ReleaseObject(entry);
+        }
+        return merged != nullptr;
+    }
+
+    // A wildcard path may cover entries anywhere; these are rare enough that a full scan is fine.
+    Entry * merged = nullptr;
+    mEntries.ForEachActiveObject([&](Entry * entry) {
+        if (aPath.IsAttributePathSupersetOf(*entry))
+        {
+            if (merged == nullptr)
+            {
+                merged             = entry;
+                entry->mGeneration = aGeneration;
+                UpdatePath(entry, aPath);
+            }
+            else
+            {
+                Release(entry);
+            }
+        }
+        return Loop::Continue;
+    });
+    return merged != nullptr;
+}
+
+bool DirtyPathSet::ReleaseTombs()
+{
+    bool pathReleased = false;
+    mEntries.ForEachActiveObject([&](Entry * entry) {
+        if (entry->mGeneration.IsZero())
+        {
+            Release(entry);
+            pathReleased = true;
+        }
+        return Loop::Continue;
+    });
+    return pathReleased;
+}
+
+bool DirtyPathSet::MergePathsUnderSameCluster()
+{
+    // Entries with the same endpoint and cluster always share a chain, so only compare entries within each chain.
+    auto mergeChain = [](Entry * head) {
+        for (Entry * outerPath = head; outerPath != nullptr; outerPath = outerPath->mpNextInChain)
+        {
+            if (outerPath->HasWildcardClusterId() || outerPath->mGeneration.IsZero())
+            {
+                continue;
+            }
+            for (Entry * innerPath = outerPath->mpNextInChain; innerPath != nullptr; innerPath = innerPath->mpNextInChain)
+            {
+                // We don't support paths with a wildcard endpoint + a concrete cluster in global dirty set, so we do a simple ==
+                // check here.
+                if (innerPath->mGeneration.IsZero() || innerPath->mEndpointId != outerPath->mEndpointId ||
+                    innerPath->mClusterId != outerPath->mClusterId)
+                {
+                    continue;
+                }
+                if (innerPath->mGeneration.After(outerPath->mGeneration))
+                {
+                    outerPath->mGeneration = innerPath->mGeneration;
+                }
+                // Endpoint and cluster are unchanged, so the entry stays in its chain.
+                outerPath->SetWildcardAttributeId();
+
+                // Mark the path as a tomb by setting its generation to 0 and clear it once all chains are merged.
+                innerPath->mGeneration.Clear();
+            }
+        }
+    };
+
+    for (size_t i = 0; i < mBucketCount; i++)
+    {
+        mergeChain(mBuckets[i]);
+    }
+    mergeChain(mWildcardEntries);
+
+    return ReleaseTombs();
+}
+
+bool DirtyPathSet::MergePathsUnderSameEndpoint()
+{
+    mEntries.ForEachActiveObject([&](Entry * outerPath) {
+        if (outerPath->HasWildcardEndpointId() || outerPath->mGeneration.IsZero())
+        {
+            return Loop::Continue;
+        }
+        bool merged = false;
+        mEntries.ForEachActiveObject([&](Entry * innerPath) {
+            if (innerPath == outerPath || innerPath->mGeneration.IsZero())
+            {
+                return Loop::Continue;
+            }
+            if (innerPath->mEndpointId != outerPath->mEndpointId)
+            {
+                return Loop::Continue;
+            }
+            if (innerPath->mGeneration.After(outerPath->mGeneration))
+            {
+                outerPath->mGeneration = innerPath->mGeneration;
+            }
+            merged = true;
+
+            // Mark the path as a tomb by setting its generation to 0 and clear it once the iteration is done.
+            innerPath->mGeneration.Clear();
+            return Loop::Continue;
+        });
+        if (merged)
+        {
+            // The entry becomes a wildcard cluster path, which moves it to the wildcard list.
+            AttributePathParams mergedPath = *outerPath;
+            mergedPath.SetWildcardClusterId();
+            mergedPath.SetWildcardAttributeId();
+            UpdatePath(outerPath, mergedPath);
+        }
+        return Loop::Continue;
+    });
+
+    return ReleaseTombs();
+}
+
+bool DirtyPathSet::IsDirtySince(const ConcreteAttributePath & aPath, AttributeGeneration aGeneration) const
+{
+    for (const Entry * entry = mBuckets[BucketIndex(aPath.mEndpointId, aPath.mClusterId)]; entry != nullptr;
+         entry               = entry->mpNextInChain)
+    {
+        if (entry->mGeneration.After(aGeneration) && entry->IsAttributePathSupersetOf(aPath))
+        {
+            return true;
+        }
+    }
+    for (const Entry * entry = mWildcardEntries; entry != nullptr; entry = entry->mpNextInChain)
+    {
+        if (entry->mGeneration.After(aGeneration) && entry->IsAttributePathSupersetOf(aPath))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -0,0 +1,171 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <app/ConcreteAttributePath.h>
+#include <app/reporting/Generations.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/support/Pool.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+struct AttributePathParamsWithGeneration : public AttributePathParams
+{
+    AttributePathParamsWithGeneration() = default;
+    AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
+
+    AttributeGeneration mGeneration;
+
+private:
+    friend class DirtyPathSet;
+
+    // Next entry in the same index chain (an (endpoint, cluster) bucket, or the wildcard list).
+    AttributePathParamsWithGeneration * mpNextInChain = nullptr;
+};
+
+// Smallest power of two that is at least as large as the given number of dirty paths.
+constexpr size_t ComputeDirtyPathBucketCount(size_t poolSize)
+{
+    size_t count = 1;
+    while (count < poolSize)
+    {
+        count <<= 1;
+    }
+    return count;
+}
+
+/**
+ * The set of attribute paths that were marked dirty for reporting, along with the generation at which each was
+ * last marked dirty.
+ *
+ * Paths with a concrete endpoint and cluster are indexed in a hash table keyed by (endpoint, cluster), so that
+ * inserting or merging a concrete path and checking whether a concrete path is dirty only touch the entries for that
+ * cluster (plus any wildcard entries), instead of the whole set. Paths with a wildcard endpoint or cluster are kept
+ * in a separate list that is consulted on every lookup; they are expected to be rare.
+ *
+ * When the entries are heap allocated (CHIP_SYSTEM_CONFIG_POOL_USE_HEAP), the set never runs out of space and the hash
+ * table grows with the number of entries, so high-rate changes across many clusters keep their precision instead of
+ * degrading into wildcard paths. With a fixed-size pool, callers use MergePathsUnderSameCluster() and
+ * MergePathsUnderSameEndpoint() to make room once the pool is exhausted.
+ */
+class DirtyPathSet
+{
+public:
+    using Entry = AttributePathParamsWithGeneration;
+
+    DirtyPathSet() = default;
+    ~DirtyPathSet();
+
+    DirtyPathSet(const DirtyPathSet &)             = delete;
+    DirtyPathSet & operator=(const DirtyPathSet &) = delete;
+
+    /**
+     * Adds aPath to the set as a new entry, without trying to merge it with existing entries.
+     *
+     * Returns nullptr if the set is full.
+     */
+    Entry * Insert(const AttributePathParams & aPath, AttributeGeneration aGeneration);
+
+    void Release(Entry * apEntry);
+    void ReleaseAll();
+
+    size_t Allocated() const { return mEntries.Allocated(); }
+    bool Exhausted() const { return mEntries.Exhausted(); }
+
+    /**
+     * Iterates over all entries. The callback may read entries, but must not modify their paths, since that would
+     * leave them in the wrong index chain. Releasing entries through Release() during iteration is allowed.
+     */
+    template <typename Function>
+    Loop ForEachActiveObject(Function && function) const
+    {
+        return mEntries.ForEachActiveObject(std::forward<Function>(function));
+    }
+
+    /**
+     * If an existing entry is a superset of aPath, update its generation. Otherwise, if aPath is a superset of one or
+     * more existing entries, replace them with a single entry for aPath.
+     *
+     * Returns whether aPath is now covered by an entry of the set.
+     */
+    bool MergeOverlapped(const AttributePathParams & aPath, AttributeGeneration aGeneration);
+
+    /**
+     * Merges entries that share an endpoint and a cluster into a single wildcard attribute entry.
+     *
+     * Returns whether any entry was released.
+     */
+    bool MergePathsUnderSameCluster();
+
+    /**
+     * Merges entries that share an endpoint into a single wildcard cluster entry.
+     *
+     * Returns whether any entry was released.
+     */
+    bool MergePathsUnderSameEndpoint();
+
+    /**
+     * Returns whether aPath is covered by an entry that was marked dirty after aGeneration.
+     */
+    bool IsDirtySince(const ConcreteAttributePath & aPath, AttributeGeneration aGeneration) const;
+
+private:
+    // Upper bound on the hash table size when it grows with the number of heap allocated entries.
+    static constexpr size_t kMaxBucketCount    = 4096;
+    static constexpr size_t kInlineBucketCount = ComputeDirtyPathBucketCount(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET);
+
+    static bool IsIndexed(const AttributePathParams & aPath)
+    {
+        return !aPath.HasWildcardEndpointId() && !aPath.HasWildcardClusterId();
+    }
+
+    size_t BucketIndex(EndpointId aEndpointId, ClusterId aClusterId) const;
+    Entry *& ChainFor(const AttributePathParams & aPath);
+
+    void Link(Entry * apEntry);
+    void Unlink(Entry * apEntry);
+    // Changes the path of an entry, moving it to the index chain of the new path.
+    void UpdatePath(Entry * apEntry, const AttributePathParams & aPath);
+    // Releases entries that were marked as tombs (zero generation) during a merge.
+    bool ReleaseTombs();
+    void GrowIfNeeded();
+
+#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
+    // For unit tests, always use inline allocation for code coverage.
+    ObjectPool<Entry, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mEntries;
+#else
+    ObjectPool<Entry, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mEntries;
+#endif
+
+    Entry * mInlineBuckets[kInlineBucketCount] = {};
+    Entry ** mBuckets                          = mInlineBuckets;
+    size_t mBucketCount                        = kInlineBucketCount;
+    Entry * mWildcardEntries                   = nullptr;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
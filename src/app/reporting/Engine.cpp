@@ -401,21 +401,9 @@ CHIP_ERROR Engine::BuildSingleReportDataAttributeReportIBs(ReportDataMessage::Bu
         {
             if (!apReadHandler->IsPriming())
             {
-                bool concretePathDirty = false;
-                // TODO: Optimize this implementation by making the iterator only emit intersected paths.
-                mGlobalDirtySet.ForEachActiveObject([&](auto * dirtyPath) {
-                    if (dirtyPath->IsAttributePathSupersetOf(readPath))
-                    {
-                        // We don't need to worry about paths that were already marked dirty before the last time this read handler
-                        // started a report that it completed: those paths already got reported.
-                        if (dirtyPath->mGeneration.After(apReadHandler->mPreviousReportsBeginGeneration))
-                        {
-                            concretePathDirty = true;
-                            return Loop::Break;
-                        }
-                    }
-                    return Loop::Continue;
-                });
+                // We don't need to worry about paths that were already marked dirty before the last time this read handler
+                // started a report that it completed: those paths already got reported.
+                bool concretePathDirty = mGlobalDirtySet.IsDirtySince(readPath, apReadHandler->mPreviousReportsBeginGeneration);
 
                 if (!concretePathDirty)
                 {
@@ -965,164 +953,85 @@ void Engine::Run()
 
 bool Engine::MergeOverlappedAttributePath(const AttributePathParams & aAttributePath)
 {
-    return Loop::Break == mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->IsAttributePathSupersetOf(aAttributePath))
-        {
-            path->mGeneration = GetDirtySetGeneration();
-            return Loop::Break;
-        }
-        if (aAttributePath.IsAttributePathSupersetOf(*path))
-        {
-            // TODO: the wildcard input path may be superset of next paths in globalDirtySet, it is fine at this moment, since
-            // when building report, it would use the first path of globalDirtySet to compare against interested paths read clients
-            // want.
-            // It is better to eliminate the duplicate wildcard paths in follow-up
-            path->mGeneration  = GetDirtySetGeneration();
-            path->mEndpointId  = aAttributePath.mEndpointId;
-            path->mClusterId   = aAttributePath.mClusterId;
-            path->mListIndex   = aAttributePath.mListIndex;
-            path->mAttributeId = aAttributePath.mAttributeId;
-            return Loop::Break;
-        }
-        return Loop::Continue;
-    });
-}
-
-bool Engine::ClearTombPaths()
-{
-    bool pathReleased = false;
-    mGlobalDirtySet.ForEachActiveObject([&](auto * path) {
-        if (path->mGeneration.IsZero())
-        {
-            mGlobalDirtySet.ReleaseObject(path);
-            pathReleased = true;
-        }
-        return Loop::Continue;
-    });
-    return pathReleased;
-}
-
-bool Engine::MergeDirtyPathsUnderSameCluster()
-{
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardClusterId() || outerPath->mGeneration.IsZero())
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            // We don't support paths with a wildcard endpoint + a concrete cluster in global dirty set, so we do a simple == check
-            // here.
-            if (innerPath->mEndpointId != outerPath->mEndpointId || innerPath->mClusterId != outerPath->mClusterId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration.After(outerPath->mGeneration))
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration.Clear();
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-
-    return ClearTombPaths();
-}
-
-bool Engine::MergeDirtyPathsUnderSameEndpoint()
-{
-    mGlobalDirtySet.ForEachActiveObject([&](auto * outerPath) {
-        if (outerPath->HasWildcardEndpointId() || outerPath->mGeneration.IsZero())
-        {
-            return Loop::Continue;
-        }
-        mGlobalDirtySet.ForEachActiveObject([&](auto * innerPath) {
-            if (innerPath == outerPath)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mEndpointId != outerPath->mEndpointId)
-            {
-                return Loop::Continue;
-            }
-            if (innerPath->mGeneration.After(outerPath->mGeneration))
-            {
-                outerPath->mGeneration = innerPath->mGeneration;
-            }
-            outerPath->SetWildcardClusterId();
-            outerPath->SetWildcardAttributeId();
-
-            // The object pool does not allow us to release objects in a nested iteration, mark the path as a tomb by setting its
-            // generation to 0 and then clear it later.
-            innerPath->mGeneration.Clear();
-            return Loop::Continue;
-        });
-        return Loop::Continue;
-    });
-    return ClearTombPaths();
+    return mGlobalDirtySet.MergeOverlapped(aAttributePath, GetDirtySetGeneration());
 }
 
 CHIP_ERROR Engine::InsertPathIntoDirtySet(const AttributePathParams & aAttributePath)
 {
     VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
 
-    if (mGlobalDirtySet.Exhausted() && !MergeDirtyPathsUnderSameCluster() && !MergeDirtyPathsUnderSameEndpoint())
+    if (mGlobalDirtySet.Exhausted() && !mGlobalDirtySet.MergePathsUnderSameCluster() &&
+        !mGlobalDirtySet.MergePathsUnderSameEndpoint())
     {
         ChipLogDetail(DataManagement, "Global dirty set pool exhausted, merge all paths.");
         mGlobalDirtySet.ReleaseAll();
-        auto object         = mGlobalDirtySet.CreateObject();
-        object->mGeneration = GetDirtySetGeneration();
+        mGlobalDirtySet.Insert(AttributePathParams(), GetDirtySetGeneration());
     }
 
     VerifyOrReturnError(!MergeOverlappedAttributePath(aAttributePath), CHIP_NO_ERROR);
     ChipLogDetail(DataManagement, "Cannot merge the new path into any existing path, create one.");
 
-    auto object = mGlobalDirtySet.CreateObject();
-    if (object == nullptr)
+    if (mGlobalDirtySet.Insert(aAttributePath, GetDirtySetGeneration()) == nullptr)
     {
         // This should not happen, this path should be merged into the wildcard endpoint at least.
         ChipLogError(DataManagement, "mGlobalDirtySet pool full, cannot handle more entries!");
         return CHIP_ERROR_NO_MEMORY;
     }
-    *object             = aAttributePath;
-    object->mGeneration = GetDirtySetGeneration();
 
     return CHIP_NO_ERROR;
 }
 
+void Engine::OnReadHandlerAttributePathsSet(ReadHandler & aReadHandler)
+{
+#if CHIP_CONFIG_IM_ENABLE_READ_HANDLER_INTEREST_INDEX
+    // Re-indexing replaces any earlier paths of this read handler. On failure the index falls back to checking all read
+    // handlers, so there is nothing else to do here.
+    mReadHandlerInterestIndex.Remove(aReadHandler);
+    RETURN_SAFELY_IGNORED mReadHandlerInterestIndex.Add(aReadHandler, aReadHandler.GetAttributePathList());
+#endif
+}
+
+void Engine::OnReadHandlerAttributePathsReleased(ReadHandler & aReadHandler)
+{
+#if CHIP_CONFIG_IM_ENABLE_READ_HANDLER_INTEREST_INDEX
+    mReadHandlerInterestIndex.Remove(aReadHandler);
+#endif
+}
+
 CHIP_ERROR Engine::SetDirty(const AttributePathParams & aAttributePath)
 {
     BumpDirtySetGeneration();
 
     bool intersectsInterestPath     = false;
     DataModel::Provider * dataModel = mpImEngine->GetDataModelProvider();
-    mpImEngine->mReadHandlers.ForEachActiveObject([&dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
+    auto markHandlerDirty           = [&dataModel, &aAttributePath, &intersectsInterestPath](ReadHandler * handler) {
         // We call AttributePathIsDirty for both read interactions and subscribe interactions, since we may send inconsistent
         // attribute data between two chunks. AttributePathIsDirty will not schedule a new run for read handlers which are
         // waiting for a response to the last message chunk for read interactions.
         if (handler->CanStartReporting() || handler->IsAwaitingReportResponse())
         {
+            handler->AttributePathIsDirty(dataModel, aAttributePath);
+            intersectsInterestPath = true;
+        }
+    };
+
+#if CHIP_CONFIG_IM_ENABLE_READ_HANDLER_INTEREST_INDEX
+    if (!mReadHandlerInterestIndex.ForEachInterestedHandler(aAttributePath, markHandlerDirty))
+#endif
+    {
+        mpImEngine->mReadHandlers.ForEachActiveObject([&aAttributePath, &markHandlerDirty](ReadHandler * handler) {
             for (auto object = handler->GetAttributePathList(); object != nullptr; object = object->mpNext)
             {
                 if (object->mValue.Intersects(aAttributePath))
                 {
-                    handler->AttributePathIsDirty(dataModel, aAttributePath);
-                    intersectsInterestPath = true;
+                    markHandlerDirty(handler);
                     break;
                 }
             }
-        }
 
-        return Loop::Continue;
-    });
+            return Loop::Continue;
+        });
+    }
 
     if (!intersectsInterestPath)
     {
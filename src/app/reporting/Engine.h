@@ -29,7 +29,9 @@
 #include <app/EventReporter.h>
 #include <app/MessageDef/ReportDataMessage.h>
 #include <app/ReadHandler.h>
+#include <app/reporting/DirtyPathSet.h>
 #include <app/reporting/Generations.h>
+#include <app/reporting/ReadHandlerInterestIndex.h>
 #include <app/util/basic-types.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/support/CodeUtils.h>
@@ -101,6 +103,17 @@ public:
      */
     CHIP_ERROR SetDirty(const AttributePathParams & aAttributePathParams);
 
+    /**
+     * Should be invoked once the attribute path list of a read handler is final, so that SetDirty can find the read handler
+     * without walking the path lists of all read handlers.
+     */
+    void OnReadHandlerAttributePathsSet(ReadHandler & aReadHandler);
+
+    /**
+     * Should be invoked before the attribute path list of a read handler is released.
+     */
+    void OnReadHandlerAttributePathsReleased(ReadHandler & aReadHandler);
+
     /*
      * Resets the tracker that tracks the currently serviced read handler.
      * apReadHandler can be non-null to indicate that the reset is due to a
@@ -146,14 +159,6 @@ private:
 
     bool IsRunScheduled() const { return mRunScheduled; }
 
-    struct AttributePathParamsWithGeneration : public AttributePathParams
-    {
-        AttributePathParamsWithGeneration() = default;
-        AttributePathParamsWithGeneration(const AttributePathParams aPath) : AttributePathParams(aPath) {}
-
-        AttributeGeneration mGeneration;
-    };
-
     /**
      * Build Single Report Data including attribute changes and event data stream, and send out
      *
@@ -212,29 +217,6 @@ private:
      */
     bool MergeOverlappedAttributePath(const AttributePathParams & aAttributePath);
 
-    /**
-     * If we are running out of ObjectPool for the global dirty set, we will try to merge the existing items by clusters.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool MergeDirtyPathsUnderSameCluster();
-
-    /**
-     * If we are running out of ObjectPool for the global dirty set and we cannot find a slot after merging the existing items by
-     * clusters, we will try to merge the existing items by endpoints.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool MergeDirtyPathsUnderSameEndpoint();
-
-    /**
-     * During the iterating of the paths, releasing the object in the inner loop will cause undefined behavior of the ObjectPool, so
-     * we replace the items to be cleared by a tomb first, then clear all the tombs after the iteration.
-     *
-     * Returns whether we have released any paths.
-     */
-    bool ClearTombPaths();
-
     CHIP_ERROR InsertPathIntoDirtySet(const AttributePathParams & aAttributePath);
 
     inline void BumpDirtySetGeneration() { mDirtyGeneration.Increment(); }
@@ -267,11 +249,10 @@ private:
      *  mGlobalDirtySet is used to track the set of attribute/event paths marked dirty for reporting purposes.
      *
      */
-#if CONFIG_BUILD_FOR_HOST_UNIT_TEST
-    // For unit tests, always use inline allocation for code coverage.
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET, ObjectPoolMem::kInline> mGlobalDirtySet;
-#else
-    ObjectPool<AttributePathParamsWithGeneration, CHIP_IM_SERVER_MAX_NUM_DIRTY_SET> mGlobalDirtySet;
+    DirtyPathSet mGlobalDirtySet;
+
+#if CHIP_CONFIG_IM_ENABLE_READ_HANDLER_INTEREST_INDEX
+    ReadHandlerInterestIndex mReadHandlerInterestIndex;
 #endif
 
     /**
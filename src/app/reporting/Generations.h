@@ -53,8 +53,8 @@ static_assert(AreGenerationsInOrder(0x80000000 + 0x12345, 0x12344));
 /// raw integer comparisons which would break at the 2^32-1 boundary.
 ///
 /// Note: usage of uint32_t is intentional to minimize size overhead. For example, in
-/// `struct AttributePathParamsWithGeneration` (defined in Engine.h), using 32-bit generations
-/// keeps the structure size at 16 bytes.
+/// `struct AttributePathParamsWithGeneration` (defined in DirtyPathSet.h), using 32-bit generations
+/// keeps the path and its generation at 16 bytes (not counting the dirty set index link).
 ///
 /// The size breakdown is as follows:
 /// - Base `AttributePathParams`: 12 bytes (4-byte ClusterId, 4-byte AttributeId,
@@ -0,0 +1,182 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/ReadHandlerInterestIndex.h>
+
+#include <lib/support/logging/CHIPLogging.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+size_t ReadHandlerInterestIndex::BucketIndex(EndpointId aEndpointId, ClusterId aClusterId)
+{
+    static_assert((kBucketCount & (kBucketCount - 1)) == 0, "Bucket count must be a power of two");
+
+    uint32_t hash = aClusterId ^ (static_cast<uint32_t>(aEndpointId) * 0x9E3779B1u);
+    hash ^= hash >> 15;
+    hash *= 0x85EBCA6Bu;
+    hash ^= hash >> 13;
+    return hash & (kBucketCount - 1);
+}
+
+size_t ReadHandlerInterestIndex::RecordBucketIndex(const ReadHandler & aReadHandler)
+{
+    static_assert((kRecordBucketCount & (kRecordBucketCount - 1)) == 0, "Record bucket count must be a power of two");
+
+    uintptr_t hash = reinterpret_cast<uintptr_t>(&aReadHandler);
+    hash ^= hash >> 16;
+    hash *= 0x45D9F3Bu;
+    hash ^= hash >> 16;
+    return hash & (kRecordBucketCount - 1);
+}
+
+CHIP_ERROR ReadHandlerInterestIndex::Add(ReadHandler & aReadHandler,
+                                         const SingleLinkedListNode<AttributePathParams> * apAttributePathList)
+{
+    VerifyOrReturnError(apAttributePathList != nullptr, CHIP_NO_ERROR);
+
+    Record * record = mRecords.CreateObject();
+    if (record == nullptr)
+    {
+        ChipLogError(DataManagement, "Read handler interest index full, falling back to checking all read handlers");
+        AddRecordless(aReadHandler);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+    record->mpReadHandler = &aReadHandler;
+
+    Record *& recordChain  = mRecordBuckets[RecordBucketIndex(aReadHandler)];
+    record->mpNextInBucket = recordChain;
+    recordChain            = record;
+
+    for (auto * path = apAttributePathList; path != nullptr; path = path->mpNext)
+    {
+        Entry * entry = mEntries.CreateObject();
+        if (entry == nullptr)
+        {
+            // Keep the (empty) record so that Remove() can leave fallback mode once this read handler goes away.
+            ChipLogError(DataManagement, "Read handler interest index full, falling back to checking all read handlers");
+            ReleaseEntries(record);
+            record->mTracked = false;
+            mUntrackedReadHandlers++;
+            return CHIP_ERROR_NO_MEMORY;
+        }
+
+        entry->mPath                = path->mValue;
+        entry->mpRecord             = record;
+        entry->mpNextForReadHandler = record->mpEntries;
+        record->mpEntries           = entry;
+
+        Entry *& chain        = mBuckets[BucketIndex(entry->mPath.mEndpointId, entry->mPath.mClusterId)];
+        entry->mpNextInBucket = chain;
+        chain                 = entry;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+void ReadHandlerInterestIndex::AddRecordless(ReadHandler & aReadHandler)
+{
+    // Remember the read handler so that Remove() can leave fallback mode once it goes away.
+    for (auto & slot : mRecordlessReadHandlers)
+    {
+        if (slot == nullptr)
+        {
+            slot = &aReadHandler;
+            mUntrackedReadHandlers++;
+            return;
+        }
+    }
+    mLostReadHandler = true;
+}
+
+void ReadHandlerInterestIndex::ReleaseEntries(Record * apRecord)
+{
+    for (Entry * entry = apRecord->mpEntries; entry != nullptr;)
+    {
+        Entry * nextEntry = entry->mpNextForReadHandler;
+
+        for (Entry ** link = &mBuckets[BucketIndex(entry->mPath.mEndpointId, entry->mPath.mClusterId)]; *link != nullptr;
+             link          = &(*link)->mpNextInBucket)
+        {
+            if (*link == entry)
+            {
+                *link = entry->mpNextInBucket;
+                break;
+            }
+        }
+        mEntries.ReleaseObject(entry);
+
+        entry = nextEntry;
+    }
+    apRecord->mpEntries = nullptr;
+}
+
+void ReadHandlerInterestIndex::Remove(ReadHandler & aReadHandler)
+{
+    for (Record ** link = &mRecordBuckets[RecordBucketIndex(aReadHandler)]; *link != nullptr; link = &(*link)->mpNextInBucket)
+    {
+        Record * record = *link;
+        if (record->mpReadHandler != &aReadHandler)
+        {
+            continue;
+        }
+        if (!record->mTracked)
+        {
+            mUntrackedReadHandlers--;
+        }
+        *link = record->mpNextInBucket;
+        ReleaseEntries(record);
+        mRecords.ReleaseObject(record);
+        return;
+    }
+
+    for (auto & slot : mRecordlessReadHandlers)
+    {
+        if (slot == &aReadHandler)
+        {
+            slot = nullptr;
+            mUntrackedReadHandlers--;
+            return;
+        }
+    }
+}
+
+void ReadHandlerInterestIndex::Clear()
+{
+    mEntries.ReleaseAll();
+    mRecords.ReleaseAll();
+    for (auto & chain : mBuckets)
+    {
+        chain = nullptr;
+    }
+    for (auto & chain : mRecordBuckets)
+    {
+        chain = nullptr;
+    }
+    for (auto & slot : mRecordlessReadHandlers)
+    {
+        slot = nullptr;
+    }
+    mUntrackedReadHandlers = 0;
+    mLostReadHandler       = false;
+}
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
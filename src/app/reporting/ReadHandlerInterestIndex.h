@@ -0,0 +1,169 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <app/AttributePathParams.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/LinkedList.h>
+#include <lib/support/Pool.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace chip {
+namespace app {
+
+class ReadHandler;
+
+namespace reporting {
+
+class TestReadHandlerInterestIndex;
+
+/**
+ * Reverse index from attribute paths to the read handlers whose attribute path lists contain them.
+ *
+ * Each path of a registered read handler is filed under its (endpoint, cluster) pair, where either may be a wildcard. A
+ * change to a concrete (endpoint, cluster) then only needs to look at four keys: the concrete pair, the endpoint with a
+ * wildcard cluster, the cluster with a wildcard endpoint, and the fully wildcard pair.
+ *
+ * Changes with a wildcard endpoint or cluster are not served by the index; callers fall back to checking every read
+ * handler for those, which matches the cost before the index existed.
+ */
+class ReadHandlerInterestIndex
+{
+public:
+    ReadHandlerInterestIndex() = default;
+    ~ReadHandlerInterestIndex() { Clear(); }
+
+    ReadHandlerInterestIndex(const ReadHandlerInterestIndex &)             = delete;
+    ReadHandlerInterestIndex & operator=(const ReadHandlerInterestIndex &) = delete;
+
+    /**
+     * Indexes the given attribute paths for aReadHandler. Must be called at most once per read handler, after its path list
+     * is final.
+     *
+     * If the index runs out of memory, the read handler is not indexed and ForEachInterestedHandler() reports that it cannot
+     * answer queries until that read handler is removed, so callers never miss a read handler. Only if several read handlers
+     * fail this way at once does the index stay in that fallback mode until Clear().
+     */
+    CHIP_ERROR Add(ReadHandler & aReadHandler, const SingleLinkedListNode<AttributePathParams> * apAttributePathList);
+
+    /**
+     * Removes all paths of aReadHandler from the index. Safe to call for a read handler that was never added. Read handlers
+     * are looked up by address, so this does not scan the other read handlers.
+     */
+    void Remove(ReadHandler & aReadHandler);
+
+    void Clear();
+
+    /**
+     * Calls function(ReadHandler *) once for every indexed read handler with an attribute path that intersects aPath.
+     *
+     * The callback must not add or remove read handlers from the index.
+     *
+     * Returns false, without calling function, if the index cannot answer the query and the caller needs to check all read
+     * handlers instead.
+     */
+    template <typename Function>
+    bool ForEachInterestedHandler(const AttributePathParams & aPath, Function && function)
+    {
+        VerifyOrReturnValue(mUntrackedReadHandlers == 0 && !mLostReadHandler, false);
+        VerifyOrReturnValue(!aPath.HasWildcardEndpointId() && !aPath.HasWildcardClusterId(), false);
+
+        // Zero is the initial value of Record::mLastVisit, so never use it as an epoch.
+        if (++mVisitEpoch == 0)
+        {
+            mVisitEpoch = 1;
+        }
+
+        const EndpointId endpointKeys[] = { aPath.mEndpointId, kInvalidEndpointId };
+        const ClusterId clusterKeys[]   = { aPath.mClusterId, kInvalidClusterId };
+        for (EndpointId endpointKey : endpointKeys)
+        {
+            for (ClusterId clusterKey : clusterKeys)
+            {
+                Entry * chain = mBuckets[BucketIndex(endpointKey, clusterKey)];
+                for (Entry * entry = chain; entry != nullptr; entry = entry->mpNextInBucket)
+                {
+                    if (entry->mPath.mEndpointId != endpointKey || entry->mPath.mClusterId != clusterKey ||
+                        entry->mpRecord->mLastVisit == mVisitEpoch || !entry->mPath.Intersects(aPath))
+                    {
+                        continue;
+                    }
+                    entry->mpRecord->mLastVisit = mVisitEpoch;
+                    function(entry->mpRecord->mpReadHandler);
+                }
+            }
+        }
+        return true;
+    }
+
+private:
+    friend class TestReadHandlerInterestIndex;
+
+    // Paths are spread over a fixed table; chains stay short for the number of paths a node can realistically serve.
+    static constexpr size_t kBucketCount = 256;
+    // Records are looked up by read handler in a smaller table of their own.
+    static constexpr size_t kRecordBucketCount = 64;
+    // Read handlers that failed to get a record and are remembered until they are removed.
+    static constexpr size_t kMaxRecordlessReadHandlers = 4;
+
+    struct Entry;
+
+    struct Record
+    {
+        ReadHandler * mpReadHandler = nullptr;
+        Entry * mpEntries           = nullptr;
+        Record * mpNextInBucket     = nullptr;
+        uint32_t mLastVisit         = 0;
+        // False if the paths of the read handler could not all be indexed.
+        bool mTracked = true;
+    };
+
+    struct Entry
+    {
+        AttributePathParams mPath;
+        Record * mpRecord            = nullptr;
+        Entry * mpNextInBucket       = nullptr;
+        Entry * mpNextForReadHandler = nullptr;
+    };
+
+    static size_t BucketIndex(EndpointId aEndpointId, ClusterId aClusterId);
+    static size_t RecordBucketIndex(const ReadHandler & aReadHandler);
+
+    void AddRecordless(ReadHandler & aReadHandler);
+    void ReleaseEntries(Record * apRecord);
+
+    ObjectPool<Record, CHIP_IM_MAX_NUM_READS + CHIP_IM_MAX_NUM_SUBSCRIPTIONS> mRecords;
+    ObjectPool<Entry, CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_READS + CHIP_IM_SERVER_MAX_NUM_PATH_GROUPS_FOR_SUBSCRIPTIONS> mEntries;
+    Entry * mBuckets[kBucketCount]                                    = {};
+    Record * mRecordBuckets[kRecordBucketCount]                       = {};
+    ReadHandler * mRecordlessReadHandlers[kMaxRecordlessReadHandlers] = {};
+    uint32_t mVisitEpoch                                              = 0;
+    // Read handlers that could not be indexed for lack of memory, with or without a record.
+    size_t mUntrackedReadHandlers = 0;
+    // Set if a read handler could neither be indexed nor remembered, which keeps the index in fallback mode until Clear().
+    bool mLostReadHandler = false;
+};
+
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -55,8 +55,7 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Register(ServerClusterRegistration &
     {
         VerifyOrReturnError(path.HasValidIds(), CHIP_ERROR_INVALID_ARGUMENT);
 
-        // Double-checking for duplicates makes the checks O(n^2) on the total number of registered
-        // items. We preserve this however we may want to make this optional at some point in time.
+        // Duplicate checks are index lookups, so registering n clusters is O(n) overall
         VerifyOrReturnError(Get(path) == nullptr, CHIP_ERROR_DUPLICATE_KEY_ID);
     }
 
@@ -69,6 +68,7 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Register(ServerClusterRegistration &
 
     entry.next     = mRegistrations;
     mRegistrations = &entry;
+    AddToIndex(entry);
 
     return CHIP_NO_ERROR;
 }
@@ -82,29 +82,12 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Unregister(ServerClusterInterface * w
     {
         if (current->serverClusterInterface == what)
         {
-            // take the item out of the current list and return it.
-            ServerClusterRegistration * next = current->next;
-
-            if (prev == nullptr)
-            {
-                mRegistrations = next;
-            }
-            else
-            {
-                prev->next = next;
-            }
-
-            if (mCachedInterface == current->serverClusterInterface)
+            Unlink(prev, *current, clusterShutdownType);
+            if (mIndexIncomplete)
             {
-                mCachedInterface = nullptr;
+                // There may be room in the index now for the paths that did not fit before
+                RebuildIndex();
             }
-
-            current->next = nullptr; // Make sure current does not look like part of a list.
-            if (mContext.has_value())
-            {
-                current->serverClusterInterface->Shutdown(clusterShutdownType);
-            }
-
             return CHIP_NO_ERROR;
         }
 
@@ -115,26 +98,70 @@ CHIP_ERROR ServerClusterInterfaceRegistry::Unregister(ServerClusterInterface * w
     return CHIP_ERROR_NOT_FOUND;
 }
 
-ServerClusterInterface * ServerClusterInterfaceRegistry::Get(const ConcreteClusterPath & clusterPath)
+void ServerClusterInterfaceRegistry::Unlink(ServerClusterRegistration * previous, ServerClusterRegistration & entry,
+                                            ClusterShutdownType clusterShutdownType)
 {
-    // Check the cache to speed things up
-    if ((mCachedInterface != nullptr) && mCachedInterface->PathsContains(clusterPath))
+    // take the item out of the current list
+    if (previous == nullptr)
     {
-        return mCachedInterface;
+        mRegistrations = entry.next;
     }
+    else
+    {
+        previous->next = entry.next;
+    }
+    entry.next = nullptr; // Make sure entry does not look like part of a list.
 
-    // The cluster searched for is not cached, do a linear search for it
-    ServerClusterRegistration * current = mRegistrations;
+    for (const ConcreteClusterPath & path : entry.serverClusterInterface->GetPaths())
+    {
+        mPathIndex.Remove(path, *entry.serverClusterInterface);
+    }
 
-    while (current != nullptr)
+    if (mContext.has_value())
     {
-        if (current->serverClusterInterface->PathsContains(clusterPath))
+        entry.serverClusterInterface->Shutdown(clusterShutdownType);
+    }
+}
+
+void ServerClusterInterfaceRegistry::AddToIndex(ServerClusterRegistration & entry)
+{
+    for (const ConcreteClusterPath & path : entry.serverClusterInterface->GetPaths())
+    {
+        if ((mPathIndex.Insert(path, *entry.serverClusterInterface) != CHIP_NO_ERROR) && !mIndexIncomplete)
         {
-            mCachedInterface = current->serverClusterInterface;
-            return mCachedInterface;
+            ChipLogProgress(DataManagement, "Cluster path index is full (%u paths), looking up further clusters by scanning",
+                            static_cast<unsigned>(mPathIndex.Size()));
+            mIndexIncomplete = true;
         }
+    }
+}
 
-        current = current->next;
+void ServerClusterInterfaceRegistry::RebuildIndex()
+{
+    mPathIndex.Clear();
+    mIndexIncomplete = false;
+
+    for (ServerClusterRegistration * registration = mRegistrations; registration != nullptr; registration = registration->next)
+    {
+        AddToIndex(*registration);
+    }
+}
+
+ServerClusterInterface * ServerClusterInterfaceRegistry::Get(const ConcreteClusterPath & clusterPath)
+{
+    ServerClusterInterface * indexed = mPathIndex.Find(clusterPath);
+    if ((indexed != nullptr) || !mIndexIncomplete)
+    {
+        return indexed;
+    }
+
+    // Some paths did not fit in the index, do a linear search for them
+    for (ServerClusterRegistration * current = mRegistrations; current != nullptr; current = current->next)
+    {
+        if (current->serverClusterInterface->PathsContains(clusterPath))
+        {
+            return current->serverClusterInterface;
+        }
     }
 
     // not found
@@ -19,6 +19,7 @@
 #include <app/AppConfig.h>
 #include <app/ConcreteClusterPath.h>
 #include <app/server-cluster/ServerClusterInterface.h>
+#include <app/server-cluster/ServerClusterPathIndex.h>
 #include <lib/core/CHIPError.h>
 #include <lib/core/DataModelTypes.h>
 #include <lib/support/logging/CHIPLogging.h>
@@ -144,6 +145,10 @@ private:
 };
 
 /// Allows registering and retrieving ServerClusterInterface instances for specific cluster paths.
+///
+/// Registered paths are kept in a hash index (see ServerClusterPathIndex) so that `Get` does not depend
+/// on the number of registrations. Paths that do not fit in the index are found by scanning the
+/// registrations.
 class ServerClusterInterfaceRegistry
 {
 public:
@@ -154,6 +159,7 @@ public:
     /// Requirements:
     ///   - entry MUST NOT be part of any other registration
     ///   - LIFETIME of entry must outlive the Registry (or entry must be unregistered)
+    ///   - GetPaths() of the entry MUST NOT change while it is registered
     ///
     /// There can be only a single registration for a given `endpointId/clusterId` path.
     [[nodiscard]] CHIP_ERROR Register(ServerClusterRegistration & entry);
@@ -218,11 +224,27 @@ public:
     ServerClusterInstances AllServerClusterInstances();
 
 protected:
+    /// Takes `entry` out of the registrations and shuts it down if a context is set.
+    /// `previous` is the registration before `entry` in the list or nullptr if `entry` is the first one.
+    ///
+    /// This does not move paths that did not fit into the freed index slots: callers that are done unlinking
+    /// should call RebuildIndex() if mIndexIncomplete is set.
+    void Unlink(ServerClusterRegistration * previous, ServerClusterRegistration & entry,
+                ClusterShutdownType clusterShutdownType);
+
+    /// Adds the paths of `entry` to the index, falling back to list scans for the ones that do not fit.
+    void AddToIndex(ServerClusterRegistration & entry);
+
+    /// Re-creates the index from the current registrations.
+    void RebuildIndex();
+
     ServerClusterRegistration * mRegistrations = nullptr;
 
-    // A one-element cache to speed up finding a cluster within an endpoint.
-    // The endpointId specifies which endpoint the cache belongs to.
-    ServerClusterInterface * mCachedInterface = nullptr;
+    ServerClusterPathIndex mPathIndex;
+
+    // Set when some registered path could not be added to mPathIndex, so that lookups that
+    // miss the index have to scan the registrations.
+    bool mIndexIncomplete = false;
 
     // Managing context for this registry
     std::optional<ServerClusterContext> mContext;
@@ -0,0 +1,158 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <app/server-cluster/ServerClusterPathIndex.h>
+
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <cstdint>
+#include <new>
+
+namespace chip {
+namespace app {
+
+ServerClusterPathIndex::~ServerClusterPathIndex()
+{
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    Platform::MemoryFree(mSlots);
+#endif
+}
+
+size_t ServerClusterPathIndex::Hash(const ConcreteClusterPath & path)
+{
+    // Cluster ids are mostly small and endpoints are consecutive: mix all the bits (murmur3 finalizer).
+    uint64_t key = (static_cast<uint64_t>(path.mEndpointId) << 32) | path.mClusterId;
+    key ^= key >> 33;
+    key *= 0xff51afd7ed558ccdULL;
+    key ^= key >> 33;
+    key *= 0xc4ceb9fe1a85ec53ULL;
+    key ^= key >> 33;
+    return static_cast<size_t>(key);
+}
+
+size_t ServerClusterPathIndex::Probe(const ConcreteClusterPath & path) const
+{
+    const size_t mask = mCapacity - 1;
+    size_t index      = Hash(path) & mask;
+
+    while ((mSlots[index].cluster != nullptr) && (mSlots[index].path != path))
+    {
+        index = (index + 1) & mask;
+    }
+    return index;
+}
+
+bool ServerClusterPathIndex::ReserveOneMore()
+{
+    if ((mCount + 1) * 4 <= mCapacity * 3)
+    {
+        return true;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    const size_t newCapacity = (mCapacity == 0) ? kInitialCapacity : mCapacity * 2;
+    VerifyOrReturnValue(newCapacity > 0, false);
+
+    Slot * newSlots = static_cast<Slot *>(Platform::MemoryAlloc(newCapacity * sizeof(Slot)));
+    VerifyOrReturnValue(newSlots != nullptr, false);
+    for (size_t i = 0; i < newCapacity; i++)
+    {
+        new (&newSlots[i]) Slot();
+    }
+
+    Slot * oldSlots          = mSlots;
+    const size_t oldCapacity = mCapacity;
+
+    mSlots    = newSlots;
+    mCapacity = newCapacity;
+    for (size_t i = 0; i < oldCapacity; i++)
+    {
+        if (oldSlots[i].cluster != nullptr)
+        {
+            mSlots[Probe(oldSlots[i].path)] = oldSlots[i];
+        }
+    }
+    Platform::MemoryFree(oldSlots);
+
+    return true;
+#else
+    return false;
+#endif
+}
+
+CHIP_ERROR ServerClusterPathIndex::Insert(const ConcreteClusterPath & path, ServerClusterInterface & cluster)
+{
+    if (mCount > 0)
+    {
+        ServerClusterInterface * existing = Find(path);
+        if (existing != nullptr)
+        {
+            return (existing == &cluster) ? CHIP_NO_ERROR : CHIP_ERROR_DUPLICATE_KEY_ID;
+        }
+    }
+
+    VerifyOrReturnError(ReserveOneMore(), CHIP_ERROR_NO_MEMORY);
+
+    Slot & slot  = mSlots[Probe(path)];
+    slot.path    = path;
+    slot.cluster = &cluster;
+    mCount++;
+
+    return CHIP_NO_ERROR;
+}
+
+ServerClusterInterface * ServerClusterPathIndex::Find(const ConcreteClusterPath & path) const
+{
+    VerifyOrReturnValue(mCount > 0, nullptr);
+    return mSlots[Probe(path)].cluster;
+}
+
+void ServerClusterPathIndex::Remove(const ConcreteClusterPath & path, const ServerClusterInterface & cluster)
+{
+    VerifyOrReturn(mCount > 0);
+
+    const size_t mask = mCapacity - 1;
+    size_t hole       = Probe(path);
+    VerifyOrReturn(mSlots[hole].cluster == &cluster);
+
+    // Backward-shift deletion: move up every following entry of the probe sequence that would
+    // no longer be reachable through the hole, so that lookups never need tombstones.
+    for (size_t next = (hole + 1) & mask; mSlots[next].cluster != nullptr; next = (next + 1) & mask)
+    {
+        const size_t home = Hash(mSlots[next].path) & mask;
+        if (((next - home) & mask) >= ((next - hole) & mask))
+        {
+            mSlots[hole] = mSlots[next];
+            hole         = next;
+        }
+    }
+
+    mSlots[hole] = Slot();
+    mCount--;
+}
+
+void ServerClusterPathIndex::Clear()
+{
+    for (size_t i = 0; i < mCapacity; i++)
+    {
+        mSlots[i] = Slot();
+    }
+    mCount = 0;
+}
+
+} // namespace app
+} // namespace chip
@@ -0,0 +1,98 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#pragma once
+
+#include <app/ConcreteClusterPath.h>
+#include <app/server-cluster/ServerClusterInterface.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemConfig.h>
+
+#include <cstddef>
+
+namespace chip {
+namespace app {
+
+/// An open-addressed (linear probing) hash table from cluster paths to the cluster
+/// serving them.
+///
+/// With CHIP_SYSTEM_CONFIG_POOL_USE_HEAP the table is allocated on first use and grows
+/// as paths are inserted. Otherwise it is a fixed array of
+/// CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE slots and insertions fail once it is
+/// full, so users have to be able to find paths some other way.
+class ServerClusterPathIndex
+{
+public:
+    static constexpr size_t kInitialCapacity = CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE;
+    static_assert((kInitialCapacity & (kInitialCapacity - 1)) == 0,
+                  "CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE must be a power of two");
+
+    ServerClusterPathIndex() = default;
+    ~ServerClusterPathIndex();
+
+    ServerClusterPathIndex(const ServerClusterPathIndex &)             = delete;
+    ServerClusterPathIndex & operator=(const ServerClusterPathIndex &) = delete;
+
+    /// Maps `path` to `cluster`.
+    ///
+    /// Returns:
+    ///   - CHIP_NO_ERROR on success, including if `path` is already mapped to `cluster`
+    ///   - CHIP_ERROR_DUPLICATE_KEY_ID if `path` is mapped to a different cluster
+    ///   - CHIP_ERROR_NO_MEMORY if the index is full and cannot grow
+    CHIP_ERROR Insert(const ConcreteClusterPath & path, ServerClusterInterface & cluster);
+
+    /// Returns the cluster mapped to `path` or nullptr.
+    ServerClusterInterface * Find(const ConcreteClusterPath & path) const;
+
+    /// Removes `path` if it is mapped to `cluster`.
+    void Remove(const ConcreteClusterPath & path, const ServerClusterInterface & cluster);
+
+    /// Removes all paths. Keeps the allocated slots.
+    void Clear();
+
+    size_t Size() const { return mCount; }
+    size_t Capacity() const { return mCapacity; }
+
+private:
+    struct Slot
+    {
+        ConcreteClusterPath path;
+        ServerClusterInterface * cluster = nullptr; // nullptr for free slots
+    };
+
+    static size_t Hash(const ConcreteClusterPath & path);
+
+    /// Index of the slot holding `path`, or of the free slot where it would be inserted.
+    /// Requires at least one free slot.
+    size_t Probe(const ConcreteClusterPath & path) const;
+
+    /// Makes room for one more path while keeping the load factor at or below 3/4.
+    bool ReserveOneMore();
+
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+    Slot * mSlots    = nullptr;
+    size_t mCapacity = 0;
+#else
+    Slot mStorage[kInitialCapacity > 0 ? kInitialCapacity : 1];
+    Slot * const mSlots    = mStorage;
+    const size_t mCapacity = kInitialCapacity;
+#endif
+    size_t mCount = 0;
+};
+
+} // namespace app
+} // namespace chip
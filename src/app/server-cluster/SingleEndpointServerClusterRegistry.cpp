@@ -60,26 +60,8 @@ void SingleEndpointServerClusterRegistry::UnregisterAllFromEndpoint(EndpointId e
         auto paths = current->serverClusterInterface->GetPaths();
         if (paths.empty() || paths.front().mEndpointId == endpointId)
         {
-            if (mCachedInterface == current->serverClusterInterface)
-            {
-                mCachedInterface = nullptr;
-            }
-            if (prev == nullptr)
-            {
-                mRegistrations = current->next;
-            }
-            else
-            {
-                prev->next = current->next;
-            }
             ServerClusterRegistration * actual_next = current->next;
-
-            current->next = nullptr; // Make sure current does not look like part of a list.
-            if (mContext.has_value())
-            {
-                current->serverClusterInterface->Shutdown(clusterShutdownType);
-            }
-
+            Unlink(prev, *current, clusterShutdownType);
             current = actual_next;
         }
         else
@@ -88,6 +70,12 @@ void SingleEndpointServerClusterRegistry::UnregisterAllFromEndpoint(EndpointId e
             current = current->next;
         }
     }
+
+    if (mIndexIncomplete)
+    {
+        // Refill the index once for all the removed clusters
+        RebuildIndex();
+    }
 }
 
 } // namespace app
@@ -30,6 +30,8 @@
 
 #include <algorithm>
 #include <cstdlib>
+#include <memory>
+#include <vector>
 
 using namespace chip;
 using namespace chip::Testing;
@@ -405,3 +407,110 @@ TEST_F(TestServerClusterInterfaceRegistry, StartupShutdownWithoutContext)
     EXPECT_EQ(cluster2.Cluster().GetShutdownCallCount(), 1u);
     EXPECT_EQ(cluster3.Cluster().GetShutdownCallCount(), 1u);
 }
+
+TEST_F(TestServerClusterInterfaceRegistry, ManyClusters)
+{
+    // More clusters than a fixed size index can hold, so that lookups also go through the fallback scan
+    constexpr EndpointId kEndpoints = 40;
+    constexpr ClusterId kClusters   = 25;
+
+    std::vector<std::unique_ptr<RegisteredServerCluster<FakeServerClusterInterface>>> clusters;
+    ServerClusterInterfaceRegistry registry;
+
+    for (EndpointId endpoint = 1; endpoint <= kEndpoints; endpoint++)
+    {
+        for (ClusterId cluster = 1; cluster <= kClusters; cluster++)
+        {
+            clusters.push_back(std::make_unique<RegisteredServerCluster<FakeServerClusterInterface>>(endpoint, cluster));
+            ASSERT_EQ(registry.Register(clusters.back()->Registration()), CHIP_NO_ERROR);
+        }
+    }
+
+    FakeServerClusterInterface duplicate(kEndpoints, kClusters);
+    ServerClusterRegistration duplicateRegistration(duplicate);
+    EXPECT_EQ(registry.Register(duplicateRegistration), CHIP_ERROR_DUPLICATE_KEY_ID);
+
+    for (auto & cluster : clusters)
+    {
+        EXPECT_EQ(registry.Get(cluster->Cluster().GetPath()), &cluster->Cluster());
+    }
+    EXPECT_EQ(registry.Get({ kEndpoints + 1, 1 }), nullptr);
+    EXPECT_EQ(registry.Get({ 1, kClusters + 1 }), nullptr);
+
+    // remove every other cluster
+    for (size_t i = 0; i < clusters.size(); i += 2)
+    {
+        EXPECT_EQ(registry.Unregister(&clusters[i]->Cluster()), CHIP_NO_ERROR);
+    }
+
+    for (size_t i = 0; i < clusters.size(); i++)
+    {
+        EXPECT_EQ(registry.Get(clusters[i]->Cluster().GetPath()), (i % 2 == 0) ? nullptr : &clusters[i]->Cluster());
+    }
+
+    // paths can be registered again once removed
+    FakeServerClusterInterface replacement(clusters[0]->Cluster().GetPath());
+    ServerClusterRegistration replacementRegistration(replacement);
+    EXPECT_EQ(registry.Register(replacementRegistration), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.Get(replacement.GetPath()), &replacement);
+    EXPECT_EQ(registry.Unregister(&replacement), CHIP_NO_ERROR);
+    EXPECT_EQ(registry.Get(replacement.GetPath()), nullptr);
+}
+
+// Get must find exactly what a scan of the registrations finds, including once more paths are registered than fit in
+// the index and after some of them are removed.
+TEST_F(TestServerClusterInterfaceRegistry, GetAgreesWithScan)
+{
+    constexpr EndpointId kEndpoints = 40;
+    constexpr ClusterId kClusters   = 5;
+
+    std::vector<std::unique_ptr<RegisteredServerCluster<FakeServerClusterInterface>>> clusters;
+    for (EndpointId endpoint = 1; endpoint <= kEndpoints; endpoint++)
+    {
+        for (ClusterId cluster = 1; cluster <= kClusters; cluster++)
+        {
+            clusters.push_back(std::make_unique<RegisteredServerCluster<FakeServerClusterInterface>>(endpoint, cluster));
+        }
+    }
+
+    ServerClusterInterfaceRegistry registry;
+
+    auto expectGetAgreesWithScan = [&registry]() {
+        // Also look up paths next to the registered ones, which must not be found
+        for (EndpointId endpoint = 0; endpoint <= kEndpoints + 1; endpoint++)
+        {
+            for (ClusterId cluster = 0; cluster <= kClusters + 1; cluster++)
+            {
+                const ConcreteClusterPath path(endpoint, cluster);
+                ServerClusterInterface * scanned = nullptr;
+                for (auto * instance : registry.AllServerClusterInstances())
+                {
+                    if (instance->PathsContains(path))
+                    {
+                        scanned = instance;
+                        break;
+                    }
+                }
+                EXPECT_EQ(registry.Get(path), scanned);
+            }
+        }
+    };
+
+    for (auto & cluster : clusters)
+    {
+        ASSERT_EQ(registry.Register(cluster->Registration()), CHIP_NO_ERROR);
+    }
+    expectGetAgreesWithScan();
+
+    for (size_t i = 0; i < clusters.size(); i += 3)
+    {
+        ASSERT_EQ(registry.Unregister(&clusters[i]->Cluster()), CHIP_NO_ERROR);
+    }
+    expectGetAgreesWithScan();
+
+    for (size_t i = 0; i < clusters.size(); i += 3)
+    {
+        ASSERT_EQ(registry.Register(clusters[i]->Registration()), CHIP_NO_ERROR);
+    }
+    expectGetAgreesWithScan();
+}
@@ -0,0 +1,147 @@
+/*
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+#include <pw_unit_test/framework.h>
+
+#include <app/ConcreteClusterPath.h>
+#include <app/server-cluster/DefaultServerCluster.h>
+#include <app/server-cluster/ServerClusterPathIndex.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+
+#include <cstdlib>
+#include <map>
+#include <utility>
+
+using namespace chip;
+using namespace chip::app;
+
+namespace {
+
+class FakeCluster : public DefaultServerCluster
+{
+public:
+    FakeCluster() : DefaultServerCluster({ 1, 1 }) {}
+
+    DataModel::ActionReturnStatus ReadAttribute(const DataModel::ReadAttributeRequest & request,
+                                                AttributeValueEncoder & encoder) override
+    {
+        return CHIP_ERROR_NOT_IMPLEMENTED;
+    }
+};
+
+struct TestServerClusterPathIndex : public ::testing::Test
+{
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+} // namespace
+
+TEST_F(TestServerClusterPathIndex, InsertFindRemove)
+{
+    FakeCluster cluster1;
+    FakeCluster cluster2;
+    ServerClusterPathIndex index;
+
+    EXPECT_EQ(index.Find({ 1, 6 }), nullptr);
+
+    EXPECT_EQ(index.Insert({ 1, 6 }, cluster1), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert({ 1, 8 }, cluster1), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert({ 2, 6 }, cluster2), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Size(), 3u);
+
+    EXPECT_EQ(index.Find({ 1, 6 }), &cluster1);
+    EXPECT_EQ(index.Find({ 1, 8 }), &cluster1);
+    EXPECT_EQ(index.Find({ 2, 6 }), &cluster2);
+    EXPECT_EQ(index.Find({ 2, 8 }), nullptr);
+
+    // re-inserting the same mapping is a no-op, mapping a path to another cluster is not allowed
+    EXPECT_EQ(index.Insert({ 1, 6 }, cluster1), CHIP_NO_ERROR);
+    EXPECT_EQ(index.Insert({ 1, 6 }, cluster2), CHIP_ERROR_DUPLICATE_KEY_ID);
+    EXPECT_EQ(index.Size(), 3u);
+
+    // only removes paths mapped to the given cluster
+    index.Remove({ 1, 6 }, cluster2);
+    EXPECT_EQ(index.Find({ 1, 6 }), &cluster1);
+
+    index.Remove({ 1, 6 }, cluster1);
+    EXPECT_EQ(index.Find({ 1, 6 }), nullptr);
+    EXPECT_EQ(index.Find({ 1, 8 }), &cluster1);
+    EXPECT_EQ(index.Size(), 2u);
+
+    index.Clear();
+    EXPECT_EQ(index.Size(), 0u);
+    EXPECT_EQ(index.Find({ 1, 8 }), nullptr);
+    EXPECT_EQ(index.Find({ 2, 6 }), nullptr);
+}
+
+TEST_F(TestServerClusterPathIndex, MatchesReferenceMap)
+{
+    // Enough paths to fill (and, with heap allocated pools, grow) the index, removed and inserted
+    // in random order to exercise probe sequences that wrap around and backward-shift deletion.
+    constexpr EndpointId kEndpoints = 16;
+    constexpr ClusterId kClusters   = 16;
+
+    FakeCluster clusters[4];
+    ServerClusterPathIndex index;
+    std::map<std::pair<EndpointId, ClusterId>, ServerClusterInterface *> reference;
+
+    srand(1234);
+    for (int i = 0; i < 20000; i++)
+    {
+        const ConcreteClusterPath path(static_cast<EndpointId>(rand() % kEndpoints), static_cast<ClusterId>(rand() % kClusters));
+        const auto key  = std::make_pair(path.mEndpointId, path.mClusterId);
+        auto & cluster  = clusters[rand() % 4];
+        const auto item = reference.find(key);
+
+        if (item != reference.end())
+        {
+            ASSERT_EQ(index.Find(path), item->second);
+            if (rand() % 2)
+            {
+                index.Remove(path, *item->second);
+                reference.erase(item);
+            }
+            continue;
+        }
+
+        ASSERT_EQ(index.Find(path), nullptr);
+        CHIP_ERROR err = index.Insert(path, cluster);
+        if (err == CHIP_NO_ERROR)
+        {
+            reference[key] = &cluster;
+        }
+        else
+        {
+            // only fixed size indexes may fill up
+            ASSERT_EQ(err, CHIP_ERROR_NO_MEMORY);
+            ASSERT_FALSE(CHIP_SYSTEM_CONFIG_POOL_USE_HEAP);
+            ASSERT_GT(index.Size() * 4 + 4, index.Capacity() * 3);
+        }
+        ASSERT_EQ(index.Size(), reference.size());
+    }
+
+    for (EndpointId endpoint = 0; endpoint < kEndpoints; endpoint++)
+    {
+        for (ClusterId cluster = 0; cluster < kClusters; cluster++)
+        {
+            const auto item = reference.find(std::make_pair(endpoint, cluster));
+            EXPECT_EQ(index.Find({ endpoint, cluster }), (item == reference.end()) ? nullptr : item->second);
+        }
+    }
+}
@@ -49,6 +49,7 @@
 #include <platform/DeviceInfoProvider.h>
 #include <platform/KeyValueStoreManager.h>
 #include <platform/LockTracker.h>
+#include <protocols/secure_channel/CASECryptoWorkerPool.h>
 #include <protocols/secure_channel/CASEServer.h>
 #include <protocols/secure_channel/MessageCounterManager.h>
 #if CHIP_ENABLE_ROTATING_DEVICE_ID && defined(CHIP_DEVICE_CONFIG_ROTATING_DEVICE_ID_UNIQUE_ID)
@@ -508,6 +509,9 @@ CHIP_ERROR Server::Init(const ServerInitParams & initParams)
                                                        &app::InteractionModelEngine::GetInstance()->GetReportingEngine());
 
         SuccessOrExit(err);
+
+        err = app::EventManagement::GetInstance().SetEventLogStore(initParams.eventLogStore);
+        SuccessOrExit(err);
     }
 #endif // CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
 
@@ -890,6 +894,8 @@ void Server::Shutdown()
     PlatformMgr().RemoveEventHandler(OnPlatformEventWrapper, reinterpret_cast<intptr_t>(this));
     mCASEServer.Shutdown();
     mCASESessionManager.Shutdown();
+    // Outstanding CASE work was canceled above; let the crypto worker threads drain and exit.
+    CASECryptoWorkerPool::Instance().Shutdown();
 #if CHIP_CONFIG_ENABLE_ICD_SERVER
     app::DnssdServer::Instance().SetICDManager(nullptr);
 #endif // CHIP_CONFIG_ENABLE_ICD_SERVER
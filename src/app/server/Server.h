@@ -27,6 +27,7 @@
 #include <app/CASEClientPool.h>
 #include <app/CASESessionManager.h>
 #include <app/DefaultSafeAttributePersistenceProvider.h>
+#include <app/EventLogStore.h>
 #include <app/FailSafeContext.h>
 #include <app/OperationalSessionSetupPool.h>
 #include <app/SimpleSubscriptionResumptionStorage.h>
@@ -213,6 +214,10 @@ struct ServerInitParams
     // Optional. Support test event triggers when provided. Must be initialized before being
     // provided.
     TestEventTriggerDelegate * testEventTriggerDelegate = nullptr;
+    // Optional. Logged events are also written to this store when provided, which keeps them across
+    // restarts and serves the events dropped from the event buffers. Must be initialized before being
+    // provided.
+    app::EventLogStore * eventLogStore = nullptr;
     // Operational keystore with access to the operational keys: MUST be injected.
     Crypto::OperationalKeystore * operationalKeystore = nullptr;
     // Operational certificate store with access to the operational certs in persisted storage:
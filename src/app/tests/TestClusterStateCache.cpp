@@ -830,4 +830,129 @@ TEST_F(TestClusterStateCache, TestCache)
                              AttributeInstruction(AttributeInstruction::kAttributeB, 0, AttributeInstruction::kData) });
 }
 
+template <typename CacheType>
+class StorageTestCallback : public CacheType::Callback
+{
+    void OnDone(ReadClient *) override {}
+};
+
+// Reports an octet string for every attribute of every cluster of every endpoint, with a length that depends on the
+// round so that updated values leave holes of varying size behind, and a status for some of the attributes.
+void SendStorageTestReport(ReadClient::Callback & callback, EndpointId endpointCount, ClusterId clusterCount,
+                           AttributeId attributeCount, uint8_t round)
+{
+    callback.OnReportBegin();
+    for (EndpointId endpoint = 0; endpoint < endpointCount; endpoint++)
+    {
+        for (ClusterId cluster = 0; cluster < clusterCount; cluster++)
+        {
+            for (AttributeId attribute = 0; attribute < attributeCount; attribute++)
+            {
+                ConcreteDataAttributePath path(endpoint, cluster, attribute);
+                path.mDataVersion.SetValue(round);
+
+                if ((attribute + round) % 7 == 0)
+                {
+                    callback.OnAttributeData(path, nullptr, StatusIB(Protocols::InteractionModel::Status::UnsupportedAttribute));
+                    continue;
+                }
+
+                uint8_t value[64];
+                size_t length = (endpoint * 31u + cluster * 7u + attribute * 3u + round * 11u) % sizeof(value);
+                memset(value, static_cast<uint8_t>(attribute + round), length);
+
+                uint8_t buffer[sizeof(value) + 8];
+                TLV::TLVWriter writer;
+                writer.Init(buffer);
+                EXPECT_SUCCESS(writer.Put(TLV::AnonymousTag(), ByteSpan(value, length)));
+                EXPECT_SUCCESS(writer.Finalize());
+
+                TLV::TLVReader reader;
+                reader.Init(buffer, writer.GetLengthWritten());
+                EXPECT_SUCCESS(reader.Next());
+                callback.OnAttributeData(path, &reader, StatusIB());
+            }
+        }
+    }
+    callback.OnReportEnd();
+}
+
+template <typename CacheType>
+void ExpectSameAttributes(const ClusterStateCache & expected, const CacheType & cache)
+{
+    size_t expectedCount = 0;
+    EXPECT_SUCCESS(expected.ForEachAttribute([&](const ConcreteAttributePath & path) {
+        expectedCount++;
+
+        TLV::TLVReader expectedReader;
+        TLV::TLVReader reader;
+        CHIP_ERROR err = expected.Get(path, expectedReader);
+        EXPECT_EQ(cache.Get(path, reader), err);
+        if (err == CHIP_NO_ERROR)
+        {
+            ByteSpan expectedValue;
+            ByteSpan value;
+            EXPECT_SUCCESS(expectedReader.Get(expectedValue));
+            EXPECT_SUCCESS(reader.Get(value));
+            EXPECT_TRUE(value.data_equal(expectedValue));
+        }
+        else
+        {
+            StatusIB expectedStatus;
+            StatusIB status;
+            EXPECT_SUCCESS(expected.GetStatus(path, expectedStatus));
+            EXPECT_SUCCESS(cache.GetStatus(path, status));
+            EXPECT_EQ(status.mStatus, expectedStatus.mStatus);
+        }
+        return CHIP_NO_ERROR;
+    }));
+
+    size_t count = 0;
+    EXPECT_SUCCESS(cache.ForEachAttribute([&](const ConcreteAttributePath & path) {
+        count++;
+        return CHIP_NO_ERROR;
+    }));
+    EXPECT_EQ(count, expectedCount);
+}
+
+TEST_F(TestClusterStateCache, TestFlatStorage)
+{
+    StorageTestCallback<ClusterStateCache> mapCallback;
+    ClusterStateCache mapCache(mapCallback);
+    StorageTestCallback<FlatClusterStateCache> flatCallback;
+    FlatClusterStateCache flatCache(flatCallback);
+
+    for (uint8_t round = 1; round <= 8; round++)
+    {
+        SendStorageTestReport(mapCache.GetBufferedCallback(), 3, 4, 10, round);
+        SendStorageTestReport(flatCache.GetBufferedCallback(), 3, 4, 10, round);
+        ExpectSameAttributes(mapCache, flatCache);
+
+        // Replaced payloads never make up more than half of an arena, beyond a small per-cluster allowance.
+        auto mapUsage  = mapCache.GetAttributeMemoryUsage();
+        auto flatUsage = flatCache.GetAttributeMemoryUsage();
+        EXPECT_EQ(flatUsage.mEndpointCount, 3u);
+        EXPECT_EQ(flatUsage.mClusterCount, 12u);
+        EXPECT_EQ(flatUsage.mAttributeCount, 120u);
+        EXPECT_EQ(mapUsage.mAttributeCount, flatUsage.mAttributeCount);
+        EXPECT_GE(flatUsage.mPayloadBytes, mapUsage.mPayloadBytes);
+        EXPECT_LE(flatUsage.mPayloadBytes, 2 * mapUsage.mPayloadBytes + 256 * flatUsage.mClusterCount);
+    }
+
+    auto clear = [](auto & cache) {
+        cache.ClearAttribute(ConcreteAttributePath(1, 2, 3));
+        cache.ClearAttributes(ConcreteClusterPath(2, 1));
+        cache.ClearAttributes(EndpointId(0));
+    };
+    clear(mapCache);
+    clear(flatCache);
+    ExpectSameAttributes(mapCache, flatCache);
+    EXPECT_EQ(flatCache.GetAttributeMemoryUsage().mAttributeCount, 69u);
+
+    // Updates after clearing land in the same arenas.
+    SendStorageTestReport(mapCache.GetBufferedCallback(), 3, 4, 10, 9);
+    SendStorageTestReport(flatCache.GetBufferedCallback(), 3, 4, 10, 9);
+    ExpectSameAttributes(mapCache, flatCache);
+}
+
 } // namespace
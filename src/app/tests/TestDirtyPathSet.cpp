@@ -0,0 +1,148 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/DirtyPathSet.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+namespace chip {
+namespace app {
+namespace reporting {
+namespace {
+
+size_t CountEntries(const DirtyPathSet & set, const AttributePathParams & path)
+{
+    size_t count = 0;
+    set.ForEachActiveObject([&](const auto * entry) {
+        if (static_cast<const AttributePathParams &>(*entry) == path)
+        {
+            count++;
+        }
+        return Loop::Continue;
+    });
+    return count;
+}
+
+TEST(TestDirtyPathSet, TestConcretePathsAreIndexed)
+{
+    DirtyPathSet set;
+    AttributeGeneration before(1);
+    AttributeGeneration generation(2);
+
+    // Spread the entries over endpoints and clusters so that several (endpoint, cluster) keys share buckets.
+    for (uint16_t i = 0; i < CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    {
+        ASSERT_NE(set.Insert(AttributePathParams(EndpointId(i % 3), ClusterId(i), AttributeId(i)), generation), nullptr);
+    }
+    EXPECT_EQ(set.Allocated(), static_cast<size_t>(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET));
+
+    for (uint16_t i = 0; i < CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    {
+        ConcreteAttributePath path(EndpointId(i % 3), ClusterId(i), AttributeId(i));
+        EXPECT_TRUE(set.IsDirtySince(path, before));
+        // Entries are only dirty for handlers that last reported before they were marked.
+        EXPECT_FALSE(set.IsDirtySince(path, generation));
+        EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(EndpointId(i % 3), ClusterId(i), AttributeId(i + 1)), before));
+        EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(EndpointId(i % 3 + 3), ClusterId(i), AttributeId(i)), before));
+    }
+
+    set.ReleaseAll();
+    EXPECT_EQ(set.Allocated(), 0u);
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(0, 0, 0), before));
+}
+
+TEST(TestDirtyPathSet, TestMergeOverlapped)
+{
+    DirtyPathSet set;
+    AttributeGeneration before(1);
+    AttributeGeneration first(2);
+    AttributeGeneration second(3);
+
+    ASSERT_NE(set.Insert(AttributePathParams(1, 6, 1), first), nullptr);
+    ASSERT_NE(set.Insert(AttributePathParams(1, 6, 2), first), nullptr);
+    ASSERT_NE(set.Insert(AttributePathParams(1, 8, 1), first), nullptr);
+    ASSERT_NE(set.Insert(AttributePathParams(2, 6, 1), first), nullptr);
+
+    // Covered by an existing entry: only the generation changes.
+    EXPECT_TRUE(set.MergeOverlapped(AttributePathParams(1, 6, 1, 0), second));
+    EXPECT_EQ(set.Allocated(), 4u);
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 6, 1), first));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(1, 6, 2), first));
+
+    // No overlap with anything in the set.
+    EXPECT_FALSE(set.MergeOverlapped(AttributePathParams(1, 6, 3), second));
+
+    // A wildcard attribute path replaces every entry of its cluster, and only those.
+    EXPECT_TRUE(set.MergeOverlapped(AttributePathParams(EndpointId(1), ClusterId(6)), second));
+    EXPECT_EQ(set.Allocated(), 3u);
+    EXPECT_EQ(CountEntries(set, AttributePathParams(EndpointId(1), ClusterId(6))), 1u);
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 6, 2), first));
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 6, 0x1234), first));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(1, 8, 1), first));
+
+    // A wildcard cluster path replaces every entry of its endpoint and is then found for any cluster.
+    EXPECT_TRUE(set.MergeOverlapped(AttributePathParams(EndpointId(1), kInvalidClusterId), second));
+    EXPECT_EQ(set.Allocated(), 2u);
+    EXPECT_EQ(CountEntries(set, AttributePathParams(EndpointId(1), kInvalidClusterId)), 1u);
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 8, 1), first));
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 0x1234, 1), first));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(2, 6, 1), first));
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(2, 6, 1), before));
+
+    // Concrete paths under the wildcard entry are merged into it.
+    EXPECT_TRUE(set.MergeOverlapped(AttributePathParams(1, 9, 9), second));
+    EXPECT_EQ(set.Allocated(), 2u);
+
+    set.ReleaseAll();
+}
+
+TEST(TestDirtyPathSet, TestMergeWhenExhausted)
+{
+    DirtyPathSet set;
+    AttributeGeneration before(1);
+
+    for (uint16_t i = 0; i < CHIP_IM_SERVER_MAX_NUM_DIRTY_SET; i++)
+    {
+        ASSERT_NE(set.Insert(AttributePathParams(EndpointId(1 + i % 2), ClusterId(i / 2), AttributeId(i)),
+                             AttributeGeneration(static_cast<uint32_t>(2 + i))),
+                  nullptr);
+    }
+
+    // Each (endpoint, cluster) pair holds a single entry, so merging by cluster cannot free anything.
+    EXPECT_FALSE(set.MergePathsUnderSameCluster());
+    EXPECT_TRUE(set.MergePathsUnderSameEndpoint());
+    EXPECT_EQ(set.Allocated(), 2u);
+    EXPECT_EQ(CountEntries(set, AttributePathParams(EndpointId(1), kInvalidClusterId)), 1u);
+    EXPECT_EQ(CountEntries(set, AttributePathParams(EndpointId(2), kInvalidClusterId)), 1u);
+
+    // The merged entries keep the newest generation of the entries they replaced.
+    AttributeGeneration newest(static_cast<uint32_t>(1 + CHIP_IM_SERVER_MAX_NUM_DIRTY_SET));
+    AttributeGeneration beforeNewest(static_cast<uint32_t>(CHIP_IM_SERVER_MAX_NUM_DIRTY_SET));
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(2, 0x55, 1), beforeNewest));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(2, 0x55, 1), newest));
+    EXPECT_TRUE(set.IsDirtySince(ConcreteAttributePath(1, 0x55, 1), before));
+    EXPECT_FALSE(set.IsDirtySince(ConcreteAttributePath(3, 0x55, 1), before));
+
+    set.ReleaseAll();
+}
+
+} // namespace
+} // namespace reporting
+} // namespace app
+} // namespace chip
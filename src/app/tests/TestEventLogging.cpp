@@ -17,10 +17,12 @@
  */
 
 #include <access/SubjectDescriptor.h>
+#include <app/EventLogStore.h>
 #include <app/EventLoggingDelegate.h>
 #include <app/EventLoggingTypes.h>
 #include <app/EventManagement.h>
 #include <app/InteractionModelEngine.h>
+#include <app/MessageDef/EventReportIB.h>
 #include <app/tests/AppTestContext.h>
 #include <data-model-providers/codegen/Instance.h>
 #include <lib/core/CHIPCore.h>
@@ -37,11 +39,15 @@
 #include <messaging/ExchangeContext.h>
 #include <messaging/Flags.h>
 #include <platform/CHIPDeviceLayer.h>
+#include <system/RAIIMockClock.h>
 #include <system/TLVPacketBufferBackingStore.h>
 
 #include <lib/core/StringBuilderAdapters.h>
 #include <pw_unit_test/framework.h>
 
+#include <thread>
+#include <vector>
+
 namespace {
 
 static const chip::ClusterId kLivenessClusterId   = 0x00000022;
@@ -288,4 +294,261 @@ TEST_F(TestEventLogging, TestCheckLogEventWithDiscardLowEvent)
     CheckLogState(logMgmt, 3, chip::app::PriorityLevel::Debug);
 }
 
+// Counts the events in the log with an event number of at least aEventMin, reading the whole log.
+static size_t CountLoggedEventsSince(chip::app::EventManagement & aLogMgmt, chip::EventNumber aEventMin)
+{
+    chip::TLV::TLVReader reader;
+    chip::app::CircularEventBufferWrapper bufWrapper;
+    size_t count = 0;
+    EXPECT_SUCCESS(aLogMgmt.GetEventReader(reader, chip::app::PriorityLevel::Critical, &bufWrapper));
+
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        chip::app::EventReportIB::Parser report;
+        chip::app::EventDataIB::Parser eventData;
+        chip::EventNumber eventNumber;
+        EXPECT_SUCCESS(report.Init(reader));
+        EXPECT_SUCCESS(report.GetEventData(&eventData));
+        EXPECT_SUCCESS(eventData.GetEventNumber(&eventNumber));
+        if (eventNumber >= aEventMin)
+        {
+            count++;
+        }
+    }
+    return count;
+}
+
+TEST_F(TestEventLogging, TestFetchEventsSinceAfterEviction)
+{
+    chip::EventNumber eid = 0;
+    chip::app::EventOptions options;
+    options.mPath = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    TestEventGenerator testEventGenerator;
+
+    // Log enough events of all priorities for them to be moved to more important buffers and dropped.
+    const chip::app::PriorityLevel priorities[] = { chip::app::PriorityLevel::Debug, chip::app::PriorityLevel::Info,
+                                                    chip::app::PriorityLevel::Critical };
+    chip::app::EventManagement & logMgmt        = chip::app::EventManagement::GetInstance();
+    for (int i = 0; i < 20; i++)
+    {
+        options.mPriority = priorities[i % 3];
+        testEventGenerator.SetStatus(i);
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+    }
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> path;
+    path.mValue.mEndpointId = kTestEndpointId1;
+    path.mValue.mClusterId  = kLivenessClusterId;
+
+    // Fetching since any event number gets the events that are still logged, and continues after the last one.
+    for (chip::EventNumber eventMin = 0; eventMin <= eid + 1; eventMin++)
+    {
+        chip::Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+        VerifyOrDie(backingStore.Alloc(1024));
+
+        chip::TLV::TLVWriter writer;
+        writer.Init(backingStore.Get(), 1024);
+
+        chip::EventNumber nextEventMin = eventMin;
+        size_t eventCount              = 0;
+        EXPECT_SUCCESS(logMgmt.FetchEventsSince(writer, &path, nextEventMin, eventCount, chip::Access::SubjectDescriptor{}));
+        EXPECT_EQ(eventCount, CountLoggedEventsSince(logMgmt, eventMin));
+        EXPECT_EQ(nextEventMin, eid + 1);
+    }
+}
+
+// Keeps the stored events in memory.
+class TestEventLogStore : public chip::app::EventLogStore
+{
+public:
+    CHIP_ERROR AppendEvent(chip::EventNumber aEventNumber, chip::FabricIndex, const chip::ByteSpan & aEvent) override
+    {
+        mEvents.push_back({ aEventNumber, std::vector<uint8_t>(aEvent.begin(), aEvent.end()) });
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR ForEachEvent(chip::EventNumber aEventMin, chip::EventNumber aEventMax,
+                            chip::TLV::Utilities::IterateHandler aHandler, void * apContext) override
+    {
+        mForEachEventCount++;
+        for (const auto & event : mEvents)
+        {
+            if (event.mEventNumber >= aEventMin && event.mEventNumber < aEventMax)
+            {
+                chip::TLV::TLVReader reader;
+                reader.Init(event.mData.data(), event.mData.size());
+                ReturnErrorOnFailure(reader.Next());
+                ReturnErrorOnFailure(aHandler(reader, 0, apContext));
+            }
+        }
+        return CHIP_NO_ERROR;
+    }
+
+    CHIP_ERROR FabricRemoved(chip::FabricIndex) override { return CHIP_NO_ERROR; }
+
+    chip::EventNumber GetNextEventNumber() const override { return mNextEventNumber; }
+
+    struct StoredEvent
+    {
+        chip::EventNumber mEventNumber;
+        std::vector<uint8_t> mData;
+    };
+    std::vector<StoredEvent> mEvents;
+    chip::EventNumber mNextEventNumber = 0;
+    size_t mForEachEventCount          = 0;
+};
+
+TEST_F(TestEventLogging, TestFetchEventsFromEventLogStore)
+{
+    chip::EventNumber eid = 0;
+    chip::app::EventOptions options;
+    options.mPath     = { kTestEndpointId1, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Debug;
+    TestEventGenerator testEventGenerator;
+    TestEventLogStore store;
+
+    // The event number counter moves past the events that the store already holds.
+    store.mNextEventNumber               = 100;
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    EXPECT_SUCCESS(logMgmt.SetEventLogStore(&store));
+
+    for (int i = 0; i < 10; i++)
+    {
+        testEventGenerator.SetStatus(i);
+        EXPECT_EQ(logMgmt.LogEvent(&testEventGenerator, options, eid), CHIP_NO_ERROR);
+        EXPECT_EQ(eid, static_cast<chip::EventNumber>(100 + i));
+    }
+    EXPECT_EQ(store.mEvents.size(), 10u);
+
+    // Only the last events fit in the debug buffer, the older ones are read from the store.
+    EXPECT_LT(CountLoggedEventsSince(logMgmt, 100), 10u);
+
+    chip::SingleLinkedListNode<chip::app::EventPathParams> path;
+    path.mValue.mEndpointId = kTestEndpointId1;
+    path.mValue.mClusterId  = kLivenessClusterId;
+
+    for (chip::EventNumber eventMin = 0; eventMin <= eid + 1; eventMin++)
+    {
+        chip::Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+        VerifyOrDie(backingStore.Alloc(1024));
+
+        chip::TLV::TLVWriter writer;
+        writer.Init(backingStore.Get(), 1024);
+
+        chip::EventNumber nextEventMin = eventMin;
+        size_t eventCount              = 0;
+        EXPECT_SUCCESS(logMgmt.FetchEventsSince(writer, &path, nextEventMin, eventCount, chip::Access::SubjectDescriptor{}));
+        EXPECT_EQ(eventCount, static_cast<size_t>(eid + 1 - std::max<chip::EventNumber>(eventMin, 100)));
+        EXPECT_EQ(nextEventMin, eid + 1);
+    }
+
+    // Events that are still buffered are not looked up in the store.
+    {
+        chip::Platform::ScopedMemoryBuffer<uint8_t> backingStore;
+        VerifyOrDie(backingStore.Alloc(1024));
+
+        chip::TLV::TLVWriter writer;
+        writer.Init(backingStore.Get(), 1024);
+
+        const size_t forEachEventCount = store.mForEachEventCount;
+        chip::EventNumber nextEventMin = eid;
+        size_t eventCount              = 0;
+        EXPECT_SUCCESS(logMgmt.FetchEventsSince(writer, &path, nextEventMin, eventCount, chip::Access::SubjectDescriptor{}));
+        EXPECT_EQ(eventCount, 1u);
+        EXPECT_EQ(store.mForEachEventCount, forEachEventCount);
+    }
+
+    EXPECT_SUCCESS(logMgmt.SetEventLogStore(nullptr));
+}
+
+#if CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+// Reads the headers of all the events in the log, oldest first.
+static std::vector<chip::app::EventHeader> ReadLoggedEventHeaders(chip::app::EventManagement & aLogMgmt)
+{
+    chip::TLV::TLVReader reader;
+    chip::app::CircularEventBufferWrapper bufWrapper;
+    std::vector<chip::app::EventHeader> headers;
+    EXPECT_SUCCESS(aLogMgmt.GetEventReader(reader, chip::app::PriorityLevel::Critical, &bufWrapper));
+
+    while (reader.Next() == CHIP_NO_ERROR)
+    {
+        chip::app::EventReportIB::Parser report;
+        chip::app::EventDataIB::Parser eventData;
+        chip::app::EventHeader header;
+        EXPECT_SUCCESS(report.Init(reader));
+        EXPECT_SUCCESS(report.GetEventData(&eventData));
+        EXPECT_SUCCESS(eventData.DecodeEventHeader(header));
+        headers.push_back(header);
+    }
+    return headers;
+}
+
+TEST_F(TestEventLogging, TestLogEventFromAnyThreadBeforeLogEvent)
+{
+    constexpr chip::EndpointId kFirstStagedEndpointId  = 10;
+    constexpr chip::EndpointId kSecondStagedEndpointId = 11;
+    constexpr chip::EndpointId kLoggedEndpointId       = 12;
+
+    chip::app::EventManagement & logMgmt = chip::app::EventManagement::GetInstance();
+    TestEventGenerator testEventGenerator;
+    testEventGenerator.SetStatus(0);
+
+    // Keep the clock where it is, but under the control of the test.
+    const chip::System::Clock::Milliseconds64 monotonicNow = chip::System::SystemClock().GetMonotonicMilliseconds64();
+    chip::System::Clock::Microseconds64 realNow;
+    if (chip::System::SystemClock().GetClock_RealTime(realNow) != CHIP_NO_ERROR)
+    {
+        realNow = chip::System::Clock::kZero;
+    }
+    chip::System::Clock::Internal::RAIIMockClock clock;
+    auto setTime = [&](uint32_t offsetMs) {
+        clock.SetMonotonic(monotonicNow + chip::System::Clock::Milliseconds64(offsetMs));
+        EXPECT_SUCCESS(clock.SetClock_RealTime(realNow + chip::System::Clock::Milliseconds64(offsetMs)));
+    };
+
+    auto stageFromOtherThread = [&](chip::EndpointId endpointId) {
+        chip::app::EventOptions options;
+        options.mPath     = { endpointId, kLivenessClusterId, kLivenessChangeEvent };
+        options.mPriority = chip::app::PriorityLevel::Critical;
+        std::thread thread([&]() { EXPECT_SUCCESS(logMgmt.LogEventFromAnyThread(&testEventGenerator, options)); });
+        thread.join();
+    };
+
+    const chip::app::EventStagingStats statsBefore = logMgmt.GetStagingStats();
+
+    setTime(2000);
+    stageFromOtherThread(kFirstStagedEndpointId);
+    // The second event carries an earlier timestamp, as when its thread read the clock before the first event was
+    // staged but staged it after.
+    setTime(1000);
+    stageFromOtherThread(kSecondStagedEndpointId);
+
+    setTime(3000);
+    chip::app::EventOptions options;
+    options.mPath     = { kLoggedEndpointId, kLivenessClusterId, kLivenessChangeEvent };
+    options.mPriority = chip::app::PriorityLevel::Critical;
+    chip::EventNumber eid;
+    EXPECT_SUCCESS(logMgmt.LogEvent(&testEventGenerator, options, eid));
+
+    EXPECT_EQ(logMgmt.GetStagingStats().mLogged, statsBefore.mLogged + 2);
+
+    // The staged events are logged first, in the order they were staged, and their timestamps never go backwards.
+    std::vector<chip::app::EventHeader> headers = ReadLoggedEventHeaders(logMgmt);
+    ASSERT_EQ(headers.size(), 3u);
+    EXPECT_EQ(headers[0].mPath.mEndpointId, kFirstStagedEndpointId);
+    EXPECT_EQ(headers[1].mPath.mEndpointId, kSecondStagedEndpointId);
+    EXPECT_EQ(headers[2].mPath.mEndpointId, kLoggedEndpointId);
+    EXPECT_EQ(headers[0].mEventNumber + 1, headers[1].mEventNumber);
+    EXPECT_EQ(headers[1].mEventNumber + 1, headers[2].mEventNumber);
+    EXPECT_EQ(headers[2].mEventNumber, eid);
+
+    for (const auto & header : headers)
+    {
+        EXPECT_EQ(header.mTimestamp.mType, headers[0].mTimestamp.mType);
+    }
+    EXPECT_EQ(headers[1].mTimestamp.mValue, headers[0].mTimestamp.mValue);
+    EXPECT_EQ(headers[2].mTimestamp.mValue, headers[0].mTimestamp.mValue + 1000);
+}
+#endif // CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+
 } // namespace
@@ -0,0 +1,251 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/EventStagingQueue.h>
+
+#include <app/MessageDef/EventDataIB.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <pw_unit_test/framework.h>
+
+#if CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
+
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using namespace chip::app;
+
+constexpr TLV::Tag kDataTag = TLV::ContextTag(EventDataIB::Tag::kData);
+
+class TestEventWriter : public EventLoggingDelegate
+{
+public:
+    TestEventWriter(uint32_t aValue, size_t aPadding = 0) : mValue(aValue), mPadding(aPadding) {}
+
+    CHIP_ERROR WriteEvent(TLV::TLVWriter & aWriter) override
+    {
+        TLV::TLVType containerType;
+        ReturnErrorOnFailure(aWriter.StartContainer(kDataTag, TLV::kTLVType_Structure, containerType));
+        ReturnErrorOnFailure(aWriter.Put(TLV::ContextTag(0), mValue));
+        if (mPadding > 0)
+        {
+            std::vector<uint8_t> padding(mPadding);
+            ReturnErrorOnFailure(aWriter.PutBytes(TLV::ContextTag(1), padding.data(), static_cast<uint32_t>(padding.size())));
+        }
+        return aWriter.EndContainer(containerType);
+    }
+
+private:
+    uint32_t mValue;
+    size_t mPadding;
+};
+
+EventOptions MakeOptions()
+{
+    EventOptions options;
+    options.mPath     = ConcreteEventPath(1, 2, 3);
+    options.mPriority = PriorityLevel::Info;
+    return options;
+}
+
+// Decodes the value that TestEventWriter wrote for a staged event.
+uint32_t StagedValue(EventStagingQueue::StagedEvent & aEvent)
+{
+    uint8_t buffer[EventStagingQueue::kMaxPayloadSize];
+    TLV::TLVWriter writer;
+    TLV::TLVType containerType;
+    writer.Init(buffer);
+    EXPECT_EQ(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType), CHIP_NO_ERROR);
+    EXPECT_EQ(aEvent.WriteEvent(writer), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.EndContainer(containerType), CHIP_NO_ERROR);
+    EXPECT_EQ(writer.Finalize(), CHIP_NO_ERROR);
+
+    TLV::TLVReader reader;
+    uint32_t value = 0;
+    reader.Init(buffer, writer.GetLengthWritten());
+    EXPECT_EQ(reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag()), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.EnterContainer(containerType), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(TLV::kTLVType_Structure, kDataTag), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.EnterContainer(containerType), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Next(TLV::ContextTag(0)), CHIP_NO_ERROR);
+    EXPECT_EQ(reader.Get(value), CHIP_NO_ERROR);
+    return value;
+}
+
+TEST(TestEventStagingQueue, TestStageAndDrain)
+{
+    auto queue = std::make_unique<EventStagingQueue>();
+
+    EXPECT_EQ(queue->Front(), nullptr);
+    EXPECT_TRUE(queue->RequestDrain());
+    EXPECT_FALSE(queue->RequestDrain());
+    queue->StartDrain();
+
+    // The event data must fit in a slot.
+    TestEventWriter tooLarge(101, EventStagingQueue::kMaxPayloadSize);
+    EXPECT_EQ(queue->Stage(tooLarge, MakeOptions(), Timestamp()), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    for (uint32_t i = 0; i < EventStagingQueue::kQueueSize; i++)
+    {
+        TestEventWriter writer(i);
+        EXPECT_EQ(queue->Stage(writer, MakeOptions(), Timestamp::System(System::Clock::Milliseconds64(i))), CHIP_NO_ERROR);
+    }
+
+    // The queue of this thread is full.
+    TestEventWriter overflow(100);
+    EXPECT_EQ(queue->Stage(overflow, MakeOptions(), Timestamp()), CHIP_ERROR_NO_MEMORY);
+
+    for (uint32_t i = 0; i < EventStagingQueue::kQueueSize; i++)
+    {
+        EventStagingQueue::StagedEvent * event = queue->Front();
+        ASSERT_NE(event, nullptr);
+        EXPECT_EQ(StagedValue(*event), i);
+        EXPECT_EQ(event->GetTimestamp().mValue, i);
+        EXPECT_EQ(event->GetOptions().mPath, ConcreteEventPath(1, 2, 3));
+        queue->PopFront(i % 2 == 0);
+    }
+    EXPECT_EQ(queue->Front(), nullptr);
+
+    EventStagingStats stats = queue->GetStats();
+    EXPECT_EQ(stats.mStaged, EventStagingQueue::kQueueSize);
+    EXPECT_EQ(stats.mLogged, EventStagingQueue::kQueueSize / 2);
+    EXPECT_EQ(stats.mDroppedLogFailed, EventStagingQueue::kQueueSize / 2);
+    EXPECT_EQ(stats.mDroppedQueueFull, 1u);
+    EXPECT_EQ(stats.mDroppedTooLarge, 1u);
+    EXPECT_EQ(stats.mDroppedNoQueue, 0u);
+}
+
+TEST(TestEventStagingQueue, TestConcurrentProducers)
+{
+    constexpr uint32_t kThreads         = CHIP_CONFIG_EVENT_STAGING_QUEUES;
+    constexpr uint32_t kEventsPerThread = 1000;
+
+    auto queue = std::make_unique<EventStagingQueue>();
+    std::atomic<uint32_t> running{ kThreads };
+    std::atomic<uint64_t> attempts{ 0 };
+    std::vector<std::thread> threads;
+
+    for (uint32_t t = 0; t < kThreads; t++)
+    {
+        threads.emplace_back([&, t]() {
+            for (uint32_t i = 0; i < kEventsPerThread; i++)
+            {
+                TestEventWriter writer(t << 16 | i);
+                attempts++;
+                while (queue->Stage(writer, MakeOptions(), Timestamp()) == CHIP_ERROR_NO_MEMORY)
+                {
+                    attempts++;
+                    std::this_thread::yield();
+                }
+            }
+            running--;
+        });
+    }
+
+    // Drain while producers run: the events of each thread come out in the order that thread staged them.
+    std::vector<int64_t> lastValue(kThreads, -1);
+    uint32_t drained = 0;
+    while (running > 0 || queue->Front() != nullptr)
+    {
+        EventStagingQueue::StagedEvent * event = queue->Front();
+        if (event == nullptr)
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        const uint32_t value  = StagedValue(*event);
+        const uint32_t thread = value >> 16;
+        ASSERT_LT(thread, kThreads);
+        EXPECT_EQ(lastValue[thread] + 1, static_cast<int64_t>(value & 0xFFFF));
+        lastValue[thread] = value & 0xFFFF;
+        queue->PopFront(true);
+        drained++;
+    }
+
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    EventStagingStats stats = queue->GetStats();
+    EXPECT_EQ(drained, kThreads * kEventsPerThread);
+    EXPECT_EQ(stats.mStaged, drained);
+    EXPECT_EQ(stats.mLogged, drained);
+    EXPECT_EQ(stats.mStaged + stats.mDroppedQueueFull, attempts.load());
+    EXPECT_EQ(stats.mDroppedNoQueue, 0u);
+}
+
+TEST(TestEventStagingQueue, TestQueuesReleasedOnThreadExit)
+{
+    auto queue = std::make_unique<EventStagingQueue>();
+    std::atomic<uint32_t> staged{ 0 };
+    std::atomic<bool> done{ false };
+    std::vector<std::thread> threads;
+
+    // Each thread keeps its queue until it exits.
+    for (uint32_t t = 0; t < CHIP_CONFIG_EVENT_STAGING_QUEUES; t++)
+    {
+        threads.emplace_back([&, t]() {
+            TestEventWriter writer(t);
+            EXPECT_EQ(queue->Stage(writer, MakeOptions(), Timestamp()), CHIP_NO_ERROR);
+            staged++;
+            while (!done)
+            {
+                std::this_thread::yield();
+            }
+        });
+    }
+    while (staged < CHIP_CONFIG_EVENT_STAGING_QUEUES)
+    {
+        std::this_thread::yield();
+    }
+
+    TestEventWriter writer(100);
+    EXPECT_EQ(queue->Stage(writer, MakeOptions(), Timestamp()), CHIP_ERROR_NO_MEMORY);
+    EXPECT_EQ(queue->GetStats().mDroppedNoQueue, 1u);
+
+    done = true;
+    for (auto & thread : threads)
+    {
+        thread.join();
+    }
+
+    // Events staged by threads that exited are still there, after them come the events of a new thread.
+    EXPECT_EQ(queue->Stage(writer, MakeOptions(), Timestamp()), CHIP_NO_ERROR);
+    for (uint32_t i = 0; i <= CHIP_CONFIG_EVENT_STAGING_QUEUES; i++)
+    {
+        EventStagingQueue::StagedEvent * event = queue->Front();
+        ASSERT_NE(event, nullptr);
+        if (i == CHIP_CONFIG_EVENT_STAGING_QUEUES)
+        {
+            EXPECT_EQ(StagedValue(*event), 100u);
+        }
+        queue->PopFront(true);
+    }
+    EXPECT_EQ(queue->Front(), nullptr);
+}
+
+} // namespace
+
+#endif // CHIP_CONFIG_EVENT_STAGING_QUEUES > 0
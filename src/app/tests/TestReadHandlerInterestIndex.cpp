@@ -0,0 +1,191 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <app/reporting/ReadHandlerInterestIndex.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <pw_unit_test/framework.h>
+
+#include <algorithm>
+#include <vector>
+
+namespace chip {
+namespace app {
+namespace reporting {
+
+class TestReadHandlerInterestIndex : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+protected:
+    // What Add() does when it cannot allocate a record for the read handler.
+    static void AddWithoutRecord(ReadHandlerInterestIndex & index, ReadHandler & handler) { index.AddRecordless(handler); }
+
+    static constexpr size_t kMaxRecordlessReadHandlers = ReadHandlerInterestIndex::kMaxRecordlessReadHandlers;
+};
+
+namespace {
+
+// The index only stores and compares read handler pointers, so stand-ins are enough here.
+struct FakeReadHandlers
+{
+    alignas(void *) uint8_t mStorage[200];
+
+    ReadHandler & operator[](size_t i) { return *reinterpret_cast<ReadHandler *>(&mStorage[i]); }
+};
+
+std::vector<ReadHandler *> Query(ReadHandlerInterestIndex & index, const AttributePathParams & path)
+{
+    std::vector<ReadHandler *> handlers;
+    EXPECT_TRUE(index.ForEachInterestedHandler(path, [&](ReadHandler * handler) { handlers.push_back(handler); }));
+    return handlers;
+}
+
+TEST_F(TestReadHandlerInterestIndex, TestConcreteAndWildcardPaths)
+{
+    ReadHandlerInterestIndex index;
+    FakeReadHandlers handlers;
+
+    // Handler 0: two attributes of the same cluster (must be reported once), plus an unrelated cluster.
+    SingleLinkedListNode<AttributePathParams> paths0[] = { { AttributePathParams(1, 6, 0) },
+                                                           { AttributePathParams(1, 6, 1) },
+                                                           { AttributePathParams(2, 8, 0) } };
+    paths0[0].mpNext                                   = &paths0[1];
+    paths0[1].mpNext                                   = &paths0[2];
+    EXPECT_EQ(index.Add(handlers[0], paths0), CHIP_NO_ERROR);
+
+    // Handler 1: every cluster on endpoint 1.
+    SingleLinkedListNode<AttributePathParams> paths1[] = { { AttributePathParams(EndpointId(1)) } };
+    EXPECT_EQ(index.Add(handlers[1], paths1), CHIP_NO_ERROR);
+
+    // Handler 2: cluster 6 on every endpoint, plus a full wildcard.
+    SingleLinkedListNode<AttributePathParams> paths2[] = { { AttributePathParams(ClusterId(6), kInvalidAttributeId) },
+                                                           { AttributePathParams() } };
+    paths2[0].mpNext                                   = &paths2[1];
+    EXPECT_EQ(index.Add(handlers[2], paths2), CHIP_NO_ERROR);
+
+    auto changed = Query(index, AttributePathParams(1, 6, 1));
+    EXPECT_EQ(changed.size(), 3u);
+    EXPECT_EQ(std::count(changed.begin(), changed.end(), &handlers[0]), 1);
+
+    changed = Query(index, AttributePathParams(1, 6, 5));
+    EXPECT_EQ(changed.size(), 2u);
+    EXPECT_EQ(std::count(changed.begin(), changed.end(), &handlers[0]), 0);
+
+    changed = Query(index, AttributePathParams(2, 8, 0));
+    EXPECT_EQ(changed.size(), 2u);
+    EXPECT_EQ(std::count(changed.begin(), changed.end(), &handlers[1]), 0);
+
+    // Changes with a wildcard endpoint or cluster have to check every read handler.
+    EXPECT_FALSE(index.ForEachInterestedHandler(AttributePathParams(EndpointId(1)), [](ReadHandler *) {}));
+
+    index.Remove(handlers[2]);
+    changed = Query(index, AttributePathParams(3, 9, 9));
+    EXPECT_TRUE(changed.empty());
+    changed = Query(index, AttributePathParams(1, 6, 0));
+    EXPECT_EQ(changed.size(), 2u);
+
+    // Removing twice, or removing a read handler that was never added, is harmless.
+    index.Remove(handlers[2]);
+    index.Remove(handlers[0]);
+    index.Remove(handlers[1]);
+    EXPECT_TRUE(Query(index, AttributePathParams(1, 6, 0)).empty());
+}
+
+TEST_F(TestReadHandlerInterestIndex, TestRemoveAmongManyReadHandlers)
+{
+    constexpr size_t kHandlerCount = 200;
+
+    ReadHandlerInterestIndex index;
+    FakeReadHandlers handlers;
+
+    // Every handler watches its own cluster on endpoint 1, so a query finds exactly the handler still indexed for it.
+    SingleLinkedListNode<AttributePathParams> paths[kHandlerCount];
+    for (size_t i = 0; i < kHandlerCount; i++)
+    {
+        paths[i].mValue = AttributePathParams(1, static_cast<ClusterId>(i), kInvalidAttributeId);
+        EXPECT_EQ(index.Add(handlers[i], &paths[i]), CHIP_NO_ERROR);
+    }
+
+    // Remove every other handler, in reverse order.
+    for (size_t i = kHandlerCount; i > 0; i -= 2)
+    {
+        index.Remove(handlers[i - 1]);
+    }
+
+    for (size_t i = 0; i < kHandlerCount; i++)
+    {
+        auto changed = Query(index, AttributePathParams(1, static_cast<ClusterId>(i), 0));
+        if (i % 2 == 1)
+        {
+            EXPECT_TRUE(changed.empty()) << "Cluster " << i;
+            continue;
+        }
+        ASSERT_EQ(changed.size(), 1u) << "Cluster " << i;
+        EXPECT_EQ(changed[0], &handlers[i]);
+    }
+
+    for (size_t i = 0; i < kHandlerCount; i += 2)
+    {
+        index.Remove(handlers[i]);
+    }
+    EXPECT_TRUE(Query(index, AttributePathParams(1, 0, 0)).empty());
+}
+
+TEST_F(TestReadHandlerInterestIndex, TestFallbackEndsWhenUnindexedReadHandlerIsRemoved)
+{
+    ReadHandlerInterestIndex index;
+    FakeReadHandlers handlers;
+
+    SingleLinkedListNode<AttributePathParams> paths0[] = { { AttributePathParams(1, 6, 0) } };
+    EXPECT_EQ(index.Add(handlers[0], paths0), CHIP_NO_ERROR);
+
+    AddWithoutRecord(index, handlers[1]);
+    EXPECT_FALSE(index.ForEachInterestedHandler(AttributePathParams(1, 6, 0), [](ReadHandler *) {}));
+
+    // Removing a read handler the index never saw does not end the fallback.
+    index.Remove(handlers[2]);
+    EXPECT_FALSE(index.ForEachInterestedHandler(AttributePathParams(1, 6, 0), [](ReadHandler *) {}));
+
+    index.Remove(handlers[1]);
+    auto changed = Query(index, AttributePathParams(1, 6, 0));
+    ASSERT_EQ(changed.size(), 1u);
+    EXPECT_EQ(changed[0], &handlers[0]);
+
+    // Once more read handlers fail than the index can remember, only Clear() ends the fallback.
+    for (size_t i = 0; i <= kMaxRecordlessReadHandlers; i++)
+    {
+        AddWithoutRecord(index, handlers[1 + i]);
+    }
+    for (size_t i = 0; i <= kMaxRecordlessReadHandlers; i++)
+    {
+        index.Remove(handlers[1 + i]);
+    }
+    EXPECT_FALSE(index.ForEachInterestedHandler(AttributePathParams(1, 6, 0), [](ReadHandler *) {}));
+
+    index.Clear();
+    EXPECT_TRUE(Query(index, AttributePathParams(1, 6, 0)).empty());
+}
+
+} // namespace
+} // namespace reporting
+} // namespace app
+} // namespace chip
@@ -169,11 +169,8 @@ bool TestReportingEngine::VerifyDirtySetContent(const Args &... args)
 
 bool TestReportingEngine::InsertToDirtySet(const AttributePathParams & aPath)
 {
-    auto path = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    VerifyOrReturnError(path != nullptr, false);
-    *path             = aPath;
-    path->mGeneration = InteractionModelEngine::GetInstance()->GetReportingEngine().GetDirtySetGeneration();
-    return true;
+    Engine & engine = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    return engine.mGlobalDirtySet.Insert(aPath, engine.GetDirtySetGeneration()) != nullptr;
 }
 
 TEST_F_FROM_FIXTURE(TestReportingEngine, TestBuildAndSendSingleReportData)
@@ -232,10 +229,9 @@ TEST_F_FROM_FIXTURE(TestReportingEngine, TestMergeOverlappedAttributePath)
                                                           app::reporting::GetDefaultReportScheduler()),
               CHIP_NO_ERROR);
 
-    AttributePathParams * clusterInfo = InteractionModelEngine::GetInstance()->GetReportingEngine().mGlobalDirtySet.CreateObject();
-    clusterInfo->mEndpointId          = 1;
-    clusterInfo->mClusterId           = 1;
-    clusterInfo->mAttributeId         = 1;
+    Engine & engine                   = InteractionModelEngine::GetInstance()->GetReportingEngine();
+    AttributePathParams * clusterInfo = engine.mGlobalDirtySet.Insert(AttributePathParams(1, 1, 1), engine.GetDirtySetGeneration());
+    ASSERT_NE(clusterInfo, nullptr);
 
     {
         AttributePathParams testClusterInfo;
@@ -39,6 +39,8 @@
 #include <platform/LockTracker.h>
 #include <protocols/interaction_model/StatusCode.h>
 
+#include <algorithm>
+
 using chip::Protocols::InteractionModel::Status;
 
 // Attribute storage depends on knowing the current layout/setup of attributes
@@ -94,6 +96,27 @@ uint16_t emberEndpointCount = 0;
 /// ember metadata (e.g. changing dynamic endpoints or enabling/disabling endpoints)
 unsigned emberMetadataStructureGeneration = 0;
 
+/// Lookup index over the enabled endpoints, sorted by endpoint id, so that attribute
+/// access does not have to walk every endpoint (and accumulate storage offsets) to find
+/// the one it wants. It is rebuilt lazily whenever emberMetadataStructureGeneration changes.
+///
+/// Since a lookup may rebuild the index, lookups write to this global state and, like every
+/// other change to the ember metadata, MUST happen on the Matter stack thread (or with the
+/// stack lock held).
+struct EnabledEndpointIndexEntry
+{
+    EndpointId endpoint;
+    uint16_t endpointIndex;
+    // Offset in attributeData of the first attribute stored for this endpoint. Only meaningful
+    // for fixed endpoints, since dynamic endpoints do not use internal attribute storage.
+    uint16_t storageOffset;
+};
+
+EnabledEndpointIndexEntry enabledEndpointIndex[MAX_ENDPOINT_COUNT];
+uint16_t enabledEndpointIndexCount      = 0;
+unsigned enabledEndpointIndexGeneration = 0;
+bool enabledEndpointIndexValid          = false;
+
 // If we have attributes that are more than 4 bytes, then
 // we need this data block for the defaults
 #if (defined(GENERATED_DEFAULTS) && GENERATED_DEFAULTS_COUNT)
@@ -147,6 +170,58 @@ bool emberAfIsThisDataTypeAListType(EmberAfAttributeType dataType)
     return dataType == ZCL_ARRAY_ATTRIBUTE_TYPE;
 }
 
+// Must run on the Matter stack thread, see enabledEndpointIndex.
+void rebuildEnabledEndpointIndex()
+{
+    uint16_t storageOffset = 0;
+
+    enabledEndpointIndexCount = 0;
+    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    {
+        if (emAfEndpoints[ep].endpoint != kInvalidEndpointId && emberAfEndpointIndexIsEnabled(ep))
+        {
+            enabledEndpointIndex[enabledEndpointIndexCount++] = { emAfEndpoints[ep].endpoint, ep, storageOffset };
+        }
+
+        // Dynamic endpoints are external and don't factor into storage size
+        if (ep < emberAfFixedEndpointCount())
+        {
+            storageOffset = static_cast<uint16_t>(storageOffset + emAfEndpoints[ep].endpointType->endpointSize);
+        }
+    }
+
+    auto * begin = enabledEndpointIndex;
+    auto * end   = enabledEndpointIndex + enabledEndpointIndexCount;
+    std::sort(begin, end, [](const EnabledEndpointIndexEntry & a, const EnabledEndpointIndexEntry & b) {
+        return (a.endpoint != b.endpoint) ? (a.endpoint < b.endpoint) : (a.endpointIndex < b.endpointIndex);
+    });
+
+    // Should an endpoint id be present more than once, lookups have always resolved to the lowest index.
+    end = std::unique(begin, end, [](const EnabledEndpointIndexEntry & a, const EnabledEndpointIndexEntry & b) {
+        return a.endpoint == b.endpoint;
+    });
+    enabledEndpointIndexCount = static_cast<uint16_t>(end - begin);
+
+    enabledEndpointIndexGeneration = emberMetadataStructureGeneration;
+    enabledEndpointIndexValid      = true;
+}
+
+// Returns the index entry for an enabled endpoint, or nullptr if there is no such endpoint.
+// Rebuilds the index first if the metadata changed, so this must run on the Matter stack thread.
+const EnabledEndpointIndexEntry * findEnabledEndpoint(EndpointId endpoint)
+{
+    if (!enabledEndpointIndexValid || enabledEndpointIndexGeneration != emberMetadataStructureGeneration)
+    {
+        rebuildEnabledEndpointIndex();
+    }
+
+    const EnabledEndpointIndexEntry * begin = enabledEndpointIndex;
+    const EnabledEndpointIndexEntry * end   = enabledEndpointIndex + enabledEndpointIndexCount;
+    const EnabledEndpointIndexEntry * entry =
+        std::lower_bound(begin, end, endpoint, [](const EnabledEndpointIndexEntry & e, EndpointId id) { return e.endpoint < id; });
+    return (entry != end && entry->endpoint == endpoint) ? entry : nullptr;
+}
+
 uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints)
 {
     if (endpoint == kInvalidEndpointId)
@@ -154,6 +229,12 @@ uint16_t findIndexFromEndpoint(EndpointId endpoint, bool ignoreDisabledEndpoints
         return kEmberInvalidEndpointIndex;
     }
 
+    if (ignoreDisabledEndpoints)
+    {
+        const EnabledEndpointIndexEntry * entry = findEnabledEndpoint(endpoint);
+        return (entry != nullptr) ? entry->endpointIndex : kEmberInvalidEndpointIndex;
+    }
+
     uint16_t epi;
     for (epi = 0; epi < emberAfEndpointCount(); epi++)
     {
@@ -270,11 +351,14 @@ void emberAfEndpointConfigure()
         }
     }
 #endif
+
+    emberMetadataStructureGeneration++;
 }
 
 void emberAfSetDynamicEndpointCount(uint16_t dynamicEndpointCount)
 {
     emberEndpointCount = static_cast<uint16_t>(FIXED_ENDPOINT_COUNT + dynamicEndpointCount);
+    emberMetadataStructureGeneration++;
 }
 
 uint16_t emberAfGetDynamicIndexFromEndpoint(EndpointId id)
@@ -662,121 +746,107 @@ Status emAfReadOrWriteAttribute(const EmberAfAttributeSearchRecord * attRecord,
 {
     assertChipStackLockedByCurrentThread();
 
-    uint16_t attributeOffsetIndex = 0;
-
-    for (uint16_t ep = 0; ep < emberAfEndpointCount(); ep++)
+    const EnabledEndpointIndexEntry * endpointEntry = findEnabledEndpoint(attRecord->endpoint);
+    if (endpointEntry == nullptr)
     {
-        // Is this a dynamic endpoint?
-        bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+        return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+    }
 
-        if (emAfEndpoints[ep].endpoint == attRecord->endpoint)
-        {
-            const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
-            uint8_t clusterIndex;
-            if (!emberAfEndpointIndexIsEnabled(ep))
-            {
-                continue;
-            }
-            for (clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    uint16_t ep                              = endpointEntry->endpointIndex;
+    uint16_t attributeOffsetIndex            = endpointEntry->storageOffset;
+    const EmberAfEndpointType * endpointType = emAfEndpoints[ep].endpointType;
+
+    // Is this a dynamic endpoint?
+    bool isDynamicEndpoint = (ep >= emberAfFixedEndpointCount());
+
+    for (uint8_t clusterIndex = 0; clusterIndex < endpointType->clusterCount; clusterIndex++)
+    {
+        const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
+        if (emAfMatchCluster(cluster, attRecord))
+        { // Got the cluster
+            uint16_t attrIndex;
+            for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
             {
-                const EmberAfCluster * cluster = &(endpointType->cluster[clusterIndex]);
-                if (emAfMatchCluster(cluster, attRecord))
-                { // Got the cluster
-                    uint16_t attrIndex;
-                    for (attrIndex = 0; attrIndex < cluster->attributeCount; attrIndex++)
+                const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
+                if (emAfMatchAttribute(cluster, am, attRecord))
+                { // Got the attribute
+                    // If passed metadata location is not null, populate
+                    if (metadata != nullptr)
                     {
-                        const EmberAfAttributeMetadata * am = &(cluster->attributes[attrIndex]);
-                        if (emAfMatchAttribute(cluster, am, attRecord))
-                        { // Got the attribute
-                            // If passed metadata location is not null, populate
-                            if (metadata != nullptr)
-                            {
-                                *metadata = am;
-                            }
-
-                            uint8_t * attributeLocation = attributeData + attributeOffsetIndex;
-                            uint8_t *src, *dst;
-                            if (write)
-                            {
-                                src = buffer;
-                                dst = attributeLocation;
-                                if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId,
-                                                                         am->attributeId))
-                                {
-                                    return Status::UnsupportedAccess;
-                                }
-                            }
-                            else
-                            {
-                                if (buffer == nullptr)
-                                {
-                                    return Status::Success;
-                                }
-
-                                src = attributeLocation;
-                                dst = buffer;
-                                if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
-                                {
-                                    return Status::UnsupportedAccess;
-                                }
-                            }
+                        *metadata = am;
+                    }
 
-                            // Is the attribute externally stored?
-                            if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
-                            {
-                                if (write)
-                                {
-                                    return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am,
-                                                                                 buffer);
-                                }
-
-                                if (readLength < emberAfAttributeSize(am))
-                                {
-                                    // Prevent a potential buffer overflow
-                                    return Status::ResourceExhausted;
-                                }
-
-                                return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
-                                                                            emberAfAttributeSize(am));
-                            }
+                    uint8_t * attributeLocation = attributeData + attributeOffsetIndex;
+                    uint8_t *src, *dst;
+                    if (write)
+                    {
+                        src = buffer;
+                        dst = attributeLocation;
+                        if (!emberAfAttributeWriteAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+                        {
+                            return Status::UnsupportedAccess;
+                        }
+                    }
+                    else
+                    {
+                        if (buffer == nullptr)
+                        {
+                            return Status::Success;
+                        }
 
-                            // Internal storage is only supported for fixed endpoints
-                            if (!isDynamicEndpoint)
-                            {
-                                return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
-                            }
+                        src = attributeLocation;
+                        dst = buffer;
+                        if (!emberAfAttributeReadAccessCallback(attRecord->endpoint, attRecord->clusterId, am->attributeId))
+                        {
+                            return Status::UnsupportedAccess;
+                        }
+                    }
 
-                            return Status::Failure;
+                    // Is the attribute externally stored?
+                    if (am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE)
+                    {
+                        if (write)
+                        {
+                            return emberAfExternalAttributeWriteCallback(attRecord->endpoint, attRecord->clusterId, am, buffer);
                         }
 
-                        // Not the attribute we are looking for
-                        // Increase the index if attribute is not externally stored
-                        if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+                        if (readLength < emberAfAttributeSize(am))
                         {
-                            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                            // Prevent a potential buffer overflow
+                            return Status::ResourceExhausted;
                         }
+
+                        return emberAfExternalAttributeReadCallback(attRecord->endpoint, attRecord->clusterId, am, buffer,
+                                                                    emberAfAttributeSize(am));
                     }
 
-                    // Attribute is not in the cluster.
-                    return Status::UnsupportedAttribute;
+                    // Internal storage is only supported for fixed endpoints
+                    if (!isDynamicEndpoint)
+                    {
+                        return typeSensitiveMemCopy(attRecord->clusterId, dst, src, am, write, readLength);
+                    }
+
+                    return Status::Failure;
                 }
 
-                // Not the cluster we are looking for
-                attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
+                // Not the attribute we are looking for
+                // Increase the index if attribute is not externally stored
+                if (!(am->mask & MATTER_ATTRIBUTE_FLAG_EXTERNAL_STORAGE))
+                {
+                    attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emberAfAttributeSize(am));
+                }
             }
 
-            // Cluster is not in the endpoint.
-            return Status::UnsupportedCluster;
+            // Attribute is not in the cluster.
+            return Status::UnsupportedAttribute;
         }
 
-        // Not the endpoint we are looking for
-        // Dynamic endpoints are external and don't factor into storage size
-        if (!isDynamicEndpoint)
-        {
-            attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + emAfEndpoints[ep].endpointType->endpointSize);
-        }
+        // Not the cluster we are looking for
+        attributeOffsetIndex = static_cast<uint16_t>(attributeOffsetIndex + cluster->clusterSize);
     }
-    return Status::UnsupportedEndpoint; // Sorry, endpoint was not found.
+
+    // Cluster is not in the endpoint.
+    return Status::UnsupportedCluster;
 }
 
 const EmberAfEndpointType * emberAfFindEndpointType(EndpointId endpointId)
@@ -1006,6 +1076,8 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable, MatterCluste
     if (enable)
     {
         emAfEndpoints[index].bitmask.Set(EmberAfEndpointOptions::isEnabled);
+        // Cluster init callbacks below may already access attributes on the endpoint.
+        emberMetadataStructureGeneration++;
     }
 
     if (currentlyEnabled != enable)
@@ -1018,6 +1090,8 @@ bool emberAfEndpointEnableDisable(EndpointId endpoint, bool enable, MatterCluste
         {
             shutdownEndpoint(&(emAfEndpoints[index]), shutdownType);
             emAfEndpoints[index].bitmask.Clear(EmberAfEndpointOptions::isEnabled);
+            // The change notifications below must no longer find the endpoint.
+            emberMetadataStructureGeneration++;
         }
 
         // The Descriptor cluster on Endpoint 0 subscribing to OnEndpointChanged events.
@@ -38,6 +38,7 @@
 #endif
 
 #include <app/server/Dnssd.h>
+#include <protocols/secure_channel/CASECryptoWorkerPool.h>
 #include <protocols/secure_channel/CASEServer.h>
 #include <protocols/secure_channel/SimpleSessionResumptionStorage.h>
 
@@ -539,6 +540,9 @@ void DeviceControllerSystemState::Shutdown()
         mCASESessionManager = nullptr;
     }
 
+    // No CASE handshake is left to post work, so the crypto worker threads (if any) can be stopped.
+    CASECryptoWorkerPool::Instance().Shutdown();
+
     // The above took care of CASE handshakes, and shutting down all the
     // controllers should have taken care of the PASE handshakes.  Clean up any
     // outstanding secure sessions (shouldn't really be any, since controllers
@@ -0,0 +1,167 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <pw_unit_test/framework.h>
+
+#include "app-common/zap-generated/ids/Clusters.h"
+#include "data-model-providers/codegen/Instance.h"
+#include "protocols/interaction_model/StatusCode.h"
+#include <app/InteractionModelEngine.h>
+#include <app/tests/AppTestContext.h>
+#include <app/util/DataModelHandler.h>
+#include <app/util/attribute-storage.h>
+#include <app/util/attribute-table.h>
+#include <app/util/endpoint-config-api.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/tests/ExtraPwTestMacros.h>
+
+using namespace chip;
+using namespace chip::app;
+using namespace chip::app::Clusters;
+using chip::Protocols::InteractionModel::Status;
+
+namespace {
+
+// The generated endpoint_config for the controller app only has fixed endpoint 1.
+constexpr EndpointId kTestEndpointId2 = 2;
+constexpr EndpointId kTestEndpointId3 = 3;
+constexpr EndpointId kTestEndpointId4 = 4;
+
+constexpr AttributeId kSharedAttribute = 0x00000001;
+constexpr AttributeId kEndpoint2Only   = 0x00000002;
+constexpr AttributeId kEndpoint3Only   = 0x00000003;
+
+//clang-format off
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(testEndpoint2Attrs)
+DECLARE_DYNAMIC_ATTRIBUTE(kSharedAttribute, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE(kEndpoint2Only, INT8U, 1, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testEndpoint2Clusters)
+DECLARE_DYNAMIC_CLUSTER(UnitTesting::Id, testEndpoint2Attrs, ZAP_CLUSTER_MASK(SERVER), nullptr, nullptr),
+    DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(testEndpoint2, testEndpoint2Clusters);
+
+DECLARE_DYNAMIC_ATTRIBUTE_LIST_BEGIN(testEndpoint3Attrs)
+DECLARE_DYNAMIC_ATTRIBUTE(kSharedAttribute, INT8U, 1, 0), DECLARE_DYNAMIC_ATTRIBUTE(kEndpoint3Only, INT8U, 1, 0),
+    DECLARE_DYNAMIC_ATTRIBUTE_LIST_END();
+
+DECLARE_DYNAMIC_CLUSTER_LIST_BEGIN(testEndpoint3Clusters)
+DECLARE_DYNAMIC_CLUSTER(UnitTesting::Id, testEndpoint3Attrs, ZAP_CLUSTER_MASK(SERVER), nullptr, nullptr),
+    DECLARE_DYNAMIC_CLUSTER_LIST_END;
+
+DECLARE_DYNAMIC_ENDPOINT(testEndpoint3, testEndpoint3Clusters);
+//clang-format on
+
+// Checks every way of looking up an attribute of an endpoint, which should all agree on whether it exists.
+void ExpectAttribute(EndpointId endpoint, AttributeId attribute, bool present)
+{
+    const EmberAfAttributeMetadata * metadata = emberAfLocateAttributeMetadata(endpoint, UnitTesting::Id, attribute);
+    if (present)
+    {
+        ASSERT_NE(metadata, nullptr);
+        EXPECT_EQ(metadata->attributeId, attribute);
+        // Without a buffer, a read only checks that the attribute can be read.
+        EXPECT_EQ(emberAfReadAttribute(endpoint, UnitTesting::Id, attribute, nullptr, 0), Status::Success);
+    }
+    else
+    {
+        EXPECT_EQ(metadata, nullptr);
+        EXPECT_NE(emberAfReadAttribute(endpoint, UnitTesting::Id, attribute, nullptr, 0), Status::Success);
+    }
+}
+
+void ExpectNoEndpoint(EndpointId endpoint)
+{
+    EXPECT_EQ(emberAfIndexFromEndpoint(endpoint), kEmberInvalidEndpointIndex);
+    EXPECT_EQ(emberAfLocateAttributeMetadata(endpoint, UnitTesting::Id, kSharedAttribute), nullptr);
+    EXPECT_EQ(emberAfReadAttribute(endpoint, UnitTesting::Id, kSharedAttribute, nullptr, 0), Status::UnsupportedEndpoint);
+}
+
+class TestAttributeStorage : public chip::Testing::AppContext
+{
+};
+
+// Endpoint and attribute lookups go through an index of the enabled endpoints, which has to follow every change
+// of the dynamic endpoints.
+TEST_F(TestAttributeStorage, TestEndpointIndexFollowsDynamicEndpoints)
+{
+    app::InteractionModelEngine * engine = app::InteractionModelEngine::GetInstance();
+
+    // Initialize the ember side server logic
+    engine->SetDataModelProvider(CodegenDataModelProviderInstance(nullptr /* delegate */));
+    InitDataModelHandler();
+
+    const uint16_t fixedCount = emberAfFixedEndpointCount();
+    ASSERT_GT(fixedCount, 0u);
+    const EndpointId fixedEndpoint = emberAfEndpointFromIndex(0);
+    EXPECT_EQ(emberAfIndexFromEndpoint(fixedEndpoint), 0u);
+
+    DataVersion dataVersionStorage2[MATTER_ARRAY_SIZE(testEndpoint2Clusters)];
+    DataVersion dataVersionStorage3[MATTER_ARRAY_SIZE(testEndpoint3Clusters)];
+
+    ExpectNoEndpoint(kTestEndpointId2);
+    ExpectNoEndpoint(kTestEndpointId3);
+
+    // Add endpoints.
+    EXPECT_SUCCESS(emberAfSetDynamicEndpoint(0, kTestEndpointId2, &testEndpoint2, Span<DataVersion>(dataVersionStorage2)));
+    EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId2), fixedCount);
+    ExpectAttribute(kTestEndpointId2, kSharedAttribute, true);
+    ExpectAttribute(kTestEndpointId2, kEndpoint2Only, true);
+    ExpectAttribute(kTestEndpointId2, kEndpoint3Only, false);
+    ExpectNoEndpoint(kTestEndpointId3);
+
+    EXPECT_SUCCESS(emberAfSetDynamicEndpoint(1, kTestEndpointId3, &testEndpoint3, Span<DataVersion>(dataVersionStorage3)));
+    EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId2), fixedCount);
+    EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId3), static_cast<uint16_t>(fixedCount + 1));
+    ExpectAttribute(kTestEndpointId3, kSharedAttribute, true);
+    ExpectAttribute(kTestEndpointId3, kEndpoint2Only, false);
+    ExpectAttribute(kTestEndpointId3, kEndpoint3Only, true);
+
+    // Disable and enable an endpoint.
+    EXPECT_TRUE(emberAfEndpointEnableDisable(kTestEndpointId2, false));
+    ExpectNoEndpoint(kTestEndpointId2);
+    EXPECT_EQ(emberAfGetDynamicIndexFromEndpoint(kTestEndpointId2), 0u);
+    EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId3), static_cast<uint16_t>(fixedCount + 1));
+    ExpectAttribute(kTestEndpointId3, kEndpoint3Only, true);
+
+    EXPECT_TRUE(emberAfEndpointEnableDisable(kTestEndpointId2, true));
+    EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId2), fixedCount);
+    ExpectAttribute(kTestEndpointId2, kEndpoint2Only, true);
+    ExpectAttribute(kTestEndpointId3, kEndpoint3Only, true);
+
+    // Remove an endpoint, then reuse its slot for another endpoint id.
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kTestEndpointId2);
+    ExpectNoEndpoint(kTestEndpointId2);
+    EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId3), static_cast<uint16_t>(fixedCount + 1));
+    ExpectAttribute(kTestEndpointId3, kSharedAttribute, true);
+
+    EXPECT_SUCCESS(emberAfSetDynamicEndpoint(0, kTestEndpointId4, &testEndpoint2, Span<DataVersion>(dataVersionStorage2)));
+    ExpectNoEndpoint(kTestEndpointId2);
+    EXPECT_EQ(emberAfIndexFromEndpoint(kTestEndpointId4), fixedCount);
+    ExpectAttribute(kTestEndpointId4, kEndpoint2Only, true);
+    ExpectAttribute(kTestEndpointId3, kEndpoint3Only, true);
+
+    EXPECT_EQ(emberAfClearDynamicEndpoint(1), kTestEndpointId3);
+    EXPECT_EQ(emberAfClearDynamicEndpoint(0), kTestEndpointId4);
+    ExpectNoEndpoint(kTestEndpointId3);
+    ExpectNoEndpoint(kTestEndpointId4);
+    EXPECT_EQ(emberAfIndexFromEndpoint(fixedEndpoint), 0u);
+}
+
+} // namespace
@@ -29,6 +29,7 @@
 
 #include <credentials/CHIPCert_Internal.h>
 #include <credentials/CHIPCertificateSet.h>
+#include <credentials/VerifiedIssuerCache.h>
 #include <lib/asn1/ASN1.h>
 #include <lib/asn1/ASN1Macros.h>
 #include <lib/core/CHIPCore.h>
@@ -411,8 +412,16 @@ CHIP_ERROR ChipCertificateSet::ValidateCert(const ChipCertificateData * cert, Va
     }
 
     // Verify signature of the current certificate against public key of the CA certificate. If signature verification
-    // succeeds, the current certificate is valid.
-    err = VerifyCertSignature(*cert, *caCert);
+    // succeeds, the current certificate is valid. Issuer certificates are shared by many chains, so their checks may
+    // be answered by the verified issuer cache.
+    if (depth > 0 && context.mVerifiedIssuerCache != nullptr)
+    {
+        err = context.mVerifiedIssuerCache->VerifyCertSignature(context.mVerifiedIssuerFabricIndex, *cert, *caCert);
+    }
+    else
+    {
+        err = VerifyCertSignature(*cert, *caCert);
+    }
     SuccessOrExit(err);
 
 exit:
@@ -500,9 +509,11 @@ bool ChipCertificateData::IsEqual(const ChipCertificateData & other) const
 
 void ValidationContext::Reset()
 {
-    mEffectiveTime  = EffectiveTime{};
-    mTrustAnchor    = nullptr;
-    mValidityPolicy = nullptr;
+    mEffectiveTime             = EffectiveTime{};
+    mTrustAnchor               = nullptr;
+    mValidityPolicy            = nullptr;
+    mVerifiedIssuerCache       = nullptr;
+    mVerifiedIssuerFabricIndex = kUndefinedFabricIndex;
     mRequiredKeyUsages.ClearAll();
     mRequiredKeyPurposes.ClearAll();
     mRequiredCertType = CertType::kNotSpecified;
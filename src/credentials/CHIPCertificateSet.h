@@ -37,6 +37,8 @@
 namespace chip {
 namespace Credentials {
 
+class VerifiedIssuerCache;
+
 struct CurrentChipEpochTime : chip::System::Clock::Seconds32
 {
     template <typename... Args>
@@ -74,6 +76,9 @@ struct ValidationContext
 
     CertificateValidityPolicy * mValidityPolicy =
         nullptr; /**< Optional application policy to apply for certificate validity period evaluation. */
+    VerifiedIssuerCache * mVerifiedIssuerCache =
+        nullptr; /**< Optional cache of issuer certificate signatures already verified, see FabricTable. */
+    FabricIndex mVerifiedIssuerFabricIndex = kUndefinedFabricIndex; /**< Fabric whose mVerifiedIssuerCache entries apply. */
 
     void Reset();
 
@@ -394,10 +394,17 @@ CHIP_ERROR FabricTable::VerifyCredentials(FabricIndex fabricIndex, ByteSpan noc,
     uint8_t rootCertBuf[kMaxCHIPCertLength];
     MutableByteSpan rootCertSpan{ rootCertBuf };
     ReturnErrorOnFailure(FetchRootCert(fabricIndex, rootCertSpan));
+    UseVerifiedIssuerCache(fabricIndex, context);
     return VerifyCredentials(noc, icac, rootCertSpan, context, outCompressedFabricId, outFabricId, outNodeId, outNocPubkey,
                              outRootPublicKey);
 }
 
+void FabricTable::UseVerifiedIssuerCache(FabricIndex fabricIndex, ValidationContext & context) const
+{
+    context.mVerifiedIssuerCache       = &mVerifiedIssuerCache;
+    context.mVerifiedIssuerFabricIndex = fabricIndex;
+}
+
 CHIP_ERROR FabricTable::VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, ValidationContext & context,
                                           CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                           Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey)
@@ -780,6 +787,8 @@ public:
 CHIP_ERROR FabricTable::NotifyFabricUpdated(FabricIndex fabricIndex)
 {
     MATTER_TRACE_SCOPE("NotifyFabricUpdated", "Fabric");
+    mVerifiedIssuerCache.Invalidate(fabricIndex);
+
     FabricTable::Delegate * delegate = mDelegateListRoot;
     while (delegate)
     {
@@ -1037,6 +1046,8 @@ CHIP_ERROR FabricTable::Delete(FabricIndex fabricIndex)
         }
     }
 
+    mVerifiedIssuerCache.Invalidate(fabricIndex);
+
     if (mDelegateListRoot != nullptr)
     {
         FabricTable::Delegate * delegate = mDelegateListRoot;
@@ -1096,6 +1107,13 @@ CHIP_ERROR FabricTable::Init(const FabricTable::InitParams & initParams)
     }
     mNextAvailableFabricIndex.SetValue(kMinValidFabricIndex);
 
+    // Without its lock the verified issuer cache is bypassed, which only costs performance.
+    CHIP_ERROR cacheErr = mVerifiedIssuerCache.Init();
+    if (cacheErr != CHIP_NO_ERROR)
+    {
+        ChipLogError(FabricProvisioning, "Failed to init verified issuer cache: %" CHIP_ERROR_FORMAT, cacheErr.Format());
+    }
+
     // Init failure of Last Known Good Time is non-fatal.  If Last Known Good
     // Time is unknown during incoming certificate validation for CASE and
     // current time is also unknown, the certificate validity policy will see
@@ -1181,6 +1199,7 @@ void FabricTable::Shutdown()
         // direct lookups fail.
         fabricInfo.Reset();
     }
+    mVerifiedIssuerCache.Clear();
 
     mStorage = nullptr;
 }
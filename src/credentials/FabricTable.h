@@ -29,6 +29,7 @@
 #include <credentials/CertificateValidityPolicy.h>
 #include <credentials/LastKnownGoodTime.h>
 #include <credentials/OperationalCertificateStore.h>
+#include <credentials/VerifiedIssuerCache.h>
 #include <crypto/CHIPCryptoPAL.h>
 #include <crypto/OperationalKeystore.h>
 #include <lib/core/CHIPEncoding.h>
@@ -1016,6 +1017,17 @@ public:
     static CHIP_ERROR VerifyCredentials(ByteSpan noc, ByteSpan icac, ByteSpan rcac, Credentials::ValidationContext & context,
                                         CompressedFabricId & outCompressedFabricId, FabricId & outFabricId, NodeId & outNodeId,
                                         Crypto::P256PublicKey & outNocPubkey, Crypto::P256PublicKey * outRootPublicKey = nullptr);
+
+    /**
+     * @brief Let certificate chain validations using `context` for the given fabric reuse, and record, the ICAC
+     *        signature checks remembered by this table. The instance VerifyCredentials() does this on its own;
+     *        callers of the static one (e.g. CASE validation off the Matter thread) opt in with this.
+     *
+     * Entries of a fabric are dropped when it is updated or removed.
+     */
+    void UseVerifiedIssuerCache(FabricIndex fabricIndex, Credentials::ValidationContext & context) const;
+
+    Credentials::VerifiedIssuerCache::Stats GetVerifiedIssuerCacheStats() const { return mVerifiedIssuerCache.GetStats(); }
     /**
      * @brief Enables FabricInfo instances to collide and reference the same logical fabric (i.e Root Public Key + FabricId).
      *
@@ -1298,6 +1310,9 @@ private:
 
     LastKnownGoodTime mLastKnownGoodTime;
 
+    // Mutable since const validations record their checks; it has its own lock.
+    mutable Credentials::VerifiedIssuerCache mVerifiedIssuerCache;
+
     // We may not have an mNextAvailableFabricIndex if our table is as large as
     // it can go and is full.
     Optional<FabricIndex> mNextAvailableFabricIndex;
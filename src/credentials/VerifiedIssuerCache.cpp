@@ -0,0 +1,152 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <credentials/VerifiedIssuerCache.h>
+
+#include <lib/support/CodeUtils.h>
+
+#include <mutex>
+
+namespace chip {
+namespace Credentials {
+
+using namespace chip::Crypto;
+
+CHIP_ERROR VerifiedIssuerCache::Init()
+{
+    VerifyOrReturnError(!mInitialized, CHIP_NO_ERROR);
+#if !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    ReturnErrorOnFailure(System::Mutex::Init(mLock));
+#endif // !CHIP_SYSTEM_CONFIG_NO_LOCKING
+    mInitialized = true;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR VerifiedIssuerCache::VerifyCertSignature(FabricIndex fabricIndex, const ChipCertificateData & cert,
+                                                    const ChipCertificateData & signer)
+{
+    uint8_t digest[kSHA256_Hash_Length];
+    MutableByteSpan digestSpan(digest);
+    if (kCacheSize == 0 || !mInitialized || ComputeDigest(cert, signer, digestSpan) != CHIP_NO_ERROR)
+    {
+        // Nothing we could cache: let the regular check report the problem, if any.
+        return Credentials::VerifyCertSignature(cert, signer);
+    }
+
+    if (Lookup(fabricIndex, digestSpan))
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    ReturnErrorOnFailure(Credentials::VerifyCertSignature(cert, signer));
+    Insert(fabricIndex, digestSpan);
+
+    return CHIP_NO_ERROR;
+}
+
+void VerifiedIssuerCache::Invalidate(FabricIndex fabricIndex)
+{
+    VerifyOrReturn(mInitialized);
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    for (auto & entry : mEntries)
+    {
+        if (entry.fabricIndex == fabricIndex)
+        {
+            entry = Entry();
+        }
+    }
+}
+
+void VerifiedIssuerCache::Clear()
+{
+    VerifyOrReturn(mInitialized);
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    for (auto & entry : mEntries)
+    {
+        entry = Entry();
+    }
+    mUseCounter = 0;
+}
+
+VerifiedIssuerCache::Stats VerifiedIssuerCache::GetStats()
+{
+    VerifyOrReturnValue(mInitialized, Stats{});
+    std::lock_guard<System::Mutex> lock(mLock);
+    return mStats;
+}
+
+CHIP_ERROR VerifiedIssuerCache::ComputeDigest(const ChipCertificateData & cert, const ChipCertificateData & signer,
+                                              MutableByteSpan & outDigest)
+{
+    VerifyOrReturnError(cert.mCertFlags.Has(CertFlags::kTBSHashPresent), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(cert.mSigAlgoOID == ASN1::kOID_SigAlgo_ECDSAWithSHA256, CHIP_ERROR_UNSUPPORTED_SIGNATURE_TYPE);
+
+    Hash_SHA256_stream hash;
+    ReturnErrorOnFailure(hash.Begin());
+    ReturnErrorOnFailure(hash.AddData(ByteSpan(cert.mTBSHash)));
+    ReturnErrorOnFailure(hash.AddData(cert.mSignature));
+    ReturnErrorOnFailure(hash.AddData(signer.mPublicKey));
+    return hash.Finish(outDigest);
+}
+
+bool VerifiedIssuerCache::Lookup(FabricIndex fabricIndex, const ByteSpan & digest)
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    for (auto & entry : mEntries)
+    {
+        if (entry.fabricIndex == fabricIndex && digest.data_equal(ByteSpan(entry.digest)))
+        {
+            entry.lastUsed = ++mUseCounter;
+            mStats.hits++;
+            return true;
+        }
+    }
+
+    mStats.misses++;
+    return false;
+}
+
+void VerifiedIssuerCache::Insert(FabricIndex fabricIndex, const ByteSpan & digest)
+{
+    std::lock_guard<System::Mutex> lock(mLock);
+
+    // Prefer a free entry, then the least recently used one. Another thread may have recorded the
+    // same check meanwhile, in which case there is nothing to do.
+    Entry * victim = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (entry.fabricIndex == fabricIndex && digest.data_equal(ByteSpan(entry.digest)))
+        {
+            return;
+        }
+        if (victim == nullptr || (victim->fabricIndex != kUndefinedFabricIndex &&
+                                  (entry.fabricIndex == kUndefinedFabricIndex || entry.lastUsed < victim->lastUsed)))
+        {
+            victim = &entry;
+        }
+    }
+
+    victim->fabricIndex = fabricIndex;
+    memcpy(victim->digest, digest.data(), sizeof(victim->digest));
+    victim->lastUsed = ++mUseCounter;
+}
+
+} // namespace Credentials
+} // namespace chip
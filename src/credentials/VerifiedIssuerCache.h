@@ -0,0 +1,111 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Cache of issuer (ICA) certificate signatures already verified during operational
+ *      certificate chain validation.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <credentials/CHIPCert.h>
+#include <crypto/CHIPCryptoPAL.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/core/DataModelTypes.h>
+#include <system/SystemMutex.h>
+
+namespace chip {
+namespace Credentials {
+
+/**
+ * Remembers, per fabric, the issuer certificates whose signature has been verified, so that validating the
+ * NOC chain of every CASE peer does not re-verify the ECDSA signature of an ICAC that was already checked.
+ *
+ * An entry is the SHA-256 digest of the certificate's TBS hash, its signature and the signer's public key,
+ * so it only ever stands for a signature that verified under that exact key. Only the signature check is
+ * skipped: validity period, key usage and path checks are still applied on every validation.
+ *
+ * The cache may be used from several threads at once (CASE validation runs off the Matter thread).
+ */
+class VerifiedIssuerCache
+{
+public:
+    static constexpr size_t kCacheSize = CHIP_CONFIG_VERIFIED_ISSUER_CACHE_SIZE;
+
+    struct Stats
+    {
+        uint32_t hits;   ///< Signature checks answered from the cache.
+        uint32_t misses; ///< Signature checks that had to be computed.
+    };
+
+    VerifiedIssuerCache() = default;
+
+    VerifiedIssuerCache(const VerifiedIssuerCache &)             = delete;
+    VerifiedIssuerCache & operator=(const VerifiedIssuerCache &) = delete;
+
+    /**
+     * Set up the lock. Until this succeeds every check is passed through to VerifyCertSignature().
+     */
+    CHIP_ERROR Init();
+
+    /**
+     * Same as VerifyCertSignature(cert, signer), answered from the entries of `fabricIndex` when
+     * possible. Successful checks are recorded for the fabric.
+     */
+    CHIP_ERROR VerifyCertSignature(FabricIndex fabricIndex, const ChipCertificateData & cert, const ChipCertificateData & signer);
+
+    /**
+     * Drop the entries of the given fabric.
+     */
+    void Invalidate(FabricIndex fabricIndex);
+
+    /**
+     * Drop every entry.
+     */
+    void Clear();
+
+    Stats GetStats();
+
+private:
+    struct Entry
+    {
+        FabricIndex fabricIndex                     = kUndefinedFabricIndex;
+        uint8_t digest[Crypto::kSHA256_Hash_Length] = {};
+        uint32_t lastUsed                           = 0;
+    };
+
+    static CHIP_ERROR ComputeDigest(const ChipCertificateData & cert, const ChipCertificateData & signer,
+                                    MutableByteSpan & outDigest);
+
+    bool Lookup(FabricIndex fabricIndex, const ByteSpan & digest);
+    void Insert(FabricIndex fabricIndex, const ByteSpan & digest);
+
+    System::Mutex mLock;
+    bool mInitialized = false;
+
+    Entry mEntries[kCacheSize > 0 ? kCacheSize : 1];
+    uint32_t mUseCounter = 0;
+    Stats mStats         = {};
+};
+
+} // namespace Credentials
+} // namespace chip
@@ -28,6 +28,7 @@
 #include <pw_unit_test/framework.h>
 
 #include <credentials/CHIPCert.h>
+#include <credentials/VerifiedIssuerCache.h>
 #include <credentials/examples/LastKnownGoodTimeCertificateValidityPolicyExample.h>
 #include <credentials/examples/StrictCertificateValidityPolicyExample.h>
 #include <crypto/CHIPCryptoPAL.h>
@@ -1363,6 +1364,73 @@ TEST_F(TestChipCert, TestChipCert_LoadDuplicateCerts)
     EXPECT_EQ(certSet.GetCertCount(), 3);
 }
 
+TEST_F(TestChipCert, TestChipCert_VerifiedIssuerCache)
+{
+    constexpr FabricIndex kFabricIndex = 1;
+
+    VerifiedIssuerCache cache;
+    EXPECT_EQ(cache.Init(), CHIP_NO_ERROR);
+
+    auto validateNode01_01 = [&](FabricIndex fabricIndex) {
+        ChipCertificateSet certSet;
+        ValidationContext validContext;
+
+        EXPECT_EQ(certSet.Init(kStandardCertsCount), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadTestCert(certSet, TestCert::kRoot01, sNullLoadFlag, sTrustAnchorFlag), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadTestCert(certSet, TestCert::kICA01, sNullLoadFlag, sGenTBSHashFlag), CHIP_NO_ERROR);
+        EXPECT_EQ(LoadTestCert(certSet, TestCert::kNode01_01, sNullLoadFlag, sGenTBSHashFlag), CHIP_NO_ERROR);
+
+        validContext.Reset();
+        EXPECT_EQ(SetCurrentTime(validContext, 2021, 1, 1), CHIP_NO_ERROR);
+        validContext.mVerifiedIssuerCache       = &cache;
+        validContext.mVerifiedIssuerFabricIndex = fabricIndex;
+
+        const ChipCertificateData * resultCert = nullptr;
+        const ChipCertificateData * nocCert    = certSet.GetLastCert();
+        EXPECT_EQ(certSet.FindValidCert(nocCert->mSubjectDN, nocCert->mSubjectKeyId, validContext, &resultCert), CHIP_NO_ERROR);
+        EXPECT_EQ(resultCert, nocCert);
+        EXPECT_EQ(validContext.mTrustAnchor, &certSet.GetCertSet()[0]);
+    };
+
+    // The first validation verifies the ICAC signature, the second one reuses it.
+    validateNode01_01(kFabricIndex);
+    EXPECT_EQ(cache.GetStats().hits, 0u);
+    EXPECT_EQ(cache.GetStats().misses, 1u);
+
+    validateNode01_01(kFabricIndex);
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+    EXPECT_EQ(cache.GetStats().misses, 1u);
+
+    // Entries are per fabric.
+    validateNode01_01(kFabricIndex + 1);
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+    EXPECT_EQ(cache.GetStats().misses, 2u);
+
+    cache.Invalidate(kFabricIndex);
+    validateNode01_01(kFabricIndex);
+    EXPECT_EQ(cache.GetStats().hits, 1u);
+    EXPECT_EQ(cache.GetStats().misses, 3u);
+
+    // A signature that does not verify is never recorded.
+    {
+        ChipCertificateData icaCert;
+        ChipCertificateData wrongRootCert;
+        ByteSpan cert;
+
+        EXPECT_EQ(GetTestCert(TestCert::kICA01, sNullLoadFlag, cert), CHIP_NO_ERROR);
+        EXPECT_EQ(DecodeChipCert(cert, icaCert, CertDecodeFlags::kGenerateTBSHash), CHIP_NO_ERROR);
+        EXPECT_EQ(GetTestCert(TestCert::kRoot02, sNullLoadFlag, cert), CHIP_NO_ERROR);
+        EXPECT_EQ(DecodeChipCert(cert, wrongRootCert), CHIP_NO_ERROR);
+
+        for (int i = 0; i < 2; i++)
+        {
+            EXPECT_NE(cache.VerifyCertSignature(kFabricIndex, icaCert, wrongRootCert), CHIP_NO_ERROR);
+        }
+        EXPECT_EQ(cache.GetStats().hits, 1u);
+        EXPECT_EQ(cache.GetStats().misses, 5u);
+    }
+}
+
 TEST_F(TestChipCert, TestChipCert_GenerateRootCert)
 {
     // Generate a new keypair for cert signing
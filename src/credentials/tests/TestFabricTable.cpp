@@ -297,6 +297,45 @@ TEST_F(TestFabricTable, TestLastKnownGoodTimeInit)
     EXPECT_EQ(lastKnownGoodChipEpochTime, firmwareBuildTime);
 }
 
+TEST_F(TestFabricTable, TestVerifiedIssuerCache)
+{
+    chip::TestPersistentStorageDelegate testStorage;
+    ScopedFabricTable fabricTableHolder;
+
+    EXPECT_EQ(fabricTableHolder.Init(&testStorage), CHIP_NO_ERROR);
+    FabricTable & fabricTable = fabricTableHolder.GetFabricTable();
+
+    auto verifyNode01_01 = [&fabricTable](FabricIndex fabricIndex) {
+        Credentials::ValidationContext validContext;
+        validContext.Reset();
+        CompressedFabricId compressedFabricId;
+        FabricId fabricId;
+        NodeId nodeId;
+        Crypto::P256PublicKey nocPubKey;
+        return fabricTable.VerifyCredentials(fabricIndex, ByteSpan(TestCerts::sTestCert_Node01_01_Chip),
+                                             ByteSpan(TestCerts::sTestCert_ICA01_Chip), validContext, compressedFabricId, fabricId,
+                                             nodeId, nocPubKey);
+    };
+
+    EXPECT_EQ(LoadTestFabric_Node01_01(fabricTable, /* doCommit = */ true), CHIP_NO_ERROR);
+    FabricIndex fabricIndex = fabricTable.begin()->GetFabricIndex();
+
+    // Only the first validation of the chain verifies the ICAC signature.
+    EXPECT_EQ(verifyNode01_01(fabricIndex), CHIP_NO_ERROR);
+    EXPECT_EQ(verifyNode01_01(fabricIndex), CHIP_NO_ERROR);
+    EXPECT_EQ(fabricTable.GetVerifiedIssuerCacheStats().hits, 1u);
+    EXPECT_EQ(fabricTable.GetVerifiedIssuerCacheStats().misses, 1u);
+
+    // Removing the fabric drops what was verified for it.
+    EXPECT_EQ(fabricTable.Delete(fabricIndex), CHIP_NO_ERROR);
+    EXPECT_EQ(LoadTestFabric_Node01_01(fabricTable, /* doCommit = */ true), CHIP_NO_ERROR);
+    fabricIndex = fabricTable.begin()->GetFabricIndex();
+
+    EXPECT_EQ(verifyNode01_01(fabricIndex), CHIP_NO_ERROR);
+    EXPECT_EQ(fabricTable.GetVerifiedIssuerCacheStats().hits, 1u);
+    EXPECT_EQ(fabricTable.GetVerifiedIssuerCacheStats().misses, 2u);
+}
+
 TEST_F(TestFabricTable, TestCollidingFabrics)
 {
     chip::TestPersistentStorageDelegate testStorage;
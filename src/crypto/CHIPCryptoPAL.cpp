@@ -31,8 +31,10 @@
 #include <lib/support/BufferReader.h>
 #include <lib/support/BufferWriter.h>
 #include <lib/support/BytesToHex.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CHIPMemString.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
 #include <lib/support/Span.h>
 #include <lib/support/StringBuilder.h>
 #include <lib/support/TypeTraits.h>
@@ -1335,5 +1337,151 @@ __attribute__((weak)) CHIP_ERROR P256Keypair::ECDSA_sign_msg_det(const uint8_t *
     return CHIP_ERROR_UNSUPPORTED_CHIP_FEATURE;
 }
 
+// Backends that do not keep a cipher context between messages use the one-shot AES-CCM functions.
+__attribute__((weak)) CHIP_ERROR Aes128CcmContext::Init(const Aes128KeyHandle & key, size_t nonce_length, size_t tag_length)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    mKey         = &key;
+    mNonceLength = nonce_length;
+    mTagLength   = tag_length;
+
+    return CHIP_NO_ERROR;
+}
+
+__attribute__((weak)) void Aes128CcmContext::Release()
+{
+    mKey         = nullptr;
+    mNonceLength = 0;
+    mTagLength   = 0;
+}
+
+__attribute__((weak)) CHIP_ERROR Aes128CcmContext::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad,
+                                                           size_t aad_length, const uint8_t * nonce, size_t nonce_length,
+                                                           uint8_t * ciphertext, uint8_t * tag, size_t tag_length)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag, tag_length);
+}
+
+__attribute__((weak)) CHIP_ERROR Aes128CcmContext::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
+                                                           const uint8_t * aad, size_t aad_length, const uint8_t * tag,
+                                                           size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                                           uint8_t * plaintext)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length,
+                           plaintext);
+}
+
+
+// Backends without a faster batch path process the entries one at a time.
+__attribute__((weak)) CHIP_ERROR AES_CCM_encrypt_batch(AesCcmBatchEntry * entries, size_t count)
+{
+    VerifyOrReturnError(entries != nullptr || count == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+    for (size_t i = 0; i < count; i++)
+    {
+        AesCcmBatchEntry & entry = entries[i];
+        if (entry.context != nullptr && entry.context->IsInitialized())
+        {
+            entry.result = entry.context->Encrypt(entry.input, entry.input_length, entry.aad, entry.aad_length, entry.nonce,
+                                                  entry.nonce_length, entry.output, entry.tag, entry.tag_length);
+        }
+        else if (entry.key != nullptr)
+        {
+            entry.result = AES_CCM_encrypt(entry.input, entry.input_length, entry.aad, entry.aad_length, *entry.key, entry.nonce,
+                                           entry.nonce_length, entry.output, entry.tag, entry.tag_length);
+        }
+        else
+        {
+            entry.result = CHIP_ERROR_INVALID_ARGUMENT;
+        }
+
+        if (firstError == CHIP_NO_ERROR)
+        {
+            firstError = entry.result;
+        }
+    }
+    return firstError;
+}
+
+__attribute__((weak)) CHIP_ERROR AES_CCM_decrypt_batch(AesCcmBatchEntry * entries, size_t count)
+{
+    VerifyOrReturnError(entries != nullptr || count == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    CHIP_ERROR firstError = CHIP_NO_ERROR;
+    for (size_t i = 0; i < count; i++)
+    {
+        AesCcmBatchEntry & entry = entries[i];
+        if (entry.context != nullptr && entry.context->IsInitialized())
+        {
+            entry.result = entry.context->Decrypt(entry.input, entry.input_length, entry.aad, entry.aad_length, entry.tag,
+                                                  entry.tag_length, entry.nonce, entry.nonce_length, entry.output);
+        }
+        else if (entry.key != nullptr)
+        {
+            entry.result = AES_CCM_decrypt(entry.input, entry.input_length, entry.aad, entry.aad_length, entry.tag,
+                                           entry.tag_length, *entry.key, entry.nonce, entry.nonce_length, entry.output);
+        }
+        else
+        {
+            entry.result = CHIP_ERROR_INVALID_ARGUMENT;
+        }
+
+        if (firstError == CHIP_NO_ERROR)
+        {
+            firstError = entry.result;
+        }
+    }
+    return firstError;
+}
+
+using HmacSha256KeyCopy = Platform::ScopedMemoryBufferWithSize<uint8_t>;
+
+// Backends that cannot copy digest states keep the key and use the one-shot HMAC.
+__attribute__((weak)) CHIP_ERROR HmacSha256PrecomputedKey::Init(const ByteSpan & key)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!key.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    auto * keyCopy = Platform::New<HmacSha256KeyCopy>();
+    VerifyOrReturnError(keyCopy != nullptr, CHIP_ERROR_NO_MEMORY);
+    if (!keyCopy->Alloc(key.size()))
+    {
+        Platform::Delete(keyCopy);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+    memcpy(keyCopy->Get(), key.data(), key.size());
+
+    mContext = keyCopy;
+    return CHIP_NO_ERROR;
+}
+
+__attribute__((weak)) void HmacSha256PrecomputedKey::Release()
+{
+    VerifyOrReturn(mContext != nullptr);
+
+    auto * keyCopy = static_cast<HmacSha256KeyCopy *>(mContext);
+    ClearSecretData(keyCopy->Get(), keyCopy->AllocatedSize());
+    Platform::Delete(keyCopy);
+    mContext = nullptr;
+}
+
+__attribute__((weak)) CHIP_ERROR HmacSha256PrecomputedKey::Compute(const ByteSpan & message, MutableByteSpan & out_buffer)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(out_buffer.size() >= kSHA256_Hash_Length, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    const auto * keyCopy = static_cast<const HmacSha256KeyCopy *>(mContext);
+    HMAC_sha hmac;
+    ReturnErrorOnFailure(hmac.HMAC_SHA256(keyCopy->Get(), keyCopy->AllocatedSize(), message.data(), message.size(),
+                                          out_buffer.data(), out_buffer.size()));
+    out_buffer.reduce_size(kSHA256_Hash_Length);
+
+    return CHIP_NO_ERROR;
+}
+
 } // namespace Crypto
 } // namespace chip
@@ -907,6 +907,109 @@ CHIP_ERROR AES_CCM_decrypt(const uint8_t * ciphertext, size_t ciphertext_length,
                            const uint8_t * tag, size_t tag_length, const Aes128KeyHandle & key, const uint8_t * nonce,
                            size_t nonce_length, uint8_t * plaintext);
 
+/**
+ * @brief AES-CCM cipher state bound to a single key.
+ *
+ * AES_CCM_encrypt() and AES_CCM_decrypt() create a cipher context and expand the key on every
+ * call. A secure session processes many messages with the same key, so this class keeps the
+ * backend cipher context, including the expanded key schedule, alive between messages and only
+ * loads the nonce for each one.
+ *
+ * The context is set up for one nonce length and tag length. Messages with other lengths, and
+ * messages with an empty payload, are passed on to AES_CCM_encrypt() / AES_CCM_decrypt().
+ * Backends without a cached implementation do the same for every message.
+ *
+ * The key handle passed to Init() must outlive the context.
+ */
+class Aes128CcmContext
+{
+public:
+    Aes128CcmContext() = default;
+    ~Aes128CcmContext() { Release(); }
+
+    Aes128CcmContext(const Aes128CcmContext &)             = delete;
+    Aes128CcmContext & operator=(const Aes128CcmContext &) = delete;
+
+    /**
+     * @brief Set up the cipher context for `key`.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if the context is already initialized,
+     *         CHIP_ERROR_NO_MEMORY if the backend context cannot be allocated,
+     *         CHIP_NO_ERROR otherwise.
+     */
+    CHIP_ERROR Init(const Aes128KeyHandle & key, size_t nonce_length, size_t tag_length);
+
+    /**
+     * @brief Free the backend context. Safe to call on an uninitialized context.
+     */
+    void Release();
+
+    bool IsInitialized() const { return mKey != nullptr; }
+
+    /**
+     * @brief Same as AES_CCM_encrypt(), using the key given to Init().
+     */
+    CHIP_ERROR Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag, size_t tag_length);
+
+    /**
+     * @brief Same as AES_CCM_decrypt(), using the key given to Init().
+     */
+    CHIP_ERROR Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                       const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length, uint8_t * plaintext);
+
+private:
+    bool CanUseCachedContext(size_t payload_length, size_t nonce_length, size_t tag_length) const
+    {
+        return mContext != nullptr && payload_length > 0 && nonce_length == mNonceLength && tag_length == mTagLength;
+    }
+
+    const Aes128KeyHandle * mKey = nullptr;
+    void * mContext              = nullptr;
+    size_t mNonceLength          = 0;
+    size_t mTagLength            = 0;
+};
+
+/**
+ * @brief One message of an AES-CCM batch, see AES_CCM_encrypt_batch() and AES_CCM_decrypt_batch().
+ *
+ * `tag` receives the tag when encrypting and holds the expected tag when decrypting. If `context`
+ * is set and initialized it is used for the message, otherwise `key` is.
+ */
+struct AesCcmBatchEntry
+{
+    const Aes128KeyHandle * key = nullptr;
+    Aes128CcmContext * context  = nullptr;
+    const uint8_t * input       = nullptr;
+    size_t input_length         = 0;
+    const uint8_t * aad         = nullptr;
+    size_t aad_length           = 0;
+    const uint8_t * nonce       = nullptr;
+    size_t nonce_length         = 0;
+    uint8_t * output            = nullptr;
+    uint8_t * tag               = nullptr;
+    size_t tag_length           = 0;
+    CHIP_ERROR result           = CHIP_NO_ERROR;
+};
+
+/**
+ * @brief Encrypt a batch of independent messages with AES-CCM.
+ *
+ * Each entry is processed as by AES_CCM_encrypt() and its outcome is stored in `result`. A failure
+ * does not stop the remaining entries. Backends can share cipher state across the batch; the
+ * default implementation processes the entries one after the other.
+ *
+ * @return CHIP_NO_ERROR if every entry succeeded, otherwise the error of the first failed entry.
+ */
+CHIP_ERROR AES_CCM_encrypt_batch(AesCcmBatchEntry * entries, size_t count);
+
+/**
+ * @brief Decrypt a batch of independent messages with AES-CCM.
+ *
+ * Same as AES_CCM_encrypt_batch(), with each entry processed as by AES_CCM_decrypt().
+ */
+CHIP_ERROR AES_CCM_decrypt_batch(AesCcmBatchEntry * entries, size_t count);
+
 /**
  * @brief A function that implements AES-CTR encryption/decryption
  *
@@ -1160,6 +1263,54 @@ public:
                                    uint8_t * out_buffer, size_t out_length);
 };
 
+/**
+ * @brief HMAC-SHA256 state for a fixed key, with the padded key already hashed.
+ *
+ * HMAC_sha::HMAC_SHA256() hashes the inner and outer padded key blocks on every call. When many
+ * short messages are authenticated under the same key, Init() hashes both pads once and Compute()
+ * only continues copies of the two digest states with the message.
+ *
+ * Backends without a precomputed implementation keep a copy of the key and call
+ * HMAC_sha::HMAC_SHA256() for every message.
+ */
+class HmacSha256PrecomputedKey
+{
+public:
+    HmacSha256PrecomputedKey() = default;
+    ~HmacSha256PrecomputedKey() { Release(); }
+
+    HmacSha256PrecomputedKey(const HmacSha256PrecomputedKey &)             = delete;
+    HmacSha256PrecomputedKey & operator=(const HmacSha256PrecomputedKey &) = delete;
+
+    /**
+     * @brief Hash the inner and outer pads of `key`.
+     *
+     * @return CHIP_ERROR_INCORRECT_STATE if the context is already initialized,
+     *         CHIP_ERROR_INVALID_ARGUMENT if the key is empty,
+     *         CHIP_ERROR_NO_MEMORY if the backend state cannot be allocated,
+     *         CHIP_NO_ERROR otherwise.
+     */
+    CHIP_ERROR Init(const ByteSpan & key);
+
+    /**
+     * @brief Free the backend state, clearing any key material. Safe to call on an uninitialized context.
+     */
+    void Release();
+
+    bool IsInitialized() const { return mContext != nullptr; }
+
+    /**
+     * @brief Same as HMAC_sha::HMAC_SHA256(), using the key given to Init().
+     *
+     * `out_buffer` must be at least kSHA256_Hash_Length bytes long; its size is set to
+     * kSHA256_Hash_Length on success.
+     */
+    CHIP_ERROR Compute(const ByteSpan & message, MutableByteSpan & out_buffer);
+
+private:
+    void * mContext = nullptr;
+};
+
 /**
  * @brief A cryptographically secure random number generator based on NIST SP800-90A
  * @param out_buffer Buffer into which to write random bytes
@@ -48,6 +48,7 @@
 #include <lib/core/CHIPSafeCasts.h>
 #include <lib/support/BufferWriter.h>
 #include <lib/support/BytesToHex.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/SafePointerCast.h>
@@ -403,6 +404,336 @@ exit:
     return error;
 }
 
+#if !CHIP_CRYPTO_BORINGSSL
+// OpenSSL picks the CCM implementation for one direction when the key is set, so encryption and
+// decryption each need their own context.
+struct AesCcmCipherContexts
+{
+    EVP_CIPHER_CTX * mEncrypt = nullptr;
+    EVP_CIPHER_CTX * mDecrypt = nullptr;
+};
+
+// Sets `key` on a context created with EVP_CipherInit_ex(context, EVP_aes_128_ccm(), ...). The
+// nonce and tag lengths are part of the CCM state set up with the key, so they have to be passed
+// in before it. Each message then only supplies a new nonce.
+static bool _setAesCcmKey(EVP_CIPHER_CTX * context, const Aes128KeyHandle & key, size_t nonce_length, size_t tag_length,
+                          bool encrypt)
+{
+    static_assert(kAES_CCM128_Key_Length == sizeof(Symmetric128BitsKeyByteArray), "Unexpected key length");
+    return EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_IVLEN, static_cast<int>(nonce_length), nullptr) == 1 &&
+        EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length), nullptr) == 1 &&
+        EVP_CipherInit_ex(context, nullptr, nullptr, key.As<Symmetric128BitsKeyByteArray>(), nullptr, encrypt ? 1 : 0) == 1;
+}
+
+static EVP_CIPHER_CTX * _newAesCcmContext(bool encrypt)
+{
+    EVP_CIPHER_CTX * context = EVP_CIPHER_CTX_new();
+    VerifyOrReturnValue(context != nullptr, nullptr);
+
+    if (EVP_CipherInit_ex(context, EVP_aes_128_ccm(), nullptr, nullptr, nullptr, encrypt ? 1 : 0) != 1)
+    {
+        EVP_CIPHER_CTX_free(context);
+        return nullptr;
+    }
+
+    return context;
+}
+
+static bool _isCachedAesCcmMessage(size_t payload_length, size_t nonce_length, size_t tag_length)
+{
+    return payload_length > 0 && CanCastTo<int>(payload_length) && nonce_length > 0 && CanCastTo<int>(nonce_length) &&
+        (tag_length == 8 || tag_length == 12 || tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
+}
+
+// Encrypts one message with a keyed context: only the nonce is loaded.
+static CHIP_ERROR _aesCcmEncryptWithContext(EVP_CIPHER_CTX * context, const uint8_t * plaintext, size_t plaintext_length,
+                                            const uint8_t * aad, size_t aad_length, const uint8_t * nonce, uint8_t * ciphertext,
+                                            uint8_t * tag, size_t tag_length)
+{
+    int bytesWritten = 0;
+
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(plaintext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    VerifyOrReturnError(EVP_EncryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(EVP_EncryptUpdate(context, nullptr, &bytesWritten, nullptr, static_cast<int>(plaintext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    if (aad_length > 0)
+    {
+        VerifyOrReturnError(
+            EVP_EncryptUpdate(context, nullptr, &bytesWritten, Uint8::to_const_uchar(aad), static_cast<int>(aad_length)) == 1,
+            CHIP_ERROR_INTERNAL);
+    }
+    VerifyOrReturnError(EVP_EncryptUpdate(context, Uint8::to_uchar(ciphertext), &bytesWritten, Uint8::to_const_uchar(plaintext),
+                                          static_cast<int>(plaintext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten == static_cast<int>(plaintext_length), CHIP_ERROR_INTERNAL);
+
+    // CCM does not output anything when finalizing, but the tag is only available afterwards.
+    VerifyOrReturnError(EVP_EncryptFinal_ex(context, Uint8::to_uchar(ciphertext) + plaintext_length, &bytesWritten) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(bytesWritten == 0, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_GET_TAG, static_cast<int>(tag_length), Uint8::to_uchar(tag)) ==
+                            1,
+                        CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+// Decrypts one message with a keyed context: only the nonce and the expected tag are loaded.
+static CHIP_ERROR _aesCcmDecryptWithContext(EVP_CIPHER_CTX * context, const uint8_t * ciphertext, size_t ciphertext_length,
+                                            const uint8_t * aad, size_t aad_length, const uint8_t * tag, size_t tag_length,
+                                            const uint8_t * nonce, uint8_t * plaintext)
+{
+    int bytesOutput = 0;
+
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(ciphertext_length), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(CanCastTo<int>(aad_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    // Removing "const" from |tag| is safe, OpenSSL only reads it.
+    VerifyOrReturnError(EVP_DecryptInit_ex(context, nullptr, nullptr, nullptr, Uint8::to_const_uchar(nonce)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(EVP_CIPHER_CTX_ctrl(context, EVP_CTRL_CCM_SET_TAG, static_cast<int>(tag_length),
+                                            const_cast<void *>(static_cast<const void *>(tag))) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(EVP_DecryptUpdate(context, nullptr, &bytesOutput, nullptr, static_cast<int>(ciphertext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+    if (aad_length > 0)
+    {
+        VerifyOrReturnError(
+            EVP_DecryptUpdate(context, nullptr, &bytesOutput, Uint8::to_const_uchar(aad), static_cast<int>(aad_length)) == 1,
+            CHIP_ERROR_INTERNAL);
+    }
+
+    // Fails if the tag does not match.
+    VerifyOrReturnError(EVP_DecryptUpdate(context, Uint8::to_uchar(plaintext), &bytesOutput, Uint8::to_const_uchar(ciphertext),
+                                          static_cast<int>(ciphertext_length)) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+#endif // !CHIP_CRYPTO_BORINGSSL
+
+CHIP_ERROR Aes128CcmContext::Init(const Aes128KeyHandle & key, size_t nonce_length, size_t tag_length)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(nonce_length > 0 && CanCastTo<int>(nonce_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+#if CHIP_CRYPTO_BORINGSSL
+    const EVP_AEAD * aead = EVP_aead_aes_128_ccm_matter();
+
+    VerifyOrReturnError(nonce_length == EVP_AEAD_nonce_length(aead), CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag_length == CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES, CHIP_ERROR_INVALID_ARGUMENT);
+
+    EVP_AEAD_CTX * context =
+        EVP_AEAD_CTX_new(aead, key.As<Symmetric128BitsKeyByteArray>(), sizeof(Symmetric128BitsKeyByteArray), tag_length);
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+#else
+    VerifyOrReturnError(_isCachedAesCcmMessage(1, nonce_length, tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    AesCcmCipherContexts * context = Platform::New<AesCcmCipherContexts>();
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    context->mEncrypt = _newAesCcmContext(true);
+    context->mDecrypt = _newAesCcmContext(false);
+    if (context->mEncrypt == nullptr || context->mDecrypt == nullptr ||
+        !_setAesCcmKey(context->mEncrypt, key, nonce_length, tag_length, true) ||
+        !_setAesCcmKey(context->mDecrypt, key, nonce_length, tag_length, false))
+    {
+        EVP_CIPHER_CTX_free(context->mEncrypt);
+        EVP_CIPHER_CTX_free(context->mDecrypt);
+        Platform::Delete(context);
+        return CHIP_ERROR_NO_MEMORY;
+    }
+#endif // CHIP_CRYPTO_BORINGSSL
+
+    mKey         = &key;
+    mContext     = context;
+    mNonceLength = nonce_length;
+    mTagLength   = tag_length;
+
+    return CHIP_NO_ERROR;
+}
+
+void Aes128CcmContext::Release()
+{
+    if (mContext != nullptr)
+    {
+#if CHIP_CRYPTO_BORINGSSL
+        EVP_AEAD_CTX_free(static_cast<EVP_AEAD_CTX *>(mContext));
+#else
+        AesCcmCipherContexts * context = static_cast<AesCcmCipherContexts *>(mContext);
+        EVP_CIPHER_CTX_free(context->mEncrypt);
+        EVP_CIPHER_CTX_free(context->mDecrypt);
+        Platform::Delete(context);
+#endif // CHIP_CRYPTO_BORINGSSL
+    }
+
+    mKey         = nullptr;
+    mContext     = nullptr;
+    mNonceLength = 0;
+    mTagLength   = 0;
+}
+
+CHIP_ERROR Aes128CcmContext::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                     size_t tag_length)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (!CanUseCachedContext(plaintext_length, nonce_length, tag_length))
+    {
+        return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag,
+                               tag_length);
+    }
+
+#if CHIP_CRYPTO_BORINGSSL
+    size_t written_tag_len = 0;
+
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    VerifyOrReturnError(EVP_AEAD_CTX_seal_scatter(static_cast<EVP_AEAD_CTX *>(mContext), ciphertext, tag, &written_tag_len,
+                                                  tag_length, nonce, nonce_length, plaintext, plaintext_length, nullptr, 0, aad,
+                                                  aad_length) == 1,
+                        CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(written_tag_len == tag_length, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+#else
+    return _aesCcmEncryptWithContext(static_cast<AesCcmCipherContexts *>(mContext)->mEncrypt, plaintext, plaintext_length, aad,
+                                     aad_length, nonce, ciphertext, tag, tag_length);
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+CHIP_ERROR Aes128CcmContext::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                     uint8_t * plaintext)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (!CanUseCachedContext(ciphertext_length, nonce_length, tag_length))
+    {
+        return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length,
+                               plaintext);
+    }
+
+#if CHIP_CRYPTO_BORINGSSL
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    VerifyOrReturnError(EVP_AEAD_CTX_open_gather(static_cast<EVP_AEAD_CTX *>(mContext), plaintext, nonce, nonce_length, ciphertext,
+                                                 ciphertext_length, tag, tag_length, aad, aad_length) == 1,
+                        CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+#else
+    return _aesCcmDecryptWithContext(static_cast<AesCcmCipherContexts *>(mContext)->mDecrypt, ciphertext, ciphertext_length, aad,
+                                     aad_length, tag, tag_length, nonce, plaintext);
+#endif // CHIP_CRYPTO_BORINGSSL
+}
+
+#if !CHIP_CRYPTO_BORINGSSL
+// Entries without a cipher context share a single OpenSSL context, which is only re-keyed when the
+// key changes, rather than allocating and setting up a new one per message as AES_CCM_encrypt()
+// and AES_CCM_decrypt() do. BoringSSL uses the default implementation from CHIPCryptoPAL.cpp.
+static CHIP_ERROR _aesCcmBatch(AesCcmBatchEntry * entries, size_t count, bool encrypt)
+{
+    VerifyOrReturnError(entries != nullptr || count == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    EVP_CIPHER_CTX * shared          = nullptr;
+    const Aes128KeyHandle * sharedKey = nullptr;
+    size_t sharedNonceLength          = 0;
+    size_t sharedTagLength            = 0;
+    CHIP_ERROR firstError             = CHIP_NO_ERROR;
+
+    for (size_t i = 0; i < count; i++)
+    {
+        AesCcmBatchEntry & entry = entries[i];
+
+        if (entry.context != nullptr && entry.context->IsInitialized())
+        {
+            entry.result = encrypt
+                ? entry.context->Encrypt(entry.input, entry.input_length, entry.aad, entry.aad_length, entry.nonce,
+                                         entry.nonce_length, entry.output, entry.tag, entry.tag_length)
+                : entry.context->Decrypt(entry.input, entry.input_length, entry.aad, entry.aad_length, entry.tag, entry.tag_length,
+                                         entry.nonce, entry.nonce_length, entry.output);
+        }
+        else if (entry.key == nullptr)
+        {
+            entry.result = CHIP_ERROR_INVALID_ARGUMENT;
+        }
+        else if (!_isCachedAesCcmMessage(entry.input_length, entry.nonce_length, entry.tag_length))
+        {
+            entry.result = encrypt ? AES_CCM_encrypt(entry.input, entry.input_length, entry.aad, entry.aad_length, *entry.key,
+                                                     entry.nonce, entry.nonce_length, entry.output, entry.tag, entry.tag_length)
+                                   : AES_CCM_decrypt(entry.input, entry.input_length, entry.aad, entry.aad_length, entry.tag,
+                                                     entry.tag_length, *entry.key, entry.nonce, entry.nonce_length, entry.output);
+        }
+        else
+        {
+            if (shared == nullptr)
+            {
+                shared = _newAesCcmContext(encrypt);
+                VerifyOrExit(shared != nullptr, entry.result = CHIP_ERROR_NO_MEMORY);
+            }
+
+            if (sharedKey != entry.key || sharedNonceLength != entry.nonce_length || sharedTagLength != entry.tag_length)
+            {
+                sharedKey = nullptr;
+                VerifyOrExit(_setAesCcmKey(shared, *entry.key, entry.nonce_length, entry.tag_length, encrypt),
+                             entry.result = CHIP_ERROR_INTERNAL);
+                sharedKey         = entry.key;
+                sharedNonceLength = entry.nonce_length;
+                sharedTagLength   = entry.tag_length;
+            }
+
+            entry.result = encrypt ? _aesCcmEncryptWithContext(shared, entry.input, entry.input_length, entry.aad, entry.aad_length,
+                                                               entry.nonce, entry.output, entry.tag, entry.tag_length)
+                                   : _aesCcmDecryptWithContext(shared, entry.input, entry.input_length, entry.aad, entry.aad_length,
+                                                               entry.tag, entry.tag_length, entry.nonce, entry.output);
+        }
+
+    exit:
+        if (firstError == CHIP_NO_ERROR)
+        {
+            firstError = entry.result;
+        }
+    }
+
+    EVP_CIPHER_CTX_free(shared);
+
+    return firstError;
+}
+
+CHIP_ERROR AES_CCM_encrypt_batch(AesCcmBatchEntry * entries, size_t count)
+{
+    return _aesCcmBatch(entries, count, true);
+}
+
+CHIP_ERROR AES_CCM_decrypt_batch(AesCcmBatchEntry * entries, size_t count)
+{
+    return _aesCcmBatch(entries, count, false);
+}
+#endif // !CHIP_CRYPTO_BORINGSSL
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
@@ -655,6 +986,52 @@ CHIP_ERROR HMAC_sha::HMAC_SHA256(const Hmac128KeyHandle & key, const uint8_t * m
                        out_buffer, out_length);
 }
 
+CHIP_ERROR HmacSha256PrecomputedKey::Init(const ByteSpan & key)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!key.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    HMAC_CTX * mac_ctx = HMAC_CTX_new();
+    VerifyOrReturnError(mac_ctx != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    // Hashes the inner and outer pads, which the context keeps for every later HMAC_Init_ex() without a key.
+    const int error_openssl = HMAC_Init_ex(mac_ctx, Uint8::to_const_uchar(key.data()),
+                                           static_cast<boringssl_size_t_openssl_int>(key.size()), EVP_sha256(), nullptr);
+    if (error_openssl != 1)
+    {
+        HMAC_CTX_free(mac_ctx);
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    mContext = mac_ctx;
+    return CHIP_NO_ERROR;
+}
+
+void HmacSha256PrecomputedKey::Release()
+{
+    // HMAC_CTX_free() cleanses the pad states.
+    HMAC_CTX_free(static_cast<HMAC_CTX *>(mContext));
+    mContext = nullptr;
+}
+
+CHIP_ERROR HmacSha256PrecomputedKey::Compute(const ByteSpan & message, MutableByteSpan & out_buffer)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(out_buffer.size() >= kSHA256_Hash_Length, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    HMAC_CTX * mac_ctx = static_cast<HMAC_CTX *>(mContext);
+
+    // A null key and digest restart from the precomputed pads.
+    VerifyOrReturnError(HMAC_Init_ex(mac_ctx, nullptr, 0, nullptr, nullptr) == 1, CHIP_ERROR_INTERNAL);
+    VerifyOrReturnError(HMAC_Update(mac_ctx, Uint8::to_const_uchar(message.data()), message.size()) == 1, CHIP_ERROR_INTERNAL);
+
+    unsigned int mac_out_len = static_cast<unsigned int>(kSHA256_Hash_Length);
+    VerifyOrReturnError(HMAC_Final(mac_ctx, Uint8::to_uchar(out_buffer.data()), &mac_out_len) == 1, CHIP_ERROR_INTERNAL);
+    out_buffer.reduce_size(kSHA256_Hash_Length);
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR PBKDF2_sha256::pbkdf2_sha256(const uint8_t * password, size_t plen, const uint8_t * salt, size_t slen,
                                         unsigned int iteration_count, uint32_t key_length, uint8_t * output)
 {
@@ -44,6 +44,7 @@
 #include <lib/core/CHIPSafeCasts.h>
 #include <lib/support/BufferWriter.h>
 #include <lib/support/BytesToHex.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
 #include <lib/support/SafeInt.h>
 #include <lib/support/SafePointerCast.h>
@@ -149,6 +150,108 @@ exit:
     return error;
 }
 
+CHIP_ERROR Aes128CcmContext::Init(const Aes128KeyHandle & key, size_t nonce_length, size_t tag_length)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(nonce_length > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(_isValidTagLength(tag_length), CHIP_ERROR_INVALID_ARGUMENT);
+
+    mbedtls_ccm_context * context = Platform::New<mbedtls_ccm_context>();
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+    mbedtls_ccm_init(context);
+
+    // Size of key is expressed in bits, hence the multiplication by 8.
+    const int result = mbedtls_ccm_setkey(context, MBEDTLS_CIPHER_ID_AES, key.As<Symmetric128BitsKeyByteArray>(),
+                                          sizeof(Symmetric128BitsKeyByteArray) * 8);
+    _log_mbedTLS_error(result);
+    if (result != 0)
+    {
+        mbedtls_ccm_free(context);
+        Platform::Delete(context);
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    mKey         = &key;
+    mContext     = context;
+    mNonceLength = nonce_length;
+    mTagLength   = tag_length;
+
+    return CHIP_NO_ERROR;
+}
+
+void Aes128CcmContext::Release()
+{
+    if (mContext != nullptr)
+    {
+        mbedtls_ccm_context * context = static_cast<mbedtls_ccm_context *>(mContext);
+        mbedtls_ccm_free(context);
+        Platform::Delete(context);
+    }
+
+    mKey         = nullptr;
+    mContext     = nullptr;
+    mNonceLength = 0;
+    mTagLength   = 0;
+}
+
+CHIP_ERROR Aes128CcmContext::Encrypt(const uint8_t * plaintext, size_t plaintext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * nonce, size_t nonce_length, uint8_t * ciphertext, uint8_t * tag,
+                                     size_t tag_length)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (!CanUseCachedContext(plaintext_length, nonce_length, tag_length))
+    {
+        return AES_CCM_encrypt(plaintext, plaintext_length, aad, aad_length, *mKey, nonce, nonce_length, ciphertext, tag,
+                               tag_length);
+    }
+
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The key schedule was expanded in Init().
+    const int result = mbedtls_ccm_encrypt_and_tag(static_cast<mbedtls_ccm_context *>(mContext), plaintext_length,
+                                                   Uint8::to_const_uchar(nonce), nonce_length, Uint8::to_const_uchar(aad),
+                                                   aad_length, Uint8::to_const_uchar(plaintext), Uint8::to_uchar(ciphertext),
+                                                   Uint8::to_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR Aes128CcmContext::Decrypt(const uint8_t * ciphertext, size_t ciphertext_length, const uint8_t * aad, size_t aad_length,
+                                     const uint8_t * tag, size_t tag_length, const uint8_t * nonce, size_t nonce_length,
+                                     uint8_t * plaintext)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    if (!CanUseCachedContext(ciphertext_length, nonce_length, tag_length))
+    {
+        return AES_CCM_decrypt(ciphertext, ciphertext_length, aad, aad_length, tag, tag_length, *mKey, nonce, nonce_length,
+                               plaintext);
+    }
+
+    VerifyOrReturnError(ciphertext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(plaintext != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(nonce != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(tag != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(aad != nullptr || aad_length == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // The key schedule was expanded in Init().
+    const int result = mbedtls_ccm_auth_decrypt(static_cast<mbedtls_ccm_context *>(mContext), ciphertext_length,
+                                                Uint8::to_const_uchar(nonce), nonce_length, Uint8::to_const_uchar(aad), aad_length,
+                                                Uint8::to_const_uchar(ciphertext), Uint8::to_uchar(plaintext),
+                                                Uint8::to_const_uchar(tag), tag_length);
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Hash_SHA256(const uint8_t * data, const size_t data_length, uint8_t * out_buffer)
 {
     // zero data length hash is supported.
@@ -332,6 +435,70 @@ CHIP_ERROR HMAC_sha::HMAC_SHA256(const Hmac128KeyHandle & key, const uint8_t * m
                        out_buffer, out_length);
 }
 
+CHIP_ERROR HmacSha256PrecomputedKey::Init(const ByteSpan & key)
+{
+    VerifyOrReturnError(!IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!key.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const mbedtls_md_info_t * const md = mbedtls_md_info_from_type(MBEDTLS_MD_SHA256);
+    VerifyOrReturnError(md != nullptr, CHIP_ERROR_INTERNAL);
+
+    mbedtls_md_context_t * context = Platform::New<mbedtls_md_context_t>();
+    VerifyOrReturnError(context != nullptr, CHIP_ERROR_NO_MEMORY);
+    mbedtls_md_init(context);
+
+    // Hashes the inner and outer pads, which mbedtls_md_hmac_reset() restarts from.
+    int result = mbedtls_md_setup(context, md, 1 /* hmac */);
+    if (result == 0)
+    {
+        result = mbedtls_md_hmac_starts(context, Uint8::to_const_uchar(key.data()), key.size());
+    }
+    _log_mbedTLS_error(result);
+    if (result != 0)
+    {
+        mbedtls_md_free(context);
+        Platform::Delete(context);
+        return CHIP_ERROR_INTERNAL;
+    }
+
+    mContext = context;
+    return CHIP_NO_ERROR;
+}
+
+void HmacSha256PrecomputedKey::Release()
+{
+    VerifyOrReturn(mContext != nullptr);
+
+    // mbedtls_md_free() zeroizes the pad states.
+    mbedtls_md_context_t * context = static_cast<mbedtls_md_context_t *>(mContext);
+    mbedtls_md_free(context);
+    Platform::Delete(context);
+    mContext = nullptr;
+}
+
+CHIP_ERROR HmacSha256PrecomputedKey::Compute(const ByteSpan & message, MutableByteSpan & out_buffer)
+{
+    VerifyOrReturnError(IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(out_buffer.size() >= kSHA256_Hash_Length, CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    mbedtls_md_context_t * context = static_cast<mbedtls_md_context_t *>(mContext);
+
+    int result = mbedtls_md_hmac_reset(context);
+    if (result == 0)
+    {
+        result = mbedtls_md_hmac_update(context, Uint8::to_const_uchar(message.data()), message.size());
+    }
+    if (result == 0)
+    {
+        result = mbedtls_md_hmac_finish(context, Uint8::to_uchar(out_buffer.data()));
+    }
+    _log_mbedTLS_error(result);
+    VerifyOrReturnError(result == 0, CHIP_ERROR_INTERNAL);
+    out_buffer.reduce_size(kSHA256_Hash_Length);
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR PBKDF2_sha256::pbkdf2_sha256(const uint8_t * password, size_t plen, const uint8_t * salt, size_t slen,
                                         unsigned int iteration_count, uint32_t key_length, uint8_t * output)
 {
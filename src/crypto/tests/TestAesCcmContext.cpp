@@ -0,0 +1,314 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "AES_CCM_128_test_vectors.h"
+
+#include <pw_unit_test/framework.h>
+
+#include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+#include <string.h>
+
+using namespace chip;
+using namespace chip::Crypto;
+
+namespace {
+
+constexpr size_t kNonceLength = 13;
+constexpr size_t kTagLength   = CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES;
+
+const uint8_t kKey[]   = { 0x5e, 0xde, 0xd2, 0x44, 0xe2, 0xab, 0x5f, 0x0f, 0x98, 0x27, 0x42, 0x8b, 0x8c, 0x16, 0x08, 0xa1 };
+const uint8_t kNonce[] = { 0x00, 0x8a, 0x4f, 0x13, 0x32, 0x1c, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01 };
+const uint8_t kAAD[]   = { 0x00, 0x8a, 0x4f, 0x13, 0x32, 0x1c, 0x00, 0x00 };
+
+struct TestAesKey
+{
+    TestAesKey(const uint8_t * keyBytes, size_t keyLength)
+    {
+        Symmetric128BitsKeyByteArray keyMaterial;
+        memcpy(&keyMaterial, keyBytes, keyLength);
+        EXPECT_EQ(keystore.CreateKey(keyMaterial, key), CHIP_NO_ERROR);
+    }
+
+    ~TestAesKey() { keystore.DestroyKey(key); }
+
+    DefaultSessionKeystore keystore;
+    Aes128KeyHandle key;
+};
+
+class TestAesCcmContext : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestAesCcmContext, TestTestVectors)
+{
+    int numOfTestsRan = 0;
+    for (const ccm_128_test_vector * vector : ccm_128_test_vectors)
+    {
+        if (vector->result != CHIP_NO_ERROR || vector->pt_len == 0 || vector->pt_len > 64)
+        {
+            continue;
+        }
+
+        TestAesKey key(vector->key, vector->key_len);
+        Aes128CcmContext context;
+        ASSERT_EQ(context.Init(key.key, vector->nonce_len, vector->tag_len), CHIP_NO_ERROR);
+
+        // Run every vector twice to check that the context is correctly reset between messages.
+        for (int i = 0; i < 2; i++)
+        {
+            uint8_t ct[64];
+            uint8_t tag[kTagLength];
+            uint8_t pt[64];
+
+            EXPECT_EQ(context.Encrypt(vector->pt, vector->pt_len, vector->aad, vector->aad_len, vector->nonce, vector->nonce_len,
+                                      ct, tag, vector->tag_len),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(ct, vector->ct, vector->ct_len), 0) << "Test " << vector->tcId;
+            EXPECT_EQ(memcmp(tag, vector->tag, vector->tag_len), 0) << "Test " << vector->tcId;
+
+            EXPECT_EQ(context.Decrypt(vector->ct, vector->ct_len, vector->aad, vector->aad_len, vector->tag, vector->tag_len,
+                                      vector->nonce, vector->nonce_len, pt),
+                      CHIP_NO_ERROR);
+            EXPECT_EQ(memcmp(pt, vector->pt, vector->pt_len), 0) << "Test " << vector->tcId;
+        }
+        numOfTestsRan++;
+    }
+    EXPECT_GT(numOfTestsRan, 0);
+}
+
+TEST_F(TestAesCcmContext, TestMatchesOneShotAndRecoversFromBadTag)
+{
+    TestAesKey key(kKey, sizeof(kKey));
+    Aes128CcmContext context;
+
+    EXPECT_FALSE(context.IsInitialized());
+    ASSERT_EQ(context.Init(key.key, kNonceLength, kTagLength), CHIP_NO_ERROR);
+    EXPECT_TRUE(context.IsInitialized());
+    EXPECT_EQ(context.Init(key.key, kNonceLength, kTagLength), CHIP_ERROR_INCORRECT_STATE);
+
+    uint8_t message[100];
+    for (size_t i = 0; i < sizeof(message); i++)
+    {
+        message[i] = static_cast<uint8_t>(i);
+    }
+
+    uint8_t expected[sizeof(message)];
+    uint8_t expectedTag[kTagLength];
+    ASSERT_EQ(AES_CCM_encrypt(message, sizeof(message), kAAD, sizeof(kAAD), key.key, kNonce, sizeof(kNonce), expected, expectedTag,
+                              kTagLength),
+              CHIP_NO_ERROR);
+
+    // In place, as done by the secure session layer.
+    uint8_t buffer[sizeof(message)];
+    uint8_t tag[kTagLength];
+    memcpy(buffer, message, sizeof(message));
+    ASSERT_EQ(context.Encrypt(buffer, sizeof(buffer), kAAD, sizeof(kAAD), kNonce, sizeof(kNonce), buffer, tag, kTagLength),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(memcmp(buffer, expected, sizeof(expected)), 0);
+    EXPECT_EQ(memcmp(tag, expectedTag, sizeof(tag)), 0);
+
+    uint8_t badTag[kTagLength];
+    memcpy(badTag, tag, sizeof(tag));
+    badTag[0] ^= 0x01;
+    uint8_t scratch[sizeof(message)];
+    EXPECT_NE(context.Decrypt(buffer, sizeof(buffer), kAAD, sizeof(kAAD), badTag, kTagLength, kNonce, sizeof(kNonce), scratch),
+              CHIP_NO_ERROR);
+
+    ASSERT_EQ(context.Decrypt(buffer, sizeof(buffer), kAAD, sizeof(kAAD), tag, kTagLength, kNonce, sizeof(kNonce), buffer),
+              CHIP_NO_ERROR);
+    EXPECT_EQ(memcmp(buffer, message, sizeof(message)), 0);
+
+    // Lengths other than the ones given to Init() are still supported.
+    uint8_t shortTag[8];
+    uint8_t expectedShortTag[8];
+    ASSERT_EQ(AES_CCM_encrypt(message, sizeof(message), nullptr, 0, key.key, kNonce, 12, expected, expectedShortTag,
+                              sizeof(expectedShortTag)),
+              CHIP_NO_ERROR);
+    ASSERT_EQ(context.Encrypt(message, sizeof(message), nullptr, 0, kNonce, 12, buffer, shortTag, sizeof(shortTag)), CHIP_NO_ERROR);
+    EXPECT_EQ(memcmp(buffer, expected, sizeof(expected)), 0);
+    EXPECT_EQ(memcmp(shortTag, expectedShortTag, sizeof(shortTag)), 0);
+
+    context.Release();
+    EXPECT_FALSE(context.IsInitialized());
+    EXPECT_EQ(context.Encrypt(message, sizeof(message), kAAD, sizeof(kAAD), kNonce, sizeof(kNonce), buffer, tag, kTagLength),
+              CHIP_ERROR_INCORRECT_STATE);
+}
+
+TEST_F(TestAesCcmContext, TestBatchMatchesOneShot)
+{
+    constexpr size_t kBatchSize     = 6;
+    constexpr size_t kMessageLength = 48;
+
+    TestAesKey keyA(kKey, sizeof(kKey));
+    uint8_t otherKey[sizeof(kKey)];
+    memcpy(otherKey, kKey, sizeof(kKey));
+    otherKey[0] ^= 0xff;
+    TestAesKey keyB(otherKey, sizeof(otherKey));
+
+    Aes128CcmContext cachedB;
+    ASSERT_EQ(cachedB.Init(keyB.key, kNonceLength, kTagLength), CHIP_NO_ERROR);
+
+    uint8_t messages[kBatchSize][kMessageLength];
+    uint8_t nonces[kBatchSize][kNonceLength];
+    uint8_t ciphertexts[kBatchSize][kMessageLength];
+    uint8_t tags[kBatchSize][kTagLength];
+    AesCcmBatchEntry entries[kBatchSize];
+
+    for (size_t i = 0; i < kBatchSize; i++)
+    {
+        memset(messages[i], static_cast<int>(i), kMessageLength);
+        memcpy(nonces[i], kNonce, kNonceLength);
+        nonces[i][kNonceLength - 1] = static_cast<uint8_t>(i);
+
+        // Mix keys, cached contexts and an empty payload in a single batch.
+        AesCcmBatchEntry & entry = entries[i];
+        entry.key                = (i % 3 == 0) ? &keyB.key : &keyA.key;
+        entry.context            = (i == 3) ? &cachedB : nullptr;
+        entry.input              = messages[i];
+        entry.input_length       = (i == 5) ? 0 : kMessageLength;
+        entry.aad                = kAAD;
+        entry.aad_length         = sizeof(kAAD);
+        entry.nonce              = nonces[i];
+        entry.nonce_length       = kNonceLength;
+        entry.output             = (i == 5) ? nullptr : ciphertexts[i];
+        entry.tag                = tags[i];
+        entry.tag_length         = kTagLength;
+    }
+
+    ASSERT_EQ(AES_CCM_encrypt_batch(entries, kBatchSize), CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kBatchSize; i++)
+    {
+        uint8_t expected[kMessageLength];
+        uint8_t expectedTag[kTagLength];
+        EXPECT_EQ(entries[i].result, CHIP_NO_ERROR);
+        ASSERT_EQ(AES_CCM_encrypt(messages[i], entries[i].input_length, kAAD, sizeof(kAAD), *entries[i].key, nonces[i],
+                                  kNonceLength, entries[i].output != nullptr ? expected : nullptr, expectedTag, kTagLength),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(ciphertexts[i], expected, entries[i].input_length), 0) << "Entry " << i;
+        EXPECT_EQ(memcmp(tags[i], expectedTag, kTagLength), 0) << "Entry " << i;
+    }
+
+    // Decrypt in place, with one corrupted tag in the middle of the batch.
+    for (size_t i = 0; i < kBatchSize; i++)
+    {
+        entries[i].input  = ciphertexts[i];
+        entries[i].output = (entries[i].output != nullptr) ? ciphertexts[i] : nullptr;
+    }
+    tags[2][0] ^= 0x01;
+
+    EXPECT_NE(AES_CCM_decrypt_batch(entries, kBatchSize), CHIP_NO_ERROR);
+    for (size_t i = 0; i < kBatchSize; i++)
+    {
+        if (i == 2)
+        {
+            EXPECT_NE(entries[i].result, CHIP_NO_ERROR);
+            continue;
+        }
+        EXPECT_EQ(entries[i].result, CHIP_NO_ERROR) << "Entry " << i;
+        EXPECT_EQ(memcmp(ciphertexts[i], messages[i], entries[i].input_length), 0) << "Entry " << i;
+    }
+
+    // Entries without a key or context fail on their own.
+    entries[0].key     = nullptr;
+    entries[0].context = nullptr;
+    EXPECT_EQ(AES_CCM_encrypt_batch(entries, 1), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(entries[0].result, CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(AES_CCM_encrypt_batch(nullptr, 0), CHIP_NO_ERROR);
+}
+
+// Encrypts a report fan-out to many subscribers, with runs of messages sharing a key, and checks that
+// the batch produces exactly the ciphertexts and tags of one AES_CCM_encrypt() per message.
+TEST_F(TestAesCcmContext, TestBatchFanOutMatchesPerMessage)
+{
+    constexpr size_t kKeyCount       = 5;
+    constexpr size_t kMessageCount   = 40;
+    constexpr size_t kMaxLength      = 300;
+    constexpr size_t kShortTagLength = 8;
+
+    Aes128KeyHandle keys[kKeyCount];
+    DefaultSessionKeystore keystore;
+    for (size_t k = 0; k < kKeyCount; k++)
+    {
+        Symmetric128BitsKeyByteArray keyMaterial;
+        memcpy(keyMaterial, kKey, sizeof(keyMaterial));
+        keyMaterial[0] = static_cast<uint8_t>(k);
+        ASSERT_EQ(keystore.CreateKey(keyMaterial, keys[k]), CHIP_NO_ERROR);
+    }
+
+    static uint8_t messages[kMessageCount][kMaxLength];
+    static uint8_t batchOutput[kMessageCount][kMaxLength];
+    static uint8_t expectedOutput[kMessageCount][kMaxLength];
+    uint8_t nonces[kMessageCount][kNonceLength];
+    uint8_t batchTags[kMessageCount][kTagLength];
+    uint8_t expectedTags[kMessageCount][kTagLength];
+    AesCcmBatchEntry entries[kMessageCount];
+
+    for (size_t i = 0; i < kMessageCount; i++)
+    {
+        const size_t length = (i * 37) % kMaxLength + 1;
+        for (size_t j = 0; j < length; j++)
+        {
+            messages[i][j] = static_cast<uint8_t>(i * 31 + j);
+        }
+        memcpy(nonces[i], kNonce, kNonceLength);
+        nonces[i][kNonceLength - 1] = static_cast<uint8_t>(i);
+
+        // Consecutive messages mostly share a key, as when one session gets several reports, and the
+        // nonce, tag and AAD lengths change within the batch.
+        AesCcmBatchEntry & entry = entries[i];
+        entry.key                = &keys[(i / 3) % kKeyCount];
+        entry.input              = messages[i];
+        entry.input_length       = length;
+        entry.aad                = kAAD;
+        entry.aad_length         = i % (sizeof(kAAD) + 1);
+        entry.nonce              = nonces[i];
+        entry.nonce_length       = (i % 11 == 10) ? kNonceLength - 1 : kNonceLength;
+        entry.output             = batchOutput[i];
+        entry.tag                = batchTags[i];
+        entry.tag_length         = (i % 7 == 6) ? kShortTagLength : kTagLength;
+
+        ASSERT_EQ(AES_CCM_encrypt(entry.input, entry.input_length, entry.aad, entry.aad_length, *entry.key, entry.nonce,
+                                  entry.nonce_length, expectedOutput[i], expectedTags[i], entry.tag_length),
+                  CHIP_NO_ERROR);
+    }
+
+    ASSERT_EQ(AES_CCM_encrypt_batch(entries, kMessageCount), CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < kMessageCount; i++)
+    {
+        EXPECT_EQ(entries[i].result, CHIP_NO_ERROR) << "Entry " << i;
+        EXPECT_EQ(memcmp(batchOutput[i], expectedOutput[i], entries[i].input_length), 0) << "Entry " << i;
+        EXPECT_EQ(memcmp(batchTags[i], expectedTags[i], entries[i].tag_length), 0) << "Entry " << i;
+    }
+
+    for (auto & key : keys)
+    {
+        keystore.DestroyKey(key);
+    }
+}
+
+} // namespace
@@ -1158,6 +1158,41 @@ TEST_F(TestChipCryptoPAL, TestHMAC_SHA256_RawKey)
     EXPECT_EQ(numOfTestsExecuted, numOfTestCases);
 }
 
+TEST_F(TestChipCryptoPAL, TestHmacSha256PrecomputedKey)
+{
+    HeapChecker heapChecker;
+    const hmac_sha256_vector * vectors[] = { &hmac_sha256_test_vectors_raw_key[0], &hmac_sha256_test_vectors_key_handle[0] };
+
+    for (const hmac_sha256_vector * v : vectors)
+    {
+        HmacSha256PrecomputedKey precomputed;
+        EXPECT_FALSE(precomputed.IsInitialized());
+        EXPECT_SUCCESS(precomputed.Init(ByteSpan(v->key, v->key_length)));
+        EXPECT_TRUE(precomputed.IsInitialized());
+        EXPECT_EQ(precomputed.Init(ByteSpan(v->key, v->key_length)), CHIP_ERROR_INCORRECT_STATE);
+
+        // The precomputed state must survive any number of computations.
+        for (int i = 0; i < 3; i++)
+        {
+            uint8_t out[CHIP_CRYPTO_HASH_LEN_BYTES + 1];
+            MutableByteSpan outSpan(out);
+            EXPECT_SUCCESS(precomputed.Compute(ByteSpan(v->message, v->message_length), outSpan));
+            EXPECT_EQ(outSpan.size(), v->output_hash_length);
+            EXPECT_EQ(memcmp(v->output_hash, out, v->output_hash_length), 0);
+        }
+
+        uint8_t tooSmall[CHIP_CRYPTO_HASH_LEN_BYTES - 1];
+        MutableByteSpan tooSmallSpan(tooSmall);
+        EXPECT_EQ(precomputed.Compute(ByteSpan(v->message, v->message_length), tooSmallSpan), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+        precomputed.Release();
+        EXPECT_FALSE(precomputed.IsInitialized());
+    }
+
+    HmacSha256PrecomputedKey precomputed;
+    EXPECT_EQ(precomputed.Init(ByteSpan()), CHIP_ERROR_INVALID_ARGUMENT);
+}
+
 #if CHIP_CRYPTO_PSA
 // Regression test for a bug where HMAC_SHA256 returned CHIP_NO_ERROR even when the underlying PSA call failed.
 // Fault Injection: A key larger than PSA_MAX_KEY_BITS makes the PAL's internal psa_import_key() return
@@ -97,6 +97,16 @@ protected:
     bool _IsChipStackLockedByCurrentThread() const;
 #endif
 
+public:
+#if !CHIP_SYSTEM_CONFIG_USE_LIBEV
+    /**
+     * Returns the depth and enqueue-to-dispatch latency statistics of the event queue. Takes the CHIP stack lock, so
+     * must not be called with it held.
+     */
+    DeviceSafeQueue::Stats GetEventQueueStats();
+#endif
+
+protected:
     // ===== Methods available to the implementation subclass.
 
 private:
@@ -34,6 +34,7 @@
 
 #include <system/SystemError.h>
 #include <system/SystemLayer.h>
+#include <system/SystemStats.h>
 
 #if CHIP_HAVE_CONFIG_H
 #include <crypto/CryptoBuildConfig.h>
@@ -42,6 +43,7 @@
 #include <psa/crypto.h>
 #endif
 
+#include <algorithm>
 #include <assert.h>
 #include <errno.h>
 #include <fcntl.h>
@@ -193,13 +195,30 @@ CHIP_ERROR GenericPlatformManagerImpl_POSIX<ImplClass>::_PostEvent(const ChipDev
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::ProcessDeviceEvents()
 {
-    while (!mChipEventQueue.Empty())
+#if CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+    // Producers run on arbitrary threads and cannot update the (non-atomic) system stats themselves, so sample the depth
+    // of the queue each time the event loop drains it.
+    size_t depth = mChipEventQueue.GetStats().mDepth;
+    SYSTEM_STATS_SET(System::Stats::kPlatformMgr_NumEvents,
+                     static_cast<System::Stats::count_t>(std::min<size_t>(depth, CHIP_SYS_STATS_COUNT_MAX)));
+#endif // CHIP_SYSTEM_CONFIG_PROVIDE_STATISTICS
+
+    ChipDeviceEvent event;
+    while (mChipEventQueue.PopFront(event))
     {
-        const ChipDeviceEvent event = mChipEventQueue.PopFront();
         Impl()->DispatchEvent(&event);
     }
 }
 
+template <class ImplClass>
+DeviceSafeQueue::Stats GenericPlatformManagerImpl_POSIX<ImplClass>::GetEventQueueStats()
+{
+    Impl()->LockChipStack();
+    DeviceSafeQueue::Stats stats = mChipEventQueue.GetStats();
+    Impl()->UnlockChipStack();
+    return stats;
+}
+
 template <class ImplClass>
 void GenericPlatformManagerImpl_POSIX<ImplClass>::_RunEventLoop()
 {
@@ -272,6 +272,30 @@
 #endif
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+/**
+ *  @def INET_CONFIG_UDP_IO_BATCH_SIZE
+ *
+ *  @brief
+ *    Maximum number of datagrams the socket-based UDP endpoint moves per
+ *    system call.
+ *
+ *  @details
+ *    When greater than 1, and the platform provides recvmmsg() and sendmmsg()
+ *    (Linux), each read readiness event drains up to this many datagrams with a
+ *    single recvmmsg() into packet buffers kept allocated between events, and
+ *    UDPEndPoint::SendMsgBatch() sends up to this many datagrams per sendmmsg(),
+ *    or as a single UDP_SEGMENT (UDP GSO) send when the datagrams allow it.
+ *    The UDP transport then also holds the messages sent to the same
+ *    destination until the end of the current event loop pass and hands them
+ *    to UDPEndPoint::SendMsgBatch() together.
+ *
+ *    The default of 1 keeps one recvmsg() / sendmsg() per datagram. The value
+ *    cannot exceed 64, the kernel's limit on the number of UDP GSO segments.
+ */
+#ifndef INET_CONFIG_UDP_IO_BATCH_SIZE
+#define INET_CONFIG_UDP_IO_BATCH_SIZE 1
+#endif // INET_CONFIG_UDP_IO_BATCH_SIZE
+
 /**
  *  @def HAVE_SO_BINDTODEVICE
  *
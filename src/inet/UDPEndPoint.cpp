@@ -121,6 +121,47 @@ CHIP_ERROR UDPEndPoint::SendMsg(const IPPacketInfo * pktInfo, System::PacketBuff
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR UDPEndPoint::SendMsgBatch(const IPPacketInfo * pktInfo, System::PacketBufferHandle * msgs, size_t count,
+                                     size_t * sentCount)
+{
+    VerifyOrReturnError(msgs != nullptr || count == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    size_t sent    = 0;
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    INET_FAULT_INJECT(FaultInjection::kFault_Send, err = INET_ERROR_UNKNOWN_INTERFACE;);
+    INET_FAULT_INJECT(FaultInjection::kFault_SendNonCritical, err = CHIP_ERROR_NO_MEMORY;);
+
+    if (err == CHIP_NO_ERROR)
+    {
+        err = SendMsgBatchImpl(pktInfo, msgs, count, sent);
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        msgs[i] = nullptr;
+    }
+    if (sentCount != nullptr)
+    {
+        *sentCount = sent;
+    }
+    ReturnErrorOnFailure(err);
+
+    CHIP_SYSTEM_FAULT_INJECT_ASYNC_EVENT();
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPoint::SendMsgBatchImpl(const IPPacketInfo * pktInfo, System::PacketBufferHandle * msgs, size_t count,
+                                         size_t & sentCount)
+{
+    for (sentCount = 0; sentCount < count; sentCount++)
+    {
+        ReturnErrorOnFailure(SendMsgImpl(pktInfo, std::move(msgs[sentCount])));
+    }
+    return CHIP_NO_ERROR;
+}
+
 void UDPEndPoint::Free()
 {
     Close();
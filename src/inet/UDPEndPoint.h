@@ -230,6 +230,28 @@ public:
      */
     CHIP_ERROR SendMsg(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg);
 
+    /**
+     * Send a batch of UDP messages to a single destination.
+     *
+     *  Equivalent to calling SendMsg() with \c pktInfo for each of the \c count messages in \c msgs, in
+     *  order, but lets the implementation hand several messages to the network stack at once (see
+     *  INET_CONFIG_UDP_IO_BATCH_SIZE). Sending stops at the first message that fails. All handles in
+     *  \c msgs are released on return, whether or not the message was sent.
+     *
+     *  When INET_CONFIG_UDP_IO_BATCH_SIZE is greater than 1, Transport::UDP queues the messages sent to
+     *  one destination during a pass of the event loop and sends them through this method.
+     *
+     * @param[in]   pktInfo     Source and destination information shared by all the UDP messages.
+     * @param[in]   msgs        Packet buffers containing the UDP messages.
+     * @param[in]   count       Number of packet buffers in \c msgs.
+     * @param[out]  sentCount   If not null, the number of messages queued for transmit.
+     *
+     * @retval  CHIP_NO_ERROR                       Success: all messages are queued for transmit.
+     * @retval  other                               As for SendMsg(), for the first message that failed.
+     */
+    CHIP_ERROR SendMsgBatch(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle * msgs, size_t count,
+                            size_t * sentCount = nullptr);
+
     /**
      * Close the endpoint.
      *
@@ -296,6 +318,13 @@ protected:
     virtual CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg)                     = 0;
     virtual void CloseImpl()                                                                                                  = 0;
 
+    /**
+     * Send the messages of a SendMsgBatch() call, setting \c sentCount to the number of messages sent.
+     * The default implementation calls SendMsgImpl() for each message.
+     */
+    virtual CHIP_ERROR SendMsgBatchImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle * msgs, size_t count,
+                                        size_t & sentCount);
+
     /**
      * Close the endpoint and recycle its memory.
      *
@@ -43,6 +43,20 @@
 #include "ZephyrSocket.h" // nogncheck
 #endif
 
+#if INET_UDP_SOCKETS_BATCHED_IO
+#include <netinet/udp.h>
+#include <system/SystemStats.h>
+
+// UDP GSO, available since Linux 4.18; the C library headers may predate it.
+#ifndef UDP_SEGMENT
+#define UDP_SEGMENT 103
+#endif
+#ifndef SOL_UDP
+#define SOL_UDP 17
+#endif
+#endif // INET_UDP_SOCKETS_BATCHED_IO
+
+#include <algorithm>
 #include <cerrno>
 #include <unistd.h>
 #include <utility>
@@ -87,6 +101,11 @@ namespace Inet {
 
 namespace {
 
+#if INET_UDP_SOCKETS_BATCHED_IO
+// Largest UDP payload that fits in an IPv4 datagram, which bounds the size of a UDP_SEGMENT send.
+constexpr size_t kMaxSegmentedSendSize = 65507;
+#endif // INET_UDP_SOCKETS_BATCHED_IO
+
 CHIP_ERROR IPv6Bind(int socket, const IPAddress & address, uint16_t port, InterfaceId interface)
 {
     struct sockaddr_in6 sa;
@@ -277,11 +296,15 @@ CHIP_ERROR UDPEndPointImplSockets::ListenImpl()
     return layer->RequestCallbackOnPendingRead(mWatch);
 }
 
-CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+struct UDPEndPointImplSockets::OutboundHeader
 {
-    // Ensure packet buffer is not null
-    VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+    SockAddr mPeerSockAddr;
+    uint8_t mControlData[256];
+    struct msghdr mMsgHeader;
+};
 
+CHIP_ERROR UDPEndPointImplSockets::PrepareOutboundHeader(const IPPacketInfo * aPktInfo, OutboundHeader & header)
+{
     // Make sure we have the appropriate type of socket based on the
     // destination address.
     ReturnErrorOnFailure(GetSocket(aPktInfo->DestAddress.Type()));
@@ -289,25 +312,13 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     // Ensure the destination address type is compatible with the endpoint address type.
     VerifyOrReturnError(mAddrType == aPktInfo->DestAddress.Type(), CHIP_ERROR_INVALID_ARGUMENT);
 
-    // For now the entire message must fit within a single buffer.
-    VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
-
-    struct iovec msgIOV;
-    msgIOV.iov_base = msg->Start();
-    msgIOV.iov_len  = msg->DataLength();
+    memset(header.mControlData, 0, sizeof(header.mControlData));
 
-#if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-    uint8_t controlData[256];
-    memset(controlData, 0, sizeof(controlData));
-#endif // defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-
-    struct msghdr msgHeader;
+    struct msghdr & msgHeader = header.mMsgHeader;
     memset(&msgHeader, 0, sizeof(msgHeader));
-    msgHeader.msg_iov    = &msgIOV;
-    msgHeader.msg_iovlen = 1;
 
     // Construct a sockaddr_in/sockaddr_in6 structure containing the destination information.
-    SockAddr peerSockAddr;
+    SockAddr & peerSockAddr = header.mPeerSockAddr;
     memset(&peerSockAddr, 0, sizeof(peerSockAddr));
     msgHeader.msg_name = &peerSockAddr;
     if (mAddrType == IPAddressType::kIPv6)
@@ -350,8 +361,8 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     if (intf.IsPresent() || aPktInfo->SrcAddress.Type() != IPAddressType::kAny)
     {
 #if defined(IP_PKTINFO) || defined(IPV6_PKTINFO)
-        msgHeader.msg_control    = controlData;
-        msgHeader.msg_controllen = sizeof(controlData);
+        msgHeader.msg_control    = header.mControlData;
+        msgHeader.msg_controllen = sizeof(header.mControlData);
 
         struct cmsghdr * controlHdr      = CMSG_FIRSTHDR(&msgHeader);
         InterfaceId::PlatformType intfId = intf.GetPlatformInterface();
@@ -409,9 +420,30 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     }
 #endif // INET_CONFIG_UDP_SOCKET_PKTINFO
 
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle && msg)
+{
+    // Ensure packet buffer is not null
+    VerifyOrReturnError(!msg.IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    OutboundHeader header;
+    ReturnErrorOnFailure(PrepareOutboundHeader(aPktInfo, header));
+
+    // For now the entire message must fit within a single buffer.
+    VerifyOrReturnError(!msg->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
+
+    struct iovec msgIOV;
+    msgIOV.iov_base = msg->Start();
+    msgIOV.iov_len  = msg->DataLength();
+
+    header.mMsgHeader.msg_iov    = &msgIOV;
+    header.mMsgHeader.msg_iovlen = 1;
+
     // Send IP packet.
     // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
-    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
+    const ssize_t lenSent = sendmsg(mSocket, &header.mMsgHeader, 0);
     if (lenSent == -1)
     {
         return CHIP_ERROR_POSIX(errno);
@@ -426,6 +458,160 @@ CHIP_ERROR UDPEndPointImplSockets::SendMsgImpl(const IPPacketInfo * aPktInfo, Sy
     return CHIP_NO_ERROR;
 }
 
+#if INET_UDP_SOCKETS_BATCHED_IO
+
+CHIP_ERROR UDPEndPointImplSockets::SendMsgBatchImpl(const IPPacketInfo * aPktInfo, System::PacketBufferHandle * msgs, size_t count,
+                                                    size_t & sentCount)
+{
+    sentCount = 0;
+    VerifyOrReturnError(count > 0, CHIP_NO_ERROR);
+
+    for (size_t i = 0; i < count; i++)
+    {
+        // Ensure packet buffer is not null
+        VerifyOrReturnError(!msgs[i].IsNull(), CHIP_ERROR_INVALID_ARGUMENT);
+    }
+
+    OutboundHeader header;
+    ReturnErrorOnFailure(PrepareOutboundHeader(aPktInfo, header));
+
+    while (sentCount < count)
+    {
+        const size_t batchSize             = std::min(count - sentCount, static_cast<size_t>(INET_CONFIG_UDP_IO_BATCH_SIZE));
+        System::PacketBufferHandle * batch = msgs + sentCount;
+
+        for (size_t i = 0; i < batchSize; i++)
+        {
+            // For now each entire message must fit within a single buffer.
+            VerifyOrReturnError(!batch[i]->HasChainedBuffer(), CHIP_ERROR_MESSAGE_TOO_LONG);
+        }
+
+        if (batchSize > 1 && !mSegmentationUnsupported)
+        {
+            CHIP_ERROR err = SendSegmented(header, batch, batchSize);
+            if (err == CHIP_NO_ERROR)
+            {
+                SYSTEM_STATS_SET(System::Stats::kInetLayer_UDPSendBatch, static_cast<System::Stats::count_t>(batchSize));
+                sentCount += batchSize;
+                continue;
+            }
+            if (err != CHIP_ERROR_NOT_IMPLEMENTED)
+            {
+                return err;
+            }
+        }
+
+        struct iovec msgIOVs[INET_CONFIG_UDP_IO_BATCH_SIZE];
+        struct mmsghdr msgHeaders[INET_CONFIG_UDP_IO_BATCH_SIZE];
+        for (size_t i = 0; i < batchSize; i++)
+        {
+            msgIOVs[i].iov_base = batch[i]->Start();
+            msgIOVs[i].iov_len  = batch[i]->DataLength();
+
+            // All messages share the destination address and control data.
+            msgHeaders[i].msg_hdr            = header.mMsgHeader;
+            msgHeaders[i].msg_hdr.msg_iov    = &msgIOVs[i];
+            msgHeaders[i].msg_hdr.msg_iovlen = 1;
+            msgHeaders[i].msg_len            = 0;
+        }
+
+        // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
+        const int numSent = sendmmsg(mSocket, msgHeaders, static_cast<unsigned int>(batchSize), 0);
+        if (numSent == -1)
+        {
+            return CHIP_ERROR_POSIX(errno);
+        }
+        SYSTEM_STATS_SET(System::Stats::kInetLayer_UDPSendBatch, static_cast<System::Stats::count_t>(numSent));
+
+        for (int i = 0; i < numSent; i++, sentCount++)
+        {
+            if (msgHeaders[i].msg_len != batch[i]->DataLength())
+            {
+                return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+            }
+        }
+        // On a short count, the next sendmmsg() reports the error for the first unsent message.
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+/**
+ * Send all the messages as a single UDP GSO "super-datagram" that the kernel (or the NIC) splits into
+ * one datagram per message. This requires every message but the last to have the same length, and
+ * the last one to be no longer than the others. Returns CHIP_ERROR_NOT_IMPLEMENTED if the messages
+ * do not allow it or the kernel does not support UDP GSO, so that the caller falls back to sendmmsg().
+ */
+CHIP_ERROR UDPEndPointImplSockets::SendSegmented(OutboundHeader & header, System::PacketBufferHandle * msgs, size_t count)
+{
+    const size_t segmentSize = msgs[0]->DataLength();
+    size_t totalSize         = 0;
+    for (size_t i = 0; i < count; i++)
+    {
+        const size_t len = msgs[i]->DataLength();
+        VerifyOrReturnError(len > 0 && (len == segmentSize || (i == count - 1 && len < segmentSize)), CHIP_ERROR_NOT_IMPLEMENTED);
+        totalSize += len;
+    }
+    VerifyOrReturnError(totalSize <= kMaxSegmentedSendSize, CHIP_ERROR_NOT_IMPLEMENTED);
+
+    struct iovec msgIOVs[INET_CONFIG_UDP_IO_BATCH_SIZE];
+    for (size_t i = 0; i < count; i++)
+    {
+        msgIOVs[i].iov_base = msgs[i]->Start();
+        msgIOVs[i].iov_len  = msgs[i]->DataLength();
+    }
+
+    // Append a UDP_SEGMENT control message after any IP_PKTINFO/IPV6_PKTINFO one.
+    struct msghdr msgHeader     = header.mMsgHeader;
+    const size_t usedControlLen = (msgHeader.msg_control != nullptr) ? msgHeader.msg_controllen : 0;
+    VerifyOrReturnError(usedControlLen + CMSG_SPACE(sizeof(uint16_t)) <= sizeof(header.mControlData), CHIP_ERROR_NOT_IMPLEMENTED);
+
+    const uint16_t gsoSize = static_cast<uint16_t>(segmentSize);
+    auto * controlHdr      = reinterpret_cast<struct cmsghdr *>(header.mControlData + usedControlLen);
+    controlHdr->cmsg_level = SOL_UDP;
+    controlHdr->cmsg_type  = UDP_SEGMENT;
+    controlHdr->cmsg_len   = CMSG_LEN(sizeof(uint16_t));
+    memcpy(CMSG_DATA(controlHdr), &gsoSize, sizeof(gsoSize));
+
+    msgHeader.msg_control    = header.mControlData;
+    msgHeader.msg_controllen = usedControlLen + CMSG_SPACE(sizeof(uint16_t));
+    msgHeader.msg_iov        = msgIOVs;
+    msgHeader.msg_iovlen     = count;
+
+    // NOLINTNEXTLINE(clang-analyzer-unix.StdCLibraryFunctions): GetSocket calls ensure mSocket is valid
+    const ssize_t lenSent = sendmsg(mSocket, &msgHeader, 0);
+    const int sendErrno   = errno;
+
+    // Leave the control data as PrepareOutboundHeader() built it for any sendmmsg() fallback.
+    memset(controlHdr, 0, CMSG_SPACE(sizeof(uint16_t)));
+
+    if (lenSent == -1)
+    {
+        if (sendErrno == ENOPROTOOPT || sendErrno == EOPNOTSUPP)
+        {
+            // The socket cannot segment at all: stop trying on this endpoint.
+            ChipLogProgress(Inet, "UDP segmentation offload unavailable (%s), using sendmmsg", strerror(sendErrno));
+            mSegmentationUnsupported = true;
+            return CHIP_ERROR_NOT_IMPLEMENTED;
+        }
+        if (sendErrno == EIO || sendErrno == EINVAL)
+        {
+            // The route or device rejected this particular send (e.g. no checksum offload on the
+            // egress interface); fall back to sendmmsg for this batch only.
+            return CHIP_ERROR_NOT_IMPLEMENTED;
+        }
+        return CHIP_ERROR_POSIX(sendErrno);
+    }
+
+    if (static_cast<size_t>(lenSent) != totalSize)
+    {
+        return CHIP_ERROR_OUTBOUND_MESSAGE_TOO_BIG;
+    }
+    return CHIP_NO_ERROR;
+}
+
+#endif // INET_UDP_SOCKETS_BATCHED_IO
+
 void UDPEndPointImplSockets::CloseImpl()
 {
     if (mSocket != kInvalidSocketFd)
@@ -434,6 +620,13 @@ void UDPEndPointImplSockets::CloseImpl()
         close(mSocket);
         mSocket = kInvalidSocketFd;
     }
+
+#if INET_UDP_SOCKETS_BATCHED_IO
+    for (auto & buffer : mRecvBuffers)
+    {
+        buffer = nullptr;
+    }
+#endif // INET_UDP_SOCKETS_BATCHED_IO
 }
 
 CHIP_ERROR UDPEndPointImplSockets::GetSocket(IPAddressType addressType)
@@ -559,6 +752,70 @@ CHIP_ERROR UDPEndPointImplSockets::GetSocket(IPAddressType addressType)
     return CHIP_NO_ERROR;
 }
 
+namespace {
+
+/**
+ * Fill in the source address and port of \c pktInfo from \c peerSockAddr, and its destination address
+ * and interface from the IP_PKTINFO/IPV6_PKTINFO control message of a received datagram, if present.
+ */
+CHIP_ERROR DecodeReceivedPacketInfo(struct msghdr & msgHeader, const SockAddr & peerSockAddr, IPPacketInfo & pktInfo)
+{
+    if (peerSockAddr.any.sa_family == AF_INET6)
+    {
+        pktInfo.SrcAddress = IPAddress(peerSockAddr.in6.sin6_addr);
+        pktInfo.SrcPort    = ntohs(peerSockAddr.in6.sin6_port);
+    }
+#if INET_CONFIG_ENABLE_IPV4
+    else if (peerSockAddr.any.sa_family == AF_INET)
+    {
+        pktInfo.SrcAddress = IPAddress(peerSockAddr.in.sin_addr);
+        pktInfo.SrcPort    = ntohs(peerSockAddr.in.sin_port);
+    }
+#endif // INET_CONFIG_ENABLE_IPV4
+    else
+    {
+        return CHIP_ERROR_INCORRECT_STATE;
+    }
+
+    for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
+         controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
+    {
+#if INET_CONFIG_ENABLE_IPV4
+#ifdef IP_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
+        {
+            auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            pktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
+            pktInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
+            continue;
+        }
+#endif // defined(IP_PKTINFO)
+#endif // INET_CONFIG_ENABLE_IPV4
+
+#ifdef IPV6_PKTINFO
+        if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
+        {
+            auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
+            if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
+            {
+                return CHIP_ERROR_INCORRECT_STATE;
+            }
+            pktInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
+            pktInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
+            continue;
+        }
+#endif // defined(IPV6_PKTINFO)
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+} // anonymous namespace
+
 // static
 void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events, intptr_t data)
 {
@@ -574,6 +831,9 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         return;
     }
 
+#if INET_UDP_SOCKETS_BATCHED_IO
+    HandlePendingReadBatch();
+#else
     // Prevent the endpoint from being freed while in the middle of a callback.
     UDPEndPointHandle ref(this);
     CHIP_ERROR lStatus = CHIP_NO_ERROR;
@@ -620,62 +880,7 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
         else
         {
             lBuffer->SetDataLength(static_cast<uint16_t>(rcvLen));
-
-            if (lPeerSockAddr.any.sa_family == AF_INET6)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in6.sin6_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in6.sin6_port);
-            }
-#if INET_CONFIG_ENABLE_IPV4
-            else if (lPeerSockAddr.any.sa_family == AF_INET)
-            {
-                lPacketInfo.SrcAddress = IPAddress(lPeerSockAddr.in.sin_addr);
-                lPacketInfo.SrcPort    = ntohs(lPeerSockAddr.in.sin_port);
-            }
-#endif // INET_CONFIG_ENABLE_IPV4
-            else
-            {
-                lStatus = CHIP_ERROR_INCORRECT_STATE;
-            }
-        }
-
-        if (lStatus == CHIP_NO_ERROR)
-        {
-            for (struct cmsghdr * controlHdr = CMSG_FIRSTHDR(&msgHeader); controlHdr != nullptr;
-                 controlHdr                  = CMSG_NXTHDR(&msgHeader, controlHdr))
-            {
-#if INET_CONFIG_ENABLE_IPV4
-#ifdef IP_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IP && controlHdr->cmsg_type == IP_PKTINFO)
-                {
-                    auto * inPktInfo = reinterpret_cast<struct in_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(inPktInfo->ipi_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(inPktInfo->ipi_addr);
-                    continue;
-                }
-#endif // defined(IP_PKTINFO)
-#endif // INET_CONFIG_ENABLE_IPV4
-
-#ifdef IPV6_PKTINFO
-                if (controlHdr->cmsg_level == IPPROTO_IPV6 && controlHdr->cmsg_type == IPV6_PKTINFO)
-                {
-                    auto * in6PktInfo = reinterpret_cast<struct in6_pktinfo *> CMSG_DATA(controlHdr);
-                    if (!CanCastTo<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex))
-                    {
-                        lStatus = CHIP_ERROR_INCORRECT_STATE;
-                        break;
-                    }
-                    lPacketInfo.Interface   = InterfaceId(static_cast<InterfaceId::PlatformType>(in6PktInfo->ipi6_ifindex));
-                    lPacketInfo.DestAddress = IPAddress(in6PktInfo->ipi6_addr);
-                    continue;
-                }
-#endif // defined(IPV6_PKTINFO)
-            }
+            lStatus = DecodeReceivedPacketInfo(msgHeader, lPeerSockAddr, lPacketInfo);
         }
     }
     else
@@ -695,7 +900,120 @@ void UDPEndPointImplSockets::HandlePendingIO(System::SocketEvents events)
             OnReceiveError(this, lStatus, nullptr);
         }
     }
+#endif // INET_UDP_SOCKETS_BATCHED_IO
+}
+
+#if INET_UDP_SOCKETS_BATCHED_IO
+void UDPEndPointImplSockets::HandlePendingReadBatch()
+{
+    constexpr size_t kBatchSize       = INET_CONFIG_UDP_IO_BATCH_SIZE;
+    constexpr size_t kControlDataSize = 256;
+
+    // Prevent the endpoint from being freed while in the middle of a callback.
+    UDPEndPointHandle ref(this);
+
+    struct iovec msgIOVs[kBatchSize];
+    struct mmsghdr msgHeaders[kBatchSize];
+    SockAddr peerSockAddrs[kBatchSize];
+    uint8_t controlData[kBatchSize][kControlDataSize];
+
+    size_t numBuffers = 0;
+    for (; numBuffers < kBatchSize; numBuffers++)
+    {
+        System::PacketBufferHandle & buffer = mRecvBuffers[numBuffers];
+        if (buffer.IsNull())
+        {
+            buffer = System::PacketBufferHandle::New(System::PacketBuffer::kMaxSizeWithoutReserve, 0);
+            if (buffer.IsNull())
+            {
+                break;
+            }
+        }
+
+        msgIOVs[numBuffers].iov_base = buffer->Start();
+        msgIOVs[numBuffers].iov_len  = buffer->AvailableDataLength();
+
+        memset(&peerSockAddrs[numBuffers], 0, sizeof(peerSockAddrs[numBuffers]));
+        memset(&msgHeaders[numBuffers], 0, sizeof(msgHeaders[numBuffers]));
+
+        struct msghdr & msgHeader = msgHeaders[numBuffers].msg_hdr;
+        msgHeader.msg_name        = &peerSockAddrs[numBuffers];
+        msgHeader.msg_namelen     = sizeof(peerSockAddrs[numBuffers]);
+        msgHeader.msg_iov         = &msgIOVs[numBuffers];
+        msgHeader.msg_iovlen      = 1;
+        msgHeader.msg_control     = controlData[numBuffers];
+        msgHeader.msg_controllen  = kControlDataSize;
+    }
+
+    if (numBuffers == 0)
+    {
+        if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, CHIP_ERROR_NO_MEMORY, nullptr);
+        }
+        return;
+    }
+
+    const int numReceived = recvmmsg(mSocket, msgHeaders, static_cast<unsigned int>(numBuffers), MSG_DONTWAIT, nullptr);
+    if (numReceived == -1)
+    {
+        CHIP_ERROR status = CHIP_ERROR_POSIX(errno);
+        if (OnReceiveError != nullptr && status != CHIP_ERROR_POSIX(EAGAIN))
+        {
+            OnReceiveError(this, status, nullptr);
+        }
+        return;
+    }
+    SYSTEM_STATS_SET(System::Stats::kInetLayer_UDPRecvBatch, static_cast<System::Stats::count_t>(numReceived));
+
+    // Take the filled buffers first: a callback may close the endpoint, which releases mRecvBuffers.
+    System::PacketBufferHandle buffers[kBatchSize];
+    for (int i = 0; i < numReceived; i++)
+    {
+        buffers[i] = std::move(mRecvBuffers[i]);
+    }
+
+    // Move the buffers that were not used to the front, to be used first by the next batch.
+    for (size_t from = static_cast<size_t>(numReceived), to = 0; from < numBuffers; from++, to++)
+    {
+        mRecvBuffers[to] = std::move(mRecvBuffers[from]);
+    }
+
+    for (int i = 0; i < numReceived; i++)
+    {
+        if (mState != State::kListening || OnMessageReceived == nullptr)
+        {
+            break;
+        }
+
+        IPPacketInfo packetInfo;
+        packetInfo.Clear();
+        packetInfo.DestPort  = mBoundPort;
+        packetInfo.Interface = mBoundIntfId;
+
+        CHIP_ERROR status = CHIP_NO_ERROR;
+        if ((msgHeaders[i].msg_hdr.msg_flags & MSG_TRUNC) || buffers[i]->AvailableDataLength() < msgHeaders[i].msg_len)
+        {
+            status = CHIP_ERROR_INBOUND_MESSAGE_TOO_BIG;
+        }
+        else
+        {
+            buffers[i]->SetDataLength(static_cast<uint16_t>(msgHeaders[i].msg_len));
+            status = DecodeReceivedPacketInfo(msgHeaders[i].msg_hdr, peerSockAddrs[i], packetInfo);
+        }
+
+        if (status == CHIP_NO_ERROR)
+        {
+            buffers[i].RightSize();
+            OnMessageReceived(this, std::move(buffers[i]), &packetInfo);
+        }
+        else if (OnReceiveError != nullptr)
+        {
+            OnReceiveError(this, status, nullptr);
+        }
+    }
 }
+#endif // INET_UDP_SOCKETS_BATCHED_IO
 
 #ifdef IPV6_MULTICAST_LOOP
 static CHIP_ERROR SocketsSetMulticastLoopback(int aSocket, bool aLoopback, int aProtocol, int aOption)
@@ -26,6 +26,15 @@
 #include <inet/EndPointStateSockets.h>
 #include <inet/UDPEndPoint.h>
 
+#if INET_CONFIG_UDP_IO_BATCH_SIZE > 1 && defined(__linux__)
+#define INET_UDP_SOCKETS_BATCHED_IO 1
+#else
+#define INET_UDP_SOCKETS_BATCHED_IO 0
+#endif
+
+static_assert(INET_CONFIG_UDP_IO_BATCH_SIZE >= 1 && INET_CONFIG_UDP_IO_BATCH_SIZE <= 64,
+              "INET_CONFIG_UDP_IO_BATCH_SIZE must be between 1 and 64");
+
 namespace chip {
 namespace Inet {
 
@@ -51,15 +60,32 @@ private:
     CHIP_ERROR BindInterfaceImpl(IPAddressType addressType, InterfaceId interfaceId) override;
     CHIP_ERROR ListenImpl() override;
     CHIP_ERROR SendMsgImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle && msg) override;
+#if INET_UDP_SOCKETS_BATCHED_IO
+    CHIP_ERROR SendMsgBatchImpl(const IPPacketInfo * pktInfo, chip::System::PacketBufferHandle * msgs, size_t count,
+                                size_t & sentCount) override;
+#endif // INET_UDP_SOCKETS_BATCHED_IO
     void CloseImpl() override;
 
+    struct OutboundHeader;
+
     CHIP_ERROR GetSocket(IPAddressType addressType);
+    CHIP_ERROR PrepareOutboundHeader(const IPPacketInfo * aPktInfo, OutboundHeader & header);
     void HandlePendingIO(System::SocketEvents events);
     static void HandlePendingIO(System::SocketEvents events, intptr_t data);
 
     InterfaceId mBoundIntfId;
     uint16_t mBoundPort;
 
+#if INET_UDP_SOCKETS_BATCHED_IO
+    void HandlePendingReadBatch();
+    CHIP_ERROR SendSegmented(OutboundHeader & header, chip::System::PacketBufferHandle * msgs, size_t count);
+
+    // Receive buffers not consumed by the previous recvmmsg() are kept for the next one.
+    chip::System::PacketBufferHandle mRecvBuffers[INET_CONFIG_UDP_IO_BATCH_SIZE];
+    // Set once the socket reports UDP_SEGMENT as unsupported, after which its batches only use sendmmsg().
+    bool mSegmentationUnsupported = false;
+#endif // INET_UDP_SOCKETS_BATCHED_IO
+
 #if CHIP_SYSTEM_CONFIG_USE_PLATFORM_MULTICAST_API
 public:
     enum class MulticastOperation
@@ -385,6 +385,79 @@ TEST_F(TestInetEndPoint, TestInetEndPointInternal)
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 }
 
+#if CHIP_SYSTEM_CONFIG_USE_SOCKETS
+size_t gBatchReceivedCount = 0;
+size_t gBatchReceivedBytes = 0;
+bool gBatchReceivedInOrder = true;
+
+void HandleBatchMessageReceived(UDPEndPoint * endPoint, PacketBufferHandle && msg, const IPPacketInfo * pktInfo)
+{
+    // Every byte of a message holds its index in the batch.
+    if (msg->DataLength() == 0 || msg->Start()[0] != static_cast<uint8_t>(gBatchReceivedCount))
+    {
+        gBatchReceivedInOrder = false;
+    }
+    gBatchReceivedCount++;
+    gBatchReceivedBytes += msg->DataLength();
+}
+
+TEST_F(TestInetEndPoint, TestUDPSendMsgBatch)
+{
+    constexpr size_t kMessageCount = 10;
+    UDPEndPointHandle testUDPEP;
+    const IPAddress loopback = IPAddress::Loopback(IPAddressType::kIPv6);
+
+    ASSERT_EQ(gUDP.NewEndPoint(testUDPEP), CHIP_NO_ERROR);
+    if (testUDPEP->Bind(IPAddressType::kIPv6, loopback, 0) != CHIP_NO_ERROR)
+    {
+        testUDPEP.Release();
+        GTEST_SKIP() << "IPv6 loopback is not available";
+    }
+    ASSERT_EQ(testUDPEP->Listen(HandleBatchMessageReceived, nullptr /*OnReceiveError*/), CHIP_NO_ERROR);
+
+    IPPacketInfo pktInfo;
+    pktInfo.Clear();
+    pktInfo.DestAddress = loopback;
+    pktInfo.DestPort    = testUDPEP->GetBoundPort();
+
+    // Equal-sized messages (which may be sent as a single segmented datagram), then messages of varying sizes.
+    for (bool equalSizes : { true, false })
+    {
+        PacketBufferHandle msgs[kMessageCount];
+        size_t expectedBytes = 0;
+        for (size_t i = 0; i < kMessageCount; i++)
+        {
+            const size_t length = equalSizes ? 100 : 50 + 7 * i;
+            msgs[i]             = PacketBufferHandle::New(length);
+            ASSERT_FALSE(msgs[i].IsNull());
+            memset(msgs[i]->Start(), static_cast<int>(i), length);
+            msgs[i]->SetDataLength(static_cast<uint16_t>(length));
+            expectedBytes += length;
+        }
+
+        gBatchReceivedCount   = 0;
+        gBatchReceivedBytes   = 0;
+        gBatchReceivedInOrder = true;
+
+        size_t sentCount = 0;
+        EXPECT_EQ(testUDPEP->SendMsgBatch(&pktInfo, msgs, kMessageCount, &sentCount), CHIP_NO_ERROR);
+        EXPECT_EQ(sentCount, kMessageCount);
+        EXPECT_TRUE(msgs[0].IsNull());
+
+        for (int attempt = 0; attempt < 100 && gBatchReceivedCount < kMessageCount; attempt++)
+        {
+            ServiceEvents(10);
+        }
+
+        EXPECT_EQ(gBatchReceivedCount, kMessageCount);
+        EXPECT_EQ(gBatchReceivedBytes, expectedBytes);
+        EXPECT_TRUE(gBatchReceivedInOrder);
+    }
+
+    testUDPEP.Release();
+}
+#endif // CHIP_SYSTEM_CONFIG_USE_SOCKETS
+
 #if !CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
 // Test the Inet resource limitations.
 TEST_F(TestInetEndPoint, TestInetEndPointLimit)
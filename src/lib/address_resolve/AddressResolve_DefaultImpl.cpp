@@ -18,9 +18,16 @@
 #include <lib/address_resolve/AddressResolve_DefaultImpl.h>
 
 #include <lib/address_resolve/TracingStructs.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <lib/support/DefaultStorageKeyAllocator.h>
+#include <lib/support/SafeInt.h>
+#include <lib/support/ScopedMemoryBuffer.h>
 #include <tracing/macros.h>
 #include <transport/raw/PeerAddress.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace AddressResolve {
 namespace Impl {
@@ -28,13 +35,319 @@ namespace {
 
 static constexpr System::Clock::Timeout kInvalidTimeout{ System::Clock::Timeout::max() };
 
+constexpr size_t kIPv6AddressSizeBytes = 16;
+
+constexpr size_t kMaxSnapshotResultSize = TLV::EstimateStructOverhead(kIPv6AddressSizeBytes, // address
+                                                                      sizeof(uint16_t),      // port
+                                                                      sizeof(uint32_t),      // idle interval
+                                                                      sizeof(uint32_t),      // active interval
+                                                                      sizeof(uint16_t),      // active threshold
+                                                                      sizeof(uint8_t));      // flags
+
+constexpr size_t kMaxSnapshotEntrySize = TLV::EstimateStructOverhead(sizeof(CompressedFabricId),                     // fabric
+                                                                     sizeof(NodeId),                                 // node
+                                                                     sizeof(uint32_t),                               // expiry
+                                                                     kNodeLookupResultsLen * kMaxSnapshotResultSize); // results
+
+constexpr size_t kSnapshotMaxSize = CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SNAPSHOT_MAX_SIZE;
+static_assert(kSnapshotMaxSize <= UINT16_MAX, "Address cache snapshot has to fit in a single storage value");
+
+CHIP_ERROR GetRealTimeSeconds(uint32_t & seconds)
+{
+    System::Clock::Microseconds64 realTime;
+    ReturnErrorOnFailure(System::SystemClock().GetClock_RealTime(realTime));
+    seconds = std::chrono::duration_cast<System::Clock::Seconds32>(realTime).count();
+    return CHIP_NO_ERROR;
+}
+
 } // namespace
 
+NodeAddressCache::Entry * NodeAddressCache::FindEntry(const PeerId & peerId)
+{
+    for (auto & entry : mEntries)
+    {
+        if ((entry.lastUsed != 0) && (entry.peerId == peerId))
+        {
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+NodeAddressCache::Entry & NodeAddressCache::AllocateEntry(System::Clock::Timestamp now)
+{
+    Entry * oldest = &mEntries[0];
+    for (auto & entry : mEntries)
+    {
+        if ((entry.lastUsed == 0) || (entry.expiresAt <= now))
+        {
+            return entry;
+        }
+        if (entry.lastUsed < oldest->lastUsed)
+        {
+            oldest = &entry;
+        }
+    }
+    return *oldest;
+}
+
+void NodeAddressCache::Update(const PeerId & peerId, const ResolveResult & result, uint32_t ttlSeconds,
+                              System::Clock::Timestamp now)
+{
+    VerifyOrReturn(!mEntries.empty());
+
+    if (ttlSeconds == 0)
+    {
+        Remove(peerId);
+        return;
+    }
+
+    const System::Clock::Timestamp expiresAt = now + System::Clock::Seconds64(ttlSeconds);
+
+    Entry * entry = FindEntry(peerId);
+    if ((entry != nullptr) && (now - entry->updatedAt <= kMergeWindow))
+    {
+        entry->expiresAt = std::min(entry->expiresAt, expiresAt);
+    }
+    else
+    {
+        if (entry == nullptr)
+        {
+            entry           = &AllocateEntry(now);
+            entry->peerId   = peerId;
+            entry->lastUsed = ++mUseCounter;
+        }
+        entry->results   = NodeLookupResults();
+        entry->updatedAt = now;
+        entry->expiresAt = expiresAt;
+    }
+
+    auto score = Dnssd::IPAddressSorter::ScoreIpAddress(result.address.GetIPAddress(), result.address.GetInterface());
+    entry->results.UpdateResults(result, score);
+}
+
+const NodeLookupResults * NodeAddressCache::Find(const PeerId & peerId, System::Clock::Timestamp now)
+{
+    Entry * entry = FindEntry(peerId);
+    VerifyOrReturnValue(entry != nullptr, nullptr);
+
+    if (entry->expiresAt <= now)
+    {
+        *entry = Entry();
+        return nullptr;
+    }
+
+    entry->lastUsed = ++mUseCounter;
+    return &entry->results;
+}
+
+void NodeAddressCache::Remove(const PeerId & peerId)
+{
+    Entry * entry = FindEntry(peerId);
+    VerifyOrReturn(entry != nullptr);
+    *entry = Entry();
+}
+
+void NodeAddressCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        entry = Entry();
+    }
+}
+
+CHIP_ERROR NodeAddressCache::SaveSnapshot(PersistentStorageDelegate & storage, System::Clock::Timestamp now) const
+{
+    uint32_t realNowSeconds;
+    ReturnErrorOnFailure(GetRealTimeSeconds(realNowSeconds));
+
+    Platform::ScopedMemoryBuffer<uint8_t> buffer;
+    VerifyOrReturnError(buffer.Alloc(kSnapshotMaxSize), CHIP_ERROR_NO_MEMORY);
+
+    TLV::TLVWriter writer;
+    writer.Init(buffer.Get(), kSnapshotMaxSize);
+
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Array, arrayType));
+
+    for (const auto & entry : mEntries)
+    {
+        if ((entry.lastUsed == 0) || (entry.expiresAt <= now))
+        {
+            continue;
+        }
+
+        // Leave room for closing the array
+        if (writer.GetRemainingFreeLength() < kMaxSnapshotEntrySize + 1)
+        {
+            ChipLogProgress(Discovery, "Address cache snapshot full, not saving all entries");
+            break;
+        }
+
+        const auto remaining = std::chrono::duration_cast<System::Clock::Seconds32>(entry.expiresAt - now);
+
+        TLV::TLVType entryType;
+        ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, entryType));
+        ReturnErrorOnFailure(writer.Put(kFabricIdTag, entry.peerId.GetCompressedFabricId()));
+        ReturnErrorOnFailure(writer.Put(kNodeIdTag, entry.peerId.GetNodeId()));
+        ReturnErrorOnFailure(writer.Put(kExpiresAtTag, static_cast<uint32_t>(realNowSeconds + remaining.count())));
+
+        TLV::TLVType resultsType;
+        ReturnErrorOnFailure(writer.StartContainer(kResultsTag, TLV::kTLVType_Array, resultsType));
+        for (uint8_t i = 0; i < entry.results.count; i++)
+        {
+            const ResolveResult & result = entry.results.results[i];
+            // Only the address and port are saved, so the interface other addresses were reported on is cleared
+            if (result.address.GetIPAddress().IsIPv6LinkLocal())
+            {
+                continue;
+            }
+
+            uint8_t address[kIPv6AddressSizeBytes];
+            uint8_t * addressEnd = address;
+            result.address.GetIPAddress().WriteAddress(addressEnd);
+
+            uint8_t flags = 0;
+            flags |= result.supportsTcpClient ? kSupportsTcpClient : 0;
+            flags |= result.supportsTcpServer ? kSupportsTcpServer : 0;
+            flags |= result.isICDOperatingAsLIT ? kIsICDOperatingAsLIT : 0;
+
+            TLV::TLVType resultType;
+            ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, resultType));
+            ReturnErrorOnFailure(writer.Put(kAddressTag, ByteSpan(address)));
+            ReturnErrorOnFailure(writer.Put(kPortTag, result.address.GetPort()));
+            ReturnErrorOnFailure(writer.Put(kIdleIntervalTag, result.mrpRemoteConfig.mIdleRetransTimeout.count()));
+            ReturnErrorOnFailure(writer.Put(kActiveIntervalTag, result.mrpRemoteConfig.mActiveRetransTimeout.count()));
+            ReturnErrorOnFailure(writer.Put(kActiveThresholdTag, result.mrpRemoteConfig.mActiveThresholdTime.count()));
+            ReturnErrorOnFailure(writer.Put(kFlagsTag, flags));
+            ReturnErrorOnFailure(writer.EndContainer(resultType));
+        }
+        ReturnErrorOnFailure(writer.EndContainer(resultsType));
+        ReturnErrorOnFailure(writer.EndContainer(entryType));
+    }
+
+    ReturnErrorOnFailure(writer.EndContainer(arrayType));
+
+    const auto len = writer.GetLengthWritten();
+    VerifyOrReturnError(CanCastTo<uint16_t>(len), CHIP_ERROR_BUFFER_TOO_SMALL);
+
+    return storage.SyncSetKeyValue(DefaultStorageKeyAllocator::AddressResolveCache().KeyName(), buffer.Get(),
+                                   static_cast<uint16_t>(len));
+}
+
+CHIP_ERROR NodeAddressCache::LoadSnapshot(PersistentStorageDelegate & storage, System::Clock::Timestamp now)
+{
+    uint32_t realNowSeconds;
+    ReturnErrorOnFailure(GetRealTimeSeconds(realNowSeconds));
+
+    Platform::ScopedMemoryBuffer<uint8_t> buffer;
+    VerifyOrReturnError(buffer.Alloc(kSnapshotMaxSize), CHIP_ERROR_NO_MEMORY);
+
+    uint16_t size = static_cast<uint16_t>(kSnapshotMaxSize);
+    ReturnErrorOnFailure(storage.SyncGetKeyValue(DefaultStorageKeyAllocator::AddressResolveCache().KeyName(), buffer.Get(), size));
+
+    TLV::TLVReader reader;
+    reader.Init(buffer.Get(), size);
+    ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, TLV::AnonymousTag()));
+
+    TLV::TLVType arrayType;
+    ReturnErrorOnFailure(reader.EnterContainer(arrayType));
+
+    CHIP_ERROR err;
+    while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag())) == CHIP_NO_ERROR)
+    {
+        CompressedFabricId fabricId;
+        NodeId nodeId;
+        uint32_t expiresAtSeconds;
+
+        TLV::TLVType entryType;
+        ReturnErrorOnFailure(reader.EnterContainer(entryType));
+        ReturnErrorOnFailure(reader.Next(kFabricIdTag));
+        ReturnErrorOnFailure(reader.Get(fabricId));
+        ReturnErrorOnFailure(reader.Next(kNodeIdTag));
+        ReturnErrorOnFailure(reader.Get(nodeId));
+        ReturnErrorOnFailure(reader.Next(kExpiresAtTag));
+        ReturnErrorOnFailure(reader.Get(expiresAtSeconds));
+        ReturnErrorOnFailure(reader.Next(TLV::kTLVType_Array, kResultsTag));
+
+        const PeerId peerId(fabricId, nodeId);
+        const uint32_t ttlSeconds = (expiresAtSeconds > realNowSeconds) ? (expiresAtSeconds - realNowSeconds) : 0;
+
+        TLV::TLVType resultsType;
+        ReturnErrorOnFailure(reader.EnterContainer(resultsType));
+        while ((err = reader.Next(TLV::kTLVType_Structure, TLV::AnonymousTag())) == CHIP_NO_ERROR)
+        {
+            ResolveResult result;
+            ByteSpan address;
+            uint16_t port;
+            uint32_t idleInterval;
+            uint32_t activeInterval;
+            uint16_t activeThreshold;
+            uint8_t flags;
+
+            TLV::TLVType resultType;
+            ReturnErrorOnFailure(reader.EnterContainer(resultType));
+            ReturnErrorOnFailure(reader.Next(kAddressTag));
+            ReturnErrorOnFailure(reader.Get(address));
+            VerifyOrReturnError(address.size() == kIPv6AddressSizeBytes, CHIP_ERROR_INTERNAL);
+            ReturnErrorOnFailure(reader.Next(kPortTag));
+            ReturnErrorOnFailure(reader.Get(port));
+            ReturnErrorOnFailure(reader.Next(kIdleIntervalTag));
+            ReturnErrorOnFailure(reader.Get(idleInterval));
+            ReturnErrorOnFailure(reader.Next(kActiveIntervalTag));
+            ReturnErrorOnFailure(reader.Get(activeInterval));
+            ReturnErrorOnFailure(reader.Next(kActiveThresholdTag));
+            ReturnErrorOnFailure(reader.Get(activeThreshold));
+            ReturnErrorOnFailure(reader.Next(kFlagsTag));
+            ReturnErrorOnFailure(reader.Get(flags));
+            ReturnErrorOnFailure(reader.ExitContainer(resultType));
+
+            Inet::IPAddress ipAddress;
+            const uint8_t * addressStart = address.data();
+            Inet::IPAddress::ReadAddress(addressStart, ipAddress);
+
+            result.address.SetIPAddress(ipAddress);
+            result.address.SetPort(port);
+            result.mrpRemoteConfig     = ReliableMessageProtocolConfig(System::Clock::Milliseconds32(idleInterval),
+                                                                       System::Clock::Milliseconds32(activeInterval),
+                                                                       System::Clock::Milliseconds16(activeThreshold));
+            result.supportsTcpClient   = (flags & kSupportsTcpClient) != 0;
+            result.supportsTcpServer   = (flags & kSupportsTcpServer) != 0;
+            result.isICDOperatingAsLIT = (flags & kIsICDOperatingAsLIT) != 0;
+
+            // Entries that expired while the snapshot was stored are dropped
+            if (ttlSeconds > 0)
+            {
+                Update(peerId, result, ttlSeconds, now);
+            }
+        }
+        VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+        ReturnErrorOnFailure(reader.ExitContainer(resultsType));
+        ReturnErrorOnFailure(reader.ExitContainer(entryType));
+    }
+    VerifyOrReturnError(err == CHIP_END_OF_TLV, err);
+
+    return reader.ExitContainer(arrayType);
+}
+
 void NodeLookupHandle::ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request)
 {
     mRequestStartTime = now;
     mRequest          = request;
     mResults          = NodeLookupResults();
+    mIsCachedLookup   = false;
+}
+
+void NodeLookupHandle::ResetForCachedLookup(System::Clock::Timestamp now, const NodeLookupRequest & request,
+                                            const NodeLookupResults & results)
+{
+    ResetForLookup(now, request);
+
+    // Nothing better is expected to show up: report the cached addresses right away
+    mRequest.SetMinLookupTime(System::Clock::Milliseconds32(0));
+    mResults          = results;
+    mResults.consumed = 0;
+    mIsCachedLookup   = true;
 }
 
 void NodeLookupHandle::LookupResult(const ResolveResult & result)
@@ -204,8 +517,20 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
 
     VerifyOrReturnError(mSystemLayer != nullptr, CHIP_ERROR_INCORRECT_STATE);
 
-    handle.ResetForLookup(mTimeSource.GetMonotonicTimestamp(), request);
-    auto & peerId = request.GetPeerId();
+    const System::Clock::Timestamp now = mTimeSource.GetMonotonicTimestamp();
+    auto & peerId                      = request.GetPeerId();
+
+    const NodeLookupResults * cachedResults = mAddressCache.Find(peerId, now);
+    if (cachedResults != nullptr)
+    {
+        handle.ResetForCachedLookup(now, request, *cachedResults);
+        mActiveLookups.PushBack(&handle);
+        ReArmTimer();
+        ChipLogProgress(Discovery, "Lookup for " ChipLogFormatPeerId " answered from address cache", ChipLogValuePeerId(peerId));
+        return CHIP_NO_ERROR;
+    }
+
+    handle.ResetForLookup(now, request);
     ReturnErrorOnFailure(Dnssd::Resolver::Instance().ResolveNodeId(peerId));
     mActiveLookups.PushBack(&handle);
     ReArmTimer();
@@ -216,10 +541,17 @@ CHIP_ERROR Resolver::LookupNode(const NodeLookupRequest & request, Impl::NodeLoo
 CHIP_ERROR Resolver::TryNextResult(Impl::NodeLookupHandle & handle)
 {
     VerifyOrReturnError(!mActiveLookups.Contains(&handle), CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(handle.HasLookupResult(), CHIP_ERROR_NOT_FOUND);
+
+    auto peerId = handle.GetRequest().GetPeerId();
+    if (!handle.HasLookupResult())
+    {
+        // None of the known addresses worked: the node probably moved, so make
+        // the next lookup ask DNSSD again.
+        mAddressCache.Remove(peerId);
+        return CHIP_ERROR_NOT_FOUND;
+    }
 
     auto listener = handle.GetListener();
-    auto peerId   = handle.GetRequest().GetPeerId();
     auto result   = handle.TakeLookupResult();
 
     MATTER_LOG_NODE_DISCOVERED(Tracing::DiscoveryInfoType::kRetryDifferent, &peerId, &result);
@@ -232,7 +564,7 @@ CHIP_ERROR Resolver::CancelLookup(Impl::NodeLookupHandle & handle, FailureCallba
 {
     VerifyOrReturnError(handle.IsActive(), CHIP_ERROR_INVALID_ARGUMENT);
     mActiveLookups.Remove(&handle);
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(handle.GetRequest().GetPeerId());
+    ResolutionNoLongerNeeded(handle.GetRequest().GetPeerId(), handle.IsCachedLookup());
 
     // Adjust any timing updates.
     ReArmTimer();
@@ -261,6 +593,25 @@ CHIP_ERROR Resolver::Init(System::Layer * systemLayer)
     return CHIP_NO_ERROR;
 }
 
+void Resolver::SetAddressCacheStorage(PersistentStorageDelegate * storage)
+{
+    mAddressCacheStorage = storage;
+    VerifyOrReturn(mAddressCacheStorage != nullptr && kAddressCacheSize > 0);
+
+    CHIP_ERROR err = mAddressCache.LoadSnapshot(*mAddressCacheStorage, mTimeSource.GetMonotonicTimestamp());
+    if (err != CHIP_NO_ERROR && err != CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND)
+    {
+        ChipLogError(Discovery, "Failed to load address cache: %" CHIP_ERROR_FORMAT, err.Format());
+    }
+}
+
+void Resolver::ResolutionNoLongerNeeded(const PeerId & peerId, bool isCachedLookup)
+{
+    // Cached lookups never asked DNSSD for anything
+    VerifyOrReturn(!isCachedLookup);
+    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+}
+
 void Resolver::Shutdown()
 {
     // mSystemLayer is set in ::Init, so if it's null that means the resolver
@@ -271,14 +622,15 @@ void Resolver::Shutdown()
     {
         auto current = mActiveLookups.begin();
 
-        const PeerId peerId     = current->GetRequest().GetPeerId();
-        NodeListener * listener = current->GetListener();
+        const PeerId peerId       = current->GetRequest().GetPeerId();
+        NodeListener * listener   = current->GetListener();
+        const bool isCachedLookup = current->IsCachedLookup();
 
         mActiveLookups.Erase(current);
 
         MATTER_LOG_NODE_DISCOVERY_FAILED(&peerId, CHIP_ERROR_SHUT_DOWN);
 
-        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+        ResolutionNoLongerNeeded(peerId, isCachedLookup);
         // Failure callback only called after iterator was cleared:
         // This allows failure handlers to deallocate structures that may
         // contain the active lookup data as a member (intrusive lists members)
@@ -289,46 +641,74 @@ void Resolver::Shutdown()
     // internal list of active lookups is empty at this point.
     ReArmTimer();
 
+    if (mAddressCacheStorage != nullptr && kAddressCacheSize > 0)
+    {
+        CHIP_ERROR err = mAddressCache.SaveSnapshot(*mAddressCacheStorage, mTimeSource.GetMonotonicTimestamp());
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(Discovery, "Failed to save address cache: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+
     mSystemLayer = nullptr;
     Dnssd::Resolver::Instance().SetOperationalDelegate(nullptr);
 }
 
 void Resolver::OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData)
 {
-    auto it = mActiveLookups.begin();
-    while (it != mActiveLookups.end())
-    {
-        auto current = it;
-        it++;
-        if (current->GetRequest().GetPeerId() != nodeData.operationalData.peerId)
-        {
-            continue;
-        }
+    const PeerId & peerId     = nodeData.operationalData.peerId;
+    const uint32_t ttlSeconds = nodeData.operationalData.ttlSeconds;
 
-        ResolveResult result;
+    ResolveResult result;
 
-        result.address.SetPort(nodeData.resolutionData.port);
-        result.address.SetInterface(nodeData.resolutionData.interfaceId);
-        result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
-        result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
-        result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
+    result.address.SetPort(nodeData.resolutionData.port);
+    result.address.SetInterface(nodeData.resolutionData.interfaceId);
+    result.mrpRemoteConfig   = nodeData.resolutionData.GetRemoteMRPConfig();
+    result.supportsTcpClient = nodeData.resolutionData.supportsTcpClient;
+    result.supportsTcpServer = nodeData.resolutionData.supportsTcpServer;
+
+    if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
+    {
+        result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
+    }
+
+    // Resolutions are cached even if no lookup is active: nodes announce
+    // themselves when they come online, which is when they are likely to be
+    // contacted next.
+    if (ttlSeconds == 0)
+    {
+        mAddressCache.Remove(peerId);
+    }
 
-        if (nodeData.resolutionData.isICDOperatingAsLIT.has_value())
+    for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
+    {
+#if !INET_CONFIG_ENABLE_IPV4
+        if (!nodeData.resolutionData.ipAddress[i].IsIPv6())
         {
-            result.isICDOperatingAsLIT = *(nodeData.resolutionData.isICDOperatingAsLIT);
+            ChipLogError(Discovery, "Skipping IPv4 address during operational resolve.");
+            continue;
         }
+#endif
+        result.address.SetIPAddress(nodeData.resolutionData.ipAddress[i]);
+        mAddressCache.Update(peerId, result, ttlSeconds, mTimeSource.GetMonotonicTimestamp());
 
-        for (size_t i = 0; i < nodeData.resolutionData.numIPs; i++)
+        for (auto & lookup : mActiveLookups)
         {
-#if !INET_CONFIG_ENABLE_IPV4
-            if (!nodeData.resolutionData.ipAddress[i].IsIPv6())
+            if (lookup.GetRequest().GetPeerId() == peerId)
             {
-                ChipLogError(Discovery, "Skipping IPv4 address during operational resolve.");
-                continue;
+                lookup.LookupResult(result);
             }
-#endif
-            result.address.SetIPAddress(nodeData.resolutionData.ipAddress[i]);
-            current->LookupResult(result);
+        }
+    }
+
+    auto it = mActiveLookups.begin();
+    while (it != mActiveLookups.end())
+    {
+        auto current = it;
+        it++;
+        if (current->GetRequest().GetPeerId() != peerId)
+        {
+            continue;
         }
 
         HandleAction(current);
@@ -348,11 +728,12 @@ void Resolver::HandleAction(IntrusiveList<NodeLookupHandle>::Iterator & current)
     }
 
     // final result, handle either success or failure
-    const PeerId peerId     = current->GetRequest().GetPeerId();
-    NodeListener * listener = current->GetListener();
+    const PeerId peerId       = current->GetRequest().GetPeerId();
+    NodeListener * listener   = current->GetListener();
+    const bool isCachedLookup = current->IsCachedLookup();
     mActiveLookups.Erase(current);
 
-    Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+    ResolutionNoLongerNeeded(peerId, isCachedLookup);
 
     // ensure action is taken AFTER the current current lookup is marked complete
     // This allows failure handlers to deallocate structures that may
@@ -399,10 +780,11 @@ void Resolver::OnOperationalNodeResolutionFailed(const PeerId & peerId, CHIP_ERR
             continue;
         }
 
-        NodeListener * listener = current->GetListener();
+        NodeListener * listener   = current->GetListener();
+        const bool isCachedLookup = current->IsCachedLookup();
         mActiveLookups.Erase(current);
 
-        Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+        ResolutionNoLongerNeeded(peerId, isCachedLookup);
 
         // Failure callback only called after iterator was cleared:
         // This allows failure handlers to deallocate structures that may
@@ -444,13 +826,14 @@ void Resolver::ReArmTimer()
         auto it = mActiveLookups.begin();
         while (it != mActiveLookups.end())
         {
-            const PeerId peerId     = it->GetRequest().GetPeerId();
-            NodeListener * listener = it->GetListener();
+            const PeerId peerId       = it->GetRequest().GetPeerId();
+            NodeListener * listener   = it->GetListener();
+            const bool isCachedLookup = it->IsCachedLookup();
 
             mActiveLookups.Erase(it);
             it = mActiveLookups.begin();
 
-            Dnssd::Resolver::Instance().NodeIdResolutionNoLongerNeeded(peerId);
+            ResolutionNoLongerNeeded(peerId, isCachedLookup);
             // Callback only called after active lookup is cleared
             // This allows failure handlers to deallocate structures that may
             // contain the active lookup data as a member (intrusive lists members)
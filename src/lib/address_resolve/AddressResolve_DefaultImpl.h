@@ -17,8 +17,11 @@
 #pragma once
 
 #include <lib/address_resolve/AddressResolve.h>
+#include <lib/core/CHIPPersistentStorageDelegate.h>
+#include <lib/core/TLVTags.h>
 #include <lib/dnssd/IPAddressSorter.h>
 #include <lib/dnssd/Resolver.h>
+#include <lib/support/Span.h>
 #include <system/TimeSource.h>
 #include <transport/raw/PeerAddress.h>
 
@@ -27,6 +30,7 @@ namespace AddressResolve {
 namespace Impl {
 
 inline constexpr uint8_t kNodeLookupResultsLen = CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS;
+inline constexpr size_t kAddressCacheSize       = CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE;
 
 enum class NodeLookupResult
 {
@@ -64,6 +68,81 @@ struct NodeLookupResults
 #endif // CHIP_DETAIL_LOGGING
 };
 
+/// Addresses of operational nodes, as found by previous lookups or by
+/// announcements received while no lookup was active.
+///
+/// Addresses are kept for the TTL of the DNSSD records they were found in, so
+/// that lookups of recently seen nodes can complete without a DNSSD round trip.
+/// When the cache is full, the least recently looked up node is forgotten.
+class NodeAddressCache
+{
+public:
+    struct Entry
+    {
+        PeerId peerId;
+        NodeLookupResults results;
+        System::Clock::Timestamp updatedAt;
+        System::Clock::Timestamp expiresAt;
+        uint32_t lastUsed = 0; // 0 for unused entries
+    };
+
+    /// Addresses reported within this time of an entry being replaced are
+    /// merged into it (a node reports its addresses one interface at a time).
+    /// Later reports replace the entry, so that addresses a node stopped
+    /// advertising are not kept.
+    static constexpr System::Clock::Milliseconds32 kMergeWindow = System::Clock::Milliseconds32(1000);
+
+    NodeAddressCache(Span<Entry> storage) : mEntries(storage) {}
+
+    /// Remember an address of `peerId`, valid for `ttlSeconds`. A TTL of 0
+    /// means that the node is going away and removes it.
+    void Update(const PeerId & peerId, const ResolveResult & result, uint32_t ttlSeconds, System::Clock::Timestamp now);
+
+    /// Returns the addresses of `peerId`, best first, or nullptr if none are valid at `now`.
+    const NodeLookupResults * Find(const PeerId & peerId, System::Clock::Timestamp now);
+
+    void Remove(const PeerId & peerId);
+    void Clear();
+
+    /// Writes the valid entries to `storage`. Expiry times are saved as real
+    /// time, so this fails if real time is not available.
+    ///
+    /// Link-local addresses are not saved: the interface they are valid on may
+    /// not be the same after a restart. Other addresses are saved without the
+    /// interface they were resolved on.
+    CHIP_ERROR SaveSnapshot(PersistentStorageDelegate & storage, System::Clock::Timestamp now) const;
+
+    /// Adds the entries saved by SaveSnapshot that are still valid.
+    CHIP_ERROR LoadSnapshot(PersistentStorageDelegate & storage, System::Clock::Timestamp now);
+
+private:
+    static constexpr TLV::Tag kFabricIdTag        = TLV::ContextTag(1);
+    static constexpr TLV::Tag kNodeIdTag          = TLV::ContextTag(2);
+    static constexpr TLV::Tag kExpiresAtTag       = TLV::ContextTag(3);
+    static constexpr TLV::Tag kResultsTag         = TLV::ContextTag(4);
+    static constexpr TLV::Tag kAddressTag         = TLV::ContextTag(1);
+    static constexpr TLV::Tag kPortTag            = TLV::ContextTag(2);
+    static constexpr TLV::Tag kIdleIntervalTag    = TLV::ContextTag(3);
+    static constexpr TLV::Tag kActiveIntervalTag  = TLV::ContextTag(4);
+    static constexpr TLV::Tag kActiveThresholdTag = TLV::ContextTag(5);
+    static constexpr TLV::Tag kFlagsTag           = TLV::ContextTag(6);
+
+    enum SnapshotFlags : uint8_t
+    {
+        kSupportsTcpClient   = 0x01,
+        kSupportsTcpServer   = 0x02,
+        kIsICDOperatingAsLIT = 0x04,
+    };
+
+    Entry * FindEntry(const PeerId & peerId);
+
+    /// Returns an unused entry, an expired one or the least recently used one.
+    Entry & AllocateEntry(System::Clock::Timestamp now);
+
+    Span<Entry> mEntries;
+    uint32_t mUseCounter = 0;
+};
+
 /// Action to take when some resolve data
 /// has been received by an active lookup
 class NodeLookupAction
@@ -133,6 +212,13 @@ public:
     /// Resets internal state (i.e. best address so far)
     void ResetForLookup(System::Clock::Timestamp now, const NodeLookupRequest & request);
 
+    /// Sets up a request answered from cached addresses: the results are
+    /// reported without waiting for the min lookup time and no DNSSD
+    /// resolution is requested for it.
+    void ResetForCachedLookup(System::Clock::Timestamp now, const NodeLookupRequest & request, const NodeLookupResults & results);
+
+    bool IsCachedLookup() const { return mIsCachedLookup; }
+
     /// Mark that a specific IP address has been found
     void LookupResult(const ResolveResult & result);
 
@@ -161,6 +247,7 @@ private:
     NodeLookupResults mResults;
     NodeLookupRequest mRequest; // active request to process
     System::Clock::Timestamp mRequestStartTime;
+    bool mIsCachedLookup = false;
 };
 
 class Resolver : public ::chip::AddressResolve::Resolver, public Dnssd::OperationalResolveDelegate
@@ -176,6 +263,10 @@ public:
     CHIP_ERROR CancelLookup(Impl::NodeLookupHandle & handle, FailureCallback cancel_method) override;
     void Shutdown() override;
 
+    /// Keeps the address cache in `storage` across restarts: it is loaded
+    /// right away and saved on Shutdown. Pass nullptr to stop saving it.
+    void SetAddressCacheStorage(PersistentStorageDelegate * storage);
+
     // Dnssd::OperationalResolveDelegate
 
     void OnOperationalNodeResolved(const Dnssd::ResolvedNodeData & nodeData) override;
@@ -194,6 +285,9 @@ private:
     /// on the closest event required for an active resolve.
     void ReArmTimer();
 
+    /// Stops the DNSSD resolution started for the given lookup, if any.
+    static void ResolutionNoLongerNeeded(const PeerId & peerId, bool isCachedLookup);
+
     /// Handles the 'NextAction' on the given iterator
     ///
     /// NOTE: may remove `current` from the internal list. Current MUST NOT
@@ -203,6 +297,10 @@ private:
     System::Layer * mSystemLayer = nullptr;
     Time::TimeSource<Time::Source::kSystem> mTimeSource;
     IntrusiveList<NodeLookupHandle> mActiveLookups;
+
+    NodeAddressCache::Entry mAddressCacheEntries[kAddressCacheSize > 0 ? kAddressCacheSize : 1];
+    NodeAddressCache mAddressCache{ Span<NodeAddressCache::Entry>(mAddressCacheEntries, kAddressCacheSize) };
+    PersistentStorageDelegate * mAddressCacheStorage = nullptr;
 };
 
 } // namespace Impl
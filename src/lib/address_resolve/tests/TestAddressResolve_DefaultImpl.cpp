@@ -19,7 +19,9 @@
 #include <lib/address_resolve/AddressResolve_DefaultImpl.h>
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/dnssd/IPAddressSorter.h>
+#include <lib/support/CHIPMem.h>
 #include <lib/support/StringBuilder.h>
+#include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <system/RAIIMockClock.h>
 #include <system/SystemLayerImpl.h>
@@ -522,6 +524,196 @@ TEST(TestAddressResolveDefaultImpl, TestGivesUpAfterMaxLookupTimeIsReachedWithou
     EXPECT_EQ(action.ErrorResult(), CHIP_ERROR_TIMEOUT);
 }
 
+class TestAddressCache : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+};
+
+TEST_F(TestAddressCache, RespectsTtl)
+{
+    System::Clock::Internal::RAIIMockClock clock;
+
+    Impl::NodeAddressCache::Entry storage[2];
+    Impl::NodeAddressCache cache{ Span<Impl::NodeAddressCache::Entry>(storage) };
+
+    const PeerId peerId(1, 2);
+    ResolveResult result;
+    result.address = GetAddressWithMediumScore();
+
+    EXPECT_EQ(cache.Find(peerId, clock.GetMonotonicTimestamp()), nullptr);
+
+    cache.Update(peerId, result, 10 /* ttlSeconds */, clock.GetMonotonicTimestamp());
+
+    const Impl::NodeLookupResults * cached = cache.Find(peerId, clock.GetMonotonicTimestamp());
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(cached->count, 1);
+    EXPECT_EQ(cached->results[0].address, result.address);
+    EXPECT_EQ(cache.Find(PeerId(1, 3), clock.GetMonotonicTimestamp()), nullptr);
+
+    clock.AdvanceMonotonic(9999_ms64);
+    EXPECT_NE(cache.Find(peerId, clock.GetMonotonicTimestamp()), nullptr);
+
+    clock.AdvanceMonotonic(1_ms64);
+    EXPECT_EQ(cache.Find(peerId, clock.GetMonotonicTimestamp()), nullptr);
+
+    // A zero TTL announces that the node is going away
+    cache.Update(peerId, result, 10, clock.GetMonotonicTimestamp());
+    EXPECT_NE(cache.Find(peerId, clock.GetMonotonicTimestamp()), nullptr);
+    cache.Update(peerId, result, 0, clock.GetMonotonicTimestamp());
+    EXPECT_EQ(cache.Find(peerId, clock.GetMonotonicTimestamp()), nullptr);
+}
+
+TEST_F(TestAddressCache, ReplacesStaleAddresses)
+{
+    System::Clock::Internal::RAIIMockClock clock;
+
+    Impl::NodeAddressCache::Entry storage[1];
+    Impl::NodeAddressCache cache{ Span<Impl::NodeAddressCache::Entry>(storage) };
+
+    const PeerId peerId(1, 2);
+    ResolveResult lowResult;
+    lowResult.address = GetAddressWithLowScore();
+    ResolveResult mediumResult;
+    mediumResult.address = GetAddressWithMediumScore();
+
+    // Addresses reported together are merged, best first
+    cache.Update(peerId, lowResult, 120, clock.GetMonotonicTimestamp());
+    clock.AdvanceMonotonic(10_ms64);
+    cache.Update(peerId, mediumResult, 120, clock.GetMonotonicTimestamp());
+
+    const Impl::NodeLookupResults * cached = cache.Find(peerId, clock.GetMonotonicTimestamp());
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(cached->results[0].address, mediumResult.address);
+
+    // A later report replaces addresses the node may have stopped using
+    clock.AdvanceMonotonic(Impl::NodeAddressCache::kMergeWindow + 1_ms64);
+    cache.Update(peerId, lowResult, 120, clock.GetMonotonicTimestamp());
+
+    cached = cache.Find(peerId, clock.GetMonotonicTimestamp());
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(cached->count, 1);
+    EXPECT_EQ(cached->results[0].address, lowResult.address);
+}
+
+TEST_F(TestAddressCache, EvictsLeastRecentlyUsed)
+{
+    System::Clock::Internal::RAIIMockClock clock;
+
+    Impl::NodeAddressCache::Entry storage[2];
+    Impl::NodeAddressCache cache{ Span<Impl::NodeAddressCache::Entry>(storage) };
+
+    ResolveResult result;
+    result.address = GetAddressWithMediumScore();
+
+    auto now = clock.GetMonotonicTimestamp();
+    cache.Update(PeerId(1, 1), result, 120, now);
+    cache.Update(PeerId(1, 2), result, 120, now);
+
+    // Node 1 was looked up more recently than node 2
+    EXPECT_NE(cache.Find(PeerId(1, 1), now), nullptr);
+
+    cache.Update(PeerId(1, 3), result, 120, now);
+    EXPECT_NE(cache.Find(PeerId(1, 1), now), nullptr);
+    EXPECT_EQ(cache.Find(PeerId(1, 2), now), nullptr);
+    EXPECT_NE(cache.Find(PeerId(1, 3), now), nullptr);
+
+    // Expired entries are reused before evicting anything
+    cache.Update(PeerId(1, 4), result, 1, now);
+    EXPECT_EQ(cache.Find(PeerId(1, 1), now), nullptr);
+    clock.AdvanceMonotonic(1000_ms64);
+    now = clock.GetMonotonicTimestamp();
+    cache.Update(PeerId(1, 5), result, 120, now);
+    EXPECT_NE(cache.Find(PeerId(1, 3), now), nullptr);
+    EXPECT_NE(cache.Find(PeerId(1, 5), now), nullptr);
+}
+
+TEST_F(TestAddressCache, Snapshot)
+{
+    System::Clock::Internal::RAIIMockClock clock;
+    EXPECT_SUCCESS(clock.SetClock_RealTime(System::Clock::Seconds64(1700000000)));
+
+    TestPersistentStorageDelegate storage;
+
+    Impl::NodeAddressCache::Entry savedStorage[3];
+    Impl::NodeAddressCache saved{ Span<Impl::NodeAddressCache::Entry>(savedStorage) };
+
+    ResolveResult result;
+    result.address                             = GetAddressWithMediumScore(1234);
+    result.mrpRemoteConfig.mIdleRetransTimeout = 5000_ms32;
+    result.supportsTcpServer                   = true;
+
+    const Inet::InterfaceId interfaceId(static_cast<Inet::InterfaceId::PlatformType>(1));
+    ResolveResult linkLocalResult;
+    linkLocalResult.address = GetAddressWithHighScore(CHIP_PORT, interfaceId);
+
+    // Resolvers report every address with the interface it was seen on
+    ResolveResult globalResult;
+    globalResult.address = GetAddressWithMediumScore(5678, interfaceId);
+
+    saved.Update(PeerId(1, 1), result, 60, clock.GetMonotonicTimestamp());
+    saved.Update(PeerId(1, 2), linkLocalResult, 60, clock.GetMonotonicTimestamp());
+    saved.Update(PeerId(1, 3), globalResult, 60, clock.GetMonotonicTimestamp());
+    EXPECT_SUCCESS(saved.SaveSnapshot(storage, clock.GetMonotonicTimestamp()));
+
+    // Restart 30 seconds later
+    clock.AdvanceRealTime(30000_ms64);
+    clock.SetMonotonic(0_ms64);
+
+    Impl::NodeAddressCache::Entry loadedStorage[3];
+    Impl::NodeAddressCache loaded{ Span<Impl::NodeAddressCache::Entry>(loadedStorage) };
+    EXPECT_SUCCESS(loaded.LoadSnapshot(storage, clock.GetMonotonicTimestamp()));
+
+    const Impl::NodeLookupResults * cached = loaded.Find(PeerId(1, 1), clock.GetMonotonicTimestamp());
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(cached->results[0].address, result.address);
+    EXPECT_EQ(cached->results[0].mrpRemoteConfig, result.mrpRemoteConfig);
+    EXPECT_TRUE(cached->results[0].supportsTcpServer);
+    EXPECT_FALSE(cached->results[0].supportsTcpClient);
+
+    // Interfaces do not survive a restart: link-local addresses are dropped, others lose their interface
+    EXPECT_EQ(loaded.Find(PeerId(1, 2), clock.GetMonotonicTimestamp()), nullptr);
+    cached = loaded.Find(PeerId(1, 3), clock.GetMonotonicTimestamp());
+    ASSERT_NE(cached, nullptr);
+    EXPECT_EQ(cached->count, 1);
+    EXPECT_EQ(cached->results[0].address.GetIPAddress(), globalResult.address.GetIPAddress());
+    EXPECT_EQ(cached->results[0].address.GetPort(), 5678);
+    EXPECT_FALSE(cached->results[0].address.GetInterface().IsPresent());
+
+    // Loaded entries keep their remaining TTL
+    clock.AdvanceMonotonic(30000_ms64);
+    EXPECT_EQ(loaded.Find(PeerId(1, 1), clock.GetMonotonicTimestamp()), nullptr);
+}
+
+TEST(TestAddressResolveDefaultImpl, CachedLookupReportsResultsRightAway)
+{
+    AddressResolve::NodeLookupHandle handle;
+
+    System::Clock::Internal::RAIIMockClock clock;
+
+    ResolveResult lowResult;
+    lowResult.address = GetAddressWithLowScore(static_cast<uint16_t>(1));
+
+    Impl::NodeLookupResults results;
+    results.UpdateResults(lowResult, IpScore::kUniqueLocal);
+
+    auto request = NodeLookupRequest(chip::PeerId(1, 2));
+    request.SetMinLookupTime(100_ms32);
+    request.SetMaxLookupTime(200_ms32);
+
+    handle.ResetForCachedLookup(clock.GetMonotonicTimestamp(), request, results);
+    EXPECT_TRUE(handle.IsCachedLookup());
+    EXPECT_EQ(handle.NextEventTimeout(clock.GetMonotonicTimestamp()), 0_ms64);
+
+    auto action = handle.NextAction(clock.GetMonotonicTimestamp());
+    EXPECT_EQ(action.Type(), chip::AddressResolve::Impl::NodeLookupResult::kLookupSuccess);
+    EXPECT_EQ(action.ResolveResult().address, lowResult.address);
+
+    handle.ResetForLookup(clock.GetMonotonicTimestamp(), request);
+    EXPECT_FALSE(handle.IsCachedLookup());
+}
+
 class MockResolver : public chip::Dnssd::Resolver
 {
 public:
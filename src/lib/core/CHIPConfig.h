@@ -821,6 +821,35 @@
 #define CHIP_CONFIG_SECURE_SESSION_POOL_SIZE (CHIP_CONFIG_MAX_FABRICS * 3 + 2)
 #endif // CHIP_CONFIG_SECURE_SESSION_POOL_SIZE
 
+/**
+ * @def CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+ *
+ * @brief Keep an AES-CCM cipher context with the expanded key for each
+ * direction of a secure session, instead of setting one up for every
+ * message (see Crypto::Aes128CcmContext).
+ *
+ * With the OpenSSL, BoringSSL and mbedTLS backends the cipher state is
+ * allocated from the heap when a session is established.
+ *
+ */
+#ifndef CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+#define CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE 0
+#endif // CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+
+/**
+ * @def CHIP_CONFIG_SECURE_MESSAGE_ENCRYPT_BATCH_SIZE
+ *
+ * @brief Number of messages that SessionManager::PrepareMessages() hands to
+ * the crypto PAL in a single AES_CCM_encrypt_batch() call.
+ *
+ * The per-message state of a batch lives on the stack, roughly 400 bytes
+ * per message.
+ *
+ */
+#ifndef CHIP_CONFIG_SECURE_MESSAGE_ENCRYPT_BATCH_SIZE
+#define CHIP_CONFIG_SECURE_MESSAGE_ENCRYPT_BATCH_SIZE 4
+#endif // CHIP_CONFIG_SECURE_MESSAGE_ENCRYPT_BATCH_SIZE
+
 /**
  *  @def CHIP_CONFIG_MAX_GROUP_DATA_PEERS
  *
@@ -983,6 +1012,34 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_IM_SERVER_MAX_NUM_DIRTY_SET 8
 #endif
 
+/**
+ * @def CHIP_CONFIG_IM_ENABLE_READ_HANDLER_INTEREST_INDEX
+ *
+ * @brief Maintain an index from attribute paths to the read handlers interested in them, so that marking an attribute
+ *        dirty only visits the read handlers whose paths intersect it instead of every path of every read handler.
+ *
+ *        The index holds one entry per attribute path of every active read handler, so it is enabled by default only
+ *        when object pools are heap allocated.
+ */
+#ifndef CHIP_CONFIG_IM_ENABLE_READ_HANDLER_INTEREST_INDEX
+#define CHIP_CONFIG_IM_ENABLE_READ_HANDLER_INTEREST_INDEX CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#endif
+
+/**
+ * @def CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE
+ *
+ * @brief Number of slots of the hash index that ServerClusterInterfaceRegistry keeps from cluster paths to the
+ *        registered clusters. Must be a power of two. The index holds up to 3/4 of its slots worth of paths (one
+ *        slot is 8 bytes plus a pointer); paths that do not fit are found by scanning the registrations.
+ *
+ *        When object pools are heap allocated this is the initial size, and the index grows as needed.
+ *
+ *        Set to 0 to disable the index.
+ */
+#ifndef CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE
+#define CHIP_CONFIG_SERVER_CLUSTER_REGISTRY_INDEX_SIZE 32
+#endif
+
 /**
  * @def CHIP_IM_MAX_NUM_WRITE_HANDLER
  *
@@ -1280,6 +1337,27 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EXAMPLE_ACCESS_CONTROL_FAST_COPY_SUPPORT 1
 #endif
 
+/**
+ * @def CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+ *
+ * Number of access control decisions (the privileges granted to a subject on a
+ * cluster instance) that AccessControl remembers, so that repeated checks, such
+ * as those for every attribute of a wildcard read, do not iterate the access
+ * control list. Must be a multiple of 4.
+ *
+ * The cache and the compiled access control entries it is built from are heap
+ * allocated, so it is enabled by default only when object pools are.
+ *
+ * Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 64
+#else
+#define CHIP_CONFIG_ACCESS_CONTROL_DECISION_CACHE_SIZE 0
+#endif
+#endif
+
 /**
  * @def CHIP_CONFIG_ENABLE_ACL_EXTENSIONS
  *
@@ -1342,6 +1420,64 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_CASE_SESSION_RESUME_CACHE_SIZE (3 * CHIP_CONFIG_MAX_FABRICS)
 #endif
 
+/**
+ * @def CHIP_CONFIG_CASE_CRYPTO_WORKER_THREADS
+ *
+ * @brief
+ *   Number of dedicated threads used to run the P-256 ECDH/ECDSA operations of CASE handshakes
+ *   (Sigma2 and Sigma3) off the Matter thread. Signatures with the operational key only run there when the
+ *   operational keystore supports signing in the background.
+ *
+ *   When 0, or when the platform does not provide POSIX threads, the work is handed to
+ *   PlatformManager::ScheduleBackgroundWork as before.
+ */
+#ifndef CHIP_CONFIG_CASE_CRYPTO_WORKER_THREADS
+#define CHIP_CONFIG_CASE_CRYPTO_WORKER_THREADS 0
+#endif // CHIP_CONFIG_CASE_CRYPTO_WORKER_THREADS
+
+/**
+ * @def CHIP_CONFIG_CASE_CRYPTO_MAX_IN_FLIGHT
+ *
+ * @brief
+ *   Maximum number of CASE crypto jobs that may be queued or running on the crypto worker pool
+ *   at any time. Once reached, a responder answers new Sigma1 messages with a Busy status report
+ *   and Sigma3 work is processed on the Matter thread.
+ */
+#ifndef CHIP_CONFIG_CASE_CRYPTO_MAX_IN_FLIGHT
+#define CHIP_CONFIG_CASE_CRYPTO_MAX_IN_FLIGHT 8
+#endif // CHIP_CONFIG_CASE_CRYPTO_MAX_IN_FLIGHT
+
+/**
+ * @def CHIP_CONFIG_CASE_DESTINATION_ID_CACHE_SIZE
+ *
+ * @brief
+ *   Number of IPKs for which a CASE responder keeps a precomputed HMAC key state, so that matching
+ *   the destination identifier of an incoming Sigma1 skips the HMAC key setup for each candidate
+ *   fabric. Each entry costs one HMAC context of the crypto backend.
+ *
+ *   A Sigma1 is matched against every epoch IPK (up to 3) of every fabric, so a cache smaller than
+ *   that evicts its own entries during a single lookup and is slower than no cache at all.
+ *
+ *   Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_CASE_DESTINATION_ID_CACHE_SIZE
+#define CHIP_CONFIG_CASE_DESTINATION_ID_CACHE_SIZE (CHIP_CONFIG_MAX_FABRICS * 3)
+#endif // CHIP_CONFIG_CASE_DESTINATION_ID_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_VERIFIED_ISSUER_CACHE_SIZE
+ *
+ * @brief
+ *   Number of intermediate (ICA) certificate signature checks the FabricTable remembers, so that
+ *   validating the operational certificate chain of a CASE peer only verifies the NOC signature
+ *   when its issuer has been seen before. Each entry takes 40 bytes or so.
+ *
+ *   Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_VERIFIED_ISSUER_CACHE_SIZE
+#define CHIP_CONFIG_VERIFIED_ISSUER_CACHE_SIZE (2 * CHIP_CONFIG_MAX_FABRICS)
+#endif // CHIP_CONFIG_VERIFIED_ISSUER_CACHE_SIZE
+
 /**
  * @def CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD
  *
@@ -1362,6 +1498,67 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD 512
 #endif /* CHIP_CONFIG_EVENT_LOGGING_BYTE_THRESHOLD */
 
+/**
+ * @def CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE
+ *
+ * @brief The number of most recent events whose event number and position
+ *   each event logging buffer remembers, so that fetching events since a given
+ *   event number can seek to it instead of decoding every older event.
+ *
+ * Each entry takes 16 bytes per priority buffer. Fetches for event numbers
+ * older than the oldest indexed event fall back to scanning the buffer.
+ *
+ * Set to 0 to disable the index.
+ */
+#ifndef CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE
+#if CHIP_SYSTEM_CONFIG_POOL_USE_HEAP
+#define CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE 32
+#else
+#define CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE 0
+#endif
+#endif /* CHIP_CONFIG_EVENT_NUMBER_INDEX_SIZE */
+
+/**
+ * @def CHIP_CONFIG_EVENT_STAGING_QUEUES
+ *
+ * @brief The number of threads that can concurrently log events with
+ *   EventManagement::LogEventFromAnyThread.
+ *
+ * Each such thread claims a staging queue for as long as it runs. Events are
+ * serialized into the queue without taking the Matter stack lock, and logged
+ * to the event buffers in batches on the Matter thread. Events staged by a
+ * thread while all queues are claimed by other threads are dropped.
+ *
+ * Set to 0 to disable LogEventFromAnyThread.
+ */
+#ifndef CHIP_CONFIG_EVENT_STAGING_QUEUES
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#define CHIP_CONFIG_EVENT_STAGING_QUEUES 4
+#else
+#define CHIP_CONFIG_EVENT_STAGING_QUEUES 0
+#endif
+#endif /* CHIP_CONFIG_EVENT_STAGING_QUEUES */
+
+/**
+ * @def CHIP_CONFIG_EVENT_STAGING_QUEUE_SIZE
+ *
+ * @brief The number of events each staging queue holds until the Matter
+ *   thread logs them. Must be a power of 2.
+ */
+#ifndef CHIP_CONFIG_EVENT_STAGING_QUEUE_SIZE
+#define CHIP_CONFIG_EVENT_STAGING_QUEUE_SIZE 16
+#endif /* CHIP_CONFIG_EVENT_STAGING_QUEUE_SIZE */
+
+/**
+ * @def CHIP_CONFIG_EVENT_STAGING_MAX_PAYLOAD_SIZE
+ *
+ * @brief The largest event data, in bytes of TLV, that can be staged by
+ *   EventManagement::LogEventFromAnyThread.
+ */
+#ifndef CHIP_CONFIG_EVENT_STAGING_MAX_PAYLOAD_SIZE
+#define CHIP_CONFIG_EVENT_STAGING_MAX_PAYLOAD_SIZE 128
+#endif /* CHIP_CONFIG_EVENT_STAGING_MAX_PAYLOAD_SIZE */
+
 /**
  * @def CHIP_CONFIG_ENABLE_SERVER_IM_EVENT
  *
@@ -1472,6 +1669,20 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES 2
 #endif // CHIP_CONFIG_MINMDNS_MAX_PARALLEL_RESOLVES
 
+/*
+ * @def CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+ *
+ * @brief Number of serialized replies the minmdns responder keeps for recently answered
+ *        queries (per query type, class, name and interface), so that repeated queries
+ *        (e.g. many controllers browsing for the same service) are answered without
+ *        rebuilding the reply. Cached replies are heap allocated.
+ *
+ *        Set to 0 to disable the cache.
+ */
+#ifndef CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+#define CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE 4
+#endif // CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE
+
 /**
  * def CHIP_CONFIG_MDNS_RESOLVE_LOOKUP_RESULTS
  *
@@ -1505,6 +1716,33 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS 45000
 #endif // CHIP_CONFIG_ADDRESS_RESOLVE_MAX_LOOKUP_TIME_MS
 
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+ *
+ * @brief Number of operational nodes whose addresses are remembered by the
+ *        default address resolver, for as long as the TTL of their DNSSD
+ *        records. Lookups of remembered nodes complete without a DNSSD
+ *        round trip.
+ *
+ *        Addresses are also learned from announcements received while no
+ *        lookup is active, so controllers talking to many nodes benefit from
+ *        a large value. 0 disables the cache.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE 0
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SIZE
+
+/**
+ * @def CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SNAPSHOT_MAX_SIZE
+ *
+ * @brief Maximum size, in bytes, of the address cache snapshot written to
+ *        persistent storage on shutdown, when the application provides a
+ *        storage for it. Entries that do not fit are not saved.
+ */
+#ifndef CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SNAPSHOT_MAX_SIZE
+#define CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SNAPSHOT_MAX_SIZE 2048
+#endif // CHIP_CONFIG_ADDRESS_RESOLVE_CACHE_SNAPSHOT_MAX_SIZE
+
 /*
  * @def CHIP_CONFIG_NETWORK_COMMISSIONING_DEBUG_TEXT_BUFFER_SIZE
  *
@@ -1957,6 +2195,31 @@ extern const char CHIP_NON_PRODUCTION_MARKER[];
 #define CHIP_CONFIG_BDX_LOG_TRANSFER_MAX_BLOCK_SIZE 1024
 #endif // CHIP_CONFIG_BDX_LOG_TRANSFER_MAX_BLOCK_SIZE
 
+/**
+ *  @def CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE
+ *
+ *  @brief
+ *    Maximum number of Blocks a BDX sender keeps in flight without having received a BlockAck for them,
+ *    when the transfer uses the Async control mode. Each in-flight Block holds a copy of its message
+ *    (one packet buffer) so that it can be retransmitted.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE
+#define CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE 8
+#endif // CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE
+
+/**
+ *  @def CHIP_CONFIG_BDX_ASYNC_RETRANSMIT_TIMEOUT_MS
+ *
+ *  @brief
+ *    Time, in milliseconds, after which a BDX sender in Async control mode sends its unacknowledged
+ *    Blocks again if the receiver has not acknowledged any of them.
+ *
+ */
+#ifndef CHIP_CONFIG_BDX_ASYNC_RETRANSMIT_TIMEOUT_MS
+#define CHIP_CONFIG_BDX_ASYNC_RETRANSMIT_TIMEOUT_MS 1000
+#endif // CHIP_CONFIG_BDX_ASYNC_RETRANSMIT_TIMEOUT_MS
+
 /**
  *  @def CHIP_CONFIG_TEST_GOOGLETEST
  *
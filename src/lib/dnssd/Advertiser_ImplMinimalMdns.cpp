@@ -100,6 +100,23 @@ void LogQuery(const QueryData & data)
 void LogQuery(const QueryData & data) {}
 #endif // CHIP_MINMDNS_HIGH_VERBOSITY
 
+/// Checks if the packet was sent by this device: our own multicast packets are looped back to us.
+bool IsFromOwnAddress(const chip::Inet::IPPacketInfo & info)
+{
+    UniquePtr<IpAddressIterator> addresses = GetAddressPolicy()->GetIpAddressesForEndpoint(info.Interface, info.SrcAddress.Type());
+    VerifyOrReturnValue(addresses != nullptr, false);
+
+    chip::Inet::IPAddress address;
+    while (addresses->Next(address))
+    {
+        if (address == info.SrcAddress)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
 // Max number of records for operational = PTR, SRV, TXT, A, AAAA, I subtype.
 constexpr size_t kMaxOperationalRecords = 6;
 
@@ -155,13 +172,14 @@ enum BroadcastAdvertiseType
 };
 
 class AdvertiserMinMdns : public ServiceAdvertiser,
-                          public MdnsPacketDelegate, // receive query packets
+                          public MdnsPacketDelegate, // receive query packets and observe responses
                           public ParserDelegate      // parses queries
 {
 public:
     AdvertiserMinMdns() : mResponseSender(&GlobalMinimalMdnsServer::Server())
     {
         GlobalMinimalMdnsServer::Instance().SetQueryDelegate(this);
+        GlobalMinimalMdnsServer::Instance().SetResponseObserver(this);
 
         CHIP_ERROR err = mResponseSender.AddQueryResponder(mQueryResponderAllocatorCommissionable.GetQueryResponder());
 
@@ -316,6 +334,7 @@ private:
 
     // current request handling
     const chip::Inet::IPPacketInfo * mCurrentSource = nullptr;
+    const KnownAnswerList * mCurrentKnownAnswers    = nullptr;
     uint16_t mMessageId                             = 0;
 
     const char * mEmptyTextEntries[1] = {
@@ -325,13 +344,31 @@ private:
 
 void AdvertiserMinMdns::OnMdnsPacketData(const BytesRange & data, const chip::Inet::IPPacketInfo * info)
 {
+    VerifyOrReturn(data.Size() >= HeaderRef::kSizeBytes);
+
+    // header is used as const, so cast is safe
+    if (!ConstHeaderRef(data.Start()).GetFlags().IsQuery())
+    {
+        // Another responder may be answering with the same records we would send
+        if (mIsInitialized && !IsFromOwnAddress(*info))
+        {
+            mResponseSender.OnResponseObserved(data, info);
+        }
+        return;
+    }
+
 #if CHIP_MINMDNS_HIGH_VERBOSITY
     char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
     VerifyOrDie(info->SrcAddress.ToString(srcAddressString) != nullptr);
     ChipLogDetail(Discovery, "Received an mDNS query from %s", srcAddressString);
 #endif
 
-    mCurrentSource = info;
+    // Answers the querier already knows about are not sent again. Known answers that do not parse are ignored.
+    KnownAnswerList knownAnswers;
+    knownAnswers.InitFromQuery(data);
+
+    mCurrentSource       = info;
+    mCurrentKnownAnswers = &knownAnswers;
     if (!ParsePacket(data, this))
     {
         ChipLogError(Discovery, "Failed to parse mDNS query");
@@ -340,7 +377,8 @@ void AdvertiserMinMdns::OnMdnsPacketData(const BytesRange & data, const chip::In
         ChipLogByteSpan(Discovery, data.AsByteSpan());
 #endif // CHIP_MINMDNS_HIGH_VERBOSITY
     }
-    mCurrentSource = nullptr;
+    mCurrentSource       = nullptr;
+    mCurrentKnownAnswers = nullptr;
 }
 
 void AdvertiserMinMdns::OnQuery(const QueryData & data)
@@ -354,7 +392,7 @@ void AdvertiserMinMdns::OnQuery(const QueryData & data)
     LogQuery(data);
 
     const ResponseConfiguration defaultResponseConfiguration;
-    CHIP_ERROR err = mResponseSender.Respond(mMessageId, data, mCurrentSource, defaultResponseConfiguration);
+    CHIP_ERROR err = mResponseSender.Respond(mMessageId, data, mCurrentSource, defaultResponseConfiguration, mCurrentKnownAnswers);
     if (err != CHIP_NO_ERROR)
     {
         ChipLogError(Discovery, "Failed to reply to query: %" CHIP_ERROR_FORMAT, err.Format());
@@ -378,6 +416,9 @@ CHIP_ERROR AdvertiserMinMdns::Init(chip::Inet::EndPointManager<chip::Inet::UDPEn
     // GlobalMinimalMdnsServer (used for testing).
     mResponseSender.SetServer(&GlobalMinimalMdnsServer::Server());
 
+    // Cached replies are per interface, which may have changed
+    mResponseSender.InvalidateResponseCache();
+
     ReturnErrorOnFailure(GlobalMinimalMdnsServer::Instance().StartServer(udpEndPointManager, kMdnsPort));
 
     ChipLogProgress(Discovery, "CHIP minimal mDNS started advertising.");
@@ -396,6 +437,7 @@ void AdvertiserMinMdns::Shutdown()
     AdvertiseRecords(BroadcastAdvertiseType::kRemovingAll);
 
     GlobalMinimalMdnsServer::Server().Shutdown();
+    mResponseSender.InvalidateResponseCache();
     mIsInitialized = false;
 }
 
@@ -415,6 +457,8 @@ CHIP_ERROR AdvertiserMinMdns::RemoveServices()
 
 void AdvertiserMinMdns::ClearServices()
 {
+    mResponseSender.InvalidateResponseCache();
+
     while (mOperationalResponders.begin() != mOperationalResponders.end())
     {
         auto it = mOperationalResponders.begin();
@@ -480,6 +524,9 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const OperationalAdvertisingParameters &
 {
     VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
 
+    // Records are about to change: cached replies are stale
+    mResponseSender.InvalidateResponseCache();
+
     char nameBuffer[Operational::kInstanceNameMaxLength + 1] = "";
 
     // need to set server name
@@ -613,6 +660,9 @@ CHIP_ERROR AdvertiserMinMdns::Advertise(const CommissionAdvertisingParameters &
 {
     VerifyOrReturnError(mIsInitialized, CHIP_ERROR_INCORRECT_STATE);
 
+    // Records are about to change: cached replies are stale
+    mResponseSender.InvalidateResponseCache();
+
     if (params.GetCommissionAdvertiseMode() == CommssionAdvertiseMode::kCommissionableNode)
     {
         mQueryResponderAllocatorCommissionable.Clear();
@@ -361,6 +361,7 @@ void DiscoveryImplPlatform::HandleNodeIdResolve(void * context, DnssdService * r
     nodeData.resolutionData.interfaceId = result->mInterface;
     nodeData.resolutionData.port        = result->mPort;
     nodeData.operationalData.peerId     = peerId;
+    nodeData.operationalData.ttlSeconds = result->mTtlSeconds;
 
     size_t addressesFound = 0;
     for (auto & ip : addresses)
@@ -25,6 +25,9 @@
 #include <lib/support/CHIPMemString.h>
 #include <tracing/macros.h>
 
+#include <algorithm>
+#include <limits>
+
 namespace chip {
 namespace Dnssd {
 
@@ -192,6 +195,8 @@ CHIP_ERROR IncrementalResolver::InitializeParsing(chip::Dnssd::SerializedQNameIt
                 return err;
             }
             mSpecificResolutionData.Get<OperationalNodeData>().hasZeroTTL = (ttl == 0);
+            mSpecificResolutionData.Get<OperationalNodeData>().ttlSeconds =
+                static_cast<uint32_t>(std::min<uint64_t>(ttl, std::numeric_limits<uint32_t>::max()));
         }
 
         LogFoundOperationalSrvRecord(mSpecificResolutionData.Get<OperationalNodeData>().peerId, mTargetHostName.Get());
@@ -270,7 +275,7 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
-        return OnIpAddress(interface, addr);
+        return OnIpAddress(interface, addr, data.GetTtlSeconds());
 #else
 #if CHIP_MINMDNS_HIGH_VERBOSITY
         ChipLogProgress(Discovery, "Ignoring A record: IPv4 not supported");
@@ -292,7 +297,7 @@ CHIP_ERROR IncrementalResolver::OnRecord(Inet::InterfaceId interface, const Reso
             return CHIP_ERROR_INVALID_ARGUMENT;
         }
 
-        return OnIpAddress(interface, addr);
+        return OnIpAddress(interface, addr, data.GetTtlSeconds());
     }
     case QType::SRV: // SRV handled on creation, ignored for 'additional data'
     default:
@@ -325,7 +330,7 @@ CHIP_ERROR IncrementalResolver::OnTxtRecord(const ResourceData & data, BytesRang
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr)
+CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr, uint64_t ttlSeconds)
 {
     if (mCommonResolutionData.numIPs >= MATTER_ARRAY_SIZE(mCommonResolutionData.ipAddress))
     {
@@ -345,6 +350,13 @@ CHIP_ERROR IncrementalResolver::OnIpAddress(Inet::InterfaceId interface, const I
 
     mCommonResolutionData.ipAddress[mCommonResolutionData.numIPs++] = addr;
 
+    if (IsActiveOperationalParse())
+    {
+        // Resolved data is only valid for as long as all the records it was built from
+        OperationalNodeData & operationalData = mSpecificResolutionData.Get<OperationalNodeData>();
+        operationalData.ttlSeconds            = static_cast<uint32_t>(std::min<uint64_t>(operationalData.ttlSeconds, ttlSeconds));
+    }
+
     LogFoundIPAddress(mTargetHostName.Get(), addr);
 
     return CHIP_NO_ERROR;
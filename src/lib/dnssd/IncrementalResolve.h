@@ -183,8 +183,10 @@ private:
     /// This is to be called on both A (if IPv4 support is enabled) and AAAA
     /// addresses.
     ///
+    /// `ttlSeconds` is the TTL of the record the address was found in.
+    ///
     /// Prerequisite: IP address belongs to the right nost name
-    CHIP_ERROR OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr);
+    CHIP_ERROR OnIpAddress(Inet::InterfaceId interface, const Inet::IPAddress & addr, uint64_t ttlSeconds);
 
     using ParsedRecordSpecificData = Variant<OperationalNodeData, CommissionNodeData>;
 
@@ -60,6 +60,10 @@ public:
     void SetQueryDelegate(MdnsPacketDelegate * delegate) { mQueryDelegate = delegate; }
     void SetResponseDelegate(MdnsPacketDelegate * delegate) { mResponseDelegate = delegate; }
 
+    /// Also receives every response, alongside the response delegate. Used by the advertiser to
+    /// notice records that other responders already sent.
+    void SetResponseObserver(MdnsPacketDelegate * observer) { mResponseObserver = observer; }
+
     // ServerDelegate implementation
     void OnQuery(const chip::Dnssd::BytesRange & data, const chip::Inet::IPPacketInfo * info) override
     {
@@ -75,6 +79,10 @@ public:
         {
             mResponseDelegate->OnMdnsPacketData(data, info);
         }
+        if (mResponseObserver != nullptr)
+        {
+            mResponseObserver->OnMdnsPacketData(data, info);
+        }
     }
 
     void SetReplacementServer(mdns::Minimal::ServerBase * server) { mReplacementServer = server; }
@@ -84,6 +92,7 @@ private:
     mdns::Minimal::ServerBase * mReplacementServer = nullptr;
     MdnsPacketDelegate * mQueryDelegate            = nullptr;
     MdnsPacketDelegate * mResponseDelegate         = nullptr;
+    MdnsPacketDelegate * mResponseObserver         = nullptr;
 };
 
 } // namespace Dnssd
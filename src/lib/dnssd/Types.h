@@ -211,6 +211,7 @@ struct OperationalNodeData
 {
     PeerId peerId;
     bool hasZeroTTL;
+    uint32_t ttlSeconds = 0; // how long the resolved data may be cached, 0 if it must not be
     void Reset() { peerId = PeerId(); }
 };
 
@@ -0,0 +1,181 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "KnownAnswers.h"
+
+#include <string.h>
+
+#include <lib/dnssd/wire/DnsHeader.h>
+#include <lib/dnssd/wire/RecordData.h>
+#include <lib/dnssd/wire/RecordWriter.h>
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CodeUtils.h>
+
+namespace mdns {
+namespace Minimal {
+using namespace chip::Dnssd;
+
+namespace {
+
+// Same limit as ParsePacket: reject packets with unreasonable record counts.
+constexpr uint16_t kMaxRecordCount = 256;
+
+uint16_t ClassWithoutFlushBit(QClass klass)
+{
+    return static_cast<uint16_t>(static_cast<uint16_t>(klass) & ~kQClassResponseFlushBit);
+}
+
+/// Calls `predicate` on every record in [start, start + count) until it returns true.
+template <typename Predicate>
+bool AnyRecord(const BytesRange & packet, const uint8_t * start, uint16_t count, Predicate predicate)
+{
+    ResourceData data;
+    for (uint16_t i = 0; i < count; i++)
+    {
+        if (!data.Parse(packet, &start))
+        {
+            return false;
+        }
+        if (predicate(data))
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+} // namespace
+
+bool IsSameRecord(const ResourceData & a, const BytesRange & aPacket, const ResourceData & b, const BytesRange & bPacket)
+{
+    VerifyOrReturnValue(a.GetType() == b.GetType(), false);
+    VerifyOrReturnValue(ClassWithoutFlushBit(a.GetClass()) == ClassWithoutFlushBit(b.GetClass()), false);
+    VerifyOrReturnValue(a.GetName() == b.GetName(), false);
+
+    // Names within the data may be compressed differently in each packet, so compare them as names
+    switch (a.GetType())
+    {
+    case QType::PTR: {
+        SerializedQNameIterator aTarget;
+        SerializedQNameIterator bTarget;
+        return ParsePtrRecord(a.GetData(), aPacket, &aTarget) && ParsePtrRecord(b.GetData(), bPacket, &bTarget) &&
+            (aTarget == bTarget);
+    }
+    case QType::SRV: {
+        SrvRecord aSrv;
+        SrvRecord bSrv;
+        return aSrv.Parse(a.GetData(), aPacket) && bSrv.Parse(b.GetData(), bPacket) &&
+            (aSrv.GetPriority() == bSrv.GetPriority()) && (aSrv.GetWeight() == bSrv.GetWeight()) &&
+            (aSrv.GetPort() == bSrv.GetPort()) && (aSrv.GetName() == bSrv.GetName());
+    }
+    default:
+        return (a.GetData().Size() == b.GetData().Size()) &&
+            (memcmp(a.GetData().Start(), b.GetData().Start(), a.GetData().Size()) == 0);
+    }
+}
+
+bool KnownAnswerList::InitFromQuery(const BytesRange & packet)
+{
+    return Init(packet, false /* includeAllSections */);
+}
+
+bool KnownAnswerList::InitFromResponse(const BytesRange & packet)
+{
+    return Init(packet, true /* includeAllSections */);
+}
+
+bool KnownAnswerList::Init(const BytesRange & packet, bool includeAllSections)
+{
+    mPacket       = BytesRange();
+    mRecordsStart = nullptr;
+    mRecordCount  = 0;
+
+    VerifyOrReturnValue(packet.Size() >= HeaderRef::kSizeBytes, false);
+
+    // header is used as const, so cast is safe
+    ConstHeaderRef header(packet.Start());
+
+    VerifyOrReturnValue(header.GetQueryCount() <= kMaxRecordCount && header.GetAnswerCount() <= kMaxRecordCount &&
+                            header.GetAuthorityCount() <= kMaxRecordCount && header.GetAdditionalCount() <= kMaxRecordCount,
+                        false);
+
+    uint16_t recordCount = header.GetAnswerCount();
+    if (includeAllSections)
+    {
+        recordCount = static_cast<uint16_t>(recordCount + header.GetAuthorityCount() + header.GetAdditionalCount());
+    }
+    VerifyOrReturnValue(recordCount > 0, true);
+
+    const uint8_t * data = packet.Start() + HeaderRef::kSizeBytes;
+
+    QueryData query;
+    for (uint16_t i = 0; i < header.GetQueryCount(); i++)
+    {
+        VerifyOrReturnValue(query.Parse(packet, &data), false);
+    }
+
+    // Validate all records once, so that lookups only ever see well formed data
+    const uint8_t * recordsStart = data;
+    ResourceData record;
+    for (uint16_t i = 0; i < recordCount; i++)
+    {
+        VerifyOrReturnValue(record.Parse(packet, &data), false);
+    }
+
+    mPacket       = packet;
+    mRecordsStart = recordsStart;
+    mRecordCount  = recordCount;
+    return true;
+}
+
+bool KnownAnswerList::HasRecordsFor(QType type, const FullQName & name) const
+{
+    return AnyRecord(mPacket, mRecordsStart, mRecordCount,
+                     [&](const ResourceData & known) { return (known.GetType() == type) && (known.GetName() == name); });
+}
+
+bool KnownAnswerList::Contains(const ResourceRecord & record, uint32_t minTtlSeconds) const
+{
+    // Known answers are mostly about other services: only serialize the record if its name matches
+    VerifyOrReturnValue(HasRecordsFor(record.GetType(), record.GetName()), false);
+
+    uint8_t buffer[kMaxRecordSizeBytes];
+    chip::Encoding::BigEndian::BufferWriter output(buffer, sizeof(buffer));
+    HeaderRef header(buffer);
+    header.Clear();
+    output.Skip(HeaderRef::kSizeBytes);
+
+    RecordWriter writer(&output);
+    VerifyOrReturnValue(record.Append(header, ResourceType::kAnswer, writer), false);
+
+    const BytesRange serialized(buffer, buffer + output.Needed());
+    const uint8_t * recordStart = buffer + HeaderRef::kSizeBytes;
+    ResourceData data;
+    VerifyOrReturnValue(data.Parse(serialized, &recordStart), false);
+
+    return Contains(data, serialized, minTtlSeconds);
+}
+
+bool KnownAnswerList::Contains(const ResourceData & record, const BytesRange & recordPacket, uint32_t minTtlSeconds) const
+{
+    return AnyRecord(mPacket, mRecordsStart, mRecordCount, [&](const ResourceData & known) {
+        return (known.GetTtlSeconds() >= minTtlSeconds) && IsSameRecord(known, mPacket, record, recordPacket);
+    });
+}
+
+} // namespace Minimal
+} // namespace mdns
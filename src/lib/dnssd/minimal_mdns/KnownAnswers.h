@@ -0,0 +1,91 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stdint.h>
+
+#include <lib/dnssd/wire/BytesRange.h>
+#include <lib/dnssd/wire/Parser.h>
+#include <lib/dnssd/wire/records/ResourceRecord.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// Checks if two parsed resource records are the same record (RFC 6762 section 7.1): same name,
+/// type, class and data. TTLs and the cache-flush bit are ignored.
+///
+/// Each record may use name compression relative to its own packet.
+bool IsSameRecord(const chip::Dnssd::ResourceData & a, const chip::Dnssd::BytesRange & aPacket,
+                  const chip::Dnssd::ResourceData & b, const chip::Dnssd::BytesRange & bPacket);
+
+/// Records found in a received mDNS packet, used to avoid sending records that the
+/// network already knows about:
+///   - the known answers of a query (https://datatracker.ietf.org/doc/html/rfc6762#section-7.1)
+///   - the records of a response sent by another responder
+///     (https://datatracker.ietf.org/doc/html/rfc6762#section-7.4)
+///
+/// Only references the packet data, which has to outlive this object.
+class KnownAnswerList
+{
+public:
+    /// Largest record that can be compared against the list. Larger records are never
+    /// reported as known.
+    static constexpr size_t kMaxRecordSizeBytes = 256;
+
+    KnownAnswerList() {}
+
+    /// Use the answer section of the given query packet.
+    ///
+    /// Returns false (and leaves the list empty) if the packet cannot be parsed.
+    bool InitFromQuery(const chip::Dnssd::BytesRange & packet);
+
+    /// Use all the records (answer, authority and additional sections) of the given response packet.
+    ///
+    /// Returns false (and leaves the list empty) if the packet cannot be parsed.
+    bool InitFromResponse(const chip::Dnssd::BytesRange & packet);
+
+    bool IsEmpty() const { return mRecordCount == 0; }
+
+    /// Checks if the list contains any record of the given type and name. Much cheaper than Contains().
+    bool HasRecordsFor(chip::Dnssd::QType type, const chip::Dnssd::FullQName & name) const;
+
+    /// Checks if the list contains the given record with a TTL of at least `minTtlSeconds`.
+    bool Contains(const chip::Dnssd::ResourceRecord & record, uint32_t minTtlSeconds) const;
+    bool Contains(const chip::Dnssd::ResourceData & record, const chip::Dnssd::BytesRange & recordPacket,
+                  uint32_t minTtlSeconds) const;
+
+    /// Checks if the given answer should be left out of a reply to the query this list was
+    /// built from: a known answer suppresses our answer if its TTL is at least half of ours.
+    bool Suppresses(const chip::Dnssd::ResourceRecord & record) const { return Contains(record, HalfTtl(record.GetTtl())); }
+    bool Suppresses(const chip::Dnssd::ResourceData & record, const chip::Dnssd::BytesRange & recordPacket) const
+    {
+        return Contains(record, recordPacket, HalfTtl(static_cast<uint32_t>(record.GetTtlSeconds())));
+    }
+
+private:
+    static constexpr uint32_t HalfTtl(uint32_t ttl) { return ttl / 2 + ttl % 2; }
+
+    bool Init(const chip::Dnssd::BytesRange & packet, bool includeAllSections);
+
+    chip::Dnssd::BytesRange mPacket;
+    const uint8_t * mRecordsStart = nullptr;
+    uint16_t mRecordCount         = 0;
+};
+
+} // namespace Minimal
+} // namespace mdns
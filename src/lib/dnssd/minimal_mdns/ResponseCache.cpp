@@ -0,0 +1,200 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include "ResponseCache.h"
+
+#include <string.h>
+
+#include <lib/support/BufferWriter.h>
+#include <lib/support/CHIPMem.h>
+#include <lib/support/CodeUtils.h>
+
+namespace mdns {
+namespace Minimal {
+using namespace chip::Dnssd;
+
+chip::ByteSpan ResponseCache::Entry::GetPacket(size_t index) const
+{
+    VerifyOrReturnValue(index < mPacketCount, chip::ByteSpan());
+
+    size_t offset = mNameSize;
+    for (size_t i = 0; i < index; i++)
+    {
+        offset += mPacketSizes[i];
+    }
+    return chip::ByteSpan(mData + offset, mPacketSizes[index]);
+}
+
+bool ResponseCache::Entry::Matches(const QueryData & query, chip::Inet::InterfaceId interface) const
+{
+    VerifyOrReturnValue((mType == query.GetType()) && (mClass == query.GetClass()) && (mInterface == interface), false);
+
+    SerializedQNameIterator name(BytesRange(mData, mData + mNameSize), mData);
+    return name == query.GetName();
+}
+
+void ResponseCache::Entry::Release()
+{
+    chip::Platform::MemoryFree(mData);
+    *this = Entry();
+}
+
+const ResponseCache::Entry * ResponseCache::Find(const QueryData & query, chip::Inet::InterfaceId interface,
+                                                 chip::System::Clock::Timestamp now)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.mData == nullptr)
+        {
+            continue;
+        }
+
+        if (now - entry.mCreatedAt > kMaxEntryAge)
+        {
+            entry.Release();
+            continue;
+        }
+
+        if (entry.Matches(query, interface))
+        {
+            entry.mLastUsed = ++mUseCounter;
+            return &entry;
+        }
+    }
+    return nullptr;
+}
+
+void ResponseCache::StartRecording(const QueryData & query, chip::Inet::InterfaceId interface)
+{
+    AbandonRecording();
+    VerifyOrReturn(kCacheSize > 0);
+
+    mPending.mData = static_cast<uint8_t *>(chip::Platform::MemoryAlloc(kMaxReplySizeBytes));
+    VerifyOrReturn(mPending.mData != nullptr);
+
+    mRecording          = true;
+    mPending.mType      = query.GetType();
+    mPending.mClass     = query.GetClass();
+    mPending.mInterface = interface;
+
+    // Keep the name uncompressed: it is matched against names found in other packets
+    chip::Encoding::BigEndian::BufferWriter writer(mPending.mData, kMaxReplySizeBytes);
+    SerializedQNameIterator name = query.GetName();
+    while (name.Next())
+    {
+        writer.Put8(static_cast<uint8_t>(strlen(name.Value()))).Put(name.Value());
+    }
+    writer.Put8(0);
+
+    if (!name.IsValid() || !writer.Fit())
+    {
+        mPendingOverflow = true;
+        return;
+    }
+
+    mPending.mNameSize = static_cast<uint16_t>(writer.Needed());
+    mPendingSize       = mPending.mNameSize;
+}
+
+void ResponseCache::RecordAnswer(Internal::QueryResponderInfo * answer)
+{
+    VerifyOrReturn(mRecording && !mPendingOverflow);
+
+    if (mPending.mAnswerCount >= kMaxAnswers)
+    {
+        mPendingOverflow = true;
+        return;
+    }
+    mPending.mAnswers[mPending.mAnswerCount++] = answer;
+}
+
+void ResponseCache::RecordPacket(const chip::System::PacketBufferHandle & packet)
+{
+    VerifyOrReturn(mRecording && !mPendingOverflow);
+
+    // Reply packets are built in a single buffer
+    const size_t size = packet->DataLength();
+    if (!packet->HasChainedBuffer() && (mPending.mPacketCount < kMaxPackets) && (size <= kMaxReplySizeBytes - mPendingSize))
+    {
+        memcpy(mPending.mData + mPendingSize, packet->Start(), size);
+        mPending.mPacketSizes[mPending.mPacketCount++] = static_cast<uint16_t>(size);
+        mPendingSize += size;
+        return;
+    }
+    mPendingOverflow = true;
+}
+
+void ResponseCache::FinishRecording(bool store, chip::System::Clock::Timestamp now)
+{
+    VerifyOrReturn(mRecording);
+
+    if (!store || mPendingOverflow)
+    {
+        AbandonRecording();
+        return;
+    }
+
+    // Give back the unused part of the recording buffer
+    void * data = chip::Platform::MemoryRealloc(mPending.mData, mPendingSize);
+    if (data != nullptr)
+    {
+        mPending.mData = static_cast<uint8_t *>(data);
+    }
+
+    Entry * slot = &mEntries[0];
+    for (auto & entry : mEntries)
+    {
+        if (entry.mData == nullptr)
+        {
+            slot = &entry;
+            break;
+        }
+        if (entry.mLastUsed < slot->mLastUsed)
+        {
+            slot = &entry;
+        }
+    }
+    slot->Release();
+
+    *slot            = mPending;
+    slot->mCreatedAt = now;
+    slot->mLastUsed  = ++mUseCounter;
+    mPending         = Entry();
+    mPendingSize     = 0;
+    mRecording       = false;
+    mPendingOverflow = false;
+}
+
+void ResponseCache::AbandonRecording()
+{
+    mPending.Release();
+    mPendingSize     = 0;
+    mRecording       = false;
+    mPendingOverflow = false;
+}
+
+void ResponseCache::Clear()
+{
+    AbandonRecording();
+    for (auto & entry : mEntries)
+    {
+        entry.Release();
+    }
+}
+
+} // namespace Minimal
+} // namespace mdns
@@ -0,0 +1,127 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <inet/InetInterface.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/dnssd/minimal_mdns/responders/QueryResponder.h>
+#include <lib/dnssd/wire/Parser.h>
+#include <lib/support/Span.h>
+#include <system/SystemClock.h>
+#include <system/SystemPacketBuffer.h>
+
+namespace mdns {
+namespace Minimal {
+
+/// Keeps the serialized replies sent to recent queries, so that a repeated query can be
+/// answered by re-sending the same packets rather than rebuilding them from the responders.
+///
+/// Entries are keyed by query type, class and name and by the interface the query was received
+/// on (address records depend on it). Replies are kept for at most kMaxEntryAge and the whole
+/// cache has to be cleared whenever the set of records being advertised changes.
+///
+/// An entry also remembers which query responder records it answers, so that the sender can
+/// apply and update the per-record multicast throttle when replaying it.
+class ResponseCache
+{
+public:
+    static constexpr size_t kCacheSize = CHIP_CONFIG_MINMDNS_RESPONSE_CACHE_SIZE;
+
+    /// Replies answering more records than this, spanning more packets than this or larger
+    /// than this are not cached.
+    static constexpr size_t kMaxAnswers        = 8;
+    static constexpr size_t kMaxPackets        = 2;
+    static constexpr size_t kMaxReplySizeBytes = 1024;
+
+    static constexpr chip::System::Clock::Milliseconds32 kMaxEntryAge = chip::System::Clock::Milliseconds32(5000);
+
+    class Entry
+    {
+    public:
+        size_t GetPacketCount() const { return mPacketCount; }
+        chip::ByteSpan GetPacket(size_t index) const;
+
+        size_t GetAnswerCount() const { return mAnswerCount; }
+        Internal::QueryResponderInfo * GetAnswer(size_t index) const { return mAnswers[index]; }
+
+    private:
+        friend class ResponseCache;
+
+        bool Matches(const chip::Dnssd::QueryData & query, chip::Inet::InterfaceId interface) const;
+        void Release();
+
+        uint8_t * mData                                      = nullptr; // query name, followed by the reply packets
+        uint16_t mNameSize                                   = 0;
+        uint16_t mPacketSizes[kMaxPackets]                   = {};
+        uint8_t mPacketCount                                 = 0;
+        Internal::QueryResponderInfo * mAnswers[kMaxAnswers] = {};
+        uint8_t mAnswerCount                                 = 0;
+        chip::Dnssd::QType mType                             = chip::Dnssd::QType::ANY;
+        chip::Dnssd::QClass mClass                           = chip::Dnssd::QClass::ANY;
+        chip::Inet::InterfaceId mInterface;
+        chip::System::Clock::Timestamp mCreatedAt = chip::System::Clock::kZero;
+        uint32_t mLastUsed                        = 0;
+    };
+
+    ResponseCache() = default;
+    ~ResponseCache() { Clear(); }
+
+    ResponseCache(const ResponseCache &)             = delete;
+    ResponseCache & operator=(const ResponseCache &) = delete;
+
+    /// Returns the cached reply to the given query received on `interface`, or nullptr.
+    const Entry * Find(const chip::Dnssd::QueryData & query, chip::Inet::InterfaceId interface,
+                       chip::System::Clock::Timestamp now);
+
+    /// Starts recording the reply to a query that was not found in the cache.
+    void StartRecording(const chip::Dnssd::QueryData & query, chip::Inet::InterfaceId interface);
+
+    bool IsRecording() const { return mRecording; }
+
+    /// Records a query responder record that the reply being recorded answers.
+    void RecordAnswer(Internal::QueryResponderInfo * answer);
+    size_t GetRecordedAnswerCount() const { return mPending.mAnswerCount; }
+
+    /// Records a reply packet, before it is sent.
+    void RecordPacket(const chip::System::PacketBufferHandle & packet);
+
+    /// Stops recording, adding the recorded reply to the cache if `store` is set and the reply
+    /// fit within the limits above. The least recently used entry is replaced if the cache is full.
+    void FinishRecording(bool store, chip::System::Clock::Timestamp now);
+
+    /// Drops every cached reply.
+    void Clear();
+
+private:
+    void AbandonRecording();
+
+    Entry mEntries[kCacheSize > 0 ? kCacheSize : 1];
+    uint32_t mUseCounter = 0;
+
+    // Reply being recorded
+    Entry mPending;
+    size_t mPendingSize   = 0;
+    bool mRecording       = false;
+    bool mPendingOverflow = false;
+};
+
+} // namespace Minimal
+} // namespace mdns
@@ -39,6 +39,37 @@ constexpr uint16_t kMdnsStandardPort = 5353;
 //    the header.
 constexpr uint16_t kPacketSizeBytes = 512;
 
+/// Checks if all the records a responder provides are part of a response seen on the network.
+class ObservedRecordsMatcher : public ResponderDelegate
+{
+public:
+    ObservedRecordsMatcher(const KnownAnswerList & observed) : mObserved(observed) {}
+
+    void Reset()
+    {
+        mRecordCount   = 0;
+        mObservedCount = 0;
+    }
+
+    bool AllObserved() const { return (mRecordCount > 0) && (mObservedCount == mRecordCount); }
+
+    void AddResponse(const ResourceRecord & record) override
+    {
+        mRecordCount++;
+        if (mObserved.Contains(record, record.GetTtl()))
+        {
+            mObservedCount++;
+        }
+    }
+    bool ShouldSend(const Responder &) const override { return true; }
+    void ResponsesAdded(const Responder &) override {}
+
+private:
+    const KnownAnswerList & mObserved;
+    size_t mRecordCount   = 0;
+    size_t mObservedCount = 0;
+};
+
 } // namespace
 namespace Internal {
 
@@ -56,6 +87,8 @@ bool ResponseSendingState::IncludeQuery() const
 
 CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder)
 {
+    mResponseCache.Clear();
+
     // If already existing or we find a free slot, just use it
     // Note that dynamic memory implementations are never expected to be nullptr
     //
@@ -78,6 +111,8 @@ CHIP_ERROR ResponseSender::AddQueryResponder(QueryResponderBase * queryResponder
 
 CHIP_ERROR ResponseSender::RemoveQueryResponder(QueryResponderBase * queryResponder)
 {
+    mResponseCache.Clear();
+
     for (auto it = mResponders.begin(); it != mResponders.end(); it++)
     {
         if (*it == queryResponder)
@@ -105,9 +140,107 @@ bool ResponseSender::HasQueryResponders() const
 }
 
 CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query, const chip::Inet::IPPacketInfo * querySource,
-                                   const ResponseConfiguration & configuration)
+                                   const ResponseConfiguration & configuration, const KnownAnswerList * knownAnswers)
+{
+    mSendState.Reset(messageId, query, querySource, knownAnswers);
+
+    const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
+
+    // Announcements, replies with adjusted TTLs and replies echoing the query are never cached
+    if (!query.IsAnnounceBroadcast() && !configuration.GetTtlSecondsOverride().has_value() && !mSendState.IncludeQuery())
+    {
+        const ResponseCache::Entry * entry = mResponseCache.Find(query, querySource->Interface, kTimeNow);
+        if ((entry != nullptr) && CanReplay(*entry, kTimeNow))
+        {
+            mResponseCacheStats.hits++;
+            return Replay(*entry, kTimeNow);
+        }
+        mResponseCacheStats.misses++;
+
+        if (entry == nullptr)
+        {
+            mResponseCache.StartRecording(query, querySource->Interface);
+        }
+    }
+
+    if (mResponseCache.IsRecording())
+    {
+        // Remember everything the query matches, whether or not it ends up throttled
+        QueryReplyFilter queryReplyFilter(query);
+        QueryResponderRecordFilter responseFilter;
+        responseFilter.SetReplyFilter(&queryReplyFilter);
+
+        for (auto & responder : mResponders)
+        {
+            if (responder == nullptr)
+            {
+                continue;
+            }
+            for (auto it = responder->begin(&responseFilter); it != responder->end(); it++)
+            {
+                mResponseCache.RecordAnswer(it.GetInternal());
+            }
+        }
+    }
+
+    size_t answeredRecords = 0;
+    CHIP_ERROR err         = BuildReply(configuration, kTimeNow, answeredRecords);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = FlushReply();
+    }
+
+    if (mResponseCache.IsRecording())
+    {
+        // Only a reply containing everything the query matches can be re-used for another querier
+        const bool complete = (err == CHIP_NO_ERROR) && (mSendState.GetSuppressedAnswerCount() == 0) &&
+            (answeredRecords == mResponseCache.GetRecordedAnswerCount());
+        mResponseCache.FinishRecording(complete, kTimeNow);
+    }
+
+    return err;
+}
+
+void ResponseSender::OnResponseObserved(const BytesRange & packet, const chip::Inet::IPPacketInfo * source)
+{
+    KnownAnswerList observed;
+    VerifyOrReturn(observed.InitFromResponse(packet) && !observed.IsEmpty());
+
+    const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
+    const ResponseConfiguration defaultConfiguration;
+    ObservedRecordsMatcher matcher(observed);
+    QueryResponderRecordFilter allRecords;
+
+    for (auto & responder : mResponders)
+    {
+        if (responder == nullptr)
+        {
+            continue;
+        }
+        for (auto it = responder->begin(&allRecords); it != responder->end(); it++)
+        {
+            if (!observed.HasRecordsFor(it->responder->GetQType(), it->responder->GetQName()))
+            {
+                continue;
+            }
+
+            matcher.Reset();
+            it->responder->AddAllResponses(source, &matcher, defaultConfiguration);
+
+            if (matcher.AllObserved())
+            {
+                // Just sent by someone else: do not multicast it again right away
+                it->lastMulticastTime = kTimeNow;
+            }
+        }
+    }
+}
+
+CHIP_ERROR ResponseSender::BuildReply(const ResponseConfiguration & configuration, chip::System::Clock::Timestamp now,
+                                      size_t & answeredRecords)
 {
-    mSendState.Reset(messageId, query, querySource);
+    const QueryData & query                      = *mSendState.GetQuery();
+    const chip::Inet::IPPacketInfo * querySource = mSendState.GetSource();
 
     if (query.IsAnnounceBroadcast())
     {
@@ -130,8 +263,6 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
 
     // send all 'Answer' replies
     {
-        const chip::System::Clock::Timestamp kTimeNow = chip::System::SystemClock().GetMonotonicTimestamp();
-
         QueryReplyFilter queryReplyFilter(query);
         QueryResponderRecordFilter responseFilter;
 
@@ -143,7 +274,7 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
             //
             // TODO: the 'last sent' value does NOT track the interface we used to send, so this may cause
             //       broadcasts on one interface to throttle broadcasts on another interface.
-            responseFilter.SetIncludeOnlyMulticastBeforeMS(kTimeNow - chip::System::Clock::Seconds32(1));
+            responseFilter.SetIncludeOnlyMulticastBeforeMS(now - chip::System::Clock::Seconds32(1));
         }
         for (auto & responder : mResponders)
         {
@@ -153,14 +284,26 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
             }
             for (auto it = responder->begin(&responseFilter); it != responder->end(); it++)
             {
+                const size_t addedBefore      = mSendState.GetAddedAnswerCount();
+                const size_t suppressedBefore = mSendState.GetSuppressedAnswerCount();
+
                 it->responder->AddAllResponses(querySource, this, configuration);
                 ReturnErrorOnFailure(mSendState.GetError());
+                answeredRecords++;
+
+                const bool noneAdded = (mSendState.GetAddedAnswerCount() == addedBefore);
+                const bool allKnown  = noneAdded && (mSendState.GetSuppressedAnswerCount() != suppressedBefore);
+                if (allKnown)
+                {
+                    // The querier already has all of it: nothing additional to send either
+                    continue;
+                }
 
                 responder->MarkAdditionalRepliesFor(it);
 
                 if (!mSendState.SendUnicast())
                 {
-                    it->lastMulticastTime = kTimeNow;
+                    it->lastMulticastTime = now;
                 }
             }
         }
@@ -197,7 +340,68 @@ CHIP_ERROR ResponseSender::Respond(uint16_t messageId, const QueryData & query,
         }
     }
 
-    return FlushReply();
+    return CHIP_NO_ERROR;
+}
+
+bool ResponseSender::CanReplay(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now) const
+{
+    if (!mSendState.SendUnicast())
+    {
+        // Same multicast throttling as when building the reply: any record that would be left out
+        // means the cached reply is not the right one.
+        const chip::System::Clock::Timestamp multicastBefore = now - chip::System::Clock::Seconds32(1);
+        for (size_t i = 0; i < entry.GetAnswerCount(); i++)
+        {
+            if ((multicastBefore > chip::System::Clock::kZero) && (entry.GetAnswer(i)->lastMulticastTime >= multicastBefore))
+            {
+                return false;
+            }
+        }
+    }
+
+    const KnownAnswerList * knownAnswers = mSendState.GetKnownAnswers();
+    VerifyOrReturnValue(knownAnswers != nullptr, true);
+
+    for (size_t i = 0; i < entry.GetPacketCount(); i++)
+    {
+        const chip::ByteSpan packet = entry.GetPacket(i);
+        const BytesRange packetRange(packet.data(), packet.data() + packet.size());
+
+        // cached replies never contain the query
+        ConstHeaderRef header(packet.data());
+        const uint8_t * data = packet.data() + HeaderRef::kSizeBytes;
+        ResourceData record;
+        for (uint16_t j = 0; j < header.GetAnswerCount(); j++)
+        {
+            VerifyOrReturnValue(record.Parse(packetRange, &data), false);
+            VerifyOrReturnValue(!knownAnswers->Suppresses(record, packetRange), false);
+        }
+    }
+    return true;
+}
+
+CHIP_ERROR ResponseSender::Replay(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now)
+{
+    for (size_t i = 0; i < entry.GetPacketCount(); i++)
+    {
+        const chip::ByteSpan packet = entry.GetPacket(i);
+
+        chip::System::PacketBufferHandle buffer = chip::System::PacketBufferHandle::NewWithData(packet.data(), packet.size());
+        VerifyOrReturnError(!buffer.IsNull(), CHIP_ERROR_NO_MEMORY);
+        HeaderRef(buffer->Start()).SetMessageId(mSendState.GetMessageId());
+
+        ReturnErrorOnFailure(SendReply(std::move(buffer)));
+    }
+
+    if (!mSendState.SendUnicast())
+    {
+        for (size_t i = 0; i < entry.GetAnswerCount(); i++)
+        {
+            entry.GetAnswer(i)->lastMulticastTime = now;
+        }
+    }
+
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR ResponseSender::FlushReply()
@@ -206,29 +410,33 @@ CHIP_ERROR ResponseSender::FlushReply()
 
     if (mResponseBuilder.HasResponseRecords())
     {
-        char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
-        VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+        chip::System::PacketBufferHandle packet = mResponseBuilder.ReleasePacket();
+        mResponseCache.RecordPacket(packet);
+        ReturnErrorOnFailure(SendReply(std::move(packet)));
+    }
 
-        if (mSendState.SendUnicast())
-        {
-#if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString,
-                          mSendState.GetSourcePort());
-#endif
-            ReturnErrorOnFailure(mServer->DirectSend(mResponseBuilder.ReleasePacket(), mSendState.GetSourceAddress(),
-                                                     mSendState.GetSourcePort(), mSendState.GetSourceInterfaceId()));
-        }
-        else
-        {
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ResponseSender::SendReply(chip::System::PacketBufferHandle && packet)
+{
+    char srcAddressString[chip::Inet::IPAddress::kMaxStringLength];
+    VerifyOrDie(mSendState.GetSourceAddress().ToString(srcAddressString) != nullptr);
+
+    if (mSendState.SendUnicast())
+    {
 #if CHIP_MINMDNS_HIGH_VERBOSITY
-            ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
+        ChipLogDetail(Discovery, "Directly sending mDns reply to peer %s on port %d", srcAddressString, mSendState.GetSourcePort());
 #endif
-            ReturnErrorOnFailure(mServer->BroadcastSend(mResponseBuilder.ReleasePacket(), kMdnsStandardPort,
-                                                        mSendState.GetSourceInterfaceId(), mSendState.GetSourceAddress().Type()));
-        }
+        return mServer->DirectSend(std::move(packet), mSendState.GetSourceAddress(), mSendState.GetSourcePort(),
+                                   mSendState.GetSourceInterfaceId());
     }
 
-    return CHIP_NO_ERROR;
+#if CHIP_MINMDNS_HIGH_VERBOSITY
+    ChipLogDetail(Discovery, "Broadcasting mDns reply for query from %s", srcAddressString);
+#endif
+    return mServer->BroadcastSend(std::move(packet), kMdnsStandardPort, mSendState.GetSourceInterfaceId(),
+                                  mSendState.GetSourceAddress().Type());
 }
 
 CHIP_ERROR ResponseSender::PrepareNewReplyPacket()
@@ -290,6 +498,17 @@ void ResponseSender::AddResponse(const ResourceRecord & record)
 {
     ReturnOnFailure(mSendState.GetError());
 
+    if (mSendState.GetResourceType() == ResourceType::kAnswer)
+    {
+        const KnownAnswerList * knownAnswers = mSendState.GetKnownAnswers();
+        if ((knownAnswers != nullptr) && knownAnswers->Suppresses(record))
+        {
+            mSendState.MarkAnswerSuppressed();
+            return;
+        }
+        mSendState.MarkAnswerAdded();
+    }
+
     if (!mResponseBuilder.HasPacketBuffer())
     {
         TEMPORARY_RETURN_IGNORED mSendState.SetError(PrepareNewReplyPacket());
@@ -17,7 +17,9 @@
 
 #pragma once
 
+#include "KnownAnswers.h"
 #include "ResponseBuilder.h"
+#include "ResponseCache.h"
 #include "Server.h"
 #include <lib/dnssd/wire/Parser.h>
 
@@ -71,13 +73,17 @@ class ResponseSendingState
 public:
     ResponseSendingState() {}
 
-    void Reset(uint16_t messageId, const chip::Dnssd::QueryData & query, const chip::Inet::IPPacketInfo * packet)
+    void Reset(uint16_t messageId, const chip::Dnssd::QueryData & query, const chip::Inet::IPPacketInfo * packet,
+               const KnownAnswerList * knownAnswers)
     {
-        mMessageId    = messageId;
-        mQuery        = &query;
-        mSource       = packet;
-        mSendError    = CHIP_NO_ERROR;
-        mResourceType = chip::Dnssd::ResourceType::kAnswer;
+        mMessageId             = messageId;
+        mQuery                 = &query;
+        mSource                = packet;
+        mKnownAnswers          = ((knownAnswers != nullptr) && !knownAnswers->IsEmpty()) ? knownAnswers : nullptr;
+        mSendError             = CHIP_NO_ERROR;
+        mResourceType          = chip::Dnssd::ResourceType::kAnswer;
+        mAddedAnswerCount      = 0;
+        mSuppressedAnswerCount = 0;
         mSentItems.ClearAll();
     }
 
@@ -95,6 +101,15 @@ public:
 
     const chip::Dnssd::QueryData * GetQuery() const { return mQuery; }
 
+    /// Known answers listed in the query, nullptr if there are none.
+    const KnownAnswerList * GetKnownAnswers() const { return mKnownAnswers; }
+
+    /// Answer records added to the reply, and left out of it because the querier already knows them.
+    void MarkAnswerAdded() { mAddedAnswerCount++; }
+    void MarkAnswerSuppressed() { mSuppressedAnswerCount++; }
+    size_t GetAddedAnswerCount() const { return mAddedAnswerCount; }
+    size_t GetSuppressedAnswerCount() const { return mSuppressedAnswerCount; }
+
     /// Check if the reply should be sent as a unicast reply
     bool SendUnicast() const;
 
@@ -113,9 +128,12 @@ public:
 private:
     const chip::Dnssd::QueryData * mQuery    = nullptr;                            // query being replied to
     const chip::Inet::IPPacketInfo * mSource = nullptr;                            // Where to send the reply (if unicast)
+    const KnownAnswerList * mKnownAnswers    = nullptr;                            // answers the querier already has
     uint16_t mMessageId                      = 0;                                  // message id for the reply
     chip::Dnssd::ResourceType mResourceType  = chip::Dnssd::ResourceType::kAnswer; // what is being sent right now
     CHIP_ERROR mSendError                    = CHIP_NO_ERROR;
+    size_t mAddedAnswerCount                 = 0;
+    size_t mSuppressedAnswerCount            = 0;
     chip::BitFlags<ResponseItemsSent> mSentItems;
 };
 
@@ -125,9 +143,19 @@ private:
 ///
 /// Handles processing the query via a QueryResponderBase and then sending back the reply
 /// using appropriate paths (unicast or multicast) via the given Server.
+///
+/// Replies to plain queries are kept in a ResponseCache and re-sent as is when the same query
+/// is received again. InvalidateResponseCache() has to be called whenever the records provided
+/// by the query responders change.
 class ResponseSender : public ResponderDelegate
 {
 public:
+    struct ResponseCacheStats
+    {
+        uint32_t hits;   ///< Queries answered from the response cache.
+        uint32_t misses; ///< Queries that could have been, but were not, answered from the response cache.
+    };
+
     ResponseSender(ServerBase * server) : mServer(server) {}
 
     CHIP_ERROR AddQueryResponder(QueryResponderBase * queryResponder);
@@ -135,8 +163,22 @@ public:
     bool HasQueryResponders() const;
 
     /// Send back the response to a particular query
+    ///
+    /// Answers found in `knownAnswers` (the answer section of the query packet) with at least half
+    /// of their TTL remaining are not sent (RFC 6762 section 7.1).
     CHIP_ERROR Respond(uint16_t messageId, const chip::Dnssd::QueryData & query, const chip::Inet::IPPacketInfo * querySource,
-                       const ResponseConfiguration & configuration);
+                       const ResponseConfiguration & configuration, const KnownAnswerList * knownAnswers = nullptr);
+
+    /// Process a response sent by another responder.
+    ///
+    /// Our records that it multicasts, with a TTL at least as large as ours, are treated as if we had
+    /// just multicast them ourselves (RFC 6762 section 7.4), which suppresses them from our own
+    /// multicast replies for the usual throttling interval.
+    void OnResponseObserved(const chip::Dnssd::BytesRange & packet, const chip::Inet::IPPacketInfo * source);
+
+    /// Drops all cached replies. Must be called when the records provided by the responders change.
+    void InvalidateResponseCache() { mResponseCache.Clear(); }
+    ResponseCacheStats GetResponseCacheStats() const { return mResponseCacheStats; }
 
     // Implementation of ResponderDelegate
     void AddResponse(const chip::Dnssd::ResourceRecord & record) override;
@@ -146,8 +188,15 @@ public:
     void SetServer(ServerBase * server) { mServer = server; }
 
 private:
+    CHIP_ERROR BuildReply(const ResponseConfiguration & configuration, chip::System::Clock::Timestamp now,
+                          size_t & answeredRecords);
     CHIP_ERROR FlushReply();
     CHIP_ERROR PrepareNewReplyPacket();
+    CHIP_ERROR SendReply(chip::System::PacketBufferHandle && packet);
+
+    /// Whether the cached reply can be sent as is for the current send state.
+    bool CanReplay(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now) const;
+    CHIP_ERROR Replay(const ResponseCache::Entry & entry, chip::System::Clock::Timestamp now);
 
     ServerBase * mServer;
     QueryResponderPtrPool mResponders = {};
@@ -155,6 +204,9 @@ private:
     /// Current send state
     ResponseBuilder mResponseBuilder;          // packet being built
     Internal::ResponseSendingState mSendState; // sending state
+
+    ResponseCache mResponseCache;
+    ResponseCacheStats mResponseCacheStats = {};
 };
 
 } // namespace Minimal
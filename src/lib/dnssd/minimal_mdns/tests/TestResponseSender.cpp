@@ -87,6 +87,35 @@ struct CommonTestElements
     }
 };
 
+/// Builds an mDNS packet made of a single query followed by some answers, as sent by a
+/// querier listing its known answers.
+struct KnownAnswerPacket
+{
+    static constexpr uint16_t kMdnsPort = 5353;
+
+    uint8_t storage[256];
+    Encoding::BigEndian::BufferWriter bufferWriter = Encoding::BigEndian::BufferWriter(storage, sizeof(storage));
+    HeaderRef header                               = HeaderRef(storage);
+    RecordWriter recordWriter                      = RecordWriter(&bufferWriter);
+
+    KnownAnswerPacket(QType type, const FullQName & name)
+    {
+        header.Clear();
+        bufferWriter.Skip(HeaderRef::kSizeBytes);
+        recordWriter.WriteQName(name).Put16(static_cast<uint16_t>(type)).Put16(static_cast<uint16_t>(QClass::IN_UNICAST));
+        header.SetQueryCount(1);
+    }
+
+    void AddAnswer(const ResourceRecord & record) { EXPECT_TRUE(record.Append(header, ResourceType::kAnswer, recordWriter)); }
+
+    BytesRange GetRange() const { return BytesRange(storage, storage + bufferWriter.Needed()); }
+
+    QueryData GetQuery(QType type) const
+    {
+        return QueryData(type, QClass::IN, true /* unicast */, storage + HeaderRef::kSizeBytes, GetRange());
+    }
+};
+
 class TestResponseSender : public ::testing::Test
 {
 public:
@@ -353,4 +382,212 @@ TEST_F(TestResponseSender, PtrSrvTxtMultipleRespondersToServiceListing)
     EXPECT_TRUE(common1->server.GetHeaderFound());
 }
 
+TEST_F(TestResponseSender, CachedReplyIsReplayed)
+{
+    CommonTestElements common("test");
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+    common.queryResponder.AddResponder(&common.txtResponder);
+
+    // Replies echoing the query are not cached: query from the standard mDNS port instead.
+    common.packetInfo.SrcPort = KnownAnswerPacket::kMdnsPort;
+    common.recordWriter.WriteQName(common.instance);
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, true, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_SUCCESS(responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseSender.GetResponseCacheStats().hits, 0u);
+    EXPECT_EQ(responseSender.GetResponseCacheStats().misses, 1u);
+
+    // Same query again: same reply, from the cache.
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_SUCCESS(responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_TRUE(common.server.GetSendCalled());
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseSender.GetResponseCacheStats().hits, 1u);
+    EXPECT_EQ(responseSender.GetResponseCacheStats().misses, 1u);
+
+    // A query for a different type is not answered from the same entry.
+    QueryData srvQuery = QueryData(QType::SRV, QClass::IN, true, common.requestNameStart, common.requestBytesRange);
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_SUCCESS(responseSender.Respond(3, srvQuery, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseSender.GetResponseCacheStats().hits, 1u);
+    EXPECT_EQ(responseSender.GetResponseCacheStats().misses, 2u);
+}
+
+TEST_F(TestResponseSender, CachedReplyIsInvalidated)
+{
+    CommonTestElements common("test");
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+
+    common.packetInfo.SrcPort = KnownAnswerPacket::kMdnsPort;
+    common.recordWriter.WriteQName(common.instance);
+    QueryData queryData = QueryData(QType::ANY, QClass::IN, true, common.requestNameStart, common.requestBytesRange);
+
+    common.server.AddExpectedRecord(&common.srvRecord);
+    EXPECT_SUCCESS(responseSender.Respond(1, queryData, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_TRUE(common.server.GetHeaderFound());
+
+    // Records change: the reply has to include the new one.
+    common.queryResponder.AddResponder(&common.txtResponder);
+    responseSender.InvalidateResponseCache();
+
+    common.server.Reset();
+    common.server.AddExpectedRecord(&common.srvRecord);
+    common.server.AddExpectedRecord(&common.txtRecord);
+    EXPECT_SUCCESS(responseSender.Respond(2, queryData, &common.packetInfo, ResponseConfiguration()));
+    EXPECT_TRUE(common.server.GetHeaderFound());
+    EXPECT_EQ(responseSender.GetResponseCacheStats().hits, 0u);
+    EXPECT_EQ(responseSender.GetResponseCacheStats().misses, 2u);
+}
+
+TEST_F(TestResponseSender, KnownAnswersAreSuppressed)
+{
+    CommonTestElements common("test");
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.ptrResponder).SetReportAdditional(common.instance);
+    common.queryResponder.AddResponder(&common.srvResponder);
+    common.queryResponder.AddResponder(&common.txtResponder);
+    common.packetInfo.SrcPort = KnownAnswerPacket::kMdnsPort;
+
+    // Without known answers: PTR and its additional records, which are then cached.
+    {
+        KnownAnswerPacket query(QType::PTR, common.service);
+        KnownAnswerList knownAnswers;
+        EXPECT_TRUE(knownAnswers.InitFromQuery(query.GetRange()));
+        EXPECT_TRUE(knownAnswers.IsEmpty());
+
+        common.server.AddExpectedRecord(&common.ptrRecord);
+        common.server.AddExpectedRecord(&common.srvRecord);
+        common.server.AddExpectedRecord(&common.txtRecord);
+        EXPECT_SUCCESS(
+            responseSender.Respond(1, query.GetQuery(QType::PTR), &common.packetInfo, ResponseConfiguration(), &knownAnswers));
+        EXPECT_TRUE(common.server.GetHeaderFound());
+    }
+
+    // Querier already knows our PTR with more than half of its TTL left: nothing to send.
+    {
+        KnownAnswerPacket query(QType::PTR, common.service);
+        PtrResourceRecord known = common.ptrRecord;
+        known.SetTtl(ResourceRecord::kDefaultTtl / 2);
+        query.AddAnswer(known);
+
+        KnownAnswerList knownAnswers;
+        EXPECT_TRUE(knownAnswers.InitFromQuery(query.GetRange()));
+        EXPECT_FALSE(knownAnswers.IsEmpty());
+        EXPECT_TRUE(knownAnswers.Suppresses(common.ptrRecord));
+        EXPECT_FALSE(knownAnswers.Suppresses(common.srvRecord));
+
+        common.server.Reset();
+        EXPECT_SUCCESS(
+            responseSender.Respond(2, query.GetQuery(QType::PTR), &common.packetInfo, ResponseConfiguration(), &knownAnswers));
+        EXPECT_FALSE(common.server.GetSendCalled());
+    }
+
+    // Known answer about to expire: the full reply is sent again.
+    {
+        KnownAnswerPacket query(QType::PTR, common.service);
+        PtrResourceRecord known = common.ptrRecord;
+        known.SetTtl(ResourceRecord::kDefaultTtl / 2 - 1);
+        query.AddAnswer(known);
+
+        KnownAnswerList knownAnswers;
+        EXPECT_TRUE(knownAnswers.InitFromQuery(query.GetRange()));
+        EXPECT_FALSE(knownAnswers.Suppresses(common.ptrRecord));
+
+        common.server.Reset();
+        common.server.AddExpectedRecord(&common.ptrRecord);
+        common.server.AddExpectedRecord(&common.srvRecord);
+        common.server.AddExpectedRecord(&common.txtRecord);
+        EXPECT_SUCCESS(
+            responseSender.Respond(3, query.GetQuery(QType::PTR), &common.packetInfo, ResponseConfiguration(), &knownAnswers));
+        EXPECT_TRUE(common.server.GetHeaderFound());
+    }
+
+    // Known answers of another instance of the service do not matter.
+    {
+        KnownAnswerPacket query(QType::PTR, common.service);
+        CommonTestElements other("other");
+        PtrResourceRecord known = PtrResourceRecord(common.service, other.instance);
+        query.AddAnswer(known);
+
+        KnownAnswerList knownAnswers;
+        EXPECT_TRUE(knownAnswers.InitFromQuery(query.GetRange()));
+        EXPECT_FALSE(knownAnswers.Suppresses(common.ptrRecord));
+
+        common.server.Reset();
+        common.server.AddExpectedRecord(&common.ptrRecord);
+        common.server.AddExpectedRecord(&common.srvRecord);
+        common.server.AddExpectedRecord(&common.txtRecord);
+        EXPECT_SUCCESS(
+            responseSender.Respond(4, query.GetQuery(QType::PTR), &common.packetInfo, ResponseConfiguration(), &knownAnswers));
+        EXPECT_TRUE(common.server.GetHeaderFound());
+    }
+
+    EXPECT_EQ(responseSender.GetResponseCacheStats().hits, 2u);
+}
+
+TEST_F(TestResponseSender, ObservedResponsesSuppressMulticast)
+{
+    CommonTestElements common("test");
+    ResponseSender responseSender(&common.server);
+    EXPECT_EQ(responseSender.AddQueryResponder(&common.queryResponder), CHIP_NO_ERROR);
+    common.queryResponder.AddResponder(&common.srvResponder);
+    common.queryResponder.AddResponder(&common.txtResponder);
+
+    auto lastMulticastTime = [&](const Responder * responder) -> System::Clock::Timestamp {
+        QueryResponderRecordFilter allRecords;
+        for (auto it = common.queryResponder.begin(&allRecords); it != common.queryResponder.end(); it++)
+        {
+            if (it->responder == responder)
+            {
+                return it->lastMulticastTime;
+            }
+        }
+        return System::Clock::kZero;
+    };
+
+    // Someone else sends our SRV with a shorter TTL: that does not replace ours.
+    {
+        KnownAnswerPacket response(QType::ANY, common.instance);
+        SrvResourceRecord observed = common.srvRecord;
+        observed.SetTtl(ResourceRecord::kDefaultTtl - 1);
+        response.AddAnswer(observed);
+
+        responseSender.OnResponseObserved(response.GetRange(), &common.packetInfo);
+        EXPECT_EQ(lastMulticastTime(&common.srvResponder), System::Clock::kZero);
+    }
+
+    // Someone else sends a SRV for the same instance, but pointing elsewhere.
+    {
+        KnownAnswerPacket response(QType::ANY, common.instance);
+        SrvResourceRecord observed = SrvResourceRecord(common.instance, common.host, CommonTestElements::kPort + 1);
+        response.AddAnswer(observed);
+
+        responseSender.OnResponseObserved(response.GetRange(), &common.packetInfo);
+        EXPECT_EQ(lastMulticastTime(&common.srvResponder), System::Clock::kZero);
+    }
+
+    // Someone else sends our exact SRV: treat it as if we had just multicast it ourselves.
+    {
+        KnownAnswerPacket response(QType::ANY, common.instance);
+        response.AddAnswer(common.srvRecord);
+
+        responseSender.OnResponseObserved(response.GetRange(), &common.packetInfo);
+        EXPECT_GT(lastMulticastTime(&common.srvResponder), System::Clock::kZero);
+        EXPECT_EQ(lastMulticastTime(&common.txtResponder), System::Clock::kZero);
+    }
+}
+
 } // namespace
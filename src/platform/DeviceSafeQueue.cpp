@@ -24,30 +24,149 @@
 
 #include <platform/DeviceSafeQueue.h>
 
+#include <algorithm>
+
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
+DeviceSafeQueue::DeviceSafeQueue()
+{
+    for (size_t i = 0; i < kRingSize; i++)
+    {
+        mSlots[i].mSequence.store(i, std::memory_order_relaxed);
+    }
+}
+
 void DeviceSafeQueue::Push(const ChipDeviceEvent & event)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    mEventQueue.push(event);
+    const QueuedEvent queued{ event, System::SystemClock().GetMonotonicMicroseconds64() };
+
+    // Count the event before publishing it, so that the consumer never decrements the depth below zero.
+    CountPushed();
+
+    if (!mOverflowActive.load(std::memory_order_acquire) && TryPushToRing(queued))
+    {
+        return;
+    }
+
+    std::lock_guard<std::mutex> lock(mOverflowLock);
+    mOverflow.push_back(queued);
+    mOverflowActive.store(true, std::memory_order_release);
 }
 
-bool DeviceSafeQueue::Empty()
+bool DeviceSafeQueue::PopFront(ChipDeviceEvent & aEvent)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
-    return mEventQueue.empty();
+    QueuedEvent queued;
+
+    if (!TryPopFromRing(queued))
+    {
+        VerifyOrReturnValue(mOverflowActive.load(std::memory_order_acquire), false);
+
+        std::lock_guard<std::mutex> lock(mOverflowLock);
+        VerifyOrReturnValue(!mOverflow.empty(), false);
+
+        // A producer that claimed a ring slot before pushing to the overflow queue may not have published that slot
+        // yet; its ring event must be popped first. The producer wakes the consumer once it is done.
+        VerifyOrReturnValue(mEnqueuePos.load(std::memory_order_acquire) == mDequeuePos, false);
+        PopOverflowLocked(queued);
+    }
+
+    aEvent = queued.mEvent;
+    CountPopped(queued);
+    return true;
 }
 
-ChipDeviceEvent DeviceSafeQueue::PopFront()
+bool DeviceSafeQueue::TryPushToRing(const QueuedEvent & queued)
 {
-    std::unique_lock<std::mutex> lock(mEventQueueLock);
+    size_t pos = mEnqueuePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        Slot & slot     = mSlots[pos & (kRingSize - 1)];
+        size_t sequence = slot.mSequence.load(std::memory_order_acquire);
+        auto diff       = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(pos);
+        if (diff == 0)
+        {
+            if (mEnqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+            {
+                slot.mQueued = queued;
+                slot.mSequence.store(pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (diff < 0)
+        {
+            // The slot still holds the event pushed one lap earlier: the ring is full.
+            return false;
+        }
+        else
+        {
+            pos = mEnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
 
-    const ChipDeviceEvent event = mEventQueue.front();
-    mEventQueue.pop();
+bool DeviceSafeQueue::TryPopFromRing(QueuedEvent & queued)
+{
+    Slot & slot = mSlots[mDequeuePos & (kRingSize - 1)];
+    VerifyOrReturnValue(slot.mSequence.load(std::memory_order_acquire) == mDequeuePos + 1, false);
+
+    queued = slot.mQueued;
+    slot.mSequence.store(mDequeuePos + kRingSize, std::memory_order_release);
+    mDequeuePos++;
+    return true;
+}
 
-    return event;
+void DeviceSafeQueue::PopOverflowLocked(QueuedEvent & queued)
+{
+    queued = mOverflow.front();
+    mOverflow.pop_front();
+    if (mOverflow.empty())
+    {
+        mOverflowActive.store(false, std::memory_order_release);
+    }
+    mOverflowed++;
+}
+
+void DeviceSafeQueue::CountPushed()
+{
+    size_t depth     = mDepth.fetch_add(1, std::memory_order_relaxed) + 1;
+    size_t watermark = mDepthHighWatermark.load(std::memory_order_relaxed);
+    while (watermark < depth && !mDepthHighWatermark.compare_exchange_weak(watermark, depth, std::memory_order_relaxed))
+    {
+    }
+}
+
+void DeviceSafeQueue::CountPopped(const QueuedEvent & queued)
+{
+    mDepth.fetch_sub(1, std::memory_order_relaxed);
+
+    const System::Clock::Microseconds64 now = System::SystemClock().GetMonotonicMicroseconds64();
+    uint64_t latencyUs = (now > queued.mEnqueuedAt) ? (now - queued.mEnqueuedAt).count() : 0;
+    mDispatched++;
+    mTotalLatencyUs += latencyUs;
+    mMaxLatencyUs = std::max(mMaxLatencyUs, latencyUs);
+}
+
+DeviceSafeQueue::Stats DeviceSafeQueue::GetStats() const
+{
+    Stats stats;
+    stats.mDepth              = mDepth.load(std::memory_order_relaxed);
+    stats.mDepthHighWatermark = mDepthHighWatermark.load(std::memory_order_relaxed);
+    stats.mDispatched         = mDispatched;
+    stats.mOverflowed         = mOverflowed;
+    stats.mTotalLatencyUs     = mTotalLatencyUs;
+    stats.mMaxLatencyUs       = mMaxLatencyUs;
+    return stats;
+}
+
+void DeviceSafeQueue::ResetStats()
+{
+    mDepthHighWatermark.store(mDepth.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    mDispatched     = 0;
+    mOverflowed     = 0;
+    mTotalLatencyUs = 0;
+    mMaxLatencyUs   = 0;
 }
 
 } // namespace Internal
@@ -24,39 +24,124 @@
 
 #pragma once
 
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
 #include <mutex>
-#include <queue>
 
 #include <lib/core/CHIPCore.h>
 #include <platform/CHIPDeviceConfig.h>
 #include <platform/CHIPDeviceEvent.h>
+#include <system/SystemClock.h>
 
 namespace chip {
 namespace DeviceLayer {
 namespace Internal {
 
+namespace detail {
+constexpr size_t RoundUpToPowerOfTwo(size_t value)
+{
+    size_t result = 1;
+    while (result < value)
+    {
+        result <<= 1;
+    }
+    return result;
+}
+} // namespace detail
+
 /**
  *  @class DeviceSafeQueue
  *
  *  @brief
- *      This class represents a thread-safe message queue implemented with C++ Standard Library, the message queue
- *      is used by the CHIP event loop to hold incoming messages. Each message is sequentially dequeued, decoded,
- *      and then an action is performed.
+ *      This class represents a thread-safe message queue used by the CHIP event loop to hold incoming messages.
+ *      Each message is sequentially dequeued, decoded, and then an action is performed.
  *
+ *      Any number of threads may push events, but only the thread running the event loop may pop them. Events are
+ *      stored in a fixed-size lock-free ring (sized from CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE), so posting an event
+ *      never waits on another producer or on the event loop. When the ring is full, events spill into a
+ *      mutex-protected overflow queue, which keeps the queue unbounded as before. Events pushed by the same thread
+ *      are always popped in the order they were pushed.
  */
 class DeviceSafeQueue
 {
 public:
-    DeviceSafeQueue()  = default;
+    /**
+     * Event queue statistics.
+     */
+    struct Stats
+    {
+        size_t mDepth              = 0; // Events currently queued.
+        size_t mDepthHighWatermark = 0; // Most events queued at once.
+        uint64_t mDispatched       = 0; // Events popped.
+        uint64_t mOverflowed       = 0; // Popped events that had to wait in the overflow queue because the ring was full.
+        // Time between pushing and popping an event, summed over all popped events and at most.
+        uint64_t mTotalLatencyUs = 0;
+        uint64_t mMaxLatencyUs   = 0;
+    };
+
+    DeviceSafeQueue();
     ~DeviceSafeQueue() = default;
 
     void Push(const ChipDeviceEvent & event);
-    bool Empty();
-    ChipDeviceEvent PopFront();
+    bool Empty() const { return mDepth.load(std::memory_order_acquire) == 0; }
+
+    /**
+     * Pops the oldest event into aEvent. Must only be called from the thread consuming the queue.
+     *
+     * Returns false if no event is ready. This can also happen while a producer is in the middle of a Push(); that
+     * producer wakes the consumer again once its event is published.
+     */
+    bool PopFront(ChipDeviceEvent & aEvent);
+
+    /**
+     * Must be called from the thread consuming the queue, or with that thread otherwise synchronized (e.g. while
+     * holding the CHIP stack lock).
+     */
+    Stats GetStats() const;
+    void ResetStats();
 
 private:
-    std::queue<ChipDeviceEvent> mEventQueue;
-    std::mutex mEventQueueLock;
+    static constexpr size_t kRingSize      = detail::RoundUpToPowerOfTwo(CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE);
+    static constexpr size_t kCacheLineSize = 64;
+
+    struct QueuedEvent
+    {
+        ChipDeviceEvent mEvent;
+        System::Clock::Microseconds64 mEnqueuedAt;
+    };
+
+    // A slot is free for the producer claiming position `pos` when mSequence == pos, and holds the event pushed at
+    // `pos` when mSequence == pos + 1.
+    struct Slot
+    {
+        std::atomic<size_t> mSequence;
+        QueuedEvent mQueued;
+    };
+
+    bool TryPushToRing(const QueuedEvent & queued);
+    bool TryPopFromRing(QueuedEvent & queued);
+    void PopOverflowLocked(QueuedEvent & queued);
+    void CountPushed();
+    void CountPopped(const QueuedEvent & queued);
+
+    Slot mSlots[kRingSize];
+    alignas(kCacheLineSize) std::atomic<size_t> mEnqueuePos{ 0 };
+    alignas(kCacheLineSize) size_t mDequeuePos = 0;
+
+    // Set, under mOverflowLock, while mOverflow holds events. Producers then push to mOverflow as well, so that their
+    // newer events cannot overtake the ones they left in mOverflow.
+    alignas(kCacheLineSize) std::atomic<bool> mOverflowActive{ false };
+    std::mutex mOverflowLock;
+    std::deque<QueuedEvent> mOverflow;
+
+    std::atomic<size_t> mDepth{ 0 };
+    std::atomic<size_t> mDepthHighWatermark{ 0 };
+    uint64_t mDispatched     = 0;
+    uint64_t mOverflowed     = 0;
+    uint64_t mTotalLatencyUs = 0;
+    uint64_t mMaxLatencyUs   = 0;
 
     DeviceSafeQueue(const DeviceSafeQueue &)             = delete;
     DeviceSafeQueue & operator=(const DeviceSafeQueue &) = delete;
@@ -0,0 +1,66 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides the CRC-32 used to check the records of the Linux log-structured stores.
+ */
+
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+struct Crc32Table
+{
+    constexpr Crc32Table() : mEntries()
+    {
+        for (uint32_t i = 0; i < 256; i++)
+        {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; bit++)
+            {
+                crc = (crc & 1) ? (0xEDB88320u ^ (crc >> 1)) : (crc >> 1);
+            }
+            mEntries[i] = crc;
+        }
+    }
+
+    uint32_t mEntries[256];
+};
+
+inline constexpr Crc32Table kCrc32Table;
+
+// Standard (IEEE 802.3) CRC-32.
+inline uint32_t Crc32(const uint8_t * data, size_t len)
+{
+    uint32_t crc = 0xFFFFFFFFu;
+    for (size_t i = 0; i < len; i++)
+    {
+        crc = kCrc32Table.mEntries[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+    }
+    return crc ^ 0xFFFFFFFFu;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
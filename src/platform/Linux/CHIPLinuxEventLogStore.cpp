@@ -0,0 +1,434 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Implements the persistent event log store for the Linux platform.
+ */
+
+#include <platform/Linux/CHIPLinuxEventLogStore.h>
+
+#include <dirent.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <utility>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/core/TLVReader.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/FileDescriptor.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/CHIPLinuxCrc32.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+using namespace chip::Encoding;
+
+constexpr char kSegmentMagic[]    = { 'C', 'H', 'I', 'P', 'E', 'V', 'L' };
+constexpr uint8_t kSegmentVersion = 1;
+
+// Segment header fields.
+constexpr size_t kFirstEventNumberOffset = 8;
+constexpr size_t kNextEventNumberOffset  = 16;
+constexpr size_t kRecordsEndOffset       = 24;
+constexpr size_t kLastRecordOffset       = 28;
+constexpr size_t kSegmentHeaderSize      = 32;
+
+// Record header fields.
+constexpr size_t kRecordFlagsOffset       = 0;
+constexpr size_t kRecordFabricIndexOffset = 1;
+constexpr size_t kRecordCrcOffset         = 4;
+constexpr size_t kRecordEventNumberOffset = 8;
+constexpr size_t kRecordEventLengthOffset = 16;
+constexpr size_t kRecordHeaderSize        = 20;
+
+constexpr uint8_t kRecordFlagFabricRemoved = 0x01;
+
+constexpr char kSegmentNamePrefix[] = "events-";
+constexpr char kSegmentNameSuffix[] = ".seg";
+
+std::string SegmentName(EventNumber firstEventNumber)
+{
+    char name[sizeof(kSegmentNamePrefix) + 16 + sizeof(kSegmentNameSuffix)];
+    snprintf(name, sizeof(name), "%s%016" PRIx64 "%s", kSegmentNamePrefix, firstEventNumber, kSegmentNameSuffix);
+    return name;
+}
+
+bool ParseSegmentName(const char * name, EventNumber & firstEventNumber)
+{
+    VerifyOrReturnValue(strncmp(name, kSegmentNamePrefix, strlen(kSegmentNamePrefix)) == 0, false);
+    firstEventNumber = strtoull(name + strlen(kSegmentNamePrefix), nullptr, 16);
+    return SegmentName(firstEventNumber) == name;
+}
+
+uint32_t GetRecordsEnd(const uint8_t * segment)
+{
+    return LittleEndian::Get32(segment + kRecordsEndOffset);
+}
+
+/**
+ * Checks the record at `offset` of a segment of `size` bytes, returning the end of the record
+ * and its event number if it is complete and intact.
+ */
+bool CheckRecord(const uint8_t * segment, size_t size, size_t offset, size_t & recordEnd, EventNumber & eventNumber)
+{
+    VerifyOrReturnValue(offset >= kSegmentHeaderSize && offset <= size && size - offset >= kRecordHeaderSize, false);
+
+    const uint8_t * record = segment + offset;
+    const size_t length    = LittleEndian::Get32(record + kRecordEventLengthOffset);
+    VerifyOrReturnValue(length <= size - offset - kRecordHeaderSize, false);
+    VerifyOrReturnValue(LittleEndian::Get32(record + kRecordCrcOffset) ==
+                            Crc32(record + kRecordEventNumberOffset, kRecordHeaderSize - kRecordEventNumberOffset + length),
+                        false);
+
+    recordEnd   = offset + kRecordHeaderSize + length;
+    eventNumber = LittleEndian::Get64(record + kRecordEventNumberOffset);
+    return true;
+}
+
+} // namespace
+
+CHIP_ERROR ChipLinuxEventLogStore::Init(const char * eventLogDir, size_t segmentSize, size_t maxSegments)
+{
+    VerifyOrReturnError(eventLogDir != nullptr && maxSegments > 0, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(segmentSize > kSegmentHeaderSize + kRecordHeaderSize && segmentSize <= UINT32_MAX,
+                        CHIP_ERROR_INVALID_ARGUMENT);
+    if (!mDir.empty())
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxEventLogStore::Init: Attempt to re-initialize with event log: %s, IGNORING.",
+                     eventLogDir);
+        return CHIP_NO_ERROR;
+    }
+
+    if (mkdir(eventLogDir, S_IRWXU) != 0 && errno != EEXIST)
+    {
+        ChipLogError(DeviceLayer, "Failed to create event log directory %s: %s", eventLogDir, strerror(errno));
+        return CHIP_ERROR_OPEN_FAILED;
+    }
+
+    DIR * dir = opendir(eventLogDir);
+    VerifyOrReturnError(dir != nullptr, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to open event log directory %s: %s", eventLogDir, strerror(errno)));
+
+    std::vector<std::pair<EventNumber, std::string>> segmentFiles;
+    for (struct dirent * entry = readdir(dir); entry != nullptr; entry = readdir(dir))
+    {
+        EventNumber firstEventNumber;
+        if (ParseSegmentName(entry->d_name, firstEventNumber))
+        {
+            segmentFiles.emplace_back(firstEventNumber, entry->d_name);
+        }
+    }
+    closedir(dir);
+    std::sort(segmentFiles.begin(), segmentFiles.end());
+
+    mDir.assign(eventLogDir);
+    mSegmentSize = segmentSize;
+    mMaxSegments = maxSegments;
+
+    for (const auto & segmentFile : segmentFiles)
+    {
+        const std::string path = mDir + "/" + segmentFile.second;
+        CHIP_ERROR err         = OpenSegment(path, segmentFile.first);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(DeviceLayer, "Deleting unreadable event log segment %s: %" CHIP_ERROR_FORMAT, path.c_str(), err.Format());
+            unlink(path.c_str());
+        }
+    }
+
+    if (!mSegments.empty())
+    {
+        RecoverSegment(mSegments.back());
+    }
+    while (mSegments.size() > mMaxSegments)
+    {
+        RemoveOldestSegment();
+    }
+
+    ChipLogProgress(DeviceLayer, "Opened event log %s with %u segments, next event number 0x" ChipLogFormatX64, eventLogDir,
+                    static_cast<unsigned>(mSegments.size()), ChipLogValueX64(GetNextEventNumber()));
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxEventLogStore::Shutdown()
+{
+    if (!mSegments.empty() && msync(mSegments.back().mpBase, mSegments.back().mSize, MS_SYNC) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to sync event log segment %s: %s", mSegments.back().mPath.c_str(), strerror(errno));
+    }
+    for (auto & segment : mSegments)
+    {
+        munmap(segment.mpBase, segment.mSize);
+    }
+    mSegments.clear();
+    mDir.clear();
+}
+
+CHIP_ERROR ChipLinuxEventLogStore::OpenSegment(const std::string & path, EventNumber firstEventNumber)
+{
+    FileDescriptor fd(open(path.c_str(), O_RDWR | O_CLOEXEC));
+    VerifyOrReturnError(fd.Get() != -1, CHIP_ERROR_OPEN_FAILED);
+
+    struct stat st;
+    VerifyOrReturnError(fstat(fd.Get(), &st) == 0, CHIP_ERROR_READ_FAILED);
+    VerifyOrReturnError(st.st_size >= static_cast<off_t>(kSegmentHeaderSize) && st.st_size <= static_cast<off_t>(UINT32_MAX),
+                        CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    const size_t size = static_cast<size_t>(st.st_size);
+    void * mapping    = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd.Get(), 0);
+    VerifyOrReturnError(mapping != MAP_FAILED, CHIP_ERROR_READ_FAILED);
+
+    const uint8_t * base = static_cast<const uint8_t *>(mapping);
+    CHIP_ERROR err       = CHIP_NO_ERROR;
+    if (memcmp(base, kSegmentMagic, sizeof(kSegmentMagic)) != 0 || base[sizeof(kSegmentMagic)] != kSegmentVersion)
+    {
+        err = CHIP_ERROR_VERSION_MISMATCH;
+    }
+    else if (LittleEndian::Get64(base + kFirstEventNumberOffset) != firstEventNumber || GetRecordsEnd(base) < kSegmentHeaderSize ||
+             GetRecordsEnd(base) > size)
+    {
+        err = CHIP_ERROR_INTEGRITY_CHECK_FAILED;
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        munmap(mapping, size);
+        return err;
+    }
+
+    Segment segment;
+    segment.mPath             = path;
+    segment.mpBase            = static_cast<uint8_t *>(mapping);
+    segment.mSize             = size;
+    segment.mFirstEventNumber = firstEventNumber;
+    mSegments.push_back(std::move(segment));
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxEventLogStore::RecoverSegment(Segment & segment)
+{
+    uint8_t * const base           = segment.mpBase;
+    const size_t recordsEnd        = GetRecordsEnd(base);
+    const size_t lastRecord        = LittleEndian::Get32(base + kLastRecordOffset);
+    const EventNumber nextEvent    = LittleEndian::Get64(base + kNextEventNumberOffset);
+    size_t lastRecordEnd           = 0;
+    EventNumber lastRecordEventNum = 0;
+
+    if (lastRecord == 0 ? (recordsEnd == kSegmentHeaderSize && nextEvent == segment.mFirstEventNumber)
+                        : (CheckRecord(base, segment.mSize, lastRecord, lastRecordEnd, lastRecordEventNum) &&
+                           lastRecordEnd == recordsEnd && lastRecordEventNum + 1 == nextEvent))
+    {
+        return;
+    }
+
+    // An append was interrupted: keep the intact records, in increasing event number order, from the start of the segment.
+    size_t offset               = kSegmentHeaderSize;
+    size_t validLastRecord      = 0;
+    EventNumber nextEventNumber = segment.mFirstEventNumber;
+    size_t recordEnd;
+    EventNumber eventNumber;
+    while (CheckRecord(base, segment.mSize, offset, recordEnd, eventNumber) && eventNumber >= nextEventNumber)
+    {
+        validLastRecord = offset;
+        nextEventNumber = eventNumber + 1;
+        offset          = recordEnd;
+    }
+
+    ChipLogError(DeviceLayer, "Recovered event log segment %s up to event number 0x" ChipLogFormatX64, segment.mPath.c_str(),
+                 ChipLogValueX64(nextEventNumber));
+    LittleEndian::Put64(base + kNextEventNumberOffset, nextEventNumber);
+    LittleEndian::Put32(base + kRecordsEndOffset, static_cast<uint32_t>(offset));
+    LittleEndian::Put32(base + kLastRecordOffset, static_cast<uint32_t>(validLastRecord));
+}
+
+CHIP_ERROR ChipLinuxEventLogStore::AddSegment(EventNumber firstEventNumber)
+{
+    if (!mSegments.empty() && msync(mSegments.back().mpBase, mSegments.back().mSize, MS_SYNC) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to sync event log segment %s: %s", mSegments.back().mPath.c_str(), strerror(errno));
+    }
+
+    const std::string path = mDir + "/" + SegmentName(firstEventNumber);
+    FileDescriptor fd(open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, S_IRUSR | S_IWUSR));
+    VerifyOrReturnError(fd.Get() != -1, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to create event log segment %s: %s", path.c_str(), strerror(errno)));
+
+    // Allocate the whole segment up front, so that running out of disk space fails here rather than
+    // when writing to the mapping.
+    int rv = posix_fallocate(fd.Get(), 0, static_cast<off_t>(mSegmentSize));
+    if (rv != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to allocate event log segment %s: %s", path.c_str(), strerror(rv));
+        unlink(path.c_str());
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    void * mapping = mmap(nullptr, mSegmentSize, PROT_READ | PROT_WRITE, MAP_SHARED, fd.Get(), 0);
+    if (mapping == MAP_FAILED)
+    {
+        ChipLogError(DeviceLayer, "Failed to map event log segment %s: %s", path.c_str(), strerror(errno));
+        unlink(path.c_str());
+        return CHIP_ERROR_NO_MEMORY;
+    }
+
+    uint8_t * base = static_cast<uint8_t *>(mapping);
+    memcpy(base, kSegmentMagic, sizeof(kSegmentMagic));
+    base[sizeof(kSegmentMagic)] = kSegmentVersion;
+    LittleEndian::Put64(base + kFirstEventNumberOffset, firstEventNumber);
+    LittleEndian::Put64(base + kNextEventNumberOffset, firstEventNumber);
+    LittleEndian::Put32(base + kRecordsEndOffset, static_cast<uint32_t>(kSegmentHeaderSize));
+    LittleEndian::Put32(base + kLastRecordOffset, 0);
+
+    Segment segment;
+    segment.mPath             = path;
+    segment.mpBase            = base;
+    segment.mSize             = mSegmentSize;
+    segment.mFirstEventNumber = firstEventNumber;
+    mSegments.push_back(std::move(segment));
+
+    while (mSegments.size() > mMaxSegments)
+    {
+        RemoveOldestSegment();
+    }
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxEventLogStore::RemoveOldestSegment()
+{
+    Segment & segment = mSegments.front();
+    munmap(segment.mpBase, segment.mSize);
+    if (unlink(segment.mPath.c_str()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to delete event log segment %s: %s", segment.mPath.c_str(), strerror(errno));
+    }
+    mSegments.erase(mSegments.begin());
+}
+
+CHIP_ERROR ChipLinuxEventLogStore::AppendEvent(EventNumber aEventNumber, FabricIndex aFabricIndex, const ByteSpan & aEvent)
+{
+    VerifyOrReturnError(!mDir.empty(), CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(aEvent.size() <= mSegmentSize - kSegmentHeaderSize - kRecordHeaderSize, CHIP_ERROR_BUFFER_TOO_SMALL);
+    VerifyOrReturnError(mSegments.empty() || aEventNumber >= GetNextEventNumber(), CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t recordLength = kRecordHeaderSize + aEvent.size();
+    if (mSegments.empty() || mSegments.back().mSize - GetRecordsEnd(mSegments.back().mpBase) < recordLength)
+    {
+        ReturnErrorOnFailure(AddSegment(aEventNumber));
+    }
+
+    uint8_t * const base  = mSegments.back().mpBase;
+    const uint32_t offset = GetRecordsEnd(base);
+    uint8_t * record      = base + offset;
+
+    record[kRecordFlagsOffset]       = 0;
+    record[kRecordFabricIndexOffset] = aFabricIndex;
+    record[2]                        = 0;
+    record[3]                        = 0;
+    LittleEndian::Put64(record + kRecordEventNumberOffset, aEventNumber);
+    LittleEndian::Put32(record + kRecordEventLengthOffset, static_cast<uint32_t>(aEvent.size()));
+    memcpy(record + kRecordHeaderSize, aEvent.data(), aEvent.size());
+    LittleEndian::Put32(record + kRecordCrcOffset,
+                        Crc32(record + kRecordEventNumberOffset, recordLength - kRecordEventNumberOffset));
+
+    // Only account for the record in the header once it is complete.
+    LittleEndian::Put32(base + kRecordsEndOffset, static_cast<uint32_t>(offset + recordLength));
+    LittleEndian::Put32(base + kLastRecordOffset, offset);
+    LittleEndian::Put64(base + kNextEventNumberOffset, aEventNumber + 1);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxEventLogStore::ForEachEvent(EventNumber aEventMin, EventNumber aEventMax,
+                                                TLV::Utilities::IterateHandler aHandler, void * apContext)
+{
+    // Segments are in event number order: start with the last one beginning at or before aEventMin.
+    auto segment = std::upper_bound(mSegments.begin(), mSegments.end(), aEventMin,
+                                    [](EventNumber eventNumber, const Segment & s) { return eventNumber < s.mFirstEventNumber; });
+    if (segment != mSegments.begin())
+    {
+        --segment;
+    }
+
+    for (; segment != mSegments.end() && segment->mFirstEventNumber < aEventMax; ++segment)
+    {
+        const uint8_t * const base = segment->mpBase;
+        const size_t recordsEnd    = GetRecordsEnd(base);
+        size_t offset              = kSegmentHeaderSize;
+        while (recordsEnd - offset >= kRecordHeaderSize)
+        {
+            const uint8_t * record        = base + offset;
+            const EventNumber eventNumber = LittleEndian::Get64(record + kRecordEventNumberOffset);
+            const size_t length           = LittleEndian::Get32(record + kRecordEventLengthOffset);
+            VerifyOrReturnError(length <= recordsEnd - offset - kRecordHeaderSize, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+            VerifyOrReturnError(eventNumber < aEventMax, CHIP_NO_ERROR);
+
+            if (eventNumber >= aEventMin && (record[kRecordFlagsOffset] & kRecordFlagFabricRemoved) == 0)
+            {
+                TLV::TLVReader reader;
+                reader.Init(record + kRecordHeaderSize, length);
+                ReturnErrorOnFailure(reader.Next());
+                ReturnErrorOnFailure(aHandler(reader, 0, apContext));
+            }
+            offset += kRecordHeaderSize + length;
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxEventLogStore::FabricRemoved(FabricIndex aFabricIndex)
+{
+    for (auto & segment : mSegments)
+    {
+        const size_t recordsEnd = GetRecordsEnd(segment.mpBase);
+        size_t offset           = kSegmentHeaderSize;
+        while (recordsEnd - offset >= kRecordHeaderSize)
+        {
+            uint8_t * record = segment.mpBase + offset;
+            if (record[kRecordFabricIndexOffset] == aFabricIndex)
+            {
+                record[kRecordFlagsOffset] |= kRecordFlagFabricRemoved;
+            }
+            offset += kRecordHeaderSize + LittleEndian::Get32(record + kRecordEventLengthOffset);
+            VerifyOrReturnError(offset <= recordsEnd, CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+        }
+    }
+    return CHIP_NO_ERROR;
+}
+
+EventNumber ChipLinuxEventLogStore::GetNextEventNumber() const
+{
+    VerifyOrReturnValue(!mSegments.empty(), 0);
+    return LittleEndian::Get64(mSegments.back().mpBase + kNextEventNumberOffset);
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,106 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides a persistent event log store for the Linux platform.
+ *
+ *          Events are appended to fixed-size segment files, named after the number of their first
+ *          event, which are mapped in memory. When the current segment is full, it is synced and a
+ *          new one is started; once there are more than the maximum number of segments, the oldest
+ *          one is deleted. Each segment header tracks the end of its records, its last record and the
+ *          next event number, so opening the store only reads the segment headers. The last record
+ *          of the newest segment is checked on open; if an append was interrupted, that segment is
+ *          scanned to recover its valid records.
+ *
+ *          Appends are not synced individually: they survive a crash of the process, and a power loss
+ *          may lose the events appended since the current segment was started.
+ *
+ *          File layout (all integers little-endian):
+ *
+ *              header:  "CHIPEVL" | version (1) | first event number (8) | next event number (8) |
+ *                       records end offset (4) | last record offset (4)
+ *              record:  flags (1) | fabric index (1) | reserved (2) | crc32 (4) | event number (8) |
+ *                       event length (4) | EventReportIB element
+ *
+ *          The CRC-32 covers every record byte that follows it. The flags mark the events of removed
+ *          fabrics, which are no longer returned.
+ */
+
+#pragma once
+
+#include <app/EventLogStore.h>
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+/**
+ * Not thread-safe: EventManagement calls it with the Matter stack lock held.
+ */
+class ChipLinuxEventLogStore : public app::EventLogStore
+{
+public:
+    ~ChipLinuxEventLogStore() override { Shutdown(); }
+
+    /**
+     * Opens (creating if needed) the event log in the directory `eventLogDir`. Segments that
+     * cannot be read are deleted.
+     */
+    CHIP_ERROR Init(const char * eventLogDir, size_t segmentSize = CHIP_CONFIG_EVENT_LOG_SEGMENT_SIZE,
+                    size_t maxSegments = CHIP_CONFIG_EVENT_LOG_MAX_SEGMENTS);
+    void Shutdown();
+
+    CHIP_ERROR AppendEvent(EventNumber aEventNumber, FabricIndex aFabricIndex, const ByteSpan & aEvent) override;
+    CHIP_ERROR ForEachEvent(EventNumber aEventMin, EventNumber aEventMax, TLV::Utilities::IterateHandler aHandler,
+                            void * apContext) override;
+    CHIP_ERROR FabricRemoved(FabricIndex aFabricIndex) override;
+    EventNumber GetNextEventNumber() const override;
+
+    size_t GetSegmentCount() const { return mSegments.size(); }
+
+private:
+    struct Segment
+    {
+        std::string mPath;
+        uint8_t * mpBase              = nullptr;
+        size_t mSize                  = 0;
+        EventNumber mFirstEventNumber = 0;
+    };
+
+    CHIP_ERROR OpenSegment(const std::string & path, EventNumber firstEventNumber);
+    CHIP_ERROR AddSegment(EventNumber firstEventNumber);
+    void RecoverSegment(Segment & segment);
+    void RemoveOldestSegment();
+
+    std::string mDir;
+    size_t mSegmentSize = CHIP_CONFIG_EVENT_LOG_SEGMENT_SIZE;
+    size_t mMaxSegments = CHIP_CONFIG_EVENT_LOG_MAX_SEGMENTS;
+    std::vector<Segment> mSegments; ///< Oldest first
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,578 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Implements the append-only, log-structured key-value store for the Linux platform.
+ */
+
+#include <platform/Linux/CHIPLinuxLogStorage.h>
+
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+
+#include <lib/core/CHIPEncoding.h>
+#include <lib/support/CodeUtils.h>
+#include <lib/support/ScopedMemoryBuffer.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/Linux/CHIPLinuxCrc32.h>
+#include <platform/Linux/CHIPLinuxStorageIni.h>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+namespace {
+
+using namespace chip::Encoding;
+
+constexpr char kLogMagic[]          = { 'C', 'H', 'I', 'P', 'K', 'V', 'L' };
+constexpr uint8_t kLogVersion       = 1;
+constexpr size_t kLogHeaderSize     = sizeof(kLogMagic) + 1;
+constexpr size_t kRecordHeaderSize  = 12;
+constexpr uint8_t kRecordTypePut    = 1;
+constexpr uint8_t kRecordTypeDelete = 2;
+
+// Well above the 10KB blob limit of the INI backend, while still bounding the size of a single record.
+constexpr size_t kMaxValueSize = UINT16_MAX;
+
+CHIP_ERROR WriteFully(int fd, const uint8_t * data, size_t len, off_t offset)
+{
+    while (len > 0)
+    {
+        ssize_t rv = pwrite(fd, data, len, offset);
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(rv > 0, CHIP_ERROR_WRITE_FAILED);
+        data += rv;
+        len -= static_cast<size_t>(rv);
+        offset += rv;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ReadFully(int fd, uint8_t * data, size_t len, off_t offset)
+{
+    while (len > 0)
+    {
+        ssize_t rv = pread(fd, data, len, offset);
+        if (rv < 0 && errno == EINTR)
+        {
+            continue;
+        }
+        VerifyOrReturnError(rv > 0, CHIP_ERROR_READ_FAILED);
+        data += rv;
+        len -= static_cast<size_t>(rv);
+        offset += rv;
+    }
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR WriteLogHeader(int fd)
+{
+    uint8_t header[kLogHeaderSize];
+    memcpy(header, kLogMagic, sizeof(kLogMagic));
+    header[sizeof(kLogMagic)] = kLogVersion;
+    return WriteFully(fd, header, sizeof(header), 0);
+}
+
+bool HasLogMagic(int fd)
+{
+    uint8_t magic[sizeof(kLogMagic)];
+    return ReadFully(fd, magic, sizeof(magic), 0) == CHIP_NO_ERROR && memcmp(magic, kLogMagic, sizeof(magic)) == 0;
+}
+
+// Encodes the record header and key into `record` and seals it with the CRC. The value must already
+// have been placed right after the key.
+void SealRecord(uint8_t * record, uint8_t type, const std::string & key, size_t valueLen)
+{
+    record[4] = type;
+    record[5] = 0;
+    LittleEndian::Put16(record + 6, static_cast<uint16_t>(key.size()));
+    LittleEndian::Put32(record + 8, static_cast<uint32_t>(valueLen));
+    memcpy(record + kRecordHeaderSize, key.data(), key.size());
+    LittleEndian::Put32(record, Crc32(record + 4, kRecordHeaderSize - 4 + key.size() + valueLen));
+}
+
+/**
+ * Writes a sealed record at `endOffset` of `fd` and advances `endOffset` past it. `value` may be
+ * null, in which case the value is expected to have been read into the record buffer already.
+ */
+CHIP_ERROR WriteRecord(int fd, off_t & endOffset, Platform::ScopedMemoryBuffer<uint8_t> & record, uint8_t type,
+                       const std::string & key, const uint8_t * value, size_t valueLen)
+{
+    const size_t recordLen = kRecordHeaderSize + key.size() + valueLen;
+    if (value != nullptr && valueLen > 0)
+    {
+        memcpy(record.Get() + kRecordHeaderSize + key.size(), value, valueLen);
+    }
+    SealRecord(record.Get(), type, key, valueLen);
+    ReturnErrorOnFailure(WriteFully(fd, record.Get(), recordLen, endOffset));
+    endOffset += static_cast<off_t>(recordLen);
+    return CHIP_NO_ERROR;
+}
+
+// Syncs the fully written temporary file `tmpPath` and atomically moves it over `path`.
+CHIP_ERROR ReplaceWithTempFile(FileDescriptor & tmpFd, const std::string & tmpPath, const std::string & path)
+{
+    if (fdatasync(tmpFd.Get()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to sync temp file %s: %s", tmpPath.c_str(), strerror(errno));
+        unlink(tmpPath.c_str());
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    if (rename(tmpPath.c_str(), path.c_str()) != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to rename %s to %s: %s", tmpPath.c_str(), path.c_str(), strerror(errno));
+        unlink(tmpPath.c_str());
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR ChipLinuxLogStorage::Init(const char * logFile)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(logFile != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    if (mFd.Get() != -1)
+    {
+        ChipLogError(DeviceLayer, "ChipLinuxLogStorage::Init: Attempt to re-initialize with KVS log file: %s, IGNORING.",
+                     logFile);
+        return CHIP_NO_ERROR;
+    }
+
+    ChipLogDetail(DeviceLayer, "ChipLinuxLogStorage::Init: Using KVS log file: %s", logFile);
+
+    mLogPath.assign(logFile);
+    mFd = FileDescriptor(open(logFile, O_RDWR | O_CREAT | O_CLOEXEC, S_IRUSR | S_IWUSR));
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to open KVS log file %s: %s", logFile, strerror(errno)));
+
+    struct stat st;
+    VerifyOrReturnError(fstat(mFd.Get(), &st) == 0, CHIP_ERROR_OPEN_FAILED);
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    if (st.st_size == 0)
+    {
+        err = WriteLogHeader(mFd.Get());
+        if (err == CHIP_NO_ERROR && fdatasync(mFd.Get()) != 0)
+        {
+            err = CHIP_ERROR_WRITE_FAILED;
+        }
+    }
+    else if (!HasLogMagic(mFd.Get()))
+    {
+        err = MigrateFromIni();
+    }
+
+    if (err == CHIP_NO_ERROR)
+    {
+        err = LoadIndex();
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to load KVS log file %s: %" CHIP_ERROR_FORMAT, logFile, err.Format());
+        mFd.Close();
+        mIndex.clear();
+    }
+    return err;
+}
+
+void ChipLinuxLogStorage::Shutdown()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    mFd.Close();
+    mIndex.clear();
+    mEndOffset   = 0;
+    mLiveBytes   = 0;
+    mCompactions = 0;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::LoadIndex()
+{
+    struct stat st;
+    VerifyOrReturnError(fstat(mFd.Get(), &st) == 0, CHIP_ERROR_READ_FAILED);
+    VerifyOrReturnError(st.st_size >= static_cast<off_t>(kLogHeaderSize), CHIP_ERROR_INTEGRITY_CHECK_FAILED);
+
+    const size_t fileSize = static_cast<size_t>(st.st_size);
+    void * mapping        = mmap(nullptr, fileSize, PROT_READ, MAP_PRIVATE, mFd.Get(), 0);
+    VerifyOrReturnError(mapping != MAP_FAILED, CHIP_ERROR_READ_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to map %s: %s", mLogPath.c_str(), strerror(errno)));
+
+    const uint8_t * base = static_cast<const uint8_t *>(mapping);
+    if (memcmp(base, kLogMagic, sizeof(kLogMagic)) != 0 || base[sizeof(kLogMagic)] != kLogVersion)
+    {
+        munmap(mapping, fileSize);
+        return CHIP_ERROR_VERSION_MISMATCH;
+    }
+
+    mIndex.clear();
+    mLiveBytes = 0;
+
+    size_t offset = kLogHeaderSize;
+    while (fileSize - offset >= kRecordHeaderSize)
+    {
+        const uint8_t * record = base + offset;
+        const uint8_t type     = record[4];
+        const uint16_t keyLen  = LittleEndian::Get16(record + 6);
+        const size_t valueLen  = LittleEndian::Get32(record + 8);
+
+        if (keyLen == 0 || keyLen > fileSize - offset - kRecordHeaderSize ||
+            valueLen > fileSize - offset - kRecordHeaderSize - keyLen)
+        {
+            break;
+        }
+        const size_t recordLen = kRecordHeaderSize + keyLen + valueLen;
+        if ((type != kRecordTypePut && type != kRecordTypeDelete) ||
+            LittleEndian::Get32(record) != Crc32(record + 4, recordLen - 4))
+        {
+            break;
+        }
+
+        std::string key(reinterpret_cast<const char *>(record + kRecordHeaderSize), keyLen);
+        auto it = mIndex.find(key);
+        if (it != mIndex.end())
+        {
+            mLiveBytes -= it->second.mRecordLength;
+        }
+
+        if (type == kRecordTypePut)
+        {
+            IndexEntry & entry  = mIndex[key];
+            entry.mValueOffset  = static_cast<off_t>(offset + kRecordHeaderSize + keyLen);
+            entry.mValueLength  = static_cast<uint32_t>(valueLen);
+            entry.mRecordLength = static_cast<uint32_t>(recordLen);
+
+            mLiveBytes += recordLen;
+        }
+        else if (it != mIndex.end())
+        {
+            mIndex.erase(it);
+        }
+
+        offset += recordLen;
+    }
+
+    munmap(mapping, fileSize);
+
+    if (offset != fileSize)
+    {
+        // Anything after the last valid record is the remains of an interrupted append (or corruption);
+        // drop it so that new records are appended right after the valid prefix.
+        ChipLogError(DeviceLayer, "Discarding %u trailing invalid bytes from KVS log %s", static_cast<unsigned>(fileSize - offset),
+                     mLogPath.c_str());
+        VerifyOrReturnError(ftruncate(mFd.Get(), static_cast<off_t>(offset)) == 0, CHIP_ERROR_WRITE_FAILED);
+    }
+
+    mEndOffset = static_cast<off_t>(offset);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::MigrateFromIni()
+{
+    ChipLinuxStorageIni ini;
+    ReturnErrorOnFailure(ini.Init());
+    ReturnErrorOnFailure(ini.AddConfig(mLogPath));
+
+    std::string tmpPath = mLogPath + "-XXXXXX";
+    FileDescriptor tmpFd(mkostemp(&tmpPath[0], O_CLOEXEC));
+    VerifyOrReturnError(tmpFd.Get() != -1, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to create temp file %s: %s", tmpPath.c_str(), strerror(errno)));
+
+    off_t endOffset = static_cast<off_t>(kLogHeaderSize);
+    size_t count    = 0;
+    CHIP_ERROR err  = WriteLogHeader(tmpFd.Get());
+    if (err == CHIP_NO_ERROR)
+    {
+        err = ini.ForEachKey([&](const char * key) -> CHIP_ERROR {
+            std::string keyString(key);
+            size_t valueLen = 0;
+            // A zero-sized read reports the decoded size of the value.
+            CHIP_ERROR readErr = ini.GetBinaryBlobValue(key, nullptr, 0, valueLen);
+            VerifyOrReturnError(readErr == CHIP_NO_ERROR || readErr == CHIP_ERROR_BUFFER_TOO_SMALL, readErr);
+            VerifyOrReturnError(keyString.size() <= UINT16_MAX && valueLen <= kMaxValueSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+            Platform::ScopedMemoryBuffer<uint8_t> record;
+            VerifyOrReturnError(record.Alloc(kRecordHeaderSize + keyString.size() + valueLen), CHIP_ERROR_NO_MEMORY);
+            uint8_t * value = record.Get() + kRecordHeaderSize + keyString.size();
+            ReturnErrorOnFailure(ini.GetBinaryBlobValue(key, value, valueLen, valueLen));
+            count++;
+            return WriteRecord(tmpFd.Get(), endOffset, record, kRecordTypePut, keyString, nullptr, valueLen);
+        });
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        unlink(tmpPath.c_str());
+        return err;
+    }
+
+    // Keep the original INI file around (e.g. to roll back to the INI backend) under a new name. A backup left by an
+    // earlier attempt that did not complete (or by an earlier migration that was rolled back) is older than the INI file
+    // being migrated, so replace it.
+    const std::string backupPath = mLogPath + ".ini";
+    int linkResult               = link(mLogPath.c_str(), backupPath.c_str());
+    if (linkResult != 0 && errno == EEXIST && unlink(backupPath.c_str()) == 0)
+    {
+        linkResult = link(mLogPath.c_str(), backupPath.c_str());
+    }
+    if (linkResult != 0)
+    {
+        ChipLogError(DeviceLayer, "Failed to back up %s to %s: %s", mLogPath.c_str(), backupPath.c_str(), strerror(errno));
+        unlink(tmpPath.c_str());
+        return CHIP_ERROR_WRITE_FAILED;
+    }
+
+    ReturnErrorOnFailure(ReplaceWithTempFile(tmpFd, tmpPath, mLogPath));
+    mFd = std::move(tmpFd);
+
+    ChipLogProgress(DeviceLayer, "Migrated %u keys from INI store %s to the log-structured format", static_cast<unsigned>(count),
+                    mLogPath.c_str());
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen, size_t offset,
+                                             size_t * totalLen)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    auto it = mIndex.find(key);
+    VerifyOrReturnError(it != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    const IndexEntry & entry = it->second;
+    if (totalLen != nullptr)
+    {
+        *totalLen = entry.mValueLength;
+    }
+    VerifyOrReturnError(offset <= entry.mValueLength, CHIP_ERROR_INVALID_ARGUMENT);
+
+    const size_t remaining = entry.mValueLength - offset;
+    outLen                 = std::min(bufSize, remaining);
+    if (outLen > 0)
+    {
+        VerifyOrReturnError(buf != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(ReadFully(mFd.Get(), buf, outLen, entry.mValueOffset + static_cast<off_t>(offset)));
+    }
+
+    return (bufSize < remaining) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::WriteValueBin(const char * key, const uint8_t * data, size_t dataLen)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(data != nullptr || dataLen == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    ReturnErrorOnFailure(AppendRecord(kRecordTypePut, key, data, dataLen));
+    MaybeCompactLocked();
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::ClearValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    VerifyOrReturnError(key != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(mIndex.find(key) != mIndex.end(), CHIP_ERROR_KEY_NOT_FOUND);
+
+    ReturnErrorOnFailure(AppendRecord(kRecordTypeDelete, key, nullptr, 0));
+    MaybeCompactLocked();
+    return CHIP_NO_ERROR;
+}
+
+bool ChipLinuxLogStorage::HasValue(const char * key)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    return key != nullptr && mIndex.find(key) != mIndex.end();
+}
+
+CHIP_ERROR ChipLinuxLogStorage::AppendRecord(uint8_t type, const std::string & key, const uint8_t * data, size_t dataLen)
+{
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(!key.empty() && key.size() <= UINT16_MAX, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(dataLen <= kMaxValueSize, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Platform::ScopedMemoryBuffer<uint8_t> record;
+    VerifyOrReturnError(record.Alloc(kRecordHeaderSize + key.size() + dataLen), CHIP_ERROR_NO_MEMORY);
+
+    const off_t recordOffset = mEndOffset;
+    off_t endOffset          = mEndOffset;
+    CHIP_ERROR err           = WriteRecord(mFd.Get(), endOffset, record, type, key, data, dataLen);
+    if (err == CHIP_NO_ERROR && fdatasync(mFd.Get()) != 0)
+    {
+        err = CHIP_ERROR_WRITE_FAILED;
+    }
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to append to KVS log %s: %s", mLogPath.c_str(), strerror(errno));
+        // Do not leave a partial record behind for the next append to follow.
+        if (ftruncate(mFd.Get(), recordOffset) != 0)
+        {
+            ChipLogError(DeviceLayer, "Failed to truncate KVS log %s: %s", mLogPath.c_str(), strerror(errno));
+        }
+        return err;
+    }
+
+    auto it = mIndex.find(key);
+    if (it != mIndex.end())
+    {
+        mLiveBytes -= it->second.mRecordLength;
+    }
+
+    if (type == kRecordTypePut)
+    {
+        IndexEntry & entry  = mIndex[key];
+        entry.mValueOffset  = recordOffset + static_cast<off_t>(kRecordHeaderSize + key.size());
+        entry.mValueLength  = static_cast<uint32_t>(dataLen);
+        entry.mRecordLength = static_cast<uint32_t>(endOffset - recordOffset);
+
+        mLiveBytes += entry.mRecordLength;
+    }
+    else if (it != mIndex.end())
+    {
+        mIndex.erase(it);
+    }
+
+    mEndOffset = endOffset;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR ChipLinuxLogStorage::Compact()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    return CompactLocked();
+}
+
+void ChipLinuxLogStorage::MaybeCompactLocked()
+{
+    const size_t logSize = static_cast<size_t>(mEndOffset);
+    if (logSize < mCompactionThreshold || mLiveBytes * 2 >= logSize - kLogHeaderSize)
+    {
+        return;
+    }
+
+    // The record that triggered compaction is already durable in the current log, so a failed
+    // compaction only means the log keeps growing until the next attempt.
+    CHIP_ERROR err = CompactLocked();
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(DeviceLayer, "Failed to compact KVS log %s: %" CHIP_ERROR_FORMAT, mLogPath.c_str(), err.Format());
+    }
+}
+
+CHIP_ERROR ChipLinuxLogStorage::CompactLocked()
+{
+    VerifyOrReturnError(mFd.Get() != -1, CHIP_ERROR_INCORRECT_STATE);
+
+    std::string tmpPath = mLogPath + "-XXXXXX";
+    FileDescriptor tmpFd(mkostemp(&tmpPath[0], O_CLOEXEC));
+    VerifyOrReturnError(tmpFd.Get() != -1, CHIP_ERROR_OPEN_FAILED,
+                        ChipLogError(DeviceLayer, "Failed to create temp file %s: %s", tmpPath.c_str(), strerror(errno)));
+
+    std::unordered_map<std::string, IndexEntry> newIndex;
+    newIndex.reserve(mIndex.size());
+
+    off_t endOffset = static_cast<off_t>(kLogHeaderSize);
+    CHIP_ERROR err  = WriteLogHeader(tmpFd.Get());
+    for (auto it = mIndex.begin(); err == CHIP_NO_ERROR && it != mIndex.end(); ++it)
+    {
+        const std::string & key  = it->first;
+        const IndexEntry & entry = it->second;
+
+        Platform::ScopedMemoryBuffer<uint8_t> record;
+        if (!record.Alloc(entry.mRecordLength))
+        {
+            err = CHIP_ERROR_NO_MEMORY;
+            break;
+        }
+
+        err = ReadFully(mFd.Get(), record.Get() + kRecordHeaderSize + key.size(), entry.mValueLength, entry.mValueOffset);
+        if (err != CHIP_NO_ERROR)
+        {
+            break;
+        }
+
+        IndexEntry & newEntry = newIndex[key];
+        newEntry              = entry;
+        newEntry.mValueOffset = endOffset + static_cast<off_t>(kRecordHeaderSize + key.size());
+        err                   = WriteRecord(tmpFd.Get(), endOffset, record, kRecordTypePut, key, nullptr, entry.mValueLength);
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        unlink(tmpPath.c_str());
+        return err;
+    }
+
+    ReturnErrorOnFailure(ReplaceWithTempFile(tmpFd, tmpPath, mLogPath));
+
+    ChipLogDetail(DeviceLayer, "Compacted KVS log %s from %u to %u bytes", mLogPath.c_str(), static_cast<unsigned>(mEndOffset),
+                  static_cast<unsigned>(endOffset));
+
+    mFd        = std::move(tmpFd);
+    mIndex     = std::move(newIndex);
+    mEndOffset = endOffset;
+    mLiveBytes = static_cast<size_t>(endOffset) - kLogHeaderSize;
+    mCompactions++;
+    return CHIP_NO_ERROR;
+}
+
+void ChipLinuxLogStorage::SetCompactionThreshold(size_t threshold)
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    mCompactionThreshold = threshold;
+}
+
+ChipLinuxLogStorage::Stats ChipLinuxLogStorage::GetStats()
+{
+    std::lock_guard<std::mutex> lock(mLock);
+
+    Stats stats;
+    stats.mFileSize    = static_cast<size_t>(mEndOffset);
+    stats.mLiveBytes   = mLiveBytes;
+    stats.mKeyCount    = mIndex.size();
+    stats.mCompactions = mCompactions;
+    return stats;
+}
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
@@ -0,0 +1,126 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *          Provides an append-only, log-structured key-value store for the Linux platform.
+ *
+ *          Every write or delete appends a single CRC-protected record to the end of the file and
+ *          syncs it, instead of regenerating and renaming the whole store as the INI backend does.
+ *          On startup the file is mapped and scanned once to rebuild an in-memory index of the
+ *          latest record for every key; a torn or corrupt tail left by an interrupted write is
+ *          truncated away. Once stale records make up most of the file, the live records are
+ *          rewritten to a temporary file which atomically replaces the log.
+ *
+ *          File layout (all integers little-endian):
+ *
+ *              header:  "CHIPKVL" | version (1 byte)
+ *              record:  crc32 (4) | type (1) | reserved (1) | key length (2) | value length (4) | key | value
+ *
+ *          The CRC-32 covers every record byte that follows it.
+ */
+
+#pragma once
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <lib/support/FileDescriptor.h>
+
+#include <mutex>
+#include <stddef.h>
+#include <stdint.h>
+#include <string>
+#include <sys/types.h>
+#include <unordered_map>
+
+namespace chip {
+namespace DeviceLayer {
+namespace Internal {
+
+class ChipLinuxLogStorage
+{
+public:
+    struct Stats
+    {
+        size_t mFileSize;  ///< Bytes currently used by the log file, including the header.
+        size_t mLiveBytes; ///< Bytes used by records that are still the latest for their key.
+        size_t mKeyCount;
+        size_t mCompactions; ///< Number of compactions since Init().
+    };
+
+    /**
+     * Opens (creating if needed) the log at `logFile` and rebuilds the index from it. A file that
+     * is not in the log format is treated as an INI store written by ChipLinuxStorage and migrated;
+     * the original INI file is kept as `<logFile>.ini`.
+     */
+    CHIP_ERROR Init(const char * logFile);
+    void Shutdown();
+
+    /**
+     * Reads up to `bufSize` bytes of the value for `key`, starting `offset` bytes into it.
+     *
+     * `outLen` receives the number of bytes copied and `totalLen` (if not null) the full value size.
+     * Returns CHIP_ERROR_BUFFER_TOO_SMALL if the value did not fit, CHIP_ERROR_KEY_NOT_FOUND if
+     * `key` is not present and CHIP_ERROR_INVALID_ARGUMENT if `offset` is past the end of the value.
+     */
+    CHIP_ERROR ReadValueBin(const char * key, uint8_t * buf, size_t bufSize, size_t & outLen, size_t offset = 0,
+                            size_t * totalLen = nullptr);
+    CHIP_ERROR WriteValueBin(const char * key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR ClearValue(const char * key);
+    bool HasValue(const char * key);
+
+    /**
+     * Rewrites the log with only the live records.
+     */
+    CHIP_ERROR Compact();
+
+    /**
+     * Sets the minimum log size at which compaction is triggered automatically (see
+     * CHIP_CONFIG_KVS_LOG_COMPACTION_THRESHOLD).
+     */
+    void SetCompactionThreshold(size_t threshold);
+
+    Stats GetStats();
+
+private:
+    struct IndexEntry
+    {
+        off_t mValueOffset;
+        uint32_t mValueLength;
+        uint32_t mRecordLength;
+    };
+
+    CHIP_ERROR LoadIndex();
+    CHIP_ERROR MigrateFromIni();
+    CHIP_ERROR AppendRecord(uint8_t type, const std::string & key, const uint8_t * data, size_t dataLen);
+    CHIP_ERROR CompactLocked();
+    void MaybeCompactLocked();
+
+    std::mutex mLock;
+    std::string mLogPath;
+    FileDescriptor mFd;
+    off_t mEndOffset            = 0;
+    size_t mLiveBytes           = 0;
+    size_t mCompactions         = 0;
+    size_t mCompactionThreshold = CHIP_CONFIG_KVS_LOG_COMPACTION_THRESHOLD;
+    std::unordered_map<std::string, IndexEntry> mIndex;
+};
+
+} // namespace Internal
+} // namespace DeviceLayer
+} // namespace chip
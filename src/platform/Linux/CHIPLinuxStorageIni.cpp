@@ -338,6 +338,26 @@ bool ChipLinuxStorageIni::HasValue(const char * key)
     return it != section.end();
 }
 
+CHIP_ERROR ChipLinuxStorageIni::ForEachKey(const std::function<CHIP_ERROR(const char * key)> & callback)
+{
+    std::map<std::string, std::string> section;
+    CHIP_ERROR err = GetDefaultSection(section);
+    if (err == CHIP_ERROR_KEY_NOT_FOUND)
+    {
+        return CHIP_NO_ERROR;
+    }
+    ReturnErrorOnFailure(err);
+
+    for (const auto & entry : section)
+    {
+        std::string key = UnescapeKey(entry.first);
+        VerifyOrReturnError(!key.empty(), CHIP_ERROR_INVALID_ARGUMENT);
+        ReturnErrorOnFailure(callback(key.c_str()));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR ChipLinuxStorageIni::AddEntry(const char * key, const char * value)
 {
     CHIP_ERROR retval = CHIP_NO_ERROR;
@@ -29,6 +29,7 @@
 #include <lib/support/ScopedMemoryBuffer.h>
 #include <platform/PersistedStorage.h>
 
+#include <functional>
 #include <map>
 #include <string>
 
@@ -49,6 +50,12 @@ public:
     CHIP_ERROR GetBinaryBlobValue(const char * key, uint8_t * decodedData, size_t bufSize, size_t & decodedDataLen);
     bool HasValue(const char * key);
 
+    /**
+     * Invokes `callback` with the (unescaped) key of every entry in the default section, stopping
+     * at the first callback that does not return CHIP_NO_ERROR.
+     */
+    CHIP_ERROR ForEachKey(const std::function<CHIP_ERROR(const char * key)> & callback);
+
 protected:
     CHIP_ERROR AddEntry(const char * key, const char * value);
     CHIP_ERROR RemoveEntry(const char * key);
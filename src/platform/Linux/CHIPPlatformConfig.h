@@ -86,3 +86,40 @@ using CHIP_CONFIG_PERSISTED_STORAGE_KEY_TYPE = const char *;
 #ifndef CHIP_CONFIG_KVS_PATH
 #define CHIP_CONFIG_KVS_PATH "/tmp/chip_kvs"
 #endif // CHIP_CONFIG_KVS_PATH
+
+// Select the append-only, log-structured KVS backend (CHIPLinuxLogStorage) instead of the INI
+// file backend. An existing INI file at the KVS path is migrated on first use.
+#ifndef CHIP_CONFIG_KVS_LOG_STRUCTURED
+#define CHIP_CONFIG_KVS_LOG_STRUCTURED 0
+#endif // CHIP_CONFIG_KVS_LOG_STRUCTURED
+
+// Minimum size of the log-structured KVS file before compaction is considered. Once above this
+// size, the log is compacted whenever stale (overwritten or deleted) records make up more than
+// half of it.
+#ifndef CHIP_CONFIG_KVS_LOG_COMPACTION_THRESHOLD
+#define CHIP_CONFIG_KVS_LOG_COMPACTION_THRESHOLD (64 * 1024)
+#endif // CHIP_CONFIG_KVS_LOG_COMPACTION_THRESHOLD
+
+// ==================== Event Logging Configuration Overrides ====================
+
+// Write logged events to segment files (ChipLinuxEventLogStore) in addition to the in-memory event
+// buffers, so that they are kept across restarts and events dropped from the buffers can still be
+// read.
+#ifndef CHIP_CONFIG_EVENT_LOG_PERSISTENT
+#define CHIP_CONFIG_EVENT_LOG_PERSISTENT 0
+#endif // CHIP_CONFIG_EVENT_LOG_PERSISTENT
+
+// Directory holding the event log segment files.
+#ifndef CHIP_CONFIG_EVENT_LOG_STORE_PATH
+#define CHIP_CONFIG_EVENT_LOG_STORE_PATH "/tmp/chip_events"
+#endif // CHIP_CONFIG_EVENT_LOG_STORE_PATH
+
+// Size of each event log segment file. A segment is mapped in memory as a whole.
+#ifndef CHIP_CONFIG_EVENT_LOG_SEGMENT_SIZE
+#define CHIP_CONFIG_EVENT_LOG_SEGMENT_SIZE (256 * 1024)
+#endif // CHIP_CONFIG_EVENT_LOG_SEGMENT_SIZE
+
+// Number of event log segments kept; the oldest segment is deleted when a new one is started.
+#ifndef CHIP_CONFIG_EVENT_LOG_MAX_SEGMENTS
+#define CHIP_CONFIG_EVENT_LOG_MAX_SEGMENTS 8
+#endif // CHIP_CONFIG_EVENT_LOG_MAX_SEGMENTS
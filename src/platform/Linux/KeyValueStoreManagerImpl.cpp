@@ -28,7 +28,6 @@
 
 #include <lib/support/CodeUtils.h>
 #include <lib/support/logging/CHIPLogging.h>
-#include <platform/Linux/CHIPLinuxStorage.h>
 
 namespace chip {
 namespace DeviceLayer {
@@ -44,6 +43,20 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t
     // Copy data into value buffer
     VerifyOrReturnError(value != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
 
+#if CHIP_CONFIG_KVS_LOG_STRUCTURED
+    // The log store reads straight from the value's location in the file, so partial and offset
+    // reads need no intermediate buffer.
+    CHIP_ERROR err = mStorage.ReadValueBin(key, static_cast<uint8_t *>(value), value_size, read_size, offset_bytes);
+    if (err == CHIP_ERROR_KEY_NOT_FOUND)
+    {
+        return CHIP_ERROR_PERSISTED_STORAGE_VALUE_NOT_FOUND;
+    }
+    if ((err == CHIP_NO_ERROR || err == CHIP_ERROR_BUFFER_TOO_SMALL) && read_bytes_size != nullptr)
+    {
+        *read_bytes_size = read_size;
+    }
+    return err;
+#else
     // On linux read first without a buffer which returns the size, and then
     // use a local buffer to read the entire object, which allows partial and
     // offset reads.
@@ -74,6 +87,7 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Get(const char * key, void * value, size_t
     ::memcpy(value, buf.Get() + offset_bytes, copy_size);
 
     return (value_size < total_size_to_read) ? CHIP_ERROR_BUFFER_TOO_SMALL : CHIP_NO_ERROR;
+#endif // CHIP_CONFIG_KVS_LOG_STRUCTURED
 }
 
 CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value, size_t value_size)
@@ -83,9 +97,12 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Put(const char * key, const void * value,
     err = mStorage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), value_size);
     SuccessOrExit(err);
 
-    // Commit the value to the persistent store.
+#if !CHIP_CONFIG_KVS_LOG_STRUCTURED
+    // Commit the value to the persistent store. The log store makes each record durable as it is
+    // appended.
     err = mStorage.Commit();
     SuccessOrExit(err);
+#endif
 
 exit:
     return err;
@@ -102,9 +119,12 @@ CHIP_ERROR KeyValueStoreManagerImpl::_Delete(const char * key)
     }
     SuccessOrExit(err);
 
-    // Commit the value to the persistent store.
+#if !CHIP_CONFIG_KVS_LOG_STRUCTURED
+    // Commit the value to the persistent store. The log store makes each record durable as it is
+    // appended.
     err = mStorage.Commit();
     SuccessOrExit(err);
+#endif
 
 exit:
     return err;
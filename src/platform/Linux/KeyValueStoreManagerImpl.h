@@ -23,7 +23,12 @@
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
+#if CHIP_CONFIG_KVS_LOG_STRUCTURED
+#include <platform/Linux/CHIPLinuxLogStorage.h>
+#else
 #include <platform/Linux/CHIPLinuxStorage.h>
+#endif
 
 namespace chip {
 namespace DeviceLayer {
@@ -43,7 +48,11 @@ public:
     CHIP_ERROR _Put(const char * key, const void * value, size_t value_size);
 
 private:
+#if CHIP_CONFIG_KVS_LOG_STRUCTURED
+    DeviceLayer::Internal::ChipLinuxLogStorage mStorage;
+#else
     DeviceLayer::Internal::ChipLinuxStorage mStorage;
+#endif
 
     // ===== Members for internal use by the following friends.
     friend KeyValueStoreManager & KeyValueStoreMgr();
@@ -0,0 +1,142 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <platform/DeviceSafeQueue.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using namespace chip::DeviceLayer;
+using chip::DeviceLayer::Internal::DeviceSafeQueue;
+
+ChipDeviceEvent MakeEvent(intptr_t arg)
+{
+    ChipDeviceEvent event;
+    event.Type                    = DeviceEventType::kCallWorkFunct;
+    event.CallWorkFunct.WorkFunct = nullptr;
+    event.CallWorkFunct.Arg       = arg;
+    return event;
+}
+
+TEST(TestDeviceSafeQueue, TestFifoThroughOverflow)
+{
+    // Push well past the capacity of the lock-free ring, so that later events go through the overflow queue.
+    constexpr intptr_t kEventCount = 3 * CHIP_DEVICE_CONFIG_MAX_EVENT_QUEUE_SIZE;
+    auto queue                     = std::make_unique<DeviceSafeQueue>();
+    ChipDeviceEvent event;
+
+    EXPECT_TRUE(queue->Empty());
+    EXPECT_FALSE(queue->PopFront(event));
+
+    for (intptr_t i = 0; i < kEventCount; i++)
+    {
+        queue->Push(MakeEvent(i));
+    }
+    EXPECT_FALSE(queue->Empty());
+    EXPECT_EQ(queue->GetStats().mDepth, static_cast<size_t>(kEventCount));
+
+    // Interleave pushes with pops while the overflow queue is in use; those must still come out last.
+    for (intptr_t i = 0; i < kEventCount; i++)
+    {
+        ASSERT_TRUE(queue->PopFront(event));
+        EXPECT_EQ(event.Type, DeviceEventType::kCallWorkFunct);
+        EXPECT_EQ(event.CallWorkFunct.Arg, i);
+        if (i < 2)
+        {
+            queue->Push(MakeEvent(kEventCount + i));
+        }
+    }
+    for (intptr_t i = kEventCount; i < kEventCount + 2; i++)
+    {
+        ASSERT_TRUE(queue->PopFront(event));
+        EXPECT_EQ(event.CallWorkFunct.Arg, i);
+    }
+    EXPECT_TRUE(queue->Empty());
+    EXPECT_FALSE(queue->PopFront(event));
+
+    DeviceSafeQueue::Stats stats = queue->GetStats();
+    EXPECT_EQ(stats.mDepth, 0u);
+    EXPECT_EQ(stats.mDepthHighWatermark, static_cast<size_t>(kEventCount));
+    EXPECT_EQ(stats.mDispatched, static_cast<uint64_t>(kEventCount + 2));
+    EXPECT_GT(stats.mOverflowed, 0u);
+    EXPECT_GE(stats.mTotalLatencyUs, stats.mMaxLatencyUs);
+
+    queue->ResetStats();
+    stats = queue->GetStats();
+    EXPECT_EQ(stats.mDepthHighWatermark, 0u);
+    EXPECT_EQ(stats.mDispatched, 0u);
+
+    // Once the overflow queue has drained, events go through the ring again.
+    queue->Push(MakeEvent(1));
+    ASSERT_TRUE(queue->PopFront(event));
+    EXPECT_EQ(event.CallWorkFunct.Arg, 1);
+    EXPECT_EQ(queue->GetStats().mOverflowed, 0u);
+}
+
+TEST(TestDeviceSafeQueue, TestMultipleProducers)
+{
+    constexpr intptr_t kProducerCount     = 4;
+    constexpr intptr_t kEventsPerProducer = 20000;
+    auto queue                            = std::make_unique<DeviceSafeQueue>();
+
+    std::vector<std::thread> producers;
+    for (intptr_t producer = 0; producer < kProducerCount; producer++)
+    {
+        producers.emplace_back([&queue, producer] {
+            for (intptr_t i = 0; i < kEventsPerProducer; i++)
+            {
+                queue->Push(MakeEvent(producer * kEventsPerProducer + i));
+            }
+        });
+    }
+
+    // Events of each producer must be popped in the order that producer pushed them, whether they went through the
+    // ring or the overflow queue.
+    std::vector<intptr_t> nextExpected(kProducerCount, 0);
+    intptr_t received = 0;
+    ChipDeviceEvent event;
+    while (received < kProducerCount * kEventsPerProducer)
+    {
+        if (!queue->PopFront(event))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        intptr_t producer = event.CallWorkFunct.Arg / kEventsPerProducer;
+        ASSERT_LT(producer, kProducerCount);
+        ASSERT_EQ(event.CallWorkFunct.Arg % kEventsPerProducer, nextExpected[static_cast<size_t>(producer)]);
+        nextExpected[static_cast<size_t>(producer)]++;
+        received++;
+    }
+
+    for (auto & producer : producers)
+    {
+        producer.join();
+    }
+    EXPECT_FALSE(queue->PopFront(event));
+    EXPECT_TRUE(queue->Empty());
+    EXPECT_EQ(queue->GetStats().mDispatched, static_cast<uint64_t>(kProducerCount * kEventsPerProducer));
+}
+
+} // namespace
@@ -0,0 +1,251 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <platform/Linux/CHIPLinuxEventLogStore.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/core/TLVReader.h>
+#include <lib/core/TLVWriter.h>
+#include <pw_unit_test/framework.h>
+
+#include <dirent.h>
+#include <fcntl.h>
+#include <stdlib.h>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+namespace {
+
+using namespace chip;
+using chip::DeviceLayer::Internal::ChipLinuxEventLogStore;
+
+constexpr size_t kSegmentSize = 512;
+constexpr size_t kMaxSegments = 3;
+
+class TestLinuxEventLogStore : public ::testing::Test
+{
+public:
+    void SetUp() override
+    {
+        char path[] = "/tmp/chip-event-log-XXXXXX";
+        ASSERT_NE(mkdtemp(path), nullptr);
+        mDir = path;
+    }
+
+    void TearDown() override
+    {
+        for (const auto & file : Files())
+        {
+            unlink((mDir + "/" + file).c_str());
+        }
+        rmdir(mDir.c_str());
+    }
+
+    std::vector<std::string> Files()
+    {
+        std::vector<std::string> files;
+        DIR * dir = opendir(mDir.c_str());
+        for (struct dirent * entry = dir ? readdir(dir) : nullptr; entry != nullptr; entry = readdir(dir))
+        {
+            if (entry->d_name[0] != '.')
+            {
+                files.push_back(entry->d_name);
+            }
+        }
+        if (dir != nullptr)
+        {
+            closedir(dir);
+        }
+        return files;
+    }
+
+    std::string mDir;
+};
+
+// Stands in for an EventReportIB: a structure holding the event number.
+CHIP_ERROR Append(ChipLinuxEventLogStore & store, EventNumber eventNumber, FabricIndex fabricIndex = kUndefinedFabricIndex)
+{
+    uint8_t buffer[64];
+    TLV::TLVWriter writer;
+    TLV::TLVType containerType;
+    writer.Init(buffer);
+    ReturnErrorOnFailure(writer.StartContainer(TLV::AnonymousTag(), TLV::kTLVType_Structure, containerType));
+    ReturnErrorOnFailure(writer.Put(TLV::ContextTag(0), eventNumber));
+    ReturnErrorOnFailure(writer.EndContainer(containerType));
+    ReturnErrorOnFailure(writer.Finalize());
+    return store.AppendEvent(eventNumber, fabricIndex, ByteSpan(buffer, writer.GetLengthWritten()));
+}
+
+CHIP_ERROR CollectEventNumber(const TLV::TLVReader & aReader, size_t, void * apContext)
+{
+    TLV::TLVReader reader;
+    TLV::TLVType containerType;
+    EventNumber eventNumber;
+    reader.Init(aReader);
+    ReturnErrorOnFailure(reader.EnterContainer(containerType));
+    ReturnErrorOnFailure(reader.Next(TLV::ContextTag(0)));
+    ReturnErrorOnFailure(reader.Get(eventNumber));
+    static_cast<std::vector<EventNumber> *>(apContext)->push_back(eventNumber);
+    return CHIP_NO_ERROR;
+}
+
+std::vector<EventNumber> Fetch(ChipLinuxEventLogStore & store, EventNumber eventMin, EventNumber eventMax)
+{
+    std::vector<EventNumber> eventNumbers;
+    EXPECT_EQ(store.ForEachEvent(eventMin, eventMax, CollectEventNumber, &eventNumbers), CHIP_NO_ERROR);
+    return eventNumbers;
+}
+
+std::vector<EventNumber> Range(EventNumber first, EventNumber end)
+{
+    std::vector<EventNumber> eventNumbers;
+    for (EventNumber eventNumber = first; eventNumber < end; eventNumber++)
+    {
+        eventNumbers.push_back(eventNumber);
+    }
+    return eventNumbers;
+}
+
+TEST_F(TestLinuxEventLogStore, TestAppendAndFetch)
+{
+    ChipLinuxEventLogStore store;
+    ASSERT_EQ(store.Init(mDir.c_str(), kSegmentSize, kMaxSegments), CHIP_NO_ERROR);
+    EXPECT_EQ(store.GetNextEventNumber(), 0u);
+    EXPECT_TRUE(Fetch(store, 0, 100).empty());
+
+    for (EventNumber eventNumber = 10; eventNumber < 30; eventNumber++)
+    {
+        EXPECT_EQ(Append(store, eventNumber), CHIP_NO_ERROR);
+    }
+    EXPECT_EQ(store.GetNextEventNumber(), 30u);
+    EXPECT_GT(store.GetSegmentCount(), 1u);
+
+    // Events are appended in increasing event number order only.
+    EXPECT_EQ(Append(store, 29), CHIP_ERROR_INVALID_ARGUMENT);
+
+    EXPECT_EQ(Fetch(store, 0, 100), Range(10, 30));
+    EXPECT_EQ(Fetch(store, 15, 25), Range(15, 25));
+    EXPECT_EQ(Fetch(store, 29, 30), Range(29, 30));
+    EXPECT_TRUE(Fetch(store, 30, 100).empty());
+}
+
+TEST_F(TestLinuxEventLogStore, TestReopen)
+{
+    {
+        ChipLinuxEventLogStore store;
+        ASSERT_EQ(store.Init(mDir.c_str(), kSegmentSize, kMaxSegments), CHIP_NO_ERROR);
+        for (EventNumber eventNumber = 0; eventNumber < 20; eventNumber++)
+        {
+            EXPECT_EQ(Append(store, eventNumber), CHIP_NO_ERROR);
+        }
+    }
+
+    ChipLinuxEventLogStore store;
+    ASSERT_EQ(store.Init(mDir.c_str(), kSegmentSize, kMaxSegments), CHIP_NO_ERROR);
+    EXPECT_EQ(store.GetNextEventNumber(), 20u);
+    EXPECT_EQ(Fetch(store, 0, 100), Range(0, 20));
+
+    // Event numbers are not reused after a restart, but they may skip ahead.
+    EXPECT_EQ(Append(store, 25), CHIP_NO_ERROR);
+    EXPECT_EQ(store.GetNextEventNumber(), 26u);
+    EXPECT_EQ(Fetch(store, 19, 100), std::vector<EventNumber>({ 19, 25 }));
+}
+
+TEST_F(TestLinuxEventLogStore, TestRotation)
+{
+    ChipLinuxEventLogStore store;
+    ASSERT_EQ(store.Init(mDir.c_str(), kSegmentSize, kMaxSegments), CHIP_NO_ERROR);
+    for (EventNumber eventNumber = 0; eventNumber < 200; eventNumber++)
+    {
+        EXPECT_EQ(Append(store, eventNumber), CHIP_NO_ERROR);
+    }
+
+    // The oldest segments were deleted, the remaining events are contiguous up to the last one.
+    EXPECT_EQ(store.GetSegmentCount(), kMaxSegments);
+    EXPECT_EQ(Files().size(), kMaxSegments);
+    std::vector<EventNumber> eventNumbers = Fetch(store, 0, 200);
+    ASSERT_FALSE(eventNumbers.empty());
+    EXPECT_GT(eventNumbers.front(), 0u);
+    EXPECT_EQ(eventNumbers, Range(eventNumbers.front(), 200));
+
+    // Events that do not fit in a segment are rejected.
+    std::vector<uint8_t> tooLarge(kSegmentSize);
+    EXPECT_EQ(store.AppendEvent(200, kUndefinedFabricIndex, ByteSpan(tooLarge.data(), tooLarge.size())),
+              CHIP_ERROR_BUFFER_TOO_SMALL);
+}
+
+TEST_F(TestLinuxEventLogStore, TestFabricRemoved)
+{
+    {
+        ChipLinuxEventLogStore store;
+        ASSERT_EQ(store.Init(mDir.c_str(), kSegmentSize, kMaxSegments), CHIP_NO_ERROR);
+        for (EventNumber eventNumber = 0; eventNumber < 20; eventNumber++)
+        {
+            EXPECT_EQ(Append(store, eventNumber, static_cast<FabricIndex>(eventNumber % 3)), CHIP_NO_ERROR);
+        }
+        EXPECT_EQ(store.FabricRemoved(1), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxEventLogStore store;
+    ASSERT_EQ(store.Init(mDir.c_str(), kSegmentSize, kMaxSegments), CHIP_NO_ERROR);
+    std::vector<EventNumber> expected;
+    for (EventNumber eventNumber = 0; eventNumber < 20; eventNumber++)
+    {
+        if (eventNumber % 3 != 1)
+        {
+            expected.push_back(eventNumber);
+        }
+    }
+    EXPECT_EQ(Fetch(store, 0, 100), expected);
+}
+
+TEST_F(TestLinuxEventLogStore, TestInterruptedAppend)
+{
+    std::string lastSegment;
+    {
+        ChipLinuxEventLogStore store;
+        ASSERT_EQ(store.Init(mDir.c_str(), kSegmentSize, kMaxSegments), CHIP_NO_ERROR);
+        for (EventNumber eventNumber = 0; eventNumber < 5; eventNumber++)
+        {
+            EXPECT_EQ(Append(store, eventNumber), CHIP_NO_ERROR);
+        }
+        ASSERT_EQ(Files().size(), 1u);
+        lastSegment = mDir + "/" + Files().front();
+    }
+
+    // Corrupt the last record and point the header past it, as if the process died while appending it.
+    int fd = open(lastSegment.c_str(), O_RDWR);
+    ASSERT_NE(fd, -1);
+    uint8_t recordsEnd[4];
+    ASSERT_EQ(pread(fd, recordsEnd, sizeof(recordsEnd), 24), 4);
+    const uint32_t end = static_cast<uint32_t>(recordsEnd[0] | recordsEnd[1] << 8 | recordsEnd[2] << 16 | recordsEnd[3] << 24);
+    const uint8_t garbage[4] = { 0xde, 0xad, 0xbe, 0xef };
+    ASSERT_EQ(pwrite(fd, garbage, sizeof(garbage), end - sizeof(garbage)), 4);
+    close(fd);
+
+    ChipLinuxEventLogStore store;
+    ASSERT_EQ(store.Init(mDir.c_str(), kSegmentSize, kMaxSegments), CHIP_NO_ERROR);
+    EXPECT_EQ(store.GetNextEventNumber(), 4u);
+    EXPECT_EQ(Fetch(store, 0, 100), Range(0, 4));
+
+    EXPECT_EQ(Append(store, 4), CHIP_NO_ERROR);
+    EXPECT_EQ(Fetch(store, 0, 100), Range(0, 5));
+}
+
+} // namespace
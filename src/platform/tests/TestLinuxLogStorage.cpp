@@ -0,0 +1,265 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <platform/Linux/CHIPLinuxLogStorage.h>
+#include <platform/Linux/CHIPLinuxStorage.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <lib/support/CHIPMem.h>
+#include <pw_unit_test/framework.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <string>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace {
+
+using namespace chip;
+using chip::DeviceLayer::Internal::ChipLinuxLogStorage;
+using chip::DeviceLayer::Internal::ChipLinuxStorage;
+
+class TestLinuxLogStorage : public ::testing::Test
+{
+public:
+    static void SetUpTestSuite() { ASSERT_EQ(chip::Platform::MemoryInit(), CHIP_NO_ERROR); }
+    static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
+
+    void SetUp() override
+    {
+        char path[] = "/tmp/chip-kvs-log-XXXXXX";
+        int fd      = mkstemp(path);
+        ASSERT_NE(fd, -1);
+        close(fd);
+        unlink(path);
+        mPath = path;
+    }
+
+    void TearDown() override
+    {
+        unlink(mPath.c_str());
+        unlink((mPath + ".ini").c_str());
+    }
+
+    size_t FileSize()
+    {
+        struct stat st;
+        return (stat(mPath.c_str(), &st) == 0) ? static_cast<size_t>(st.st_size) : 0;
+    }
+
+    std::string mPath;
+};
+
+void ExpectValue(ChipLinuxLogStorage & storage, const char * key, const char * expected)
+{
+    uint8_t buf[64];
+    size_t len = 0;
+    EXPECT_EQ(storage.ReadValueBin(key, buf, sizeof(buf), len), CHIP_NO_ERROR);
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(buf), len), expected);
+}
+
+CHIP_ERROR Write(ChipLinuxLogStorage & storage, const char * key, const char * value)
+{
+    return storage.WriteValueBin(key, reinterpret_cast<const uint8_t *>(value), strlen(value));
+}
+
+TEST_F(TestLinuxLogStorage, TestPutGetDeleteAcrossRestart)
+{
+    {
+        ChipLinuxLogStorage storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+        EXPECT_EQ(Write(storage, "a", "first"), CHIP_NO_ERROR);
+        EXPECT_EQ(Write(storage, "b", "second"), CHIP_NO_ERROR);
+        EXPECT_EQ(Write(storage, "a", "updated"), CHIP_NO_ERROR);
+        EXPECT_EQ(Write(storage, "g/fs/1 with=odd\nchars", ""), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ClearValue("b"), CHIP_NO_ERROR);
+        EXPECT_EQ(storage.ClearValue("b"), CHIP_ERROR_KEY_NOT_FOUND);
+
+        ExpectValue(storage, "a", "updated");
+        EXPECT_FALSE(storage.HasValue("b"));
+    }
+
+    ChipLinuxLogStorage storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+
+    ExpectValue(storage, "a", "updated");
+    ExpectValue(storage, "g/fs/1 with=odd\nchars", "");
+    EXPECT_FALSE(storage.HasValue("b"));
+    EXPECT_EQ(storage.GetStats().mKeyCount, 2u);
+    EXPECT_EQ(storage.GetStats().mFileSize, FileSize());
+}
+
+TEST_F(TestLinuxLogStorage, TestPartialAndOffsetReads)
+{
+    ChipLinuxLogStorage storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    ASSERT_EQ(Write(storage, "key", "0123456789"), CHIP_NO_ERROR);
+
+    uint8_t buf[4];
+    size_t len   = 0;
+    size_t total = 0;
+    EXPECT_EQ(storage.ReadValueBin("key", buf, sizeof(buf), len, 2, &total), CHIP_ERROR_BUFFER_TOO_SMALL);
+    EXPECT_EQ(len, sizeof(buf));
+    EXPECT_EQ(total, 10u);
+    EXPECT_EQ(memcmp(buf, "2345", sizeof(buf)), 0);
+
+    EXPECT_EQ(storage.ReadValueBin("key", buf, sizeof(buf), len, 7), CHIP_NO_ERROR);
+    EXPECT_EQ(len, 3u);
+    EXPECT_EQ(memcmp(buf, "789", 3), 0);
+
+    EXPECT_EQ(storage.ReadValueBin("key", buf, sizeof(buf), len, 11), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(storage.ReadValueBin("missing", buf, sizeof(buf), len), CHIP_ERROR_KEY_NOT_FOUND);
+}
+
+TEST_F(TestLinuxLogStorage, TestTornTailIsDiscarded)
+{
+    size_t validSize;
+    {
+        ChipLinuxLogStorage storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        ASSERT_EQ(Write(storage, "kept", "value"), CHIP_NO_ERROR);
+        validSize = FileSize();
+        ASSERT_EQ(Write(storage, "torn", "this record gets cut short"), CHIP_NO_ERROR);
+    }
+
+    // Simulate a crash in the middle of the last append.
+    ASSERT_EQ(truncate(mPath.c_str(), static_cast<off_t>(FileSize() - 5)), 0);
+
+    {
+        ChipLinuxLogStorage storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        ExpectValue(storage, "kept", "value");
+        EXPECT_FALSE(storage.HasValue("torn"));
+        EXPECT_EQ(FileSize(), validSize);
+
+        // New records follow the last valid one.
+        EXPECT_EQ(Write(storage, "after", "crash"), CHIP_NO_ERROR);
+    }
+
+    // A corrupted byte in the middle of a record invalidates it and everything after it.
+    {
+        FILE * file = fopen(mPath.c_str(), "r+b");
+        ASSERT_NE(file, nullptr);
+        ASSERT_EQ(fseek(file, static_cast<long>(validSize + 14), SEEK_SET), 0);
+        fputc('X', file);
+        fclose(file);
+    }
+
+    ChipLinuxLogStorage storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(storage, "kept", "value");
+    EXPECT_FALSE(storage.HasValue("after"));
+}
+
+TEST_F(TestLinuxLogStorage, TestCompaction)
+{
+    {
+        ChipLinuxLogStorage storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        storage.SetCompactionThreshold(1024);
+
+        char value[32];
+        for (int i = 0; i < 200; i++)
+        {
+            snprintf(value, sizeof(value), "value-%d", i);
+            ASSERT_EQ(Write(storage, (i % 2) ? "odd" : "even", value), CHIP_NO_ERROR);
+        }
+        ASSERT_EQ(Write(storage, "deleted", "soon"), CHIP_NO_ERROR);
+        ASSERT_EQ(storage.ClearValue("deleted"), CHIP_NO_ERROR);
+
+        ChipLinuxLogStorage::Stats stats = storage.GetStats();
+        EXPECT_GT(stats.mCompactions, 0u);
+        EXPECT_LT(stats.mFileSize, 1024u + 64u);
+
+        ASSERT_EQ(storage.Compact(), CHIP_NO_ERROR);
+        stats = storage.GetStats();
+        EXPECT_EQ(stats.mKeyCount, 2u);
+        EXPECT_EQ(stats.mFileSize, FileSize());
+        EXPECT_LE(stats.mLiveBytes, stats.mFileSize);
+
+        ExpectValue(storage, "even", "value-198");
+        ExpectValue(storage, "odd", "value-199");
+    }
+
+    ChipLinuxLogStorage storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(storage, "even", "value-198");
+    ExpectValue(storage, "odd", "value-199");
+    EXPECT_FALSE(storage.HasValue("deleted"));
+}
+
+TEST_F(TestLinuxLogStorage, TestMigrationFromIni)
+{
+    const uint8_t binary[] = { 0x00, 0xFF, 0x10, 0x3D, 0x0A };
+    {
+        ChipLinuxStorage ini;
+        ASSERT_EQ(ini.Init(mPath.c_str()), CHIP_NO_ERROR);
+        ASSERT_EQ(ini.WriteValueBin("g/fidx", reinterpret_cast<const uint8_t *>("fabric"), 6), CHIP_NO_ERROR);
+        ASSERT_EQ(ini.WriteValueBin("key with = spaces", binary, sizeof(binary)), CHIP_NO_ERROR);
+        ASSERT_EQ(ini.Commit(), CHIP_NO_ERROR);
+    }
+
+    ChipLinuxLogStorage storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    EXPECT_EQ(storage.GetStats().mKeyCount, 2u);
+    ExpectValue(storage, "g/fidx", "fabric");
+
+    uint8_t buf[16];
+    size_t len = 0;
+    EXPECT_EQ(storage.ReadValueBin("key with = spaces", buf, sizeof(buf), len), CHIP_NO_ERROR);
+    ASSERT_EQ(len, sizeof(binary));
+    EXPECT_EQ(memcmp(buf, binary, sizeof(binary)), 0);
+
+    // The original INI file is kept as a backup.
+    EXPECT_EQ(access((mPath + ".ini").c_str(), F_OK), 0);
+}
+
+TEST_F(TestLinuxLogStorage, TestMigrationReplacesLeftoverBackup)
+{
+    // A migration interrupted after backing up the INI file leaves the backup behind; migrating again must not fail on it.
+    {
+        ChipLinuxStorage ini;
+        ASSERT_EQ(ini.Init(mPath.c_str()), CHIP_NO_ERROR);
+        ASSERT_EQ(ini.WriteValueBin("g/fidx", reinterpret_cast<const uint8_t *>("fabric"), 6), CHIP_NO_ERROR);
+        ASSERT_EQ(ini.Commit(), CHIP_NO_ERROR);
+    }
+    ASSERT_EQ(link(mPath.c_str(), (mPath + ".ini").c_str()), 0);
+
+    {
+        ChipLinuxLogStorage storage;
+        ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+        ExpectValue(storage, "g/fidx", "fabric");
+    }
+
+    // The store is usable across restarts, and the backup still holds the INI contents.
+    ChipLinuxLogStorage storage;
+    ASSERT_EQ(storage.Init(mPath.c_str()), CHIP_NO_ERROR);
+    ExpectValue(storage, "g/fidx", "fabric");
+
+    ChipLinuxStorage backup;
+    ASSERT_EQ(backup.Init((mPath + ".ini").c_str()), CHIP_NO_ERROR);
+    uint8_t buf[16];
+    size_t len = 0;
+    EXPECT_EQ(backup.ReadValueBin("g/fidx", buf, sizeof(buf), len), CHIP_NO_ERROR);
+    EXPECT_EQ(std::string(reinterpret_cast<const char *>(buf), len), "fabric");
+}
+
+} // namespace
@@ -22,7 +22,13 @@
 namespace chip {
 namespace bdx {
 
-AsyncTransferFacilitator::~AsyncTransferFacilitator() {}
+AsyncTransferFacilitator::~AsyncTransferFacilitator()
+{
+    if (mSystemLayer != nullptr)
+    {
+        mSystemLayer->CancelTimer(HandleAsyncPollTimer, this);
+    }
+}
 
 CHIP_ERROR AsyncTransferFacilitator::Init(System::Layer * layer, Messaging::ExchangeContext * exchangeCtx,
                                           System::Clock::Timeout timeout)
@@ -110,7 +116,23 @@ void AsyncTransferFacilitator::ProcessOutputEvents()
     if (mDestroySelfAfterProcessingEvents)
     {
         DestroySelf();
+        return;
     }
+
+    // An Async transfer has work to do even when no message arrives: retransmitting lost Blocks and noticing a silent peer.
+    if (mTransfer.IsAsyncTransferInProgress())
+    {
+        CHIP_ERROR err = mSystemLayer->StartTimer(TransferSession::kAsyncRetransmitTimeout, HandleAsyncPollTimer, this);
+        if (err != CHIP_NO_ERROR)
+        {
+            ChipLogError(BDX, "ProcessOutputEvents: Failed to start poll timer: %" CHIP_ERROR_FORMAT, err.Format());
+        }
+    }
+}
+
+void AsyncTransferFacilitator::HandleAsyncPollTimer(System::Layer * layer, void * context)
+{
+    static_cast<AsyncTransferFacilitator *>(context)->ProcessOutputEvents();
 }
 
 CHIP_ERROR AsyncTransferFacilitator::SendMessage(const TransferSession::MessageTypeData msgTypeData,
@@ -120,9 +142,20 @@ CHIP_ERROR AsyncTransferFacilitator::SendMessage(const TransferSession::MessageT
 
     Messaging::SendFlags sendFlags;
 
-    // All messages that are sent expect a response, except for a StatusReport which would indicate an error and
+    // In Async mode, Blocks and BlockAcks are not sent reliably: several of them are in flight at once, which MRP does not
+    // allow on a single exchange, and the TransferSession retransmits whatever gets lost. BlockAckEOF still is, so the
+    // transfer ends cleanly.
+    const bool isAsyncBlockMessage = (mTransfer.GetControlMode() == TransferControlFlags::kAsync) &&
+        (msgTypeData.HasMessageType(MessageType::Block) || msgTypeData.HasMessageType(MessageType::BlockEOF) ||
+         msgTypeData.HasMessageType(MessageType::BlockAck));
+
+    if (isAsyncBlockMessage)
+    {
+        sendFlags.Set(Messaging::SendMessageFlags::kNoAutoRequestAck);
+    }
+    // All other messages that are sent expect a response, except for a StatusReport which would indicate an error and
     // the end of the transfer.
-    if (!msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport))
+    else if (!msgTypeData.HasMessageType(Protocols::SecureChannel::MsgType::StatusReport))
     {
         sendFlags.Set(Messaging::SendMessageFlags::kExpectResponse);
     }
@@ -131,7 +164,15 @@ CHIP_ERROR AsyncTransferFacilitator::SendMessage(const TransferSession::MessageT
 
     // Set the response timeout on the exchange before sending the message.
     ec->SetResponseTimeout(mTimeout);
-    return ec->SendMessage(msgTypeData.ProtocolId, msgTypeData.MessageType, std::move(msgBuf), sendFlags);
+    ReturnErrorOnFailure(ec->SendMessage(msgTypeData.ProtocolId, msgTypeData.MessageType, std::move(msgBuf), sendFlags));
+
+    if (isAsyncBlockMessage)
+    {
+        // Nothing else keeps the exchange open until the next message of the transfer.
+        ec->WillSendMessage();
+    }
+
+    return CHIP_NO_ERROR;
 }
 
 CHIP_ERROR AsyncTransferFacilitator::OnMessageReceived(Messaging::ExchangeContext * ec, const PayloadHeader & payloadHeader,
@@ -37,6 +37,10 @@ namespace bdx {
  * TODO: # 29334 - Add AsyncInitiator to handle the initiating side of a transfer.
  *
  * An AsyncTransferFacilitator is associated with a specific BDX transfer.
+ *
+ * In Async mode, Blocks and BlockAcks are sent without MRP (which allows only one unacknowledged message per exchange) so that
+ * several Blocks can be in flight; losses are recovered by TransferSession retransmissions, for which the TransferSession is
+ * polled on a timer while the transfer is in progress.
  */
 class AsyncTransferFacilitator : public Messaging::ExchangeDelegate
 {
@@ -91,9 +95,11 @@ private:
     // The timeout for the BDX transfer session.
     System::Clock::Timeout mTimeout;
 
-    System::Layer * mSystemLayer;
+    System::Layer * mSystemLayer = nullptr;
 
     CHIP_ERROR SendMessage(const TransferSession::MessageTypeData msgTypeData, System::PacketBufferHandle & msgBuf);
+
+    static void HandleAsyncPollTimer(System::Layer * layer, void * context);
 };
 
 /**
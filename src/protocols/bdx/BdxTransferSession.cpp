@@ -1,7 +1,6 @@
 /**
  *    @file
  *      Implementation for the TransferSession class.
- *      // TODO: Support Asynchronous mode. Currently, only Synchronous mode is supported.
  */
 
 #include <protocols/bdx/BdxTransferSession.h>
@@ -17,6 +16,7 @@
 #include <system/SystemPacketBuffer.h>
 #include <transport/SessionManager.h>
 
+#include <algorithm>
 #include <type_traits>
 
 namespace {
@@ -82,10 +82,23 @@ void TransferSession::PollOutput(OutputEvent & event, System::Clock::Timestamp c
         return;
     }
 
+    // In Async mode, nothing tells the sender that a Block was lost if every later Block (or every acknowledgement) was lost too,
+    // so resend the whole window when the receiver has been silent for too long.
+    if (IsAsyncSender() && HasUnackedBlocks() && mAsyncRetransmitBlockNum >= mAsyncRetransmitEndBlockNum &&
+        (curTime - std::max(mTimeoutStartTime, mAsyncRetransmitTime)) >= kAsyncRetransmitTimeout)
+    {
+        StartAsyncRetransmission();
+        mAsyncRetransmitTime = curTime;
+    }
+
     switch (mPendingOutput)
     {
     case OutputEventType::kNone:
         event = OutputEvent(OutputEventType::kNone);
+        if (IsAsyncSender())
+        {
+            PollAsyncSenderOutput(event);
+        }
         break;
     case OutputEventType::kInternalError:
         event = OutputEvent::StatusReportEvent(OutputEventType::kInternalError, mStatusReportData);
@@ -212,6 +225,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
     VerifyOrReturnError(acceptData.MaxBlockSize <= mTransferRequestData.MaxBlockSize, CHIP_ERROR_INVALID_ARGUMENT);
 
     mTransferMaxBlockSize = acceptData.MaxBlockSize;
+    mControlMode          = acceptData.ControlMode;
 
     if (mRole == TransferRole::kSender)
     {
@@ -255,7 +269,7 @@ CHIP_ERROR TransferSession::AcceptTransfer(const TransferAcceptData & acceptData
 
     mState = TransferState::kTransferInProgress;
 
-    if ((mRole == TransferRole::kReceiver && mControlMode == TransferControlFlags::kSenderDrive) ||
+    if ((mRole == TransferRole::kReceiver && mControlMode != TransferControlFlags::kReceiverDrive) ||
         (mRole == TransferRole::kSender && mControlMode == TransferControlFlags::kReceiverDrive))
     {
         mAwaitingResponse = true;
@@ -327,7 +341,14 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
     VerifyOrReturnError(mState == TransferState::kTransferInProgress, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mRole == TransferRole::kSender, CHIP_ERROR_INCORRECT_STATE);
     VerifyOrReturnError(mPendingOutput == OutputEventType::kNone, CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        VerifyOrReturnError(mNextBlockNum - mNextUnackedBlockNum < kAsyncWindowSize, CHIP_ERROR_BUSY);
+    }
+    else
+    {
+        VerifyOrReturnError(!mAwaitingResponse, CHIP_ERROR_INCORRECT_STATE);
+    }
 
     // Verify non-zero data is provided and is no longer than MaxBlockSize (BlockEOF may contain 0 length data)
     VerifyOrReturnError((inData.Data != nullptr) && (inData.Length <= mTransferMaxBlockSize), CHIP_ERROR_INVALID_ARGUMENT);
@@ -339,6 +360,19 @@ CHIP_ERROR TransferSession::PrepareBlock(const BlockData & inData)
 
     ReturnErrorOnFailure(WriteToPacketBuffer(blockMsg, mPendingMsgHandle));
 
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        // Keep a copy until the Block is acknowledged, in case it has to be sent again.
+        System::PacketBufferHandle & unackedBlock = mUnackedBlocks[mNextBlockNum % kAsyncWindowSize];
+        unackedBlock                              = mPendingMsgHandle.CloneData();
+        if (unackedBlock.IsNull())
+        {
+            mPendingMsgHandle = nullptr;
+            return CHIP_ERROR_NO_MEMORY;
+        }
+        mAsyncQueryPending = false;
+    }
+
     const MessageType msgType = inData.IsEof ? MessageType::BlockEOF : MessageType::Block;
 
     if (msgType == MessageType::BlockEOF)
@@ -373,10 +407,10 @@ CHIP_ERROR TransferSession::PrepareBlockAck()
 
     if (mState == TransferState::kTransferInProgress)
     {
-        if (mControlMode == TransferControlFlags::kSenderDrive)
+        if (mControlMode == TransferControlFlags::kSenderDrive || mControlMode == TransferControlFlags::kAsync)
         {
             // In Sender Drive, a BlockAck is implied to also be a query for the next Block, so expect to receive a Block
-            // message.
+            // message. In Async mode, more Blocks may already be on their way.
             mLastQueryNum     = ackMsg.BlockCounter + 1;
             mAwaitingResponse = true;
         }
@@ -412,6 +446,7 @@ void TransferSession::Reset()
     mPendingOutput = OutputEventType::kNone;
     mState         = TransferState::kUnitialized;
     mSuppportedXferOpts.ClearAll();
+    mControlMode           = TransferControlFlags();
     mTransferVersion       = 0;
     mMaxSupportedBlockSize = 0;
     mStartOffset           = 0;
@@ -430,6 +465,19 @@ void TransferSession::Reset()
     mTimeoutStartTime       = System::Clock::kZero;
     mShouldInitTimeoutStart = true;
     mAwaitingResponse       = false;
+
+    for (auto & block : mUnackedBlocks)
+    {
+        block = nullptr;
+    }
+    mNextUnackedBlockNum        = 0;
+    mAsyncRetransmitBlockNum    = 0;
+    mAsyncRetransmitEndBlockNum = 0;
+    mAsyncGapRetransmitBlockNum = 0;
+    mNumBlocksRetransmitted     = 0;
+    mAsyncRetransmitTime        = System::Clock::kZero;
+    mAsyncQueryPending          = false;
+    mAsyncGapReported           = false;
 }
 
 CHIP_ERROR TransferSession::HandleMessageReceived(const PayloadHeader & payloadHeader, System::PacketBufferHandle msg,
@@ -611,7 +659,7 @@ void TransferSession::HandleReceiveAccept(System::PacketBufferHandle msgData)
     mPendingMsgHandle = std::move(msgData);
     mPendingOutput    = OutputEventType::kAcceptReceived;
 
-    mAwaitingResponse = (mControlMode == TransferControlFlags::kSenderDrive);
+    mAwaitingResponse = (mControlMode != TransferControlFlags::kReceiverDrive);
     mState            = TransferState::kTransferInProgress;
 
 #if CHIP_AUTOMATION_LOGGING
@@ -696,6 +744,11 @@ void TransferSession::HandleBlockQueryWithSkip(System::PacketBufferHandle msgDat
 void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        HandleAsyncBlock(MessageType::Block, std::move(msgData));
+        return;
+    }
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
@@ -730,6 +783,11 @@ void TransferSession::HandleBlock(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kReceiver, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        HandleAsyncBlock(MessageType::BlockEOF, std::move(msgData));
+        return;
+    }
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
@@ -762,6 +820,11 @@ void TransferSession::HandleBlockEOF(System::PacketBufferHandle msgData)
 void TransferSession::HandleBlockAck(System::PacketBufferHandle msgData)
 {
     VerifyOrReturn(mRole == TransferRole::kSender, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    if (mControlMode == TransferControlFlags::kAsync)
+    {
+        HandleAsyncBlockAck(std::move(msgData));
+        return;
+    }
     VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
     VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
 
@@ -790,6 +853,8 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
 
     mPendingOutput = OutputEventType::kAckEOFReceived;
 
+    // The receiver has everything, including any Block still waiting to be retransmitted in Async mode.
+    ReleaseAckedBlocks(mNextBlockNum);
     mAwaitingResponse = false;
 
     mState = TransferState::kTransferDone;
@@ -799,6 +864,167 @@ void TransferSession::HandleBlockAckEOF(System::PacketBufferHandle msgData)
 #endif // CHIP_AUTOMATION_LOGGING
 }
 
+// Async mode, receiver: Blocks may be lost, duplicated or reordered on the way. Only the next expected Block is delivered; a
+// duplicate is answered with a BlockAck in case the previous one was lost, and the first Block after a gap with a BlockAck for the
+// last Block received, which tells the sender where to resume.
+void TransferSession::HandleAsyncBlock(MessageType msgType, System::PacketBufferHandle msgData)
+{
+    DataBlock blockMsg;
+    const CHIP_ERROR err = blockMsg.Parse(msgData.Retain());
+    VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+
+    // Late retransmissions may still arrive once the BlockEOF has been received.
+    if ((mState == TransferState::kReceivedEOF || mState == TransferState::kTransferDone) &&
+        blockMsg.BlockCounter <= mLastBlockNum)
+    {
+        return;
+    }
+
+    VerifyOrReturn(mState == TransferState::kTransferInProgress, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+    VerifyOrReturn(mAwaitingResponse, PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    if (blockMsg.BlockCounter != mNextBlockNum)
+    {
+        const bool isDuplicate = (blockMsg.BlockCounter < mNextBlockNum);
+        if (isDuplicate || !mAsyncGapReported)
+        {
+            PrepareAsyncBlockAck();
+            mAsyncGapReported = mAsyncGapReported || !isDuplicate;
+        }
+        return;
+    }
+
+    const bool isEof = (msgType == MessageType::BlockEOF);
+    VerifyOrReturn((isEof || blockMsg.DataLength > 0) && (blockMsg.DataLength <= mTransferMaxBlockSize),
+                   PrepareStatusReport(StatusCode::kBadMessageContents));
+
+    if (!isEof && IsTransferLengthDefinite())
+    {
+        VerifyOrReturn(mNumBytesProcessed + blockMsg.DataLength <= mTransferLength,
+                       PrepareStatusReport(StatusCode::kLengthMismatch));
+    }
+
+    mBlockEventData.Data         = blockMsg.Data;
+    mBlockEventData.Length       = blockMsg.DataLength;
+    mBlockEventData.IsEof        = isEof;
+    mBlockEventData.BlockCounter = blockMsg.BlockCounter;
+
+    mPendingMsgHandle = std::move(msgData);
+    mPendingOutput    = OutputEventType::kBlockReceived;
+
+    mNumBytesProcessed += blockMsg.DataLength;
+    mLastBlockNum     = blockMsg.BlockCounter;
+    mNextBlockNum     = blockMsg.BlockCounter + 1;
+    mAsyncGapReported = false;
+
+    if (isEof)
+    {
+        mAwaitingResponse = false;
+        mState            = TransferState::kReceivedEOF;
+
+#if CHIP_AUTOMATION_LOGGING
+        blockMsg.LogMessage(MessageType::BlockEOF);
+#endif // CHIP_AUTOMATION_LOGGING
+    }
+}
+
+// Async mode, sender: a BlockAck acknowledges every Block up to and including its counter. An acknowledgement that does not move
+// past the first unacknowledged Block means the receiver is missing it, so everything from there is sent again (once per gap).
+void TransferSession::HandleAsyncBlockAck(System::PacketBufferHandle msgData)
+{
+    VerifyOrReturn(mState == TransferState::kTransferInProgress || mState == TransferState::kAwaitingEOFAck,
+                   PrepareStatusReport(StatusCode::kUnexpectedMessage));
+
+    BlockAck ackMsg;
+    const CHIP_ERROR err = ackMsg.Parse(std::move(msgData));
+    VerifyOrReturn(err == CHIP_NO_ERROR, PrepareStatusReport(StatusCode::kBadMessageContents));
+    VerifyOrReturn(ackMsg.BlockCounter < mNextBlockNum, PrepareStatusReport(StatusCode::kBadBlockCounter));
+
+    if (ackMsg.BlockCounter >= mNextUnackedBlockNum)
+    {
+        ReleaseAckedBlocks(ackMsg.BlockCounter + 1);
+    }
+    else if (ackMsg.BlockCounter + 1 == mNextUnackedBlockNum && HasUnackedBlocks() &&
+             mAsyncGapRetransmitBlockNum != mNextUnackedBlockNum)
+    {
+        mAsyncGapRetransmitBlockNum = mNextUnackedBlockNum;
+        StartAsyncRetransmission();
+    }
+
+    mAwaitingResponse = HasUnackedBlocks();
+}
+
+void TransferSession::PrepareAsyncBlockAck()
+{
+    // Nothing was received yet, so there is nothing to acknowledge: the sender will retransmit on its own.
+    VerifyOrReturn(mNextBlockNum > 0);
+
+    CounterMessage ackMsg;
+    ackMsg.BlockCounter  = mLastBlockNum;
+    const CHIP_ERROR err = WriteToPacketBuffer(ackMsg, mPendingMsgHandle);
+    VerifyOrReturn(err == CHIP_NO_ERROR,
+                   ChipLogError(BDX, "%s: error preparing message: %" CHIP_ERROR_FORMAT, __FUNCTION__, err.Format()));
+
+    PrepareOutgoingMessageEvent(MessageType::BlockAck, mPendingOutput, mMsgTypeData);
+}
+
+// Output that an Async sender generates on its own: pending retransmissions first, then a request for the next Block if the
+// window is not full.
+void TransferSession::PollAsyncSenderOutput(OutputEvent & event)
+{
+    if (mAsyncRetransmitBlockNum < mAsyncRetransmitEndBlockNum)
+    {
+        const uint32_t blockNum        = mAsyncRetransmitBlockNum;
+        System::PacketBufferHandle msg = mUnackedBlocks[blockNum % kAsyncWindowSize].CloneData();
+        // Out of buffers: try again on the next call.
+        VerifyOrReturn(!msg.IsNull());
+
+        const bool isEof = (mState == TransferState::kAwaitingEOFAck && blockNum == mLastBlockNum);
+        MessageTypeData msgTypeData;
+        msgTypeData.ProtocolId  = Protocols::BDX::Id;
+        msgTypeData.MessageType = to_underlying(isEof ? MessageType::BlockEOF : MessageType::Block);
+
+        event = OutputEvent::MsgToSendEvent(msgTypeData, std::move(msg));
+        mAsyncRetransmitBlockNum++;
+        mNumBlocksRetransmitted++;
+        return;
+    }
+
+    if (mState == TransferState::kTransferInProgress && !mAsyncQueryPending &&
+        (mNextBlockNum - mNextUnackedBlockNum) < kAsyncWindowSize)
+    {
+        event              = OutputEvent(OutputEventType::kQueryReceived);
+        mAsyncQueryPending = true;
+        mLastQueryNum      = mNextBlockNum;
+    }
+}
+
+void TransferSession::StartAsyncRetransmission()
+{
+    mAsyncRetransmitBlockNum    = mNextUnackedBlockNum;
+    mAsyncRetransmitEndBlockNum = mNextBlockNum;
+}
+
+void TransferSession::ReleaseAckedBlocks(uint32_t nextUnackedBlockNum)
+{
+    for (; mNextUnackedBlockNum < nextUnackedBlockNum; mNextUnackedBlockNum++)
+    {
+        mUnackedBlocks[mNextUnackedBlockNum % kAsyncWindowSize] = nullptr;
+    }
+    mAsyncRetransmitBlockNum = std::max(mAsyncRetransmitBlockNum, mNextUnackedBlockNum);
+}
+
+bool TransferSession::IsAsyncSender() const
+{
+    return mRole == TransferRole::kSender && IsAsyncTransferInProgress();
+}
+
+bool TransferSession::IsAsyncTransferInProgress() const
+{
+    return (mState == TransferState::kTransferInProgress || mState == TransferState::kAwaitingEOFAck) &&
+        mControlMode == TransferControlFlags::kAsync;
+}
+
 void TransferSession::ResolveTransferControlOptions(const BitFlags<TransferControlFlags> & proposed)
 {
     // Must specify at least one synchronous option
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include <lib/core/CHIPConfig.h>
 #include <lib/core/CHIPError.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <system/SystemClock.h>
@@ -27,6 +28,17 @@ enum class TransferRole : uint8_t
 class DLL_EXPORT TransferSession
 {
 public:
+    /**
+     * Maximum number of Blocks the sender of an Async transfer may have sent without having them acknowledged.
+     */
+    static constexpr uint32_t kAsyncWindowSize = CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE;
+    static_assert(kAsyncWindowSize > 0, "CHIP_CONFIG_BDX_ASYNC_WINDOW_SIZE must be at least 1");
+
+    /**
+     * Time without any acknowledgement after which the sender of an Async transfer sends its unacknowledged Blocks again.
+     */
+    static constexpr System::Clock::Milliseconds32 kAsyncRetransmitTimeout{ CHIP_CONFIG_BDX_ASYNC_RETRANSMIT_TIMEOUT_MS };
+
     enum class OutputEventType : uint16_t
     {
         kNone = 0,
@@ -265,6 +277,12 @@ public:
      * @brief
      *   Prepare a Block message. The Block counter will be populated automatically.
      *
+     *   In Async mode the sender does not wait for a BlockAck between Blocks: a kQueryReceived event is emitted whenever fewer
+     *   than kAsyncWindowSize Blocks are unacknowledged, and the caller should answer it with the next Block. Unacknowledged
+     *   Blocks are retransmitted by the TransferSession itself (emitted as kMsgToSend) when the receiver reports a missing Block
+     *   or after kAsyncRetransmitTimeout without any acknowledgement, so PollOutput() must keep being called while
+     *   IsAsyncTransferInProgress() returns true.
+     *
      * @param inData Contains data for filling out the Block message
      *
      * @return CHIP_ERROR The result of the preparation of a Block message. May also indicate if the TransferSession object
@@ -276,6 +294,9 @@ public:
      * @brief
      *   Prepare a BlockAck message. The Block counter will be populated automatically.
      *
+     *   In Async mode a BlockAck acknowledges every Block up to and including the last one received, and does not need to be
+     *   followed by a BlockQuery.
+     *
      * @return CHIP_ERROR The result of the preparation of a BlockAck message. May also indicate if the TransferSession object
      *                    is unable to handle this request.
      */
@@ -323,12 +344,21 @@ public:
     uint32_t GetLastBlockNum() const { return mLastBlockNum; }
     uint32_t GetLastQueryNum() const { return mLastQueryNum; }
     size_t GetNumBytesProcessed() const { return mNumBytesProcessed; }
+    uint32_t GetNumBlocksRetransmitted() const { return mNumBlocksRetransmitted; }
     const uint8_t * GetFileDesignator(uint16_t & fileDesignatorLen) const
     {
         fileDesignatorLen = mTransferRequestData.FileDesLength;
         return mTransferRequestData.FileDesignator;
     }
 
+    /**
+     * @brief
+     *   Whether an accepted Async transfer is still in progress. While it is, PollOutput() must be called periodically (at least
+     *   every kAsyncRetransmitTimeout) even when no message is received, so that lost Blocks are retransmitted and a silent peer
+     *   is detected.
+     */
+    bool IsAsyncTransferInProgress() const;
+
     TransferSession();
 
 private:
@@ -358,6 +388,16 @@ private:
     void HandleBlockAck(System::PacketBufferHandle msgData);
     void HandleBlockAckEOF(System::PacketBufferHandle msgData);
 
+    // Async mode helpers
+    void HandleAsyncBlock(MessageType msgType, System::PacketBufferHandle msgData);
+    void HandleAsyncBlockAck(System::PacketBufferHandle msgData);
+    void PrepareAsyncBlockAck();
+    void PollAsyncSenderOutput(OutputEvent & event);
+    void StartAsyncRetransmission();
+    void ReleaseAckedBlocks(uint32_t nextUnackedBlockNum);
+    bool IsAsyncSender() const;
+    bool HasUnackedBlocks() const { return mNextUnackedBlockNum != mNextBlockNum; }
+
     /**
      * @brief
      *   Used when handling a TransferInit message. Determines if there are any compatible Transfer control modes between the two
@@ -383,7 +423,7 @@ private:
     uint16_t mMaxSupportedBlockSize = 0;
 
     // Used to govern transfer once it has been accepted
-    TransferControlFlags mControlMode;
+    TransferControlFlags mControlMode{}; ///< No mode (0) until one is chosen
     uint8_t mTransferVersion       = 0;
     uint64_t mStartOffset          = 0; ///< 0 represents no offset
     uint64_t mTransferLength       = 0; ///< 0 represents indefinite length
@@ -409,6 +449,20 @@ private:
     System::Clock::Timestamp mTimeoutStartTime = System::Clock::kZero;
     bool mShouldInitTimeoutStart               = true;
     bool mAwaitingResponse                     = false;
+
+    // Async mode, sender: copies of the Blocks sent but not acknowledged yet, indexed by block counter modulo the window
+    // size. The emitted messages cannot be kept instead since they are encrypted in place when sent.
+    System::PacketBufferHandle mUnackedBlocks[kAsyncWindowSize];
+    uint32_t mNextUnackedBlockNum                 = 0;
+    uint32_t mAsyncRetransmitBlockNum             = 0; ///< Next Block to retransmit, if below mAsyncRetransmitEndBlockNum
+    uint32_t mAsyncRetransmitEndBlockNum          = 0;
+    uint32_t mAsyncGapRetransmitBlockNum          = 0; ///< First unacknowledged Block when a gap was last reported
+    uint32_t mNumBlocksRetransmitted              = 0;
+    System::Clock::Timestamp mAsyncRetransmitTime = System::Clock::kZero;
+    bool mAsyncQueryPending                       = false; ///< kQueryReceived emitted and not answered by PrepareBlock() yet
+
+    // Async mode, receiver: whether the missing Block has already been reported for the current gap.
+    bool mAsyncGapReported = false;
 };
 
 } // namespace bdx
@@ -1,5 +1,9 @@
 #include <string.h>
 
+#include <algorithm>
+#include <deque>
+#include <vector>
+
 #include <pw_unit_test/framework.h>
 
 #include <lib/core/StringBuilderAdapters.h>
@@ -7,11 +11,13 @@
 #include <lib/support/BufferReader.h>
 #include <lib/support/CHIPMem.h>
 #include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
 #include <protocols/Protocols.h>
 #include <protocols/bdx/BdxMessages.h>
 #include <protocols/bdx/BdxTransferSession.h>
 #include <protocols/secure_channel/Constants.h>
 #include <protocols/secure_channel/StatusReport.h>
+#include <system/SystemClock.h>
 #include <system/SystemPacketBuffer.h>
 
 using namespace ::chip;
@@ -875,3 +881,375 @@ TEST_F(TestBdxTransferSession, TestRejectTransfer)
     // Reject the transfer with a status
     SendAndVerifyRejectMsg(outEvent, respondingSender, StatusCode::kResponderBusy, initiatingReceiver);
 }
+
+namespace {
+
+constexpr System::Clock::Timeout kAsyncTestTimeout = System::Clock::Seconds16(30);
+
+TransferControlFlags AsyncProposal()
+{
+    // A TransferInit has to offer a synchronous mode along with Async.
+    return static_cast<TransferControlFlags>(
+        BitFlags<TransferControlFlags>(TransferControlFlags::kAsync, TransferControlFlags::kReceiverDrive).Raw());
+}
+
+uint32_t ParseBlockCounter(const System::PacketBufferHandle & msg)
+{
+    DataBlock block;
+    EXPECT_EQ(block.Parse(msg.CloneData()), CHIP_NO_ERROR);
+    return block.BlockCounter;
+}
+
+/**
+ * Runs a whole transfer between an initiating receiver and a responding sender (as an OTA Requestor and Provider would) over a
+ * simulated link with a fixed one-way delay, optionally dropping a percentage of the Blocks sent (pseudo-randomly, but
+ * reproducibly). Both sides are driven the way a simple application would drive them. Time is simulated, so results do not
+ * depend on the machine running the test.
+ */
+class LoopbackTransfer
+{
+public:
+    static constexpr uint16_t kBlockSize = 64;
+
+    LoopbackTransfer(TransferControlFlags mode, uint32_t numBlocks, System::Clock::Milliseconds32 oneWayDelay,
+                     uint32_t blockLossPercent = 0) :
+        mMode(mode),
+        mNumBlocks(numBlocks), mOneWayDelay(oneWayDelay), mBlockLossPercent(blockLossPercent)
+    {
+        mImage.resize(static_cast<size_t>(numBlocks) * kBlockSize);
+        for (size_t i = 0; i < mImage.size(); i++)
+        {
+            mImage[i] = static_cast<uint8_t>(i * 7 + i / 256);
+        }
+    }
+
+    void Run()
+    {
+        BitFlags<TransferControlFlags> senderOpts(TransferControlFlags::kReceiverDrive);
+        if (mMode == TransferControlFlags::kAsync)
+        {
+            senderOpts.Set(TransferControlFlags::kAsync);
+        }
+        ASSERT_EQ(mSender.WaitForTransfer(TransferRole::kSender, senderOpts, kBlockSize, kAsyncTestTimeout), CHIP_NO_ERROR);
+
+        char fileDesignator[] = "image.bin";
+        TransferSession::TransferInitData initData;
+        initData.TransferCtlFlags = (mMode == TransferControlFlags::kAsync) ? AsyncProposal() : mMode;
+        initData.MaxBlockSize     = kBlockSize;
+        initData.FileDesignator   = reinterpret_cast<uint8_t *>(fileDesignator);
+        initData.FileDesLength    = static_cast<uint16_t>(strlen(fileDesignator));
+        ASSERT_EQ(mReceiver.StartTransfer(TransferRole::kReceiver, initData, kAsyncTestTimeout), CHIP_NO_ERROR);
+
+        // Bounded so that a broken state machine fails the test rather than hanging it.
+        for (uint32_t step = 0; step < 100 * mNumBlocks + 1000 && !mDone && !mFailed; step++)
+        {
+            Drain(mReceiver);
+            Drain(mSender);
+            if (mDone || mFailed)
+            {
+                break;
+            }
+
+            if (mLink.empty())
+            {
+                // Nothing in flight: let the retransmission timers run.
+                mNow += TransferSession::kAsyncRetransmitTimeout;
+                continue;
+            }
+
+            InFlightMessage message = std::move(mLink.front());
+            mLink.pop_front();
+            mNow = std::max(mNow, message.deliveryTime);
+
+            PayloadHeader header;
+            header.SetMessageType(message.typeData.ProtocolId, message.typeData.MessageType);
+            if (message.destination->HandleMessageReceived(header, std::move(message.msg), mNow) != CHIP_NO_ERROR)
+            {
+                mFailed = true;
+            }
+        }
+    }
+
+    bool Succeeded() const { return mDone && !mFailed && mReceivedBytes == mImage.size(); }
+    System::Clock::Timestamp GetElapsedTime() const { return mNow; }
+    uint32_t GetNumMessagesSent() const { return mNumMessagesSent; }
+    uint32_t GetNumBlocksRetransmitted() const { return mSender.GetNumBlocksRetransmitted(); }
+
+private:
+    struct InFlightMessage
+    {
+        System::Clock::Timestamp deliveryTime;
+        TransferSession * destination;
+        TransferSession::MessageTypeData typeData;
+        System::PacketBufferHandle msg;
+    };
+
+    void Drain(TransferSession & session)
+    {
+        TransferSession::OutputEvent event;
+        for (session.PollOutput(event, mNow); event.EventType != TransferSession::OutputEventType::kNone && !mFailed;
+             session.PollOutput(event, mNow))
+        {
+            switch (event.EventType)
+            {
+            case TransferSession::OutputEventType::kMsgToSend:
+                Send(session, event);
+                break;
+            case TransferSession::OutputEventType::kInitReceived: {
+                TransferSession::TransferAcceptData acceptData;
+                acceptData.ControlMode  = mMode;
+                acceptData.MaxBlockSize = kBlockSize;
+                acceptData.Length       = mImage.size();
+                Check(mSender.AcceptTransfer(acceptData));
+                break;
+            }
+            case TransferSession::OutputEventType::kAcceptReceived:
+                if (mMode != TransferControlFlags::kAsync)
+                {
+                    Check(mReceiver.PrepareBlockQuery());
+                }
+                break;
+            case TransferSession::OutputEventType::kQueryReceived: {
+                const uint32_t blockNum = mSender.GetNextBlockNum();
+                TransferSession::BlockData blockData;
+                blockData.Data   = mImage.data() + static_cast<size_t>(blockNum) * kBlockSize;
+                blockData.Length = kBlockSize;
+                blockData.IsEof  = (blockNum == mNumBlocks - 1);
+                Check(mSender.PrepareBlock(blockData));
+                break;
+            }
+            case TransferSession::OutputEventType::kBlockReceived:
+                if (event.blockdata.Length > mImage.size() - mReceivedBytes ||
+                    memcmp(event.blockdata.Data, mImage.data() + mReceivedBytes, event.blockdata.Length) != 0)
+                {
+                    mFailed = true;
+                    break;
+                }
+                mReceivedBytes += event.blockdata.Length;
+                if (event.blockdata.IsEof || mMode == TransferControlFlags::kAsync)
+                {
+                    Check(mReceiver.PrepareBlockAck());
+                }
+                else
+                {
+                    Check(mReceiver.PrepareBlockQuery());
+                }
+                break;
+            case TransferSession::OutputEventType::kAckEOFReceived:
+                mDone = true;
+                break;
+            default:
+                mFailed = true;
+                break;
+            }
+        }
+    }
+
+    void Send(TransferSession & source, TransferSession::OutputEvent & event)
+    {
+        mNumMessagesSent++;
+        if (&source == &mSender &&
+            (event.msgTypeData.HasMessageType(MessageType::Block) || event.msgTypeData.HasMessageType(MessageType::BlockEOF)))
+        {
+            mRandomState = mRandomState * 1103515245u + 12345u;
+            if (((mRandomState >> 16) % 100) < mBlockLossPercent)
+            {
+                return;
+            }
+        }
+
+        TransferSession * destination = (&source == &mSender) ? &mReceiver : &mSender;
+        mLink.push_back({ mNow + mOneWayDelay, destination, event.msgTypeData, std::move(event.MsgData) });
+    }
+
+    void Check(CHIP_ERROR err) { mFailed = mFailed || (err != CHIP_NO_ERROR); }
+
+    TransferControlFlags mMode;
+    uint32_t mNumBlocks;
+    System::Clock::Milliseconds32 mOneWayDelay;
+    uint32_t mBlockLossPercent;
+
+    TransferSession mSender;
+    TransferSession mReceiver;
+    std::vector<uint8_t> mImage;
+    std::deque<InFlightMessage> mLink;
+    System::Clock::Timestamp mNow = System::Clock::kZero;
+
+    size_t mReceivedBytes     = 0;
+    uint32_t mNumMessagesSent = 0;
+    uint32_t mRandomState     = 1;
+    bool mDone                = false;
+    bool mFailed              = false;
+};
+
+} // anonymous namespace
+
+// Test that an Async sender keeps up to kAsyncWindowSize Blocks in flight, and resends from the first missing Block once the
+// receiver reports a gap.
+TEST_F(TestBdxTransferSession, TestAsyncWindowAndGap)
+{
+    TransferSession::OutputEvent outEvent;
+    TransferSession initiatingReceiver;
+    TransferSession respondingSender;
+
+    uint8_t fakeData[32] = { 0 };
+    uint16_t blockSize   = sizeof(fakeData);
+
+    BitFlags<TransferControlFlags> senderOpts(TransferControlFlags::kAsync, TransferControlFlags::kReceiverDrive);
+    EXPECT_EQ(respondingSender.WaitForTransfer(TransferRole::kSender, senderOpts, blockSize, kAsyncTestTimeout), CHIP_NO_ERROR);
+
+    char testFileDes[9] = { "test.txt" };
+    TransferSession::TransferInitData initOptions;
+    initOptions.TransferCtlFlags = AsyncProposal();
+    initOptions.MaxBlockSize     = blockSize;
+    initOptions.FileDesLength    = static_cast<uint16_t>(strlen(testFileDes));
+    initOptions.FileDesignator   = reinterpret_cast<uint8_t *>(testFileDes);
+    EXPECT_EQ(initiatingReceiver.StartTransfer(TransferRole::kReceiver, initOptions, kAsyncTestTimeout), CHIP_NO_ERROR);
+
+    initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(outEvent, MessageType::ReceiveInit);
+    EXPECT_EQ(AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), respondingSender), CHIP_NO_ERROR);
+    respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kInitReceived);
+
+    // Both modes are common to the peers, so the responder picks one.
+    TransferSession::TransferAcceptData acceptData;
+    acceptData.ControlMode  = TransferControlFlags::kAsync;
+    acceptData.MaxBlockSize = blockSize;
+    EXPECT_EQ(respondingSender.AcceptTransfer(acceptData), CHIP_NO_ERROR);
+    respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(outEvent, MessageType::ReceiveAccept);
+    EXPECT_EQ(AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingReceiver), CHIP_NO_ERROR);
+    initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kAcceptReceived);
+    EXPECT_EQ(initiatingReceiver.GetControlMode(), TransferControlFlags::kAsync);
+    EXPECT_TRUE(initiatingReceiver.IsAsyncTransferInProgress());
+    EXPECT_TRUE(respondingSender.IsAsyncTransferInProgress());
+
+    // The sender asks for a whole window of Blocks without waiting for any acknowledgement.
+    TransferSession::BlockData blockData;
+    blockData.Data   = fakeData;
+    blockData.Length = blockSize;
+
+    System::PacketBufferHandle blocks[TransferSession::kAsyncWindowSize];
+    TransferSession::MessageTypeData blockTypeData;
+    for (uint32_t i = 0; i < TransferSession::kAsyncWindowSize; i++)
+    {
+        respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+        ASSERT_EQ(outEvent.EventType, TransferSession::OutputEventType::kQueryReceived);
+        fakeData[0] = static_cast<uint8_t>(i);
+        EXPECT_EQ(respondingSender.PrepareBlock(blockData), CHIP_NO_ERROR);
+        respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+        VerifyBdxMessageToSend(outEvent, MessageType::Block);
+        blockTypeData = outEvent.msgTypeData;
+        blocks[i]     = std::move(outEvent.MsgData);
+    }
+
+    // The window is full.
+    VerifyNoMoreOutput(respondingSender);
+    EXPECT_EQ(respondingSender.PrepareBlock(blockData), CHIP_ERROR_BUSY);
+
+    // Block 0 arrives and is acknowledged, which opens the window by one Block.
+    EXPECT_EQ(AttachHeaderAndSend(blockTypeData, std::move(blocks[0]), initiatingReceiver), CHIP_NO_ERROR);
+    initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kBlockReceived);
+    EXPECT_EQ(outEvent.blockdata.BlockCounter, 0u);
+    EXPECT_EQ(initiatingReceiver.PrepareBlockAck(), CHIP_NO_ERROR);
+    initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(outEvent, MessageType::BlockAck);
+    EXPECT_EQ(AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), respondingSender), CHIP_NO_ERROR);
+    respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kQueryReceived);
+    VerifyNoMoreOutput(respondingSender);
+
+    if (TransferSession::kAsyncWindowSize < 3)
+    {
+        return;
+    }
+
+    // Block 1 is lost: Block 2 is dropped by the receiver, which acknowledges Block 0 again. Further Blocks are dropped silently.
+    EXPECT_EQ(AttachHeaderAndSend(blockTypeData, std::move(blocks[2]), initiatingReceiver), CHIP_NO_ERROR);
+    initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(outEvent, MessageType::BlockAck);
+    TransferSession::MessageTypeData gapAckTypeData = outEvent.msgTypeData;
+    System::PacketBufferHandle gapAck               = std::move(outEvent.MsgData);
+    if (TransferSession::kAsyncWindowSize > 3)
+    {
+        EXPECT_EQ(AttachHeaderAndSend(blockTypeData, std::move(blocks[3]), initiatingReceiver), CHIP_NO_ERROR);
+        VerifyNoMoreOutput(initiatingReceiver);
+    }
+
+    // The sender resends everything from Block 1, before asking for more data.
+    EXPECT_EQ(AttachHeaderAndSend(gapAckTypeData, std::move(gapAck), respondingSender), CHIP_NO_ERROR);
+    respondingSender.PollOutput(outEvent, kNoAdvanceTime);
+    VerifyBdxMessageToSend(outEvent, MessageType::Block);
+    EXPECT_EQ(ParseBlockCounter(outEvent.MsgData), 1u);
+    EXPECT_EQ(respondingSender.GetNumBlocksRetransmitted(), 1u);
+
+    EXPECT_EQ(AttachHeaderAndSend(outEvent.msgTypeData, std::move(outEvent.MsgData), initiatingReceiver), CHIP_NO_ERROR);
+    initiatingReceiver.PollOutput(outEvent, kNoAdvanceTime);
+    EXPECT_EQ(outEvent.EventType, TransferSession::OutputEventType::kBlockReceived);
+    EXPECT_EQ(outEvent.blockdata.BlockCounter, 1u);
+    EXPECT_EQ(outEvent.blockdata.Data[0], 1u);
+}
+
+// Test a complete Async transfer over a lossless link.
+TEST_F(TestBdxTransferSession, TestAsyncTransfer)
+{
+    LoopbackTransfer transfer(TransferControlFlags::kAsync, 100, System::Clock::Milliseconds32(10));
+    transfer.Run();
+    EXPECT_TRUE(transfer.Succeeded());
+    EXPECT_EQ(transfer.GetNumBlocksRetransmitted(), 0u);
+}
+
+// Test that an Async transfer completes when Blocks are lost.
+TEST_F(TestBdxTransferSession, TestAsyncTransferWithLostBlocks)
+{
+    for (uint32_t blockLossPercent : { 5u, 20u, 50u })
+    {
+        LoopbackTransfer transfer(TransferControlFlags::kAsync, 100, System::Clock::Milliseconds32(10), blockLossPercent);
+        transfer.Run();
+        EXPECT_TRUE(transfer.Succeeded());
+        EXPECT_GT(transfer.GetNumBlocksRetransmitted(), 0u);
+    }
+}
+
+// Compares the time a lock-step (Receiver Drive) and an Async transfer take over a link with a 20 ms one-way delay. The time
+// is simulated; the wall-clock time, which measures the cost of the state machines themselves, is only logged.
+TEST_F(TestBdxTransferSession, TestAsyncTransferBenchmark)
+{
+    constexpr uint32_t kNumBlocks                      = 1000;
+    constexpr System::Clock::Milliseconds32 kLinkDelay = System::Clock::Milliseconds32(20);
+
+    struct
+    {
+        TransferControlFlags mode;
+        const char * name;
+        System::Clock::Timestamp elapsed;
+    } runs[] = {
+        { TransferControlFlags::kReceiverDrive, "receiver drive", System::Clock::kZero },
+        { TransferControlFlags::kAsync, "async", System::Clock::kZero },
+    };
+
+    for (auto & run : runs)
+    {
+        LoopbackTransfer transfer(run.mode, kNumBlocks, kLinkDelay);
+
+        uint64_t start = System::SystemClock().GetMonotonicMicroseconds64().count();
+        transfer.Run();
+        uint64_t wallUs = System::SystemClock().GetMonotonicMicroseconds64().count() - start;
+
+        EXPECT_TRUE(transfer.Succeeded());
+        run.elapsed = transfer.GetElapsedTime();
+
+        uint64_t elapsedMs = std::chrono::duration_cast<System::Clock::Milliseconds64>(run.elapsed).count();
+        ChipLogProgress(BDX, "BDX %s: %u blocks of %u bytes in %llu ms simulated (%llu B/s), %u messages, %llu us wall clock",
+                        run.name, static_cast<unsigned>(kNumBlocks), static_cast<unsigned>(LoopbackTransfer::kBlockSize),
+                        static_cast<unsigned long long>(elapsedMs),
+                        static_cast<unsigned long long>(kNumBlocks * LoopbackTransfer::kBlockSize * 1000ull /
+                                                        (elapsedMs > 0 ? elapsedMs : 1)),
+                        static_cast<unsigned>(transfer.GetNumMessagesSent()), static_cast<unsigned long long>(wallUs));
+    }
+
+    EXPECT_LT(runs[1].elapsed, runs[0].elapsed);
+}
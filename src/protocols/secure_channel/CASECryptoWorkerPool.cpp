@@ -0,0 +1,220 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <protocols/secure_channel/CASECryptoWorkerPool.h>
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/logging/CHIPLogging.h>
+#include <platform/PlatformManager.h>
+#include <system/SystemError.h>
+
+namespace chip {
+
+CASECryptoWorkerPool & CASECryptoWorkerPool::Instance()
+{
+    static CASECryptoWorkerPool sInstance;
+    return sInstance;
+}
+
+CHIP_ERROR CASECryptoWorkerPool::ScheduleWork(WorkFunct work, intptr_t arg)
+{
+    VerifyOrReturnError(work != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    // A slot is always free while mInFlight is below the bound, since jobs release their slot first.
+    Job * job = (mInFlight.load() < kMaxInFlight) ? FindFreeJob() : nullptr;
+    if (job == nullptr)
+    {
+        mRejected++;
+        ChipLogProgress(SecureChannel, "CASE crypto worker pool is full (%u jobs in flight)", static_cast<unsigned>(kMaxInFlight));
+        return CHIP_ERROR_BUSY;
+    }
+
+    job->work = work;
+    job->arg  = arg;
+    job->inUse.store(true, std::memory_order_relaxed);
+
+    UpdateHighWatermark(mInFlightHighWatermark, ++mInFlight);
+    UpdateHighWatermark(mQueuedHighWatermark, ++mQueued);
+
+    CHIP_ERROR err = Dispatch(*job);
+    if (err != CHIP_NO_ERROR)
+    {
+        mQueued--;
+        ReleaseJob(*job);
+        return err;
+    }
+
+    mScheduled++;
+    return CHIP_NO_ERROR;
+}
+
+CASECryptoWorkerPool::Stats CASECryptoWorkerPool::GetStats() const
+{
+    Stats stats;
+    stats.inFlight              = mInFlight.load();
+    stats.inFlightHighWatermark = mInFlightHighWatermark.load();
+    stats.queued                = mQueued.load();
+    stats.queuedHighWatermark   = mQueuedHighWatermark.load();
+    stats.scheduled             = mScheduled.load();
+    stats.rejected              = mRejected.load();
+    return stats;
+}
+
+void CASECryptoWorkerPool::ResetStats()
+{
+    mInFlightHighWatermark.store(mInFlight.load());
+    mQueuedHighWatermark.store(mQueued.load());
+    mScheduled.store(0);
+    mRejected.store(0);
+}
+
+void CASECryptoWorkerPool::UpdateHighWatermark(std::atomic<uint32_t> & watermark, uint32_t value)
+{
+    // Depths only grow on the Matter thread, so a plain compare is enough.
+    if (value > watermark.load())
+    {
+        watermark.store(value);
+    }
+}
+
+CASECryptoWorkerPool::Job * CASECryptoWorkerPool::FindFreeJob()
+{
+    for (auto & job : mJobs)
+    {
+        if (!job.inUse.load(std::memory_order_acquire))
+        {
+            return &job;
+        }
+    }
+    return nullptr;
+}
+
+void CASECryptoWorkerPool::RunJob(Job & job)
+{
+    mQueued--;
+    job.work(job.arg);
+    ReleaseJob(job);
+}
+
+void CASECryptoWorkerPool::ReleaseJob(Job & job)
+{
+    job.inUse.store(false, std::memory_order_release);
+    mInFlight--;
+}
+
+#if CHIP_CASE_CRYPTO_WORKER_POOL_USE_THREADS
+
+CHIP_ERROR CASECryptoWorkerPool::Dispatch(Job & job)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    pthread_mutex_lock(&mLock);
+
+    // Start the worker threads on first use (or first use after Shutdown).
+    while (mThreadCount < kWorkerThreads)
+    {
+        int ret = pthread_create(&mThreads[mThreadCount], nullptr, WorkerMain, this);
+        if (ret != 0)
+        {
+            ChipLogError(SecureChannel, "Failed to start CASE crypto worker thread: %d", ret);
+            // Carry on with the threads that did start, if any.
+            err = (mThreadCount == 0) ? CHIP_ERROR_POSIX(ret) : CHIP_NO_ERROR;
+            break;
+        }
+        mThreadCount++;
+    }
+
+    if (err == CHIP_NO_ERROR)
+    {
+        // Cannot overflow: the run queue never holds more than the in-flight jobs.
+        mRunQueue[(mRunQueueHead + mRunQueueCount) % kMaxInFlight] = &job;
+        mRunQueueCount++;
+        pthread_cond_signal(&mCondition);
+    }
+
+    pthread_mutex_unlock(&mLock);
+
+    return err;
+}
+
+void * CASECryptoWorkerPool::WorkerMain(void * context)
+{
+    auto * pool = static_cast<CASECryptoWorkerPool *>(context);
+
+    pthread_mutex_lock(&pool->mLock);
+    while (true)
+    {
+        while (pool->mRunQueueCount == 0 && !pool->mStopping)
+        {
+            pthread_cond_wait(&pool->mCondition, &pool->mLock);
+        }
+
+        // Stopping and drained.
+        if (pool->mRunQueueCount == 0)
+        {
+            break;
+        }
+
+        Job * job           = pool->mRunQueue[pool->mRunQueueHead];
+        pool->mRunQueueHead = (pool->mRunQueueHead + 1) % kMaxInFlight;
+        pool->mRunQueueCount--;
+
+        pthread_mutex_unlock(&pool->mLock);
+        pool->RunJob(*job);
+        pthread_mutex_lock(&pool->mLock);
+    }
+    pthread_mutex_unlock(&pool->mLock);
+
+    return nullptr;
+}
+
+void CASECryptoWorkerPool::Shutdown()
+{
+    pthread_mutex_lock(&mLock);
+    mStopping          = true;
+    size_t threadCount = mThreadCount;
+    pthread_cond_broadcast(&mCondition);
+    pthread_mutex_unlock(&mLock);
+
+    for (size_t i = 0; i < threadCount; i++)
+    {
+        pthread_join(mThreads[i], nullptr);
+    }
+
+    pthread_mutex_lock(&mLock);
+    mThreadCount = 0;
+    mStopping    = false;
+    pthread_mutex_unlock(&mLock);
+}
+
+#else // CHIP_CASE_CRYPTO_WORKER_POOL_USE_THREADS
+
+void CASECryptoWorkerPool::HandleJob(intptr_t arg)
+{
+    Instance().RunJob(*reinterpret_cast<Job *>(arg));
+}
+
+CHIP_ERROR CASECryptoWorkerPool::Dispatch(Job & job)
+{
+    return DeviceLayer::PlatformMgr().ScheduleBackgroundWork(HandleJob, reinterpret_cast<intptr_t>(&job));
+}
+
+void CASECryptoWorkerPool::Shutdown() {}
+
+#endif // CHIP_CASE_CRYPTO_WORKER_POOL_USE_THREADS
+
+} // namespace chip
@@ -0,0 +1,139 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Worker pool running the P-256 operations of CASE handshakes off the Matter thread.
+ */
+
+#pragma once
+
+#include <atomic>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <lib/core/CHIPConfig.h>
+#include <lib/core/CHIPError.h>
+#include <system/SystemConfig.h>
+
+#if CHIP_CONFIG_CASE_CRYPTO_WORKER_THREADS > 0 && CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#define CHIP_CASE_CRYPTO_WORKER_POOL_USE_THREADS 1
+#include <pthread.h>
+#else
+#define CHIP_CASE_CRYPTO_WORKER_POOL_USE_THREADS 0
+#endif
+
+namespace chip {
+
+/**
+ * Runs the ECDH/ECDSA work of CASE handshakes (see CASESession::WorkHelper) off the Matter thread.
+ *
+ * Jobs are executed by CHIP_CONFIG_CASE_CRYPTO_WORKER_THREADS dedicated threads, started on demand, or,
+ * when no threads are configured, handed to PlatformManager::ScheduleBackgroundWork.
+ *
+ * At most CHIP_CONFIG_CASE_CRYPTO_MAX_IN_FLIGHT jobs may be queued or running at once, so that a burst
+ * of handshakes cannot build an unbounded backlog of expensive work; callers decide what to do when the
+ * pool is full. Queue-depth statistics are kept for tuning the bound and the thread count.
+ *
+ * ScheduleWork() and Shutdown() must be called from the Matter thread. Jobs must not touch Matter stack
+ * state and should post their results back with PlatformManager::ScheduleWork.
+ */
+class CASECryptoWorkerPool
+{
+public:
+    typedef void (*WorkFunct)(intptr_t arg);
+
+    struct Stats
+    {
+        uint32_t inFlight;              ///< Jobs accepted and not yet completed.
+        uint32_t inFlightHighWatermark; ///< Largest inFlight value observed.
+        uint32_t queued;                ///< Jobs accepted and not yet started.
+        uint32_t queuedHighWatermark;   ///< Largest queued value observed.
+        uint32_t scheduled;             ///< Total jobs accepted.
+        uint32_t rejected;              ///< Total jobs refused because the pool was full.
+    };
+
+    static constexpr size_t kMaxInFlight = CHIP_CONFIG_CASE_CRYPTO_MAX_IN_FLIGHT;
+
+    static CASECryptoWorkerPool & Instance();
+
+    /**
+     * Run `work(arg)` on the pool.
+     *
+     * @retval CHIP_ERROR_BUSY  if kMaxInFlight jobs are already queued or running.
+     */
+    CHIP_ERROR ScheduleWork(WorkFunct work, intptr_t arg);
+
+    /**
+     * Stop the worker threads, if any, once every queued job has run. Threads are started again by
+     * the next ScheduleWork() call.
+     */
+    void Shutdown();
+
+    Stats GetStats() const;
+
+    /**
+     * Reset the totals, and the high watermarks to the current depths.
+     */
+    void ResetStats();
+
+private:
+    struct Job
+    {
+        WorkFunct work = nullptr;
+        intptr_t arg   = 0;
+        std::atomic<bool> inUse{ false };
+    };
+
+    static void UpdateHighWatermark(std::atomic<uint32_t> & watermark, uint32_t value);
+
+    Job * FindFreeJob();
+    CHIP_ERROR Dispatch(Job & job);
+    void RunJob(Job & job);
+    void ReleaseJob(Job & job);
+
+    Job mJobs[kMaxInFlight];
+
+    std::atomic<uint32_t> mInFlight{ 0 };
+    std::atomic<uint32_t> mInFlightHighWatermark{ 0 };
+    std::atomic<uint32_t> mQueued{ 0 };
+    std::atomic<uint32_t> mQueuedHighWatermark{ 0 };
+    std::atomic<uint32_t> mScheduled{ 0 };
+    std::atomic<uint32_t> mRejected{ 0 };
+
+#if !CHIP_CASE_CRYPTO_WORKER_POOL_USE_THREADS
+    static void HandleJob(intptr_t arg);
+#else
+    static constexpr size_t kWorkerThreads = CHIP_CONFIG_CASE_CRYPTO_WORKER_THREADS;
+
+    static void * WorkerMain(void * context);
+
+    // Protects the run queue and the thread bookkeeping below.
+    pthread_mutex_t mLock     = PTHREAD_MUTEX_INITIALIZER;
+    pthread_cond_t mCondition = PTHREAD_COND_INITIALIZER;
+
+    Job * mRunQueue[kMaxInFlight];
+    size_t mRunQueueHead  = 0;
+    size_t mRunQueueCount = 0;
+
+    pthread_t mThreads[kWorkerThreads];
+    size_t mThreadCount = 0;
+    bool mStopping      = false;
+#endif // CHIP_CASE_CRYPTO_WORKER_POOL_USE_THREADS
+};
+
+} // namespace chip
@@ -29,19 +29,17 @@ namespace chip {
 
 using namespace chip::Crypto;
 
-CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & initiatorRandom, const ByteSpan & rootPubKey,
-                                     FabricId fabricId, NodeId nodeId, MutableByteSpan & outDestinationId)
+namespace {
+
+constexpr size_t kDestinationMessageLen = kSigmaParamRandomNumberSize + kP256_PublicKey_Length + sizeof(FabricId) + sizeof(NodeId);
+
+CHIP_ERROR EncodeDestinationMessage(const ByteSpan & initiatorRandom, const ByteSpan & rootPubKey, FabricId fabricId,
+                                    NodeId nodeId, MutableByteSpan & outMessage)
 {
-    VerifyOrReturnError(ipk.size() == kIPKSize, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(initiatorRandom.size() == kSigmaParamRandomNumberSize, CHIP_ERROR_INVALID_ARGUMENT);
     VerifyOrReturnError(rootPubKey.size() == kP256_PublicKey_Length, CHIP_ERROR_INVALID_ARGUMENT);
-    VerifyOrReturnError(outDestinationId.size() >= kSHA256_Hash_Length, CHIP_ERROR_INVALID_ARGUMENT);
 
-    constexpr size_t kDestinationMessageLen =
-        kSigmaParamRandomNumberSize + kP256_PublicKey_Length + sizeof(FabricId) + sizeof(NodeId);
-    uint8_t destinationMessage[kDestinationMessageLen];
-
-    Encoding::LittleEndian::BufferWriter bbuf(destinationMessage, sizeof(destinationMessage));
+    Encoding::LittleEndian::BufferWriter bbuf(outMessage);
     bbuf.Put(initiatorRandom.data(), initiatorRandom.size());
     bbuf.Put(rootPubKey.data(), rootPubKey.size());
     bbuf.Put64(fabricId);
@@ -49,10 +47,26 @@ CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & init
 
     size_t written = 0;
     VerifyOrReturnError(bbuf.Fit(written), CHIP_ERROR_BUFFER_TOO_SMALL);
+    outMessage.reduce_size(written);
+
+    return CHIP_NO_ERROR;
+}
+
+} // namespace
+
+CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & initiatorRandom, const ByteSpan & rootPubKey,
+                                     FabricId fabricId, NodeId nodeId, MutableByteSpan & outDestinationId)
+{
+    VerifyOrReturnError(ipk.size() == kIPKSize, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(outDestinationId.size() >= kSHA256_Hash_Length, CHIP_ERROR_INVALID_ARGUMENT);
+
+    uint8_t destinationMessage[kDestinationMessageLen];
+    MutableByteSpan destinationMessageSpan(destinationMessage);
+    ReturnErrorOnFailure(EncodeDestinationMessage(initiatorRandom, rootPubKey, fabricId, nodeId, destinationMessageSpan));
 
     HMAC_sha hmac;
-    CHIP_ERROR err =
-        hmac.HMAC_SHA256(ipk.data(), ipk.size(), bbuf.Buffer(), written, outDestinationId.data(), outDestinationId.size());
+    CHIP_ERROR err = hmac.HMAC_SHA256(ipk.data(), ipk.size(), destinationMessageSpan.data(), destinationMessageSpan.size(),
+                                      outDestinationId.data(), outDestinationId.size());
 
     if (err == CHIP_NO_ERROR)
     {
@@ -62,4 +76,83 @@ CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & init
     return err;
 }
 
+CHIP_ERROR CASEDestinationIdCache::GenerateDestinationId(FabricIndex fabricIndex, const ByteSpan & ipk,
+                                                         const ByteSpan & initiatorRandom, const ByteSpan & rootPubKey,
+                                                         FabricId fabricId, NodeId nodeId, MutableByteSpan & outDestinationId)
+{
+    VerifyOrReturnError(ipk.size() == kIPKSize, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(outDestinationId.size() >= kSHA256_Hash_Length, CHIP_ERROR_INVALID_ARGUMENT);
+
+    Entry * entry = FindOrCreateEntry(fabricIndex, ipk);
+    if (entry == nullptr)
+    {
+        // Caching disabled or out of memory for the HMAC state: fall back to the one-shot computation.
+        return GenerateCaseDestinationId(ipk, initiatorRandom, rootPubKey, fabricId, nodeId, outDestinationId);
+    }
+
+    uint8_t destinationMessage[kDestinationMessageLen];
+    MutableByteSpan destinationMessageSpan(destinationMessage);
+    ReturnErrorOnFailure(EncodeDestinationMessage(initiatorRandom, rootPubKey, fabricId, nodeId, destinationMessageSpan));
+
+    return entry->hmacKey.Compute(destinationMessageSpan, outDestinationId);
+}
+
+CASEDestinationIdCache::Entry * CASEDestinationIdCache::FindOrCreateEntry(FabricIndex fabricIndex, const ByteSpan & ipk)
+{
+    VerifyOrReturnValue(kCacheSize > 0, nullptr);
+
+    Entry * victim = nullptr;
+    for (auto & entry : mEntries)
+    {
+        if (entry.fabricIndex == fabricIndex && IsBufferContentEqualConstantTime(entry.ipk, ipk.data(), kIPKSize))
+        {
+            entry.lastUsed = ++mUseCounter;
+            return &entry;
+        }
+
+        // Prefer a free entry, then the least recently used one.
+        if (victim == nullptr || (victim->fabricIndex != kUndefinedFabricIndex &&
+                                  (entry.fabricIndex == kUndefinedFabricIndex || entry.lastUsed < victim->lastUsed)))
+        {
+            victim = &entry;
+        }
+    }
+
+    ClearEntry(*victim);
+    VerifyOrReturnValue(victim->hmacKey.Init(ipk) == CHIP_NO_ERROR, nullptr);
+    victim->fabricIndex = fabricIndex;
+    memcpy(victim->ipk, ipk.data(), kIPKSize);
+    victim->lastUsed = ++mUseCounter;
+
+    return victim;
+}
+
+void CASEDestinationIdCache::Invalidate(FabricIndex fabricIndex)
+{
+    for (auto & entry : mEntries)
+    {
+        if (entry.fabricIndex == fabricIndex)
+        {
+            ClearEntry(entry);
+        }
+    }
+}
+
+void CASEDestinationIdCache::Clear()
+{
+    for (auto & entry : mEntries)
+    {
+        ClearEntry(entry);
+    }
+    mUseCounter = 0;
+}
+
+void CASEDestinationIdCache::ClearEntry(Entry & entry)
+{
+    entry.hmacKey.Release();
+    ClearSecretData(entry.ipk);
+    entry.fabricIndex = kUndefinedFabricIndex;
+    entry.lastUsed    = 0;
+}
+
 } // namespace chip
@@ -34,4 +34,62 @@ inline constexpr uint16_t kIPKSize                    = Crypto::CHIP_CRYPTO_SYMM
 CHIP_ERROR GenerateCaseDestinationId(const ByteSpan & ipk, const ByteSpan & initiatorRandom, const ByteSpan & rootPubKey,
                                      FabricId fabricId, NodeId nodeId, MutableByteSpan & outDestinationId);
 
+/**
+ * Keeps the HMAC key state of recently used IPKs, so that a CASE responder matching a Sigma1
+ * destination identifier against every local fabric does not redo the HMAC key setup (hashing
+ * the inner and outer pads) for each candidate.
+ *
+ * Entries are looked up by fabric index and IPK value, so a changed IPK in the GroupDataProvider
+ * simply misses and replaces the stale entry. Entries of removed or updated fabrics are dropped
+ * when the cache is registered as a FabricTable delegate.
+ */
+class CASEDestinationIdCache : public FabricTable::Delegate
+{
+public:
+    static constexpr size_t kCacheSize = CHIP_CONFIG_CASE_DESTINATION_ID_CACHE_SIZE;
+
+    CASEDestinationIdCache() = default;
+    ~CASEDestinationIdCache() override { Clear(); }
+
+    CASEDestinationIdCache(const CASEDestinationIdCache &)             = delete;
+    CASEDestinationIdCache & operator=(const CASEDestinationIdCache &) = delete;
+
+    /**
+     * Same as GenerateCaseDestinationId(), reusing the HMAC key state cached for `ipk` of fabric
+     * `fabricIndex`, or creating it if needed.
+     */
+    CHIP_ERROR GenerateDestinationId(FabricIndex fabricIndex, const ByteSpan & ipk, const ByteSpan & initiatorRandom,
+                                     const ByteSpan & rootPubKey, FabricId fabricId, NodeId nodeId,
+                                     MutableByteSpan & outDestinationId);
+
+    /**
+     * Drop the entries of the given fabric.
+     */
+    void Invalidate(FabricIndex fabricIndex);
+
+    /**
+     * Drop every entry.
+     */
+    void Clear();
+
+    //// FabricTable::Delegate Implementation ////
+    void OnFabricRemoved(const FabricTable & fabricTable, FabricIndex fabricIndex) override { Invalidate(fabricIndex); }
+    void OnFabricUpdated(const FabricTable & fabricTable, FabricIndex fabricIndex) override { Invalidate(fabricIndex); }
+
+private:
+    struct Entry
+    {
+        FabricIndex fabricIndex = kUndefinedFabricIndex;
+        uint8_t ipk[kIPKSize]   = {};
+        uint32_t lastUsed       = 0;
+        Crypto::HmacSha256PrecomputedKey hmacKey;
+    };
+
+    Entry * FindOrCreateEntry(FabricIndex fabricIndex, const ByteSpan & ipk);
+    static void ClearEntry(Entry & entry);
+
+    Entry mEntries[kCacheSize > 0 ? kCacheSize : 1];
+    uint32_t mUseCounter = 0;
+};
+
 } // namespace chip
@@ -47,8 +47,23 @@ CHIP_ERROR CASEServer::ListenForSessionEstablishment(Messaging::ExchangeManager
     mExchangeManager           = exchangeManager;
     mGroupDataProvider         = responderGroupDataProvider;
 
-    // Set up the group state provider that persists across all handshakes.
+    // Set up the group state provider and destination identifier cache that persist across all handshakes.
     GetSession().SetGroupDataProvider(mGroupDataProvider);
+    GetSession().SetDestinationIdCache(&mDestinationIdCache);
+    if (mDestinationIdCacheFabrics != mFabrics)
+    {
+        if (mDestinationIdCacheFabrics != nullptr)
+        {
+            mDestinationIdCacheFabrics->RemoveFabricDelegate(&mDestinationIdCache);
+            mDestinationIdCacheFabrics = nullptr;
+        }
+        mDestinationIdCache.Clear();
+        if (mFabrics != nullptr)
+        {
+            ReturnErrorOnFailure(mFabrics->AddFabricDelegate(&mDestinationIdCache));
+            mDestinationIdCacheFabrics = mFabrics;
+        }
+    }
 
     ChipLogProgress(Inet, "CASE Server enabling CASE session setups");
     TEMPORARY_RETURN_IGNORED mExchangeManager->RegisterUnsolicitedMessageHandlerForType(
@@ -49,6 +49,13 @@ public:
             mExchangeManager = nullptr;
         }
 
+        if (mDestinationIdCacheFabrics != nullptr)
+        {
+            mDestinationIdCacheFabrics->RemoveFabricDelegate(&mDestinationIdCache);
+            mDestinationIdCacheFabrics = nullptr;
+        }
+        mDestinationIdCache.Clear();
+
         GetSession().Clear();
         mPinnedSecureSession.ClearValue();
     }
@@ -97,6 +104,11 @@ private:
     FabricTable * mFabrics                              = nullptr;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
 
+    // IPK HMAC states for matching Sigma1 destination identifiers, kept across handshakes, and the
+    // fabric table it is registered with as a delegate.
+    CASEDestinationIdCache mDestinationIdCache;
+    FabricTable * mDestinationIdCacheFabrics = nullptr;
+
     CHIP_ERROR InitCASEHandshake(Messaging::ExchangeContext * ec);
 
     /*
@@ -41,6 +41,7 @@
 #include <messaging/SessionParameters.h>
 #include <platform/PlatformManager.h>
 #include <protocols/Protocols.h>
+#include <protocols/secure_channel/CASECryptoWorkerPool.h>
 #include <protocols/secure_channel/CASEDestinationId.h>
 #include <protocols/secure_channel/PairingSession.h>
 #include <protocols/secure_channel/SessionResumptionStorage.h>
@@ -153,6 +154,9 @@ static constexpr ExchangeContext::Timeout kExpectedLowProcessingTime    = System
 static constexpr ExchangeContext::Timeout kExpectedSigma1ProcessingTime = kExpectedLowProcessingTime;
 static constexpr ExchangeContext::Timeout kExpectedHighProcessingTime   = System::Clock::Seconds16(30);
 
+// Minimum wait time advertised to an initiator when the CASE crypto worker pool has no room for its Sigma2.
+static constexpr System::Clock::Milliseconds16 kCryptoWorkerPoolBusyWaitTime = System::Clock::Milliseconds16(5000);
+
 // Helper for managing a session's outstanding work.
 // Holds work data which is provided to a scheduled work callback (standalone),
 // then (if not canceled) to a scheduled after work callback (on the session).
@@ -160,7 +164,7 @@ template <class DATA>
 class CASESession::WorkHelper
 {
 public:
-    // Work callback, processed in the background via `PlatformManager::ScheduleBackgroundWork`.
+    // Work callback, processed in the background via `CASECryptoWorkerPool::ScheduleWork`.
     // This is a non-member function which does not use the associated session.
     // The return value is passed to the after work callback (called afterward).
     // Set `cancel` to true if calling the after work callback is not necessary.
@@ -219,12 +223,13 @@ public:
 
     // Schedule the work for later execution.
     // If lifetime is managed, the helper shares management while work is outstanding.
+    // Returns CHIP_ERROR_BUSY if the crypto worker pool is at its in-flight bound.
     CHIP_ERROR ScheduleWork()
     {
         VerifyOrReturnError(mSession && mWorkCallback && mAfterWorkCallback, CHIP_ERROR_INCORRECT_STATE);
         // Hold strong ptr while work is outstanding
         mStrongPtr  = mWeakPtr.lock(); // set in `Create`
-        auto status = DeviceLayer::PlatformMgr().ScheduleBackgroundWork(WorkHandler, reinterpret_cast<intptr_t>(this));
+        auto status = CASECryptoWorkerPool::Instance().ScheduleWork(WorkHandler, reinterpret_cast<intptr_t>(this));
         if (status != CHIP_NO_ERROR)
         {
             // Release strong ptr since scheduling failed.
@@ -377,6 +382,11 @@ void CASESession::Clear()
 {
     MATTER_TRACE_SCOPE("Clear", "CASESession");
     // Cancel any outstanding work.
+    if (mSendSigma2Helper)
+    {
+        mSendSigma2Helper->CancelWork();
+        mSendSigma2Helper.reset();
+    }
     if (mSendSigma3Helper)
     {
         mSendSigma3Helper->CancelWork();
@@ -900,16 +910,8 @@ CHIP_ERROR CASESession::HandleSigma1_and_SendSigma2(System::PacketBufferHandle &
     {
     case Step::kSendSigma2: {
 
-        System::PacketBufferHandle msgR2;
-        EncodeSigma2Inputs encodeSigma2;
-
-        SuccessOrExit(err = PrepareSigma2(encodeSigma2));
-        SuccessOrExit(err = EncodeSigma2(msgR2, encodeSigma2));
-
-        MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2);
-        SuccessOrExitAction(err = SendSigma2(std::move(msgR2)), MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2, err));
-
-        mDelegate->OnSessionEstablishmentStarted();
+        // Sigma2 is sent by SendSigma2c() once the worker pool has done the P-256 operations.
+        SuccessOrExit(err = SendSigma2a());
         break;
     }
     case Step::kSendSigma2Resume: {
@@ -937,6 +939,16 @@ exit:
         SendStatusReport(mExchangeCtxt, kProtocolCodeNoSharedRoot);
         mState = State::kInitialized;
     }
+    else if (err == CHIP_ERROR_BUSY)
+    {
+        // The crypto worker pool is full; have the initiator retry later rather than fail its handshake.
+        System::PacketBufferHandle busy = StatusReport::MakeBusyStatusReportMessage(kCryptoWorkerPoolBusyWaitTime);
+        if (!busy.IsNull())
+        {
+            RETURN_SAFELY_IGNORED mExchangeCtxt.Value()->SendMessage(MsgType::StatusReport, std::move(busy));
+        }
+        mState = State::kInitialized;
+    }
     else if (err != CHIP_NO_ERROR)
     {
         SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
@@ -977,8 +989,16 @@ CHIP_ERROR CASESession::FindLocalNodeFromDestinationId(const ByteSpan & destinat
             MutableByteSpan candidateDestinationIdSpan(candidateDestinationId);
             ByteSpan candidateIpkSpan(ipkKeySet.epoch_keys[keyIdx].key);
 
-            err = GenerateCaseDestinationId(candidateIpkSpan, initiatorRandom, rootPubKeySpan, fabricId, nodeId,
-                                            candidateDestinationIdSpan);
+            if (mDestinationIdCache != nullptr)
+            {
+                err = mDestinationIdCache->GenerateDestinationId(fabricInfo.GetFabricIndex(), candidateIpkSpan, initiatorRandom,
+                                                                 rootPubKeySpan, fabricId, nodeId, candidateDestinationIdSpan);
+            }
+            else
+            {
+                err = GenerateCaseDestinationId(candidateIpkSpan, initiatorRandom, rootPubKeySpan, fabricId, nodeId,
+                                                candidateDestinationIdSpan);
+            }
             if ((err == CHIP_NO_ERROR) && (candidateDestinationIdSpan.data_equal(destinationId)))
             {
                 // Found a match, stop working, cache IPK, update local fabric context
@@ -1166,39 +1186,11 @@ CHIP_ERROR CASESession::SendSigma2Resume(System::PacketBufferHandle && msgR2Resu
     return CHIP_NO_ERROR;
 }
 
-CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
+CHIP_ERROR CASESession::EncryptSigma2TBEData(EncodeSigma2Inputs & outSigma2Data, MutableByteSpan & nocCert,
+                                             MutableByteSpan & icaCert, P256ECDSASignature & tbsData2Signature)
 {
-
-    MATTER_TRACE_SCOPE("PrepareSigma2", "CASESession");
-
-    VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
+    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_INTERNAL);
     VerifyOrReturnError(mLocalMRPConfig.HasValue(), CHIP_ERROR_INCORRECT_STATE);
-    VerifyOrReturnError(GetLocalSessionId().HasValue(), CHIP_ERROR_INCORRECT_STATE);
-    outSigma2Data.responderSessionId = GetLocalSessionId().Value();
-
-    chip::Platform::ScopedMemoryBuffer<uint8_t> icacBuf;
-    VerifyOrReturnError(icacBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
-
-    chip::Platform::ScopedMemoryBuffer<uint8_t> nocBuf;
-    VerifyOrReturnError(nocBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
-
-    MutableByteSpan icaCert{ icacBuf.Get(), kMaxCHIPCertLength };
-    ReturnErrorOnFailure(mFabricsTable->FetchICACert(mFabricIndex, icaCert));
-
-    MutableByteSpan nocCert{ nocBuf.Get(), kMaxCHIPCertLength };
-    ReturnErrorOnFailure(mFabricsTable->FetchNOCCert(mFabricIndex, nocCert));
-
-    // Fill in the random value
-    ReturnErrorOnFailure(DRBG_get_bytes(&outSigma2Data.responderRandom[0], sizeof(outSigma2Data.responderRandom)));
-
-    // Generate an ephemeral keypair
-    mEphemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
-    VerifyOrReturnError(mEphemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
-    ReturnErrorOnFailure(mEphemeralKey->Initialize(ECPKeyTarget::ECDH));
-    outSigma2Data.responderEphPubKey = &mEphemeralKey->Pubkey();
-
-    // Generate a Shared Secret
-    ReturnErrorOnFailure(mEphemeralKey->ECDH_derive_secret(mRemotePubKey, mSharedSecret));
 
     SensitiveDataFixedBuffer<kIPKSize + kSigmaParamRandomNumberSize + kP256_PublicKey_Length + kSHA256_Hash_Length> msgSalt;
 
@@ -1209,25 +1201,6 @@ CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
     AutoReleaseSessionKey sr2k(*mSessionManager->GetSessionKeystore());
     ReturnErrorOnFailure(DeriveSigmaKey(saltSpan, ByteSpan(kKDFSR2Info), sr2k));
 
-    // Construct Sigma2 TBS Data
-    P256ECDSASignature tbsData2Signature;
-    {
-        size_t msgR2SignedLen = EstimateStructOverhead(kMaxCHIPCertLength,     // responderNoc
-                                                       kMaxCHIPCertLength,     // responderICAC
-                                                       kP256_PublicKey_Length, // responderEphPubKey
-                                                       kP256_PublicKey_Length  // InitiatorEphPubKey
-        );
-
-        chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
-        VerifyOrReturnError(msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
-        MutableByteSpan msgR2SignedSpan{ msgR2Signed.Get(), msgR2SignedLen };
-
-        ReturnErrorOnFailure(ConstructTBSData(nocCert, icaCert, ByteSpan(mEphemeralKey->Pubkey(), mEphemeralKey->Pubkey().Length()),
-                                              ByteSpan(mRemotePubKey, mRemotePubKey.Length()), msgR2SignedSpan));
-
-        // Generate a Signature
-        ReturnErrorOnFailure(mFabricsTable->SignWithOpKeypair(mFabricIndex, msgR2SignedSpan, tbsData2Signature));
-    }
     // Construct Sigma2 TBE Data
     size_t msgR2SignedEncLen = EstimateStructOverhead(nocCert.size(),                             // responderNoc
                                                       icaCert.size(),                             // responderICAC
@@ -1254,15 +1227,6 @@ CHIP_ERROR CASESession::PrepareSigma2(EncodeSigma2Inputs & outSigma2Data)
         ReturnErrorOnFailure(tlvWriter.Put(AsTlvContextTag(TBEDataTags::kSenderICAC), icaCert));
     }
 
-    // We are now done with ICAC and NOC certs so we can release the memory.
-    {
-        icacBuf.Free();
-        icaCert = MutableByteSpan{};
-
-        nocBuf.Free();
-        nocCert = MutableByteSpan{};
-    }
-
     CHIP_FAULT_INJECT(FaultInjection::kFault_CASECorruptSigma2Signature, *tbsData2Signature.Bytes() ^= 0xFF);
 
     ReturnErrorOnFailure(tlvWriter.PutBytes(AsTlvContextTag(TBEDataTags::kSignature), tbsData2Signature.ConstBytes(),
@@ -1352,6 +1316,136 @@ CHIP_ERROR CASESession::SendSigma2(System::PacketBufferHandle && msgR2)
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CASESession::SendSigma2a()
+{
+    MATTER_TRACE_SCOPE("SendSigma2a", "CASESession");
+
+    auto helper = WorkHelper<SendSigma2Data>::Create(*this, &SendSigma2b, &CASESession::SendSigma2c);
+    VerifyOrReturnError(helper, CHIP_ERROR_NO_MEMORY);
+    {
+        auto & data = helper->mData;
+
+        VerifyOrReturnError(mFabricsTable != nullptr, CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(mLocalMRPConfig.HasValue(), CHIP_ERROR_INCORRECT_STATE);
+        VerifyOrReturnError(GetLocalSessionId().HasValue(), CHIP_ERROR_INCORRECT_STATE);
+        data.fabricIndex               = mFabricIndex;
+        data.fabricTable               = mFabricsTable;
+        data.keystore                  = nullptr;
+        data.sigma2.responderSessionId = GetLocalSessionId().Value();
+
+        {
+            const FabricInfo * fabricInfo = mFabricsTable->FindFabricWithIndex(mFabricIndex);
+            VerifyOrReturnError(fabricInfo != nullptr, CHIP_ERROR_KEY_NOT_FOUND);
+            auto * keystore = mFabricsTable->GetOperationalKeystore();
+            if (!fabricInfo->HasOperationalKey() && keystore != nullptr && keystore->SupportsSignWithOpKeypairInBackground())
+            {
+                // NOTE: used to sign in background.
+                data.keystore = keystore;
+            }
+            // Otherwise SendSigma2c() signs in foreground, through the fabric table.
+        }
+
+        VerifyOrReturnError(data.icacBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        data.icaCert = MutableByteSpan{ data.icacBuf.Get(), kMaxCHIPCertLength };
+
+        VerifyOrReturnError(data.nocBuf.Alloc(kMaxCHIPCertLength), CHIP_ERROR_NO_MEMORY);
+        data.nocCert = MutableByteSpan{ data.nocBuf.Get(), kMaxCHIPCertLength };
+
+        ReturnErrorOnFailure(mFabricsTable->FetchICACert(mFabricIndex, data.icaCert));
+        ReturnErrorOnFailure(mFabricsTable->FetchNOCCert(mFabricIndex, data.nocCert));
+
+        // Fill in the random value
+        ReturnErrorOnFailure(DRBG_get_bytes(&data.sigma2.responderRandom[0], sizeof(data.sigma2.responderRandom)));
+
+        // The ephemeral keypair is generated in the background, along with the shared secret
+        data.ephemeralKey = mFabricsTable->AllocateEphemeralKeypairForCASE();
+        VerifyOrReturnError(data.ephemeralKey != nullptr, CHIP_ERROR_NO_MEMORY);
+        data.remotePubKey = mRemotePubKey;
+
+        size_t msgR2SignedLen = EstimateStructOverhead(data.nocCert.size(),    // responderNoc
+                                                       data.icaCert.size(),    // responderICAC
+                                                       kP256_PublicKey_Length, // responderEphPubKey
+                                                       kP256_PublicKey_Length  // InitiatorEphPubKey
+        );
+
+        VerifyOrReturnError(data.msgR2Signed.Alloc(msgR2SignedLen), CHIP_ERROR_NO_MEMORY);
+        data.msgR2SignedSpan = MutableByteSpan{ data.msgR2Signed.Get(), msgR2SignedLen };
+
+        ReturnErrorOnFailure(helper->ScheduleWork());
+        mSendSigma2Helper = helper;
+        mExchangeCtxt.Value()->WillSendMessage();
+        mState = State::kSendSigma2Pending;
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::SendSigma2b(SendSigma2Data & data, bool & cancel)
+{
+    // Generate an ephemeral keypair and a Shared Secret
+    ReturnErrorOnFailure(data.ephemeralKey->Initialize(ECPKeyTarget::ECDH));
+    ReturnErrorOnFailure(data.ephemeralKey->ECDH_derive_secret(data.remotePubKey, data.sharedSecret));
+
+    // Construct Sigma2 TBS Data
+    const P256PublicKey & ephemeralPubKey = data.ephemeralKey->Pubkey();
+    ReturnErrorOnFailure(ConstructTBSData(data.nocCert, data.icaCert, ByteSpan(ephemeralPubKey, ephemeralPubKey.Length()),
+                                          ByteSpan(data.remotePubKey, data.remotePubKey.Length()), data.msgR2SignedSpan));
+
+    // Generate a Signature, if the keystore allows it off the Matter thread
+    if (data.keystore != nullptr)
+    {
+        ReturnErrorOnFailure(data.keystore->SignWithOpKeypair(data.fabricIndex, data.msgR2SignedSpan, data.tbsData2Signature));
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR CASESession::SendSigma2c(SendSigma2Data & data, CHIP_ERROR status)
+{
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    System::PacketBufferHandle msgR2;
+
+    VerifyOrExit(mState == State::kSendSigma2Pending, err = CHIP_ERROR_INCORRECT_STATE);
+
+    SuccessOrExit(err = status);
+
+    // Take back the ephemeral key and the Shared Secret
+    mEphemeralKey     = data.ephemeralKey;
+    data.ephemeralKey = nullptr;
+    mSharedSecret     = data.sharedSecret;
+
+    if (data.keystore == nullptr)
+    {
+        // Legacy case: the operational key can only be used from the Matter thread
+        SuccessOrExit(err = mFabricsTable->SignWithOpKeypair(data.fabricIndex, data.msgR2SignedSpan, data.tbsData2Signature));
+    }
+
+    data.sigma2.responderEphPubKey = &mEphemeralKey->Pubkey();
+    SuccessOrExit(err = EncryptSigma2TBEData(data.sigma2, data.nocCert, data.icaCert, data.tbsData2Signature));
+    SuccessOrExit(err = EncodeSigma2(msgR2, data.sigma2));
+
+    MATTER_LOG_METRIC_BEGIN(kMetricDeviceCASESessionSigma2);
+    SuccessOrExitAction(err = SendSigma2(std::move(msgR2)), MATTER_LOG_METRIC_END(kMetricDeviceCASESessionSigma2, err));
+
+    mDelegate->OnSessionEstablishmentStarted();
+
+exit:
+    mSendSigma2Helper.reset();
+
+    // Processing occurred in the background, so if an error occurred, need to send status report
+    // (normally occurs in HandleSigma1_and_SendSigma2), and discard exchange and abort pending
+    // establish (normally occurs in OnMessageReceived).
+    if (err != CHIP_NO_ERROR)
+    {
+        SendStatusReport(mExchangeCtxt, kProtocolCodeInvalidParam);
+        DiscardExchange();
+        AbortPendingEstablish(err);
+    }
+
+    return err;
+}
+
 CHIP_ERROR CASESession::HandleSigma2Resume(System::PacketBufferHandle && msg)
 {
     MATTER_TRACE_SCOPE("HandleSigma2Resume", "CASESession");
@@ -1754,15 +1848,22 @@ CHIP_ERROR CASESession::SendSigma3a()
 
         if (data.keystore != nullptr)
         {
-            ReturnErrorOnFailure(helper->ScheduleWork());
-            mSendSigma3Helper = helper;
-            mExchangeCtxt.Value()->WillSendMessage();
-            mState = State::kSendSigma3Pending;
-        }
-        else
-        {
-            ReturnErrorOnFailure(helper->DoWork());
+            CHIP_ERROR err = helper->ScheduleWork();
+            if (err == CHIP_NO_ERROR)
+            {
+                mSendSigma3Helper = helper;
+                mExchangeCtxt.Value()->WillSendMessage();
+                mState = State::kSendSigma3Pending;
+                return CHIP_NO_ERROR;
+            }
+            VerifyOrReturnError(err == CHIP_ERROR_BUSY, err);
+
+            // The crypto worker pool is full: sign in the foreground rather than fail the handshake.
+            data.keystore    = nullptr;
+            data.fabricTable = mFabricsTable;
         }
+
+        ReturnErrorOnFailure(helper->DoWork());
     }
 
     return CHIP_NO_ERROR;
@@ -1991,6 +2092,7 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
         // Copy remaining needed data into work structure
         {
             data.validContext = mValidContext;
+            mFabricsTable->UseVerifiedIssuerCache(mFabricIndex, data.validContext);
 
             // initiatorNOC and initiatorICAC are spans into msgR3Encrypted
             // which is going away, so to save memory, redirect them to their
@@ -2012,7 +2114,17 @@ CHIP_ERROR CASESession::HandleSigma3a(System::PacketBufferHandle && msg)
             SuccessOrExit(err = signedDataTlvReader.ExitContainer(containerType));
         }
 
-        SuccessOrExit(err = helper->ScheduleWork());
+        err = helper->ScheduleWork();
+        if (err == CHIP_ERROR_BUSY)
+        {
+            // The crypto worker pool is full: validate in the foreground rather than fail the handshake.
+            // HandleSigma3c() reports and handles its own errors, so there is nothing left to do here.
+            mHandleSigma3Helper = helper;
+            mState              = State::kHandleSigma3Pending;
+            RETURN_SAFELY_IGNORED helper->DoWork();
+            return CHIP_NO_ERROR;
+        }
+        SuccessOrExit(err);
         mHandleSigma3Helper = helper;
         mExchangeCtxt.Value()->WillSendMessage();
         mState = State::kHandleSigma3Pending;
@@ -2657,6 +2769,13 @@ bool CASESession::InvokeBackgroundWorkWatchdog()
 {
     bool watchdogFired = false;
 
+    if (mSendSigma2Helper && mSendSigma2Helper->UnableToScheduleAfterWorkCallback())
+    {
+        ChipLogError(SecureChannel, "SendSigma2Helper was unable to schedule the AfterWorkCallback");
+        mSendSigma2Helper->DoAfterWork();
+        watchdogFired = true;
+    }
+
     if (mSendSigma3Helper && mSendSigma3Helper->UnableToScheduleAfterWorkCallback())
     {
         ChipLogError(SecureChannel, "SendSigma3Helper was unable to schedule the AfterWorkCallback");
@@ -2684,6 +2803,8 @@ SessionEstablishmentStage CASESession::MapCASEStateToSessionEstablishmentStage(S
     case State::kSentSigma1:
     case State::kSentSigma1Resume:
         return SessionEstablishmentStage::kSentSigma1;
+    case State::kSendSigma2Pending:
+        return SessionEstablishmentStage::kReceivedSigma1;
     case State::kSentSigma2:
     case State::kSentSigma2Resume:
         return SessionEstablishmentStage::kSentSigma2;
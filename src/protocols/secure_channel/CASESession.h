@@ -118,6 +118,16 @@ public:
      */
     void SetGroupDataProvider(Credentials::GroupDataProvider * groupDataProvider) { mGroupDataProvider = groupDataProvider; }
 
+    /**
+     * @brief Set the cache of IPK HMAC states used by a responder to match Sigma1 destination identifiers.
+     *
+     * Like the group data provider, the cache persists across handshakes and is not reset by Clear().
+     *
+     * @param destinationIdCache - Pointer to the cache (if nullptr, every candidate destination identifier
+     *                             is computed from scratch).
+     */
+    void SetDestinationIdCache(CASEDestinationIdCache * destinationIdCache) { mDestinationIdCache = destinationIdCache; }
+
     /**
      * @brief
      *   Derive a secure session from the established session. The API will return error if called before session is established.
@@ -182,6 +192,7 @@ public:
         kFinishedViaResume   = 7,
         kSendSigma3Pending   = 8,
         kHandleSigma3Pending = 9,
+        kSendSigma2Pending   = 10,
     };
 
     State GetState() { return mState; }
@@ -290,6 +301,43 @@ protected:
         bool responderSessionParamStructPresent = false;
     };
 
+    struct SendSigma2Data
+    {
+        FabricIndex fabricIndex;
+        // Set when the operational keystore can sign in the background. Otherwise only the ephemeral key and the
+        // shared secret are computed in the background, and SendSigma2c() signs on the Matter thread.
+        const Crypto::OperationalKeystore * keystore;
+
+        // The ephemeral key is owned here while the background work is outstanding, and handed back to
+        // the session by SendSigma2c(). It is released through fabricTable if that never happens.
+        FabricTable * fabricTable;
+        Crypto::P256Keypair * ephemeralKey = nullptr;
+
+        Crypto::P256PublicKey remotePubKey;
+        Crypto::P256ECDHDerivedSecret sharedSecret;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> msgR2Signed;
+        MutableByteSpan msgR2SignedSpan;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> icacBuf;
+        MutableByteSpan icaCert;
+
+        chip::Platform::ScopedMemoryBuffer<uint8_t> nocBuf;
+        MutableByteSpan nocCert;
+
+        Crypto::P256ECDSASignature tbsData2Signature;
+
+        EncodeSigma2Inputs sigma2;
+
+        ~SendSigma2Data()
+        {
+            if (ephemeralKey != nullptr)
+            {
+                fabricTable->ReleaseEphemeralKeypair(ephemeralKey);
+            }
+        }
+    };
+
     struct SendSigma3Data
     {
         FabricIndex fabricIndex;
@@ -493,7 +541,8 @@ private:
     CHIP_ERROR TryResumeSession(SessionResumptionStorage::ConstResumptionIdView resumptionId, ByteSpan resume1MIC,
                                 ByteSpan initiatorRandom);
 
-    CHIP_ERROR PrepareSigma2(EncodeSigma2Inputs & output);
+    CHIP_ERROR EncryptSigma2TBEData(EncodeSigma2Inputs & output, MutableByteSpan & nocCert, MutableByteSpan & icaCert,
+                                    Crypto::P256ECDSASignature & tbsData2Signature);
     CHIP_ERROR PrepareSigma2Resume(EncodeSigma2ResumeInputs & output);
     CHIP_ERROR SendSigma2(System::PacketBufferHandle && msg_R2);
     CHIP_ERROR SendSigma2Resume(System::PacketBufferHandle && msg_R2_resume);
@@ -502,6 +551,10 @@ private:
     CHIP_ERROR HandleSigma2(System::PacketBufferHandle && msg);
     CHIP_ERROR HandleSigma2Resume(System::PacketBufferHandle && msg);
 
+    CHIP_ERROR SendSigma2a();
+    static CHIP_ERROR SendSigma2b(SendSigma2Data & data, bool & cancel);
+    CHIP_ERROR SendSigma2c(SendSigma2Data & data, CHIP_ERROR status);
+
     CHIP_ERROR SendSigma3a();
     static CHIP_ERROR SendSigma3b(SendSigma3Data & data, bool & cancel);
     CHIP_ERROR SendSigma3c(SendSigma3Data & data, CHIP_ERROR status);
@@ -514,8 +567,8 @@ private:
     CHIP_ERROR DeriveSigmaKey(const ByteSpan & salt, const ByteSpan & info, AutoReleaseSessionKey & key) const;
     CHIP_ERROR ConstructSaltSigma2(const ByteSpan & rand, const Crypto::P256PublicKey & pubkey, const ByteSpan & ipk,
                                    MutableByteSpan & salt);
-    CHIP_ERROR ConstructTBSData(const ByteSpan & senderNOC, const ByteSpan & senderICAC, const ByteSpan & senderPubKey,
-                                const ByteSpan & receiverPubKey, MutableByteSpan & outTbsData);
+    static CHIP_ERROR ConstructTBSData(const ByteSpan & senderNOC, const ByteSpan & senderICAC, const ByteSpan & senderPubKey,
+                                       const ByteSpan & receiverPubKey, MutableByteSpan & outTbsData);
     CHIP_ERROR ConstructSaltSigma3(const ByteSpan & ipk, MutableByteSpan & salt);
 
     CHIP_ERROR ConstructSigmaResumeKey(const ByteSpan & initiatorRandom, const ByteSpan & resumptionID, const ByteSpan & skInfo,
@@ -565,6 +618,7 @@ private:
     Crypto::P256ECDHDerivedSecret mSharedSecret;
     Credentials::ValidationContext mValidContext;
     Credentials::GroupDataProvider * mGroupDataProvider = nullptr;
+    CASEDestinationIdCache * mDestinationIdCache        = nullptr;
 
     uint8_t mMessageDigest[Crypto::kSHA256_Hash_Length];
     uint8_t mIPK[kIPKSize];
@@ -585,6 +639,7 @@ private:
 
     template <class DATA>
     class WorkHelper;
+    Platform::SharedPtr<WorkHelper<SendSigma2Data>> mSendSigma2Helper;
     Platform::SharedPtr<WorkHelper<SendSigma3Data>> mSendSigma3Helper;
     Platform::SharedPtr<WorkHelper<HandleSigma3Data>> mHandleSigma3Helper;
 
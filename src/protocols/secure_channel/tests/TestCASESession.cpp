@@ -44,6 +44,7 @@
 #include <lib/support/TestPersistentStorageDelegate.h>
 #include <lib/support/tests/ExtraPwTestMacros.h>
 #include <messaging/tests/MessagingContext.h>
+#include <protocols/secure_channel/CASECryptoWorkerPool.h>
 #include <protocols/secure_channel/CASEServer.h>
 #include <protocols/secure_channel/CASESession.h>
 
@@ -214,6 +215,7 @@ public:
         mSingleFabricIndex = kUndefinedFabricIndex;
         mKeypair           = nullptr;
     }
+    void SetSupportsSignInBackground(bool supported) { mSupportsSignInBackground = supported; }
 
     bool HasPendingOpKeypair() const override { return false; }
     bool HasOpKeypairForFabric(FabricIndex fabricIndex) const override { return mSingleFabricIndex != kUndefinedFabricIndex; }
@@ -245,9 +247,12 @@ public:
 
     void ReleaseEphemeralKeypair(Crypto::P256Keypair * keypair) override { Platform::Delete<Crypto::P256Keypair>(keypair); }
 
+    bool SupportsSignWithOpKeypairInBackground() const override { return mSupportsSignInBackground; }
+
 protected:
     Platform::UniquePtr<P256Keypair> mKeypair;
     FabricIndex mSingleFabricIndex = kUndefinedFabricIndex;
+    bool mSupportsSignInBackground = false;
 };
 
 #if CHIP_CONFIG_SLOW_CRYPTO
@@ -597,6 +602,88 @@ TEST_F(TestCASESession, SecurePairingHandshakeServerTest)
     gPairingServer.Shutdown();
 }
 
+TEST_F(TestCASESession, SecurePairingHandshakeBackgroundCryptoTest)
+{
+    auto & pool = CASECryptoWorkerPool::Instance();
+    pool.ResetStats();
+
+    // The responder can sign in the background, so Sigma2 (ECDH + signature) and Sigma3
+    // validation both go through the crypto worker pool.
+    gDeviceOperationalKeystore.SetSupportsSignInBackground(true);
+
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioner;
+    CASESession pairingCommissioner;
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+    SecurePairingHandshakeTestCommon(sessionManager, pairingCommissioner, delegateCommissioner);
+
+    gDeviceOperationalKeystore.SetSupportsSignInBackground(false);
+
+    CASECryptoWorkerPool::Stats stats = pool.GetStats();
+    EXPECT_EQ(stats.scheduled, 2u);
+    EXPECT_EQ(stats.rejected, 0u);
+    EXPECT_EQ(stats.inFlight, 0u);
+    EXPECT_EQ(stats.queued, 0u);
+    EXPECT_GE(stats.inFlightHighWatermark, 1u);
+}
+
+TEST_F(TestCASESession, SecurePairingHandshakeForegroundSignTest)
+{
+    auto & pool = CASECryptoWorkerPool::Instance();
+    pool.ResetStats();
+
+    // The responder keystore cannot sign in the background: the Sigma2 ephemeral key and ECDH still go through
+    // the crypto worker pool, and only the signature is computed on the Matter thread.
+    TemporarySessionManager sessionManager(*this);
+    TestCASESecurePairingDelegate delegateCommissioner;
+    CASESession pairingCommissioner;
+    pairingCommissioner.SetGroupDataProvider(&gCommissionerGroupDataProvider);
+    SecurePairingHandshakeTestCommon(sessionManager, pairingCommissioner, delegateCommissioner);
+
+    CASECryptoWorkerPool::Stats stats = pool.GetStats();
+    EXPECT_EQ(stats.scheduled, 2u);
+    EXPECT_EQ(stats.rejected, 0u);
+    EXPECT_EQ(stats.inFlight, 0u);
+}
+
+#if !CHIP_CASE_CRYPTO_WORKER_POOL_USE_THREADS
+TEST_F(TestCASESession, CryptoWorkerPoolInFlightBoundTest)
+{
+    static size_t sJobsRun;
+    sJobsRun = 0;
+
+    auto & pool = CASECryptoWorkerPool::Instance();
+    pool.ResetStats();
+
+    // Jobs only run once the event loop is serviced, so they all stay in flight until then.
+    for (size_t i = 0; i < CASECryptoWorkerPool::kMaxInFlight; i++)
+    {
+        EXPECT_SUCCESS(pool.ScheduleWork([](intptr_t) { sJobsRun++; }, 0));
+    }
+    EXPECT_EQ(pool.ScheduleWork([](intptr_t) { sJobsRun++; }, 0), CHIP_ERROR_BUSY);
+
+    CASECryptoWorkerPool::Stats stats = pool.GetStats();
+    EXPECT_EQ(stats.inFlight, CASECryptoWorkerPool::kMaxInFlight);
+    EXPECT_EQ(stats.queued, CASECryptoWorkerPool::kMaxInFlight);
+    EXPECT_EQ(stats.queuedHighWatermark, CASECryptoWorkerPool::kMaxInFlight);
+    EXPECT_EQ(stats.scheduled, CASECryptoWorkerPool::kMaxInFlight);
+    EXPECT_EQ(stats.rejected, 1u);
+
+    ServiceEvents();
+
+    EXPECT_EQ(sJobsRun, CASECryptoWorkerPool::kMaxInFlight);
+    stats = pool.GetStats();
+    EXPECT_EQ(stats.inFlight, 0u);
+    EXPECT_EQ(stats.queued, 0u);
+    EXPECT_EQ(stats.inFlightHighWatermark, CASECryptoWorkerPool::kMaxInFlight);
+
+    // Completed jobs free their slots.
+    EXPECT_SUCCESS(pool.ScheduleWork([](intptr_t) { sJobsRun++; }, 0));
+    ServiceEvents();
+    EXPECT_EQ(sJobsRun, CASECryptoWorkerPool::kMaxInFlight + 1);
+}
+#endif // !CHIP_CASE_CRYPTO_WORKER_POOL_USE_THREADS
+
 TEST_F(TestCASESession, ClientReceivesBusyTest)
 {
     TemporarySessionManager sessionManager(*this);
@@ -775,6 +862,36 @@ TEST_F(TestCASESession, DestinationIdTest)
               CHIP_NO_ERROR);
     EXPECT_EQ(destinationIdSpan.size(), sizeof(destinationIdBuf));
     EXPECT_FALSE(destinationIdSpan.data_equal(ByteSpan(kExpectedDestinationIdFromSpec)));
+
+    // The cached HMAC state must give the same results, across repeated use and after invalidation.
+    CASEDestinationIdCache cache;
+    constexpr FabricIndex kFabricIndex = 1;
+    for (int i = 0; i < 3; i++)
+    {
+        destinationIdSpan = MutableByteSpan(destinationIdBuf);
+        EXPECT_EQ(cache.GenerateDestinationId(kFabricIndex, ByteSpan(kIpkOperationalGroupKeyFromSpec),
+                                              ByteSpan(kInitiatorRandomFromSpec), ByteSpan(kRootPubKeyFromSpec), kFabricIdFromSpec,
+                                              kNodeIdFromSpec, destinationIdSpan),
+                  CHIP_NO_ERROR);
+        EXPECT_TRUE(destinationIdSpan.data_equal(ByteSpan(kExpectedDestinationIdFromSpec)));
+
+        cache.Invalidate(static_cast<FabricIndex>(kFabricIndex + i));
+    }
+
+    // A different IPK for the same fabric must not reuse the cached state.
+    uint8_t otherIpk[sizeof(kIpkOperationalGroupKeyFromSpec)];
+    memcpy(otherIpk, kIpkOperationalGroupKeyFromSpec, sizeof(otherIpk));
+    otherIpk[0] ^= 0xFF;
+    destinationIdSpan = MutableByteSpan(destinationIdBuf);
+    EXPECT_EQ(cache.GenerateDestinationId(kFabricIndex, ByteSpan(otherIpk), ByteSpan(kInitiatorRandomFromSpec),
+                                          ByteSpan(kRootPubKeyFromSpec), kFabricIdFromSpec, kNodeIdFromSpec, destinationIdSpan),
+              CHIP_NO_ERROR);
+    EXPECT_FALSE(destinationIdSpan.data_equal(ByteSpan(kExpectedDestinationIdFromSpec)));
+
+    EXPECT_EQ(cache.GenerateDestinationId(kFabricIndex, ByteSpan(kIpkOperationalGroupKeyFromSpec).SubSpan(1),
+                                          ByteSpan(kInitiatorRandomFromSpec), ByteSpan(kRootPubKeyFromSpec), kFabricIdFromSpec,
+                                          kNodeIdFromSpec, destinationIdSpan),
+              CHIP_ERROR_INVALID_ARGUMENT);
 }
 
 template <typename Params>
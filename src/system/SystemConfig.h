@@ -127,6 +127,10 @@
 #error "FORBIDDEN: CHIP_SYSTEM_CONFIG_MULTICAST_HOMING WAS NOT TESTED WITH ZEPHYR"
 #endif
 
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL && (!CHIP_SYSTEM_CONFIG_USE_SOCKETS || CHIP_SYSTEM_CONFIG_USE_LIBEV)
+#error "FORBIDDEN: CHIP_SYSTEM_CONFIG_USE_EPOLL REQUIRES SOCKETS AND CANNOT BE COMBINED WITH CHIP_SYSTEM_CONFIG_USE_LIBEV"
+#endif
+
 // clang-format off
 
 /**
@@ -394,6 +398,54 @@
 #define CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE 15
 #endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+ *
+ *  @brief
+ *      When packet buffers are allocated dynamically (CHIP_SYSTEM_CONFIG_PACKETBUFFER_POOL_SIZE is zero), this enables (1)
+ *      recycling their memory through size-classed slabs with per-thread caches instead of a malloc/free pair per buffer.
+ *
+ *      This requires CHIP_SYSTEM_CONFIG_POSIX_LOCKING and is intended for hosted (e.g. Linux) builds.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+ *
+ *  @brief
+ *      With CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB, the number of free blocks of each size class that every thread keeps for
+ *      itself before returning blocks to the shared cache.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE 16
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE
+ *
+ *  @brief
+ *      With CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB, the number of free blocks of each size class kept in the cache shared by
+ *      all threads. Blocks freed beyond this are returned to the heap.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE 128
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_SOFT_CAP
+ *
+ *  @brief
+ *      With CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB, the default number of packet buffers in use above which the allocator
+ *      reports backpressure (see PacketBufferSlab::IsOverSoftCap()). Allocations above the cap still succeed.
+ *
+ *      This may be set to zero (0) to disable backpressure reporting.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_PACKETBUFFER_SOFT_CAP
+#define CHIP_SYSTEM_CONFIG_PACKETBUFFER_SOFT_CAP 0
+#endif /* CHIP_SYSTEM_CONFIG_PACKETBUFFER_SOFT_CAP */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_PACKETBUFFER_LWIP_PBUF_RAM
  *
@@ -531,6 +583,30 @@ struct LwIPEvent;
 #define CHIP_SYSTEM_CONFIG_NUM_TIMERS 32
 #endif /* CHIP_SYSTEM_CONFIG_NUM_TIMERS */
 
+/**
+ *  @def CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+ *
+ *  @brief
+ *      Define as 1 to keep pending timers of select()/epoll() based System::Layer implementations in a hierarchical
+ *      timer wheel (System::TimerWheel) instead of a sorted list (System::TimerList). The wheel makes starting and
+ *      cancelling a timer O(1) at the cost of a few kilobytes of fixed bookkeeping, which pays off once many timers
+ *      are active at the same time.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+#define CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL 0
+#endif /* CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL */
+
+/**
+ *  @def CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS
+ *
+ *  @brief
+ *      Number of buckets (a power of two) of the (callback, appState) index of System::TimerWheel, used by CancelTimer()
+ *      and GetRemainingTime(). Should be in the order of the expected number of concurrently active timers.
+ */
+#ifndef CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS
+#define CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS 256
+#endif /* CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS */
+
 /**
  *  @def CHIP_SYSTEM_CONFIG_THREAD_LOCAL_STORAGE
  *
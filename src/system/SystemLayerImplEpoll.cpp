@@ -0,0 +1,730 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements Layer using Linux epoll() and timerfd.
+ */
+
+#include <lib/support/CodeUtils.h>
+#include <lib/support/TimeUtils.h>
+#include <platform/LockTracker.h>
+#include <system/SystemFaultInjection.h>
+#include <system/SystemLayer.h>
+#include <system/SystemLayerImplEpoll.h>
+
+#include <algorithm>
+#include <errno.h>
+#include <sys/timerfd.h>
+#include <unistd.h>
+
+// Choose an approximation of PTHREAD_NULL if pthread.h doesn't define one.
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+#define PTHREAD_NULL 0
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING && !defined(PTHREAD_NULL)
+
+namespace chip {
+namespace System {
+
+constexpr Clock::Seconds64 kDefaultMinSleepPeriod = Clock::Seconds64(60 * 60 * 24 * 30); // Month [sec]
+
+CriticalFailure LayerImplEpoll::Init()
+{
+    VerifyOrReturnError(mLayerState.SetInitializing(), CHIP_ERROR_INCORRECT_STATE);
+
+    RegisterPOSIXErrorFormatter();
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+    std::fill(std::begin(mSocketWatchIndex), std::end(mSocketWatchIndex), kNoSocketWatch);
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    CHIP_ERROR err = CHIP_NO_ERROR;
+    struct epoll_event event;
+
+    mEpollFd = epoll_create1(EPOLL_CLOEXEC);
+    VerifyOrExit(mEpollFd >= 0, err = CHIP_ERROR_POSIX(errno));
+
+    mTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+    VerifyOrExit(mTimerFd >= 0, err = CHIP_ERROR_POSIX(errno));
+    mTimerFdAwakenTime = Clock::kZero;
+
+    // Create an event to allow an arbitrary thread to wake the thread in the event loop.
+    SuccessOrExit(err = mWakeEvent.Open());
+
+    // Every registration is tagged with its descriptor; socket events are mapped back to their watch
+    // through mSocketWatchIndex.
+    event         = {};
+    event.events  = EPOLLIN;
+    event.data.fd = mWakeEvent.GetReadFD();
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mWakeEvent.GetReadFD(), &event) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    event         = {};
+    event.events  = EPOLLIN;
+    event.data.fd = mTimerFd;
+    VerifyOrExit(epoll_ctl(mEpollFd, EPOLL_CTL_ADD, mTimerFd, &event) == 0, err = CHIP_ERROR_POSIX(errno));
+
+    VerifyOrReturnError(mLayerState.SetInitialized(), CHIP_ERROR_INCORRECT_STATE);
+    return CHIP_NO_ERROR;
+
+exit:
+    ChipLogError(chipSystemLayer, "epoll layer init failed: %" CHIP_ERROR_FORMAT, err.Format());
+    mWakeEvent.Close();
+    if (mTimerFd >= 0)
+    {
+        close(mTimerFd);
+        mTimerFd = -1;
+    }
+    if (mEpollFd >= 0)
+    {
+        close(mEpollFd);
+        mEpollFd = -1;
+    }
+    return err;
+}
+
+void LayerImplEpoll::Shutdown()
+{
+    VerifyOrReturn(mLayerState.SetShuttingDown());
+
+    EventSourceClear();
+
+    mTimerList.Clear();
+    mTimerPool.ReleaseAll();
+
+    for (auto & w : mSocketWatchPool)
+    {
+        w.Clear();
+    }
+    std::fill(std::begin(mSocketWatchIndex), std::end(mSocketWatchIndex), kNoSocketWatch);
+
+    mWakeEvent.Close();
+    close(mTimerFd);
+    mTimerFd = -1;
+    close(mEpollFd);
+    mEpollFd = -1;
+
+    mLayerState.ResetFromShuttingDown(); // Return to uninitialized state to permit re-initialization.
+}
+
+void LayerImplEpoll::Signal()
+{
+    /*
+     * Wake up the I/O thread by notifying the wake event.
+     *
+     * If this is being called from within an I/O event callback, then notifying can be skipped, since
+     * the I/O thread is already awake and will re-evaluate timers before it waits again.
+     */
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    if (pthread_equal(mHandleSelectThread, pthread_self()))
+    {
+        return;
+    }
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    CHIP_ERROR status = mWakeEvent.Notify();
+    if (status != CHIP_NO_ERROR)
+    {
+        ChipLogError(chipSystemLayer, "System wake event notify failed: %" CHIP_ERROR_FORMAT, status.Format());
+    }
+}
+
+CriticalFailure LayerImplEpoll::StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    CHIP_SYSTEM_FAULT_INJECT(FaultInjection::kFault_TimeoutImmediate, delay = System::Clock::kZero);
+
+    CancelTimer(onComplete, appState);
+
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp() + delay, onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        // The new timer is the earliest, so the timerfd deadline has to be moved.
+        Signal();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState)
+{
+    VerifyOrReturnError(delay.count() > 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    assertChipStackLockedByCurrentThread();
+
+    Clock::Timeout remainingTime = mTimerList.GetRemainingTime(onComplete, appState);
+    if (remainingTime.count() < delay.count())
+    {
+        return StartTimer(delay, onComplete, appState);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+bool LayerImplEpoll::IsTimerActive(TimerCompleteCallback onComplete, void * appState)
+{
+    bool timerIsActive = (mTimerList.GetRemainingTime(onComplete, appState) > Clock::kZero);
+
+    if (!timerIsActive)
+    {
+        // check if the timer is in the mExpiredTimers list about to be fired.
+        for (TimerList::Node * timer = mExpiredTimers.Earliest(); timer != nullptr; timer = timer->mNextTimer)
+        {
+            if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState)
+            {
+                return true;
+            }
+        }
+    }
+
+    return timerIsActive;
+}
+
+Clock::Timeout LayerImplEpoll::GetRemainingTime(TimerCompleteCallback onComplete, void * appState)
+{
+    return mTimerList.GetRemainingTime(onComplete, appState);
+}
+
+void LayerImplEpoll::CancelTimer(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturn(mLayerState.IsInitialized());
+
+    TimerQueue::Node * timer = mTimerList.Remove(onComplete, appState);
+    if (timer == nullptr)
+    {
+        // The timer might be in the "we're about to fire these" chunk we already grabbed.
+        timer = static_cast<TimerQueue::Node *>(mExpiredTimers.Remove(onComplete, appState));
+    }
+    VerifyOrReturn(timer != nullptr);
+
+    mTimerPool.Release(timer);
+
+    // No Signal() here: a timerfd armed for a cancelled timer only causes one spurious wakeup, after
+    // which PrepareEvents() re-arms it for the next remaining timer.
+}
+
+CriticalFailure LayerImplEpoll::ScheduleWork(TimerCompleteCallback onComplete, void * appState)
+{
+    assertChipStackLockedByCurrentThread();
+
+    VerifyOrReturnError(mLayerState.IsInitialized(), CHIP_ERROR_INCORRECT_STATE);
+
+    // As in LayerImplSelect, use an expires-ASAP timer as the closure, without cancelling existing
+    // timers with the same callback and appState.
+    TimerQueue::Node * timer = mTimerPool.Create(*this, SystemClock().GetMonotonicTimestamp(), onComplete, appState);
+    VerifyOrReturnError(timer != nullptr, CHIP_ERROR_NO_MEMORY);
+
+    if (mTimerList.Add(timer) == timer)
+    {
+        Signal();
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::StartWatchingSocket(int fd, SocketWatchToken * tokenOut)
+{
+    VerifyOrReturnError(fd >= 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    SocketWatch * watch = FindSocketWatch(fd);
+    if (watch != nullptr)
+    {
+        // Already registered, return the existing token
+        *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+        return CHIP_NO_ERROR;
+    }
+
+    // Find a free slot.
+    for (auto & w : mSocketWatchPool)
+    {
+        if (w.mFD == kInvalidFd)
+        {
+            watch = &w;
+            break;
+        }
+    }
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_ENDPOINT_POOL_FULL);
+
+    watch->mFD = fd;
+    IndexSocketWatch(*watch);
+
+    *tokenOut = reinterpret_cast<SocketWatchToken>(watch);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mCallback     = callback;
+    watch->mCallbackData = data;
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kRead);
+    return UpdateEpollRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::RequestCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Set(SocketEventFlags::kWrite);
+    return UpdateEpollRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingRead(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kRead);
+    return UpdateEpollRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::ClearCallbackOnPendingWrite(SocketWatchToken token)
+{
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(token);
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    watch->mPendingIO.Clear(SocketEventFlags::kWrite);
+    return UpdateEpollRegistration(*watch);
+}
+
+CHIP_ERROR LayerImplEpoll::StopWatchingSocket(SocketWatchToken * tokenInOut)
+{
+    VerifyOrReturnError(tokenInOut != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+
+    SocketWatch * watch = reinterpret_cast<SocketWatch *>(*tokenInOut);
+    *tokenInOut         = InvalidSocketWatchToken();
+
+    VerifyOrReturnError(watch != nullptr, CHIP_ERROR_INVALID_ARGUMENT);
+    VerifyOrReturnError(watch->mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    if (watch->mRegistered)
+    {
+        // Failure is not interesting here: the descriptor may already have been closed, which removes
+        // it from the epoll set implicitly.
+        (void) epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch->mFD, nullptr);
+    }
+    UnindexSocketWatch(*watch);
+    watch->Clear();
+
+    // Unlike LayerImplSelect there is no need to wake the event loop: the kernel no longer reports
+    // the descriptor, and events already harvested for this watch are filtered in HandleEvents().
+    return CHIP_NO_ERROR;
+}
+
+LayerImplEpoll::SocketWatch * LayerImplEpoll::FindSocketWatch(int fd)
+{
+    for (size_t slot = SocketWatchIndexSlot(fd); mSocketWatchIndex[slot] != kNoSocketWatch;
+         slot = (slot + 1) & (kSocketWatchIndexSize - 1))
+    {
+        SocketWatch & watch = mSocketWatchPool[mSocketWatchIndex[slot]];
+        if (watch.mFD == fd)
+        {
+            return &watch;
+        }
+    }
+    return nullptr;
+}
+
+void LayerImplEpoll::IndexSocketWatch(SocketWatch & watch)
+{
+    // The index has more slots than the pool has watches, so there is always a free slot.
+    size_t slot = SocketWatchIndexSlot(watch.mFD);
+    while (mSocketWatchIndex[slot] != kNoSocketWatch)
+    {
+        slot = (slot + 1) & (kSocketWatchIndexSize - 1);
+    }
+    mSocketWatchIndex[slot] = static_cast<int16_t>(&watch - mSocketWatchPool);
+}
+
+void LayerImplEpoll::UnindexSocketWatch(const SocketWatch & watch)
+{
+    constexpr size_t kMask  = kSocketWatchIndexSize - 1;
+    const int16_t poolIndex = static_cast<int16_t>(&watch - mSocketWatchPool);
+
+    size_t hole = SocketWatchIndexSlot(watch.mFD);
+    while (mSocketWatchIndex[hole] != poolIndex)
+    {
+        VerifyOrReturn(mSocketWatchIndex[hole] != kNoSocketWatch);
+        hole = (hole + 1) & kMask;
+    }
+
+    // Backward-shift deletion: move later entries of the probe run into the hole unless that would
+    // place them before their home slot, so lookups never need tombstones.
+    for (size_t next = (hole + 1) & kMask; mSocketWatchIndex[next] != kNoSocketWatch; next = (next + 1) & kMask)
+    {
+        const size_t home = SocketWatchIndexSlot(mSocketWatchPool[mSocketWatchIndex[next]].mFD);
+        if (((next - home) & kMask) >= ((next - hole) & kMask))
+        {
+            mSocketWatchIndex[hole] = mSocketWatchIndex[next];
+            hole                    = next;
+        }
+    }
+    mSocketWatchIndex[hole] = kNoSocketWatch;
+}
+
+/**
+ *  Bring the kernel registration of @p watch in line with its requested events. Descriptors are added
+ *  when the first event is requested and removed again when none are: EPOLLERR and EPOLLHUP cannot be
+ *  masked, so an idle descriptor left in the epoll set would keep waking the loop after an error.
+ */
+CHIP_ERROR LayerImplEpoll::UpdateEpollRegistration(SocketWatch & watch)
+{
+    VerifyOrReturnError(watch.mFD >= 0, CHIP_ERROR_INCORRECT_STATE);
+
+    uint32_t events = 0;
+    if (watch.mPendingIO.Has(SocketEventFlags::kRead))
+    {
+        events |= EPOLLIN;
+    }
+    if (watch.mPendingIO.Has(SocketEventFlags::kWrite))
+    {
+        events |= EPOLLOUT;
+    }
+
+    if (events == 0)
+    {
+        VerifyOrReturnError(watch.mRegistered, CHIP_NO_ERROR);
+        watch.mRegistered = false;
+        // As in StopWatchingSocket(), a descriptor that was already closed has left the epoll set anyway.
+        (void) epoll_ctl(mEpollFd, EPOLL_CTL_DEL, watch.mFD, nullptr);
+        return CHIP_NO_ERROR;
+    }
+
+    if (watch.mRegistered && watch.mEpollEvents == events)
+    {
+        return CHIP_NO_ERROR;
+    }
+
+    struct epoll_event event = {};
+    event.events             = events;
+    event.data.fd            = watch.mFD;
+
+    if (epoll_ctl(mEpollFd, watch.mRegistered ? EPOLL_CTL_MOD : EPOLL_CTL_ADD, watch.mFD, &event) != 0)
+    {
+        return CHIP_ERROR_POSIX(errno);
+    }
+
+    watch.mRegistered  = true;
+    watch.mEpollEvents = events;
+    return CHIP_NO_ERROR;
+}
+
+enum : intptr_t
+{
+    kLoopHandlerInactive = 0, // default value for EventLoopHandler::mState
+    kLoopHandlerPending,
+    kLoopHandlerActive,
+};
+
+void LayerImplEpoll::AddLoopHandler(EventLoopHandler & handler)
+{
+    // Add the handler as pending because this method can be called at any point
+    // in a PrepareEvents() / WaitForEvents() / HandleEvents() sequence.
+    // It will be marked active when we call PrepareEvents() on it for the first time.
+    auto & state = LoopHandlerState(handler);
+    VerifyOrDie(state == kLoopHandlerInactive);
+    state = kLoopHandlerPending;
+    mLoopHandlers.PushBack(&handler);
+}
+
+void LayerImplEpoll::RemoveLoopHandler(EventLoopHandler & handler)
+{
+    mLoopHandlers.Remove(&handler);
+    LoopHandlerState(handler) = kLoopHandlerInactive;
+}
+
+void LayerImplEpoll::EventSourceAdd(EventSource * source)
+{
+    assertChipStackLockedByCurrentThread();
+    if (mSources.Contains(source))
+    {
+        ChipLogDetail(DeviceLayer, "Warning: the EventSource is already added");
+        return;
+    }
+    mSources.PushBack(source);
+}
+
+void LayerImplEpoll::EventSourceRemove(EventSource * source)
+{
+    assertChipStackLockedByCurrentThread();
+    if (mSources.Contains(source))
+    {
+        mSources.Remove(source);
+    }
+}
+
+void LayerImplEpoll::EventSourceClear()
+{
+    assertChipStackLockedByCurrentThread();
+    mSources.Clear();
+}
+
+/**
+ *  Point the timerfd at @p awakenTime, or disarm it if there is no deadline (Clock::Timestamp::max()).
+ *  The kernel is only called when the earliest deadline differs from the one already armed.
+ */
+void LayerImplEpoll::ArmTimerFd(Clock::Timestamp awakenTime, Clock::Timestamp currentTime)
+{
+    if (awakenTime <= currentTime)
+    {
+        // Something is already due; poll without blocking and leave the timerfd alone.
+        mEpollTimeoutMs = 0;
+        return;
+    }
+
+    mEpollTimeoutMs = -1;
+
+    const Clock::Timestamp armedTime = (awakenTime == Clock::Timestamp::max()) ? Clock::kZero : awakenTime;
+    VerifyOrReturn(armedTime != mTimerFdAwakenTime);
+
+    // An all-zero it_value disarms the timer.
+    struct itimerspec spec = {};
+    if (armedTime != Clock::kZero)
+    {
+        const Clock::Milliseconds64 sleepTime = std::chrono::duration_cast<Clock::Milliseconds64>(awakenTime - currentTime);
+        spec.it_value.tv_sec                  = static_cast<time_t>(sleepTime.count() / 1000);
+        spec.it_value.tv_nsec                 = static_cast<long>((sleepTime.count() % 1000) * 1000000);
+    }
+    if (timerfd_settime(mTimerFd, 0, &spec, nullptr) != 0)
+    {
+        ChipLogError(chipSystemLayer, "timerfd_settime failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        mTimerFdAwakenTime = Clock::kZero;
+        if (armedTime != Clock::kZero)
+        {
+            // Fall back to a bounded epoll_wait() so timers still fire.
+            const auto sleepTime = std::chrono::duration_cast<Clock::Milliseconds64>(awakenTime - currentTime);
+            mEpollTimeoutMs      = static_cast<int>(std::min<uint64_t>(sleepTime.count(), INT32_MAX));
+        }
+        return;
+    }
+    mTimerFdAwakenTime = armedTime;
+}
+
+void LayerImplEpoll::PrepareEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    const Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    // Clock::Timestamp::max() means "no deadline": the timerfd stays disarmed rather than being re-armed
+    // for a moving default on every iteration.
+    Clock::Timestamp awakenTime = Clock::Timestamp::max();
+
+    TimerQueue::Node * timer = mTimerList.Earliest();
+    if (timer)
+    {
+        awakenTime = std::min(awakenTime, timer->AwakenTime());
+    }
+
+    // Activate added EventLoopHandlers and call PrepareEvents on active handlers.
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        switch (auto & state = LoopHandlerState(loop))
+        {
+        case kLoopHandlerPending:
+            state = kLoopHandlerActive;
+            [[fallthrough]];
+        case kLoopHandlerActive:
+            awakenTime = std::min(awakenTime, loop.PrepareEvents(currentTime));
+            break;
+        }
+    }
+
+    ArmTimerFd(awakenTime, currentTime);
+
+    VerifyOrReturn(!mSources.Empty());
+
+    awakenTime                       = std::min<Clock::Timestamp>(awakenTime, currentTime + kDefaultMinSleepPeriod);
+    const Clock::Timestamp sleepTime = (awakenTime > currentTime) ? (awakenTime - currentTime) : Clock::kZero;
+
+    Clock::ToTimeval(sleepTime, mNextTimeout);
+
+    // NOLINTBEGIN(clang-analyzer-security.insecureAPI.bzero)
+    FD_ZERO(&mSelected.mReadSet);
+    FD_ZERO(&mSelected.mWriteSet);
+    FD_ZERO(&mSelected.mErrorSet);
+    // NOLINTEND(clang-analyzer-security.insecureAPI.bzero)
+
+    // The epoll descriptor becomes readable when any descriptor registered with it (sockets, the wake
+    // event or the timerfd) is ready.
+    FD_SET(mEpollFd, &mSelected.mReadSet);
+    mMaxFd = mEpollFd;
+
+    for (auto & source : mSources)
+    {
+        source.PrepareEvents(mMaxFd, mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet, mNextTimeout);
+    }
+}
+
+void LayerImplEpoll::WaitForEvents()
+{
+    if (mSources.Empty())
+    {
+        mSelectResult = -1;
+        mEpollResult  = epoll_wait(mEpollFd, mEpollEvents, kMaxEpollEvents, mEpollTimeoutMs);
+        return;
+    }
+
+    mSelectResult = select(mMaxFd + 1, &mSelected.mReadSet, &mSelected.mWriteSet, &mSelected.mErrorSet, &mNextTimeout);
+    if (mSelectResult > 0 && FD_ISSET(mEpollFd, &mSelected.mReadSet))
+    {
+        mEpollResult = epoll_wait(mEpollFd, mEpollEvents, kMaxEpollEvents, 0);
+    }
+    else
+    {
+        mEpollResult = (mSelectResult < 0) ? -1 : 0;
+    }
+}
+
+void LayerImplEpoll::DispatchSocketEvents(const struct epoll_event & event)
+{
+    // The watch may have been stopped (or stopped and reused) by a callback earlier in this pass; only
+    // report events the current owner still asks for.
+    SocketWatch * w = FindSocketWatch(event.data.fd);
+    VerifyOrReturn(w != nullptr && w->mCallback != nullptr);
+
+    // As with select(), an error or hangup makes the descriptor both readable and writable, so it is
+    // reported through whichever of those the watch asked for and the endpoint sees the failure on its
+    // next recv()/send().
+    const bool failed = (event.events & (EPOLLERR | EPOLLHUP)) != 0;
+
+    SocketEvents events;
+    if ((failed || (event.events & EPOLLIN)) && w->mPendingIO.Has(SocketEventFlags::kRead))
+    {
+        events.Set(SocketEventFlags::kRead);
+    }
+    if ((failed || (event.events & EPOLLOUT)) && w->mPendingIO.Has(SocketEventFlags::kWrite))
+    {
+        events.Set(SocketEventFlags::kWrite);
+    }
+
+    if (events.HasAny())
+    {
+        w->mCallback(events, w->mCallbackData);
+    }
+}
+
+void LayerImplEpoll::HandleEvents()
+{
+    assertChipStackLockedByCurrentThread();
+
+    if (!IsSelectResultValid())
+    {
+        VerifyOrReturn(errno != EINTR); // EINTR is not really an error (and we don't use it for signal handling)
+        ChipLogError(DeviceLayer, "epoll_wait failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
+        return;
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = pthread_self();
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    for (int i = 0; i < mEpollResult; i++)
+    {
+        if (mEpollEvents[i].data.fd == mWakeEvent.GetReadFD())
+        {
+            mWakeEvent.Confirm();
+        }
+        else if (mEpollEvents[i].data.fd == mTimerFd)
+        {
+            uint64_t expirations;
+            (void) read(mTimerFd, &expirations, sizeof(expirations));
+            mTimerFdAwakenTime = Clock::kZero;
+        }
+    }
+
+    // Obtain the list of currently expired timers. Any new timers added by timer callback are NOT handled on this pass,
+    // since that could result in infinite handling of new timers blocking any other progress.
+    VerifyOrDieWithMsg(mExpiredTimers.Empty(), DeviceLayer, "Re-entry into HandleEvents from a timer callback?");
+    mExpiredTimers          = mTimerList.ExtractEarlier(Clock::Timeout(1) + SystemClock().GetMonotonicTimestamp());
+    TimerList::Node * timer = nullptr;
+    while ((timer = mExpiredTimers.PopEarliest()) != nullptr)
+    {
+        mTimerPool.Invoke(static_cast<TimerQueue::Node *>(timer));
+    }
+
+    // Process socket events, if any.  Only ready descriptors are visited.
+    for (int i = 0; i < mEpollResult; i++)
+    {
+        const int fd = mEpollEvents[i].data.fd;
+        if (fd != mWakeEvent.GetReadFD() && fd != mTimerFd)
+        {
+            DispatchSocketEvents(mEpollEvents[i]);
+        }
+    }
+    mEpollResult = 0;
+
+    if (mSelectResult >= 0)
+    {
+        for (auto & source : mSources)
+        {
+            source.ProcessEvents(mSelected.mReadSet, mSelected.mWriteSet, mSelected.mErrorSet);
+        }
+    }
+
+    // Call HandleEvents for active loop handlers
+    auto loopIter = mLoopHandlers.begin();
+    while (loopIter != mLoopHandlers.end())
+    {
+        auto & loop = *loopIter++; // advance before calling out, in case a list modification clobbers the `next` pointer
+        if (LoopHandlerState(loop) == kLoopHandlerActive)
+        {
+            loop.HandleEvents();
+        }
+    }
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    mHandleSelectThread = PTHREAD_NULL;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+}
+
+void LayerImplEpoll::SocketWatch::Clear()
+{
+    mFD = kInvalidFd;
+    mPendingIO.ClearAll();
+    mEpollEvents  = 0;
+    mRegistered   = false;
+    mCallback     = nullptr;
+    mCallbackData = 0;
+}
+
+} // namespace System
+} // namespace chip
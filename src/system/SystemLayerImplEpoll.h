@@ -0,0 +1,235 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares an implementation of System::Layer using Linux epoll() and timerfd.
+ *
+ *      Unlike LayerImplSelect, socket watches are registered with the kernel once (and updated only
+ *      when the requested events change), so the cost of a wakeup is proportional to the number of
+ *      ready descriptors rather than to the highest descriptor number, and the number of watched
+ *      sockets is not limited by FD_SETSIZE.
+ */
+
+#pragma once
+
+#include "system/SystemConfig.h"
+
+#if !CHIP_SYSTEM_CONFIG_USE_EPOLL
+#error "SystemLayerImplEpoll.h requires CHIP_SYSTEM_CONFIG_USE_EPOLL"
+#endif
+
+#include <sys/epoll.h>
+#include <sys/select.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
+#include <pthread.h>
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <lib/support/IntrusiveList.h>
+#include <lib/support/ObjectLifeCycle.h>
+#include <system/SystemLayer.h>
+#include <system/SystemTimer.h>
+#include <system/WakeEvent.h>
+
+namespace chip {
+namespace System {
+
+class LayerImplEpoll : public LayerSelectLoop
+{
+public:
+    LayerImplEpoll() = default;
+    ~LayerImplEpoll() override { VerifyOrDie(mLayerState.Destroy()); }
+
+    // Layer overrides.
+    CriticalFailure Init() override;
+    void Shutdown() override;
+    bool IsInitialized() const override { return mLayerState.IsInitialized(); }
+    CriticalFailure StartTimer(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    CHIP_ERROR ExtendTimerTo(Clock::Timeout delay, TimerCompleteCallback onComplete, void * appState) override;
+    bool IsTimerActive(TimerCompleteCallback onComplete, void * appState) override;
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback onComplete, void * appState) override;
+    void CancelTimer(TimerCompleteCallback onComplete, void * appState) override;
+    CriticalFailure ScheduleWork(TimerCompleteCallback onComplete, void * appState) override;
+
+    // LayerSocket overrides.
+    CHIP_ERROR StartWatchingSocket(int fd, SocketWatchToken * tokenOut) override;
+    CHIP_ERROR SetCallback(SocketWatchToken token, SocketWatchCallback callback, intptr_t data) override;
+    CHIP_ERROR RequestCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR RequestCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingRead(SocketWatchToken token) override;
+    CHIP_ERROR ClearCallbackOnPendingWrite(SocketWatchToken token) override;
+    CHIP_ERROR StopWatchingSocket(SocketWatchToken * tokenInOut) override;
+    SocketWatchToken InvalidSocketWatchToken() override { return reinterpret_cast<SocketWatchToken>(nullptr); }
+
+    // LayerSelectLoop overrides.
+    void Signal() override;
+    void EventLoopBegins() override {}
+    void PrepareEvents() override;
+    void WaitForEvents() override;
+    void HandleEvents() override;
+    void EventLoopEnds() override {}
+
+    void AddLoopHandler(EventLoopHandler & handler) override;
+    void RemoveLoopHandler(EventLoopHandler & handler) override;
+
+    // Expose the result of WaitForEvents() for non-blocking socket implementations.
+    bool IsSelectResultValid() const { return mEpollResult >= 0; }
+
+    /**
+     * @brief Abstract interface for an event source compatible with a select()-based event loop.
+     *
+     * This is source-compatible with LayerImplSelect::EventSource so that components which integrate
+     * external descriptors (e.g. the OpenThread POSIX platform) work unchanged with either layer.
+     *
+     * Event sources are not registered with epoll, since their descriptor sets may change on every
+     * iteration. While at least one source is registered, WaitForEvents() calls select() on the source
+     * descriptors together with the epoll descriptor itself, and only harvests epoll events when the
+     * epoll descriptor is readable. With no sources registered, select() is not used at all.
+     */
+    struct EventSource : public IntrusiveListNodeBase<IntrusiveMode::Strict>
+    {
+        virtual ~EventSource() = default;
+
+        /**
+         * @brief Prepares the file descriptor sets and timeout before the select() call.
+         *
+         * See LayerImplSelect::EventSource::PrepareEvents() for the timeout modification rules.
+         */
+        virtual void PrepareEvents(int & maxfd, fd_set & readfds, fd_set & writefds, fd_set & exceptfds,
+                                   struct timeval & timeout) = 0;
+
+        /**
+         * @brief Processes the results after the select() call returns.
+         */
+        virtual void ProcessEvents(const fd_set & readfds, const fd_set & writefds, const fd_set & exceptfds) = 0;
+    };
+
+    /**
+     * @brief Register an EventSource with this layer.
+     *
+     * Same contract as LayerImplSelect::EventSourceAdd(): MUST be called with the ChipStack lock held,
+     * and the layer does not take ownership of @p source.
+     */
+    void EventSourceAdd(EventSource * source);
+
+    /**
+     * @brief Unregister a previously added EventSource. Safe to call for a source that is not registered.
+     */
+    void EventSourceRemove(EventSource * source);
+
+    /**
+     * @brief Clear all registered EventSource instances without destroying them.
+     */
+    void EventSourceClear();
+
+protected:
+    static constexpr int kSocketWatchMax = (INET_CONFIG_ENABLE_TCP_ENDPOINT ? INET_CONFIG_NUM_TCP_ENDPOINTS : 0) +
+        (INET_CONFIG_ENABLE_UDP_ENDPOINT ? INET_CONFIG_NUM_UDP_ENDPOINTS : 0);
+
+    // Upper bound on the number of ready descriptors harvested by a single epoll_wait() call.  Any
+    // further ready descriptors remain ready (level-triggered) and are reported on the next iteration.
+    static constexpr int kMaxEpollEvents = 64;
+
+    // Size of the open-addressed fd -> watch index; a power of two with at least half the slots free.
+    static constexpr size_t kSocketWatchIndexSize = []() {
+        size_t size = 1;
+        while (size < 2 * static_cast<size_t>(kSocketWatchMax))
+        {
+            size <<= 1;
+        }
+        return size;
+    }();
+    static constexpr int16_t kNoSocketWatch = -1;
+    static_assert(kSocketWatchMax < INT16_MAX, "Socket watch pool index must fit in mSocketWatchIndex");
+
+    struct SocketWatch
+    {
+        void Clear();
+        int mFD;
+        SocketEvents mPendingIO;
+        // Events currently registered with the kernel; only meaningful while mRegistered is true.
+        uint32_t mEpollEvents;
+        // Whether mFD is in the epoll set; it is only while read or write events are requested.
+        bool mRegistered;
+        SocketWatchCallback mCallback;
+        intptr_t mCallbackData;
+    };
+
+    static size_t SocketWatchIndexSlot(int fd) { return static_cast<size_t>(fd) & (kSocketWatchIndexSize - 1); }
+    SocketWatch * FindSocketWatch(int fd);
+    void IndexSocketWatch(SocketWatch & watch);
+    void UnindexSocketWatch(const SocketWatch & watch);
+
+    CHIP_ERROR UpdateEpollRegistration(SocketWatch & watch);
+    void ArmTimerFd(Clock::Timestamp awakenTime, Clock::Timestamp currentTime);
+    void DispatchSocketEvents(const struct epoll_event & event);
+
+    IntrusiveList<EventSource> mSources;
+
+    SocketWatch mSocketWatchPool[kSocketWatchMax];
+    // Indices into mSocketWatchPool of the active watches, hashed by descriptor (linear probing).
+    int16_t mSocketWatchIndex[kSocketWatchIndexSize];
+
+    TimerPool<TimerQueue::Node> mTimerPool;
+    TimerQueue mTimerList;
+    // List of expired timers being processed right now.  Stored in a member so
+    // we can cancel them.
+    TimerList mExpiredTimers;
+
+    IntrusiveList<EventLoopHandler> mLoopHandlers;
+
+    int mEpollFd = -1;
+    int mTimerFd = -1;
+    // The awaken time the timerfd is currently armed for, or kZero if it is disarmed.  The timerfd is
+    // only re-armed when the earliest deadline differs from this.
+    Clock::Timestamp mTimerFdAwakenTime = Clock::kZero;
+    // Timeout passed to epoll_wait(): 0 when work is already due, -1 to rely on the timerfd.
+    int mEpollTimeoutMs = -1;
+
+    struct epoll_event mEpollEvents[kMaxEpollEvents];
+
+    // Members used only while EventSources are registered.
+    struct SelectSets
+    {
+        fd_set mReadSet;
+        fd_set mWriteSet;
+        fd_set mErrorSet;
+    };
+    SelectSets mSelected;
+    int mMaxFd;
+    timeval mNextTimeout;
+
+    // Number of entries in mEpollEvents, or -1 on error; carried between WaitForEvents() and HandleEvents().
+    int mEpollResult = 0;
+    // Return value from select() when EventSources are registered.
+    int mSelectResult = 0;
+
+    ObjectLifeCycle mLayerState;
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+    std::atomic<pthread_t> mHandleSelectThread;
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+    WakeEvent mWakeEvent;
+};
+
+using LayerImpl = LayerImplEpoll;
+
+} // namespace System
+} // namespace chip
@@ -230,8 +230,8 @@ protected:
     SocketWatch mSocketWatchPool[kSocketWatchMax];
 #endif
 
-    TimerPool<TimerList::Node> mTimerPool;
-    TimerList mTimerList;
+    TimerPool<TimerQueue::Node> mTimerPool;
+    TimerQueue mTimerList;
     // List of expired timers being processed right now.  Stored in a member so
     // we can cancel them.
     TimerList mExpiredTimers;
@@ -58,6 +58,10 @@
 #include <lib/support/CHIPMem.h>
 #endif
 
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+#include <system/SystemPacketBufferSlab.h>
+#endif
+
 namespace chip {
 namespace System {
 
@@ -114,8 +118,10 @@ void PacketBuffer::InternalCheck(const PacketBuffer * buffer)
 {
     if (buffer)
     {
+#if !CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
         VerifyOrDieWithMsg(::chip::Platform::MemoryDebugCheckPointer(buffer, buffer->alloc_size + kStructureSize), chipSystemLayer,
                            "invalid packet buffer pointer");
+#endif
         VerifyOrDieWithMsg(buffer->alloc_size >= buffer->ReservedSize() + buffer->len, chipSystemLayer,
                            "packet buffer overflow %" PRIu32 " < %" PRIu32 " +%" PRIu32, static_cast<uint32_t>(buffer->alloc_size),
                            static_cast<uint32_t>(buffer->ReservedSize()), static_cast<uint32_t>(buffer->len));
@@ -143,8 +149,12 @@ void PacketBufferHandle::InternalRightSize()
         return;
     }
 
-    const size_t blockSize   = usedSize + PacketBuffer::kStructureSize;
+    const size_t blockSize = usedSize + PacketBuffer::kStructureSize;
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(PacketBufferSlab::Allocate(blockSize));
+#else
     PacketBuffer * newBuffer = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(blockSize));
+#endif
     if (newBuffer == nullptr)
     {
         ChipLogError(chipSystemLayer, "PacketBuffer: pool EMPTY.");
@@ -644,7 +654,11 @@ PacketBufferHandle PacketBufferHandle::New(size_t aAvailableSize, uint16_t aRese
     // sumOfSizes is essentially (kStructureSize + lAllocSize) which we already
     // checked to fit in a size_t.
     const size_t lBlockSize = static_cast<size_t>(sumOfSizes);
-    lPacket                 = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+    lPacket = reinterpret_cast<PacketBuffer *>(PacketBufferSlab::Allocate(lBlockSize));
+#else
+    lPacket = reinterpret_cast<PacketBuffer *>(chip::Platform::MemoryAlloc(lBlockSize));
+#endif
 
 #else
 #error "Unimplemented PacketBuffer storage case"
@@ -724,12 +738,17 @@ void PacketBuffer::Free(PacketBuffer * aPacket)
         {
             SYSTEM_STATS_DECREMENT(chip::System::Stats::kSystemLayer_NumPacketBufs);
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
-            ::chip::Platform::MemoryDebugCheckPointer(aPacket, aPacket->alloc_size + kStructureSize);
+            const size_t blockSize = aPacket->alloc_size + kStructureSize;
+#if !CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+            ::chip::Platform::MemoryDebugCheckPointer(aPacket, blockSize);
+#endif
 #endif
             aPacket->Clear();
 #if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL
             aPacket->next = sFreeList;
             sFreeList     = aPacket;
+#elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+            PacketBufferSlab::Release(aPacket, blockSize);
 #elif CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP
             chip::Platform::MemoryFree(aPacket);
 #endif
@@ -49,6 +49,22 @@
 #define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_POOL 0
 #endif
 
+/**
+ * CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB
+ *
+ * True if packet buffers are allocated in the SDK from size-classed slabs backed by malloc() (see PacketBufferSlab).
+ * This is a variant of CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP, which is also true in that case.
+ */
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_HEAP && CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB
+#define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB 1
+#else
+#define CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB 0
+#endif
+
+#if CHIP_SYSTEM_PACKETBUFFER_FROM_CHIP_SLAB && !CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#error "CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB requires CHIP_SYSTEM_CONFIG_POSIX_LOCKING"
+#endif
+
 /**
  * CHIP_SYSTEM_PACKETBUFFER_FROM_LWIP_POOL
  *
@@ -0,0 +1,354 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file implements the size-classed slab allocator that backs System::PacketBuffer
+ *      when CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB is enabled.
+ */
+
+#include <system/SystemPacketBufferSlab.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <lib/support/CodeUtils.h>
+
+#include <atomic>
+#include <mutex>
+#include <stdlib.h>
+#include <string.h>
+
+namespace chip {
+namespace System {
+
+namespace {
+
+constexpr size_t kThreadCacheSize = CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE;
+constexpr size_t kSharedCacheSize = CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_SHARED_CACHE_SIZE;
+// Blocks move between a thread cache and the shared cache in batches, so that a thread that only allocates (or only
+// frees) takes the shared lock once per batch rather than once per block.
+constexpr size_t kTransferBatchSize = (kThreadCacheSize + 1) / 2;
+
+static_assert(kThreadCacheSize > 0, "CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE must be positive");
+
+// Free blocks are chained through their first bytes.
+struct FreeBlock
+{
+    FreeBlock * mNext;
+};
+
+constexpr size_t kNoSizeClass = PacketBufferSlab::kNumSizeClasses;
+
+size_t SizeClassFor(size_t aBlockSize)
+{
+    for (size_t i = 0; i < PacketBufferSlab::kNumSizeClasses; i++)
+    {
+        if (aBlockSize <= PacketBufferSlab::kSizeClasses[i])
+        {
+            return i;
+        }
+    }
+    return kNoSizeClass;
+}
+
+struct SharedCache
+{
+    std::mutex mLock;
+    FreeBlock * mFreeLists[PacketBufferSlab::kNumSizeClasses] = {};
+    size_t mCounts[PacketBufferSlab::kNumSizeClasses]         = {};
+
+    // Moves up to aMaxBlocks blocks of the given class into aBlocks, returning how many were moved.
+    size_t Take(size_t aSizeClass, void ** aBlocks, size_t aMaxBlocks)
+    {
+        std::lock_guard<std::mutex> lock(mLock);
+        size_t taken = 0;
+        while (taken < aMaxBlocks && mFreeLists[aSizeClass] != nullptr)
+        {
+            FreeBlock * block      = mFreeLists[aSizeClass];
+            mFreeLists[aSizeClass] = block->mNext;
+            aBlocks[taken++]       = block;
+        }
+        mCounts[aSizeClass] -= taken;
+        return taken;
+    }
+
+    // Adds the given blocks to the cache, freeing those that do not fit.
+    void Put(size_t aSizeClass, void * const * aBlocks, size_t aNumBlocks)
+    {
+        size_t kept = 0;
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            for (; kept < aNumBlocks && mCounts[aSizeClass] < kSharedCacheSize; kept++)
+            {
+                auto * block           = static_cast<FreeBlock *>(aBlocks[kept]);
+                block->mNext           = mFreeLists[aSizeClass];
+                mFreeLists[aSizeClass] = block;
+                mCounts[aSizeClass]++;
+            }
+        }
+        for (size_t i = kept; i < aNumBlocks; i++)
+        {
+            ::free(aBlocks[i]);
+        }
+    }
+
+    void ReleaseAll()
+    {
+        FreeBlock * lists[PacketBufferSlab::kNumSizeClasses];
+        {
+            std::lock_guard<std::mutex> lock(mLock);
+            for (size_t i = 0; i < PacketBufferSlab::kNumSizeClasses; i++)
+            {
+                lists[i]      = mFreeLists[i];
+                mFreeLists[i] = nullptr;
+                mCounts[i]    = 0;
+            }
+        }
+        for (FreeBlock * list : lists)
+        {
+            while (list != nullptr)
+            {
+                FreeBlock * next = list->mNext;
+                ::free(list);
+                list = next;
+            }
+        }
+    }
+};
+
+SharedCache sSharedCache;
+
+struct ThreadCache
+{
+    void * mBlocks[PacketBufferSlab::kNumSizeClasses][kThreadCacheSize];
+    size_t mCounts[PacketBufferSlab::kNumSizeClasses] = {};
+    // Blocks released while the thread is exiting, after this cache was destroyed, go to the shared cache directly.
+    bool mDestroyed = false;
+
+    ~ThreadCache()
+    {
+        for (size_t i = 0; i < PacketBufferSlab::kNumSizeClasses; i++)
+        {
+            sSharedCache.Put(i, mBlocks[i], mCounts[i]);
+            mCounts[i] = 0;
+        }
+        mDestroyed = true;
+    }
+};
+
+thread_local ThreadCache sThreadCache;
+
+std::atomic<size_t> sBlocksInUse{ 0 };
+std::atomic<size_t> sBlocksHighWatermark{ 0 };
+std::atomic<size_t> sBytesInUse{ 0 };
+std::atomic<size_t> sBytesHighWatermark{ 0 };
+std::atomic<uint64_t> sThreadCacheHits{ 0 };
+std::atomic<uint64_t> sSharedCacheHits{ 0 };
+std::atomic<uint64_t> sHeapAllocations{ 0 };
+std::atomic<uint64_t> sSoftCapAllocations{ 0 };
+std::atomic<size_t> sSoftCap{ CHIP_SYSTEM_CONFIG_PACKETBUFFER_SOFT_CAP };
+std::atomic<PacketBufferSlab::BackpressureHandler> sBackpressureHandler{ nullptr };
+
+void RaiseWatermark(std::atomic<size_t> & aWatermark, size_t aValue)
+{
+    size_t watermark = aWatermark.load(std::memory_order_relaxed);
+    while (watermark < aValue && !aWatermark.compare_exchange_weak(watermark, aValue, std::memory_order_relaxed))
+    {
+    }
+}
+
+void NotifyBackpressure()
+{
+    PacketBufferSlab::BackpressureHandler handler = sBackpressureHandler.load(std::memory_order_acquire);
+    if (handler != nullptr)
+    {
+        handler();
+    }
+}
+
+void CountAllocated(size_t aBytes)
+{
+    size_t blocks = sBlocksInUse.fetch_add(1, std::memory_order_relaxed) + 1;
+    size_t bytes  = sBytesInUse.fetch_add(aBytes, std::memory_order_relaxed) + aBytes;
+    RaiseWatermark(sBlocksHighWatermark, blocks);
+    RaiseWatermark(sBytesHighWatermark, bytes);
+
+    size_t softCap = sSoftCap.load(std::memory_order_relaxed);
+    if (softCap != 0 && blocks > softCap)
+    {
+        sSoftCapAllocations.fetch_add(1, std::memory_order_relaxed);
+        if (blocks == softCap + 1)
+        {
+            NotifyBackpressure();
+        }
+    }
+}
+
+void CountReleased(size_t aBytes)
+{
+    size_t blocks = sBlocksInUse.fetch_sub(1, std::memory_order_relaxed);
+    sBytesInUse.fetch_sub(aBytes, std::memory_order_relaxed);
+
+    size_t softCap = sSoftCap.load(std::memory_order_relaxed);
+    if (softCap != 0 && blocks == softCap + 1)
+    {
+        NotifyBackpressure();
+    }
+}
+
+} // namespace
+
+void * PacketBufferSlab::Allocate(size_t aBlockSize)
+{
+    size_t sizeClass = SizeClassFor(aBlockSize);
+    if (sizeClass == kNoSizeClass)
+    {
+        void * block = ::malloc(aBlockSize);
+        VerifyOrReturnValue(block != nullptr, nullptr);
+        sHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+        CountAllocated(aBlockSize);
+        return block;
+    }
+
+    void * block        = nullptr;
+    ThreadCache & cache = sThreadCache;
+    if (cache.mDestroyed)
+    {
+        if (sSharedCache.Take(sizeClass, &block, 1) > 0)
+        {
+            sSharedCacheHits.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+    else
+    {
+        size_t & count       = cache.mCounts[sizeClass];
+        void ** const blocks = cache.mBlocks[sizeClass];
+        if (count > 0)
+        {
+            block = blocks[--count];
+            sThreadCacheHits.fetch_add(1, std::memory_order_relaxed);
+        }
+        else if ((count = sSharedCache.Take(sizeClass, blocks, kTransferBatchSize)) > 0)
+        {
+            // A whole batch was moved into the thread cache, so the next allocations do not take the shared lock.
+            block = blocks[--count];
+            sSharedCacheHits.fetch_add(1, std::memory_order_relaxed);
+        }
+    }
+
+    if (block == nullptr)
+    {
+        block = ::malloc(kSizeClasses[sizeClass]);
+        VerifyOrReturnValue(block != nullptr, nullptr);
+        sHeapAllocations.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    CountAllocated(kSizeClasses[sizeClass]);
+    return block;
+}
+
+void PacketBufferSlab::Release(void * aBlock, size_t aBlockSize)
+{
+    VerifyOrReturn(aBlock != nullptr);
+
+    size_t sizeClass = SizeClassFor(aBlockSize);
+    if (sizeClass == kNoSizeClass)
+    {
+        CountReleased(aBlockSize);
+        ::free(aBlock);
+        return;
+    }
+
+    CountReleased(kSizeClasses[sizeClass]);
+
+    ThreadCache & cache = sThreadCache;
+    if (cache.mDestroyed)
+    {
+        sSharedCache.Put(sizeClass, &aBlock, 1);
+        return;
+    }
+
+    size_t & count       = cache.mCounts[sizeClass];
+    void ** const blocks = cache.mBlocks[sizeClass];
+    if (count == kThreadCacheSize)
+    {
+        // Hand the oldest half of the cache over to other threads; keep the most recently freed (cache-warm) blocks.
+        sSharedCache.Put(sizeClass, blocks, kTransferBatchSize);
+        count -= kTransferBatchSize;
+        memmove(blocks, blocks + kTransferBatchSize, count * sizeof(void *));
+    }
+    blocks[count++] = aBlock;
+}
+
+void PacketBufferSlab::SetSoftCap(size_t aMaxBlocks)
+{
+    sSoftCap.store(aMaxBlocks, std::memory_order_relaxed);
+}
+
+bool PacketBufferSlab::IsOverSoftCap()
+{
+    size_t softCap = sSoftCap.load(std::memory_order_relaxed);
+    return softCap != 0 && sBlocksInUse.load(std::memory_order_relaxed) > softCap;
+}
+
+void PacketBufferSlab::SetBackpressureHandler(BackpressureHandler aHandler)
+{
+    sBackpressureHandler.store(aHandler, std::memory_order_release);
+}
+
+PacketBufferSlab::Stats PacketBufferSlab::GetStats()
+{
+    Stats stats;
+    stats.mBlocksInUse         = sBlocksInUse.load(std::memory_order_relaxed);
+    stats.mBlocksHighWatermark = sBlocksHighWatermark.load(std::memory_order_relaxed);
+    stats.mBytesInUse          = sBytesInUse.load(std::memory_order_relaxed);
+    stats.mBytesHighWatermark  = sBytesHighWatermark.load(std::memory_order_relaxed);
+    stats.mThreadCacheHits     = sThreadCacheHits.load(std::memory_order_relaxed);
+    stats.mSharedCacheHits     = sSharedCacheHits.load(std::memory_order_relaxed);
+    stats.mHeapAllocations     = sHeapAllocations.load(std::memory_order_relaxed);
+    stats.mSoftCapAllocations  = sSoftCapAllocations.load(std::memory_order_relaxed);
+    return stats;
+}
+
+void PacketBufferSlab::ResetHighWatermarks()
+{
+    sBlocksHighWatermark.store(sBlocksInUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+    sBytesHighWatermark.store(sBytesInUse.load(std::memory_order_relaxed), std::memory_order_relaxed);
+}
+
+void PacketBufferSlab::ReleaseCachedBlocks()
+{
+    ThreadCache & cache = sThreadCache;
+    if (!cache.mDestroyed)
+    {
+        for (size_t i = 0; i < kNumSizeClasses; i++)
+        {
+            for (size_t j = 0; j < cache.mCounts[i]; j++)
+            {
+                ::free(cache.mBlocks[i][j]);
+            }
+            cache.mCounts[i] = 0;
+        }
+    }
+    sSharedCache.ReleaseAll();
+}
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
@@ -0,0 +1,111 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      This file declares the size-classed slab allocator that backs System::PacketBuffer
+ *      when CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB is enabled.
+ */
+
+#pragma once
+
+#include <system/SystemConfig.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <stddef.h>
+#include <stdint.h>
+
+namespace chip {
+namespace System {
+
+/**
+ * Allocator for packet buffer memory.
+ *
+ * Requests are rounded up to one of a few size classes. Freed blocks are kept in a small cache owned by the freeing
+ * thread, spill over in batches into a cache shared by all threads, and only go back to the heap once both are full.
+ * Requests larger than the largest size class (e.g. large TCP buffers) go straight to the heap.
+ *
+ * Blocks come from malloc() rather than Platform::MemoryAlloc(), since cached blocks outlive Platform::MemoryShutdown()
+ * and are only released when their thread exits.
+ *
+ * All methods are thread-safe. The allocator is available on all POSIX hosts, but only backs packet buffers when
+ * CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB is enabled.
+ */
+class PacketBufferSlab
+{
+public:
+    // Block sizes, including the PacketBuffer header. The largest class fits a buffer of
+    // CHIP_SYSTEM_CONFIG_PACKETBUFFER_CAPACITY_MAX bytes.
+    static constexpr size_t kSizeClasses[]  = { 256, 512, 1024, 2048 };
+    static constexpr size_t kNumSizeClasses = sizeof(kSizeClasses) / sizeof(kSizeClasses[0]);
+
+    struct Stats
+    {
+        size_t mBlocksInUse          = 0;
+        size_t mBlocksHighWatermark  = 0;
+        size_t mBytesInUse           = 0; // Rounded up to the size class of each block.
+        size_t mBytesHighWatermark   = 0;
+        uint64_t mThreadCacheHits    = 0; // Allocations served from the cache of the allocating thread.
+        uint64_t mSharedCacheHits    = 0; // Allocations served from the shared cache.
+        uint64_t mHeapAllocations    = 0; // Allocations that had to go to the heap.
+        uint64_t mSoftCapAllocations = 0; // Allocations made while over the soft cap.
+    };
+
+    /**
+     * Called, from whichever thread allocated or released a block, when the number of blocks in use crosses the soft cap in
+     * either direction. Concurrent crossings may be reported out of order, so handlers should check IsOverSoftCap() (e.g.
+     * after scheduling work on the event loop) rather than track the crossings themselves.
+     */
+    using BackpressureHandler = void (*)();
+
+    /**
+     * Returns a block of at least aBlockSize bytes, or nullptr if the heap is exhausted.
+     */
+    static void * Allocate(size_t aBlockSize);
+
+    /**
+     * Releases a block returned by Allocate(). aBlockSize must be the size that was passed to Allocate().
+     */
+    static void Release(void * aBlock, size_t aBlockSize);
+
+    /**
+     * Sets the number of blocks in use above which the allocator reports backpressure. Zero disables reporting.
+     * Defaults to CHIP_SYSTEM_CONFIG_PACKETBUFFER_SOFT_CAP.
+     */
+    static void SetSoftCap(size_t aMaxBlocks);
+    static bool IsOverSoftCap();
+    static void SetBackpressureHandler(BackpressureHandler aHandler);
+
+    static Stats GetStats();
+
+    /**
+     * Resets the high watermarks to the current usage.
+     */
+    static void ResetHighWatermarks();
+
+    /**
+     * Returns the blocks in the shared cache and in the cache of the calling thread to the heap.
+     */
+    static void ReleaseCachedBlocks();
+};
+
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
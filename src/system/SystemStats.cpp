@@ -51,6 +51,8 @@ static const Label sStatsStrings[chip::System::Stats::kNumEntries] = {
 #endif
 #if INET_CONFIG_NUM_UDP_ENDPOINTS
     "UDP endpoints",
+    "UDP datagrams per receive batch",
+    "UDP datagrams per send batch",
 #endif
     "Exchange contexts",
     "Unsolicited message handlers",
@@ -61,6 +61,8 @@ enum
 #endif
 #if INET_CONFIG_NUM_UDP_ENDPOINTS
     kInetLayer_NumUDPEps,
+    kInetLayer_UDPRecvBatch,
+    kInetLayer_UDPSendBatch,
 #endif
     kExchangeMgr_NumContexts,
     kExchangeMgr_NumUMHandlers,
@@ -164,6 +166,8 @@ const Label * GetStrings();
 
 #define SYSTEM_STATS_DECREMENT_BY_N(entry, count)
 
+#define SYSTEM_STATS_SET(entry, count)
+
 #define SYSTEM_STATS_RESET(entry)
 
 #define SYSTEM_STATS_UPDATE_LWIP_PBUF_COUNTS()
@@ -27,6 +27,7 @@
 #include <system/SystemTimer.h>
 
 // Include local headers
+#include <algorithm>
 #include <string.h>
 
 #include <system/SystemError.h>
@@ -34,6 +35,7 @@
 #include <system/SystemLayer.h>
 
 #include <lib/support/CodeUtils.h>
+#include <lib/support/PopCount.h>
 
 namespace chip {
 namespace System {
@@ -178,5 +180,428 @@ Clock::Timeout TimerList::GetRemainingTime(TimerCompleteCallback aOnComplete, vo
     return Clock::kZero;
 }
 
+bool TimerWheel::IsEarlier(const Node * a, const Node * b)
+{
+    return (a->AwakenTime() < b->AwakenTime()) || ((a->AwakenTime() == b->AwakenTime()) && (a->mSequence < b->mSequence));
+}
+
+size_t TimerWheel::HashOf(TimerCompleteCallback onComplete, void * appState)
+{
+    uint64_t h = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(onComplete));
+    h ^= static_cast<uint64_t>(reinterpret_cast<uintptr_t>(appState)) * 0x9E3779B97F4A7C15ull;
+    h ^= h >> 29;
+    return static_cast<size_t>(h & (kHashBuckets - 1));
+}
+
+void TimerWheel::Clear()
+{
+    memset(mSlots, 0, sizeof(mSlots));
+    memset(mOccupied, 0, sizeof(mOccupied));
+    memset(mHash, 0, sizeof(mHash));
+    mOverdue       = nullptr;
+    mNow           = 0;
+    mEarliest      = nullptr;
+    mEarliestValid = true;
+    mNextSequence  = 0;
+    mCount         = 0;
+}
+
+void TimerWheel::Insert(Node * timer)
+{
+    const uint64_t awaken = timer->AwakenTime().count();
+    Node ** head;
+
+    if (awaken <= mNow)
+    {
+        timer->mSlot = kOverdue;
+        head         = &mOverdue;
+    }
+    else
+    {
+        unsigned level = 0;
+        uint64_t slot  = awaken;
+        if (awaken - mNow >= kSlotsPerLevel)
+        {
+            // Find the finest level on which the timer is less than a full turn ahead of the current slot.
+            for (level = 1; level < kLevels; level++)
+            {
+                slot = awaken >> (kLevelBits * level);
+                if (slot - (mNow >> (kLevelBits * level)) < kSlotsPerLevel)
+                {
+                    break;
+                }
+            }
+            if (level == kLevels)
+            {
+                // Beyond the range of the wheel: park in the last slot of the top level, from where the timer is
+                // re-inserted once that slot comes up.
+                level = kLevels - 1;
+                slot  = (mNow >> (kLevelBits * level)) + kSlotsPerLevel - 1;
+            }
+        }
+        const unsigned index = static_cast<unsigned>(slot & (kSlotsPerLevel - 1));
+        timer->mSlot         = static_cast<int16_t>(level * kSlotsPerLevel + index);
+        head                 = &mSlots[timer->mSlot];
+        mOccupied[level] |= (1ull << index);
+    }
+
+    timer->mPrevTimer = nullptr;
+    timer->mNextTimer = *head;
+    if (*head != nullptr)
+    {
+        (*head)->mPrevTimer = timer;
+    }
+    *head = timer;
+}
+
+void TimerWheel::Unlink(Node * timer)
+{
+    Node * next = static_cast<Node *>(timer->mNextTimer);
+    if (next != nullptr)
+    {
+        next->mPrevTimer = timer->mPrevTimer;
+    }
+    if (timer->mPrevTimer != nullptr)
+    {
+        timer->mPrevTimer->mNextTimer = next;
+    }
+    else if (timer->mSlot == kOverdue)
+    {
+        mOverdue = next;
+    }
+    else
+    {
+        mSlots[timer->mSlot] = next;
+        if (next == nullptr)
+        {
+            mOccupied[static_cast<unsigned>(timer->mSlot) / kSlotsPerLevel] &=
+                ~(1ull << (static_cast<unsigned>(timer->mSlot) % kSlotsPerLevel));
+        }
+    }
+    timer->mPrevTimer = nullptr;
+    timer->mNextTimer = nullptr;
+}
+
+TimerWheel::Node * TimerWheel::Add(Node * add)
+{
+    VerifyOrDie(add->mSlot == kNotQueued);
+
+    add->mSequence = mNextSequence++;
+    if (mCount == 0 && add->AwakenTime().count() > 0 && static_cast<uint64_t>(add->AwakenTime().count()) <= mNow)
+    {
+        // The clock went backwards (e.g. a mock clock in tests). An empty wheel can simply be rewound, which keeps
+        // the overdue list from collecting timers that are not due yet.
+        mNow = static_cast<uint64_t>(add->AwakenTime().count()) - 1;
+    }
+    Insert(add);
+
+    Node ** bucket = &mHash[HashOf(add->GetCallback().GetOnComplete(), add->GetCallback().GetAppState())];
+    add->mHashPrev = nullptr;
+    add->mHashNext = *bucket;
+    if (*bucket != nullptr)
+    {
+        (*bucket)->mHashPrev = add;
+    }
+    *bucket = add;
+    mCount++;
+
+    if (mEarliestValid && (mEarliest == nullptr || IsEarlier(add, mEarliest)))
+    {
+        mEarliest = add;
+    }
+    return Earliest();
+}
+
+TimerWheel::Node * TimerWheel::Remove(Node * remove)
+{
+    if (remove != nullptr && remove->mSlot != kNotQueued)
+    {
+        Unlink(remove);
+        remove->mSlot = kNotQueued;
+
+        if (remove->mHashNext != nullptr)
+        {
+            remove->mHashNext->mHashPrev = remove->mHashPrev;
+        }
+        if (remove->mHashPrev != nullptr)
+        {
+            remove->mHashPrev->mHashNext = remove->mHashNext;
+        }
+        else
+        {
+            mHash[HashOf(remove->GetCallback().GetOnComplete(), remove->GetCallback().GetAppState())] = remove->mHashNext;
+        }
+        remove->mHashNext = remove->mHashPrev = nullptr;
+        mCount--;
+
+        if (remove == mEarliest)
+        {
+            mEarliest      = nullptr;
+            mEarliestValid = false;
+        }
+    }
+    return Earliest();
+}
+
+TimerWheel::Node * TimerWheel::FindEarliest(TimerCompleteCallback onComplete, void * appState) const
+{
+    Node * found = nullptr;
+    for (Node * timer = mHash[HashOf(onComplete, appState)]; timer != nullptr; timer = timer->mHashNext)
+    {
+        if (timer->GetCallback().GetOnComplete() == onComplete && timer->GetCallback().GetAppState() == appState &&
+            (found == nullptr || IsEarlier(timer, found)))
+        {
+            found = timer;
+        }
+    }
+    return found;
+}
+
+TimerWheel::Node * TimerWheel::Remove(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = FindEarliest(aOnComplete, aAppState);
+    Remove(timer);
+    return timer;
+}
+
+TimerWheel::Node * TimerWheel::Earliest()
+{
+    VerifyOrReturnValue(!mEarliestValid, mEarliest);
+
+    Node * earliest = nullptr;
+    for (Node * timer = mOverdue; timer != nullptr; timer = static_cast<Node *>(timer->mNextTimer))
+    {
+        if (earliest == nullptr || IsEarlier(timer, earliest))
+        {
+            earliest = timer;
+        }
+    }
+
+    // On every level the timers are less than one turn ahead of the current slot, so the first occupied slot after
+    // the current one holds the earliest timer of that level. Levels overlap in time, so each one has to be checked.
+    for (unsigned level = 0; level < kLevels; level++)
+    {
+        const uint64_t occupied = mOccupied[level];
+        if (occupied == 0)
+        {
+            continue;
+        }
+        const unsigned start    = static_cast<unsigned>(((mNow >> (kLevelBits * level)) + 1) & (kSlotsPerLevel - 1));
+        const uint64_t rotated  = (start == 0) ? occupied : ((occupied >> start) | (occupied << (kSlotsPerLevel - start)));
+        const unsigned index    = (start + static_cast<unsigned>(PopCount((rotated & (~rotated + 1)) - 1))) & (kSlotsPerLevel - 1);
+        for (Node * timer = mSlots[level * kSlotsPerLevel + index]; timer != nullptr; timer = static_cast<Node *>(timer->mNextTimer))
+        {
+            if (earliest == nullptr || IsEarlier(timer, earliest))
+            {
+                earliest = timer;
+            }
+        }
+    }
+
+    mEarliest      = earliest;
+    mEarliestValid = true;
+    return mEarliest;
+}
+
+TimerWheel::Node * TimerWheel::PopEarliest()
+{
+    Node * earliest = Earliest();
+    Remove(earliest);
+    return earliest;
+}
+
+TimerWheel::Node * TimerWheel::PopIfEarlier(Clock::Timestamp t)
+{
+    Node * earliest = Earliest();
+    if ((earliest == nullptr) || !(earliest->AwakenTime() < t))
+    {
+        return nullptr;
+    }
+    Remove(earliest);
+    return earliest;
+}
+
+/**
+ * Move the wheel forward to @a now: timers expiring at or before @a now are prepended to @a expired (linked through
+ * mNextTimer, still registered in the hash index), and timers in visited slots that are not yet due cascade down to
+ * a finer level.
+ */
+void TimerWheel::Advance(uint64_t now, Node *& expired)
+{
+    Node * cascade = nullptr;
+
+    for (unsigned level = 0; level < kLevels; level++)
+    {
+        const unsigned shift = kLevelBits * level;
+        const uint64_t from  = (mNow >> shift) + 1;
+        const uint64_t to    = now >> shift;
+        if (to < from)
+        {
+            // Coarser levels move even more slowly.
+            break;
+        }
+        const uint64_t count = std::min<uint64_t>(to - from + 1, kSlotsPerLevel);
+        for (uint64_t i = 0; i < count; i++)
+        {
+            const unsigned index = static_cast<unsigned>((from + i) & (kSlotsPerLevel - 1));
+            Node ** head         = &mSlots[level * kSlotsPerLevel + index];
+            while (*head != nullptr)
+            {
+                Node * timer = *head;
+                Unlink(timer);
+                if (static_cast<uint64_t>(timer->AwakenTime().count()) <= now)
+                {
+                    timer->mNextTimer = expired;
+                    expired           = timer;
+                }
+                else
+                {
+                    timer->mNextTimer = cascade;
+                    cascade           = timer;
+                }
+            }
+        }
+    }
+
+    mNow = now;
+    while (cascade != nullptr)
+    {
+        Node * timer = cascade;
+        cascade      = static_cast<Node *>(timer->mNextTimer);
+        Insert(timer);
+    }
+}
+
+TimerWheel::Node * TimerWheel::SortByAwakenTime(Node * list)
+{
+    // Bottom-up merge sort on the mNextTimer links: stable and O(n log n) for large expiry batches.
+    if (list == nullptr || list->mNextTimer == nullptr)
+    {
+        return list;
+    }
+
+    for (size_t width = 1;; width *= 2)
+    {
+        Node * remaining          = list;
+        TimerList::Node * merged  = nullptr;
+        TimerList::Node ** tail   = &merged;
+        size_t merges             = 0;
+
+        while (remaining != nullptr)
+        {
+            merges++;
+            Node * left  = remaining;
+            Node * right = left;
+            size_t leftSize = 0;
+            while (leftSize < width && right != nullptr)
+            {
+                right = static_cast<Node *>(right->mNextTimer);
+                leftSize++;
+            }
+            size_t rightSize = width;
+            while (leftSize > 0 || (rightSize > 0 && right != nullptr))
+            {
+                Node * next;
+                if (leftSize == 0)
+                {
+                    next  = right;
+                    right = static_cast<Node *>(right->mNextTimer);
+                    rightSize--;
+                }
+                else if (rightSize == 0 || right == nullptr || !IsEarlier(right, left))
+                {
+                    next = left;
+                    left = static_cast<Node *>(left->mNextTimer);
+                    leftSize--;
+                }
+                else
+                {
+                    next  = right;
+                    right = static_cast<Node *>(right->mNextTimer);
+                    rightSize--;
+                }
+                *tail = next;
+                tail  = &next->mNextTimer;
+            }
+            remaining = right;
+        }
+        *tail = nullptr;
+        list  = static_cast<Node *>(merged);
+
+        if (merges <= 1)
+        {
+            return list;
+        }
+    }
+}
+
+TimerList TimerWheel::ExtractEarlier(Clock::Timestamp t)
+{
+    TimerList out;
+    VerifyOrReturnValue(mCount > 0 && t.count() > 0, out);
+
+    const uint64_t now = t.count() - 1;
+    Node * expired     = nullptr;
+
+    // Overdue timers were added with an expiration time at or before mNow; normally all of them are due.
+    for (Node * timer = mOverdue; timer != nullptr;)
+    {
+        Node * next = static_cast<Node *>(timer->mNextTimer);
+        if (static_cast<uint64_t>(timer->AwakenTime().count()) <= now)
+        {
+            Unlink(timer);
+            timer->mNextTimer = expired;
+            expired           = timer;
+        }
+        timer = next;
+    }
+
+    if (now > mNow)
+    {
+        Advance(now, expired);
+    }
+
+    // Detach the expired timers from the hash index; Unlink() already took them out of their slots.
+    for (Node * timer = expired; timer != nullptr; timer = static_cast<Node *>(timer->mNextTimer))
+    {
+        if (timer->mHashNext != nullptr)
+        {
+            timer->mHashNext->mHashPrev = timer->mHashPrev;
+        }
+        if (timer->mHashPrev != nullptr)
+        {
+            timer->mHashPrev->mHashNext = timer->mHashNext;
+        }
+        else
+        {
+            mHash[HashOf(timer->GetCallback().GetOnComplete(), timer->GetCallback().GetAppState())] = timer->mHashNext;
+        }
+        timer->mHashNext = timer->mHashPrev = nullptr;
+        timer->mSlot                        = kNotQueued;
+        mCount--;
+        if (timer == mEarliest)
+        {
+            mEarliest      = nullptr;
+            mEarliestValid = false;
+        }
+    }
+
+    out.mEarliestTimer = SortByAwakenTime(expired);
+    return out;
+}
+
+Clock::Timeout TimerWheel::GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState)
+{
+    Node * timer = FindEarliest(aOnComplete, aAppState);
+    VerifyOrReturnValue(timer != nullptr, Clock::kZero);
+
+    Clock::Timestamp currentTime = SystemClock().GetMonotonicTimestamp();
+    if (currentTime < timer->AwakenTime())
+    {
+        return Clock::Timeout(timer->AwakenTime() - currentTime);
+    }
+    return Clock::kZero;
+}
+
 } // namespace System
 } // namespace chip
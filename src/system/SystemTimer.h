@@ -186,9 +186,150 @@ public:
     Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
 
 private:
+    friend class TimerWheel;
+
     Node * mEarliestTimer;
 };
 
+/**
+ * Hierarchical timer wheel holding `Timer`s, with the same interface as TimerList.
+ *
+ * Timers live in kLevels levels of kSlotsPerLevel slots, where a slot of level `l` spans kSlotsPerLevel^l milliseconds.
+ * Add() and Remove() are O(1), and Remove(onComplete, appState) / GetRemainingTime() are O(1) on average thanks to a
+ * hash index on the callback. Expired timers are harvested in one batch by ExtractEarlier(), which visits at most
+ * kSlotsPerLevel slots per level no matter how much time has passed, and are returned as a TimerList ordered by
+ * expiration time (timers with the same expiration time keep the order in which they were added).
+ */
+class TimerWheel
+{
+public:
+    class Node : public TimerList::Node
+    {
+    public:
+        Node(Layer & systemLayer, System::Clock::Timestamp awakenTime, TimerCompleteCallback onComplete, void * appState) :
+            TimerList::Node(systemLayer, awakenTime, onComplete, appState)
+        {}
+
+    private:
+        friend class TimerWheel;
+
+        Node * mPrevTimer  = nullptr;
+        Node * mHashNext   = nullptr;
+        Node * mHashPrev   = nullptr;
+        uint32_t mSequence = 0;
+        int16_t mSlot      = -1;
+    };
+
+    TimerWheel() { Clear(); }
+
+    /**
+     * Add a timer to the wheel
+     *
+     * @return  The new earliest timer in the wheel. If this is the newly added timer, that implies it is earlier
+     *          than any existing timer.
+     */
+    Node * Add(Node * timer);
+
+    /**
+     * Remove the given timer from the wheel, if present. It is not an error for the timer not to be present.
+     *
+     * @return  The new earliest timer in the wheel, or nullptr if the wheel is empty.
+     */
+    Node * Remove(Node * remove);
+
+    /**
+     * Remove the earliest timer with the given properties, if present. It is not an error for no such timer to be present.
+     *
+     * @return  The removed timer, or nullptr if the wheel contains no matching timer.
+     */
+    Node * Remove(TimerCompleteCallback onComplete, void * appState);
+
+    /**
+     * Remove and return the earliest timer in the wheel.
+     *
+     * @return  The earliest timer, or nullptr if the wheel is empty.
+     */
+    Node * PopEarliest();
+
+    /**
+     * Remove and return the earliest timer in the wheel, provided it expires earlier than the given time @a t.
+     *
+     * @return  The earliest timer expiring before @a t, or nullptr if there is no such timer.
+     */
+    Node * PopIfEarlier(Clock::Timestamp t);
+
+    /**
+     * Get the earliest timer in the wheel.
+     *
+     * This is cached; after the earliest timer was removed the next call looks at one slot per level.
+     *
+     * @return  The earliest timer, or nullptr if there are no timers.
+     */
+    Node * Earliest();
+
+    /**
+     * Test whether there are any timers.
+     */
+    bool Empty() const { return mCount == 0; }
+
+    /**
+     * Remove and return all timers that expire before the given time @a t, ordered by expiration time.
+     */
+    TimerList ExtractEarlier(Clock::Timestamp t);
+
+    /**
+     * Remove all timers.
+     */
+    void Clear();
+
+    /**
+     * Find the earliest timer with the given properties, if present, and return its remaining time
+     *
+     * @return The remaining time on this particular timer or 0 if not found.
+     */
+    Clock::Timeout GetRemainingTime(TimerCompleteCallback aOnComplete, void * aAppState);
+
+private:
+    static constexpr unsigned kLevelBits      = 6;
+    static constexpr unsigned kSlotsPerLevel  = 1u << kLevelBits;
+    static constexpr unsigned kLevels         = 6; // covers about 795 days at 1 ms resolution
+    static constexpr unsigned kHashBuckets    = CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS;
+    static constexpr int16_t kNotQueued       = -1;
+    static constexpr int16_t kOverdue         = -2;
+
+    static_assert((kHashBuckets & (kHashBuckets - 1)) == 0, "CHIP_SYSTEM_CONFIG_TIMER_WHEEL_HASH_BUCKETS must be a power of 2");
+
+    static bool IsEarlier(const Node * a, const Node * b);
+    static size_t HashOf(TimerCompleteCallback onComplete, void * appState);
+    static Node * SortByAwakenTime(Node * list);
+
+    void Insert(Node * timer);
+    void Unlink(Node * timer);
+    void Advance(uint64_t now, Node *& expired);
+    Node * FindEarliest(TimerCompleteCallback onComplete, void * appState) const;
+
+    Node * mSlots[kLevels * kSlotsPerLevel];
+    uint64_t mOccupied[kLevels];
+    // Timers that were already due when added (e.g. ScheduleWork()).
+    Node * mOverdue;
+    Node * mHash[kHashBuckets];
+    // Every timer expiring at or before this tick has been moved out of the slots.
+    uint64_t mNow;
+    Node * mEarliest;
+    bool mEarliestValid;
+    uint32_t mNextSequence;
+    size_t mCount;
+};
+
+#if CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+/**
+ * Container used by event loop based System::Layer implementations for pending timers.
+ */
+using TimerQueue = TimerWheel;
+#else
+using TimerQueue = TimerList;
+#endif // CHIP_SYSTEM_CONFIG_USE_TIMER_WHEEL
+
 /**
  * ObjectPool wrapper that keeps System Timer statistics.
  */
@@ -78,6 +78,7 @@ CHIP_ERROR WakeEvent::Open()
 
     mReadFD  = fds[FD_READ];
     mWriteFD = fds[FD_WRITE];
+    mPending.store(false, std::memory_order_relaxed);
 
     return CHIP_NO_ERROR;
 }
@@ -102,17 +103,27 @@ void WakeEvent::Confirm() const
         {
             ChipLogError(chipSystemLayer, "System wake event confirm failed: %" CHIP_ERROR_FORMAT,
                          CHIP_ERROR_POSIX(errno).Format());
-            return;
+            break;
         }
     } while (res == sizeof(buffer));
+
+    // Clear the pending flag only once the descriptor is drained: a Notify() that lands before this point has either
+    // written a byte that was just drained or was coalesced, and either way its work is seen since callers process their
+    // work after Confirm(). Clearing the flag first would let the drain eat the byte of a racing Notify() and leave the
+    // flag set with nothing to read, so that no later Notify() would ever write again. The exchange also acquires the
+    // work published by a coalesced Notify().
+    mPending.exchange(false, std::memory_order_acq_rel);
 }
 
 CHIP_ERROR WakeEvent::Notify() const
 {
+    VerifyOrReturnError(!mPending.exchange(true, std::memory_order_acq_rel), CHIP_NO_ERROR);
+
     char byte = 1;
 
     if (::write(mWriteFD, &byte, 1) < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
     {
+        mPending.store(false, std::memory_order_release);
         return CHIP_ERROR_POSIX(errno);
     }
 
@@ -164,6 +175,7 @@ CHIP_ERROR WakeEvent::Open()
     {
         return CHIP_ERROR_POSIX(errno);
     }
+    mPending.store(false, std::memory_order_relaxed);
 
     return CHIP_NO_ERROR;
 }
@@ -180,12 +192,18 @@ void WakeEvent::Confirm() const
     {
         ChipLogError(chipSystemLayer, "System wake event confirm failed: %" CHIP_ERROR_FORMAT, CHIP_ERROR_POSIX(errno).Format());
     }
+
+    // Only after draining; see the pipe implementation above.
+    mPending.exchange(false, std::memory_order_acq_rel);
 }
 
 CHIP_ERROR WakeEvent::Notify() const
 {
+    VerifyOrReturnError(!mPending.exchange(true, std::memory_order_acq_rel), CHIP_NO_ERROR);
+
     if (WriteEvent(mReadFD) < 0 && errno != EAGAIN && errno != EWOULDBLOCK)
     {
+        mPending.store(false, std::memory_order_release);
         return CHIP_ERROR_POSIX(errno);
     }
 
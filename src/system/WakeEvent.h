@@ -30,6 +30,8 @@
 #include <lib/core/CHIPError.h>
 #include <system/SocketEvents.h>
 
+#include <atomic>
+
 namespace chip {
 namespace System {
 
@@ -47,8 +49,12 @@ public:
     CHIP_ERROR Open(); /**< Initialize the pipeline */
     void Close();      /**< Close both ends of the pipeline. */
 
-    CHIP_ERROR Notify() const; /**< Set the event. */
-    void Confirm() const;      /**< Clear the event. */
+    /**
+     * Set the event. Notifications that arrive while the event is already set are coalesced: only the first one since
+     * the last Confirm() writes to the file descriptor.
+     */
+    CHIP_ERROR Notify() const;
+    void Confirm() const; /**< Clear the event. */
 
     int GetReadFD() const { return mReadFD; }
 
@@ -59,6 +65,8 @@ private:
     int mWriteFD;
 #endif
     int mReadFD;
+    // True from the first Notify() after a Confirm() until the next Confirm().
+    mutable std::atomic<bool> mPending{ false };
 };
 
 } // namespace System
@@ -0,0 +1,153 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+#include <system/SystemPacketBufferSlab.h>
+
+#include <lib/core/StringBuilderAdapters.h>
+#include <pw_unit_test/framework.h>
+
+#if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+
+#include <atomic>
+#include <thread>
+#include <vector>
+
+namespace chip {
+namespace System {
+namespace {
+
+class TestSystemPacketBufferSlab : public ::testing::Test
+{
+public:
+    static void TearDownTestSuite() { PacketBufferSlab::ReleaseCachedBlocks(); }
+
+    // Each test starts with empty caches, so that cache hits only come from blocks the test released itself.
+    void SetUp() override { PacketBufferSlab::ReleaseCachedBlocks(); }
+};
+
+TEST_F(TestSystemPacketBufferSlab, TestSizeClassesAndReuse)
+{
+    PacketBufferSlab::Stats before = PacketBufferSlab::GetStats();
+
+    void * block = PacketBufferSlab::Allocate(300);
+    ASSERT_NE(block, nullptr);
+    PacketBufferSlab::Stats stats = PacketBufferSlab::GetStats();
+    EXPECT_EQ(stats.mBlocksInUse, before.mBlocksInUse + 1);
+    EXPECT_EQ(stats.mBytesInUse, before.mBytesInUse + 512);
+    EXPECT_EQ(stats.mHeapAllocations, before.mHeapAllocations + 1);
+    PacketBufferSlab::Release(block, 300);
+
+    // Any request of the same size class reuses the block that was just released.
+    void * reused = PacketBufferSlab::Allocate(512);
+    EXPECT_EQ(reused, block);
+    stats = PacketBufferSlab::GetStats();
+    EXPECT_EQ(stats.mThreadCacheHits, before.mThreadCacheHits + 1);
+    EXPECT_EQ(stats.mHeapAllocations, before.mHeapAllocations + 1);
+
+    // Requests beyond the largest size class are served by the heap and accounted at their exact size.
+    constexpr size_t kLargeSize = PacketBufferSlab::kSizeClasses[PacketBufferSlab::kNumSizeClasses - 1] + 1;
+    void * large                = PacketBufferSlab::Allocate(kLargeSize);
+    ASSERT_NE(large, nullptr);
+    stats = PacketBufferSlab::GetStats();
+    EXPECT_EQ(stats.mBytesInUse, before.mBytesInUse + 512 + kLargeSize);
+    EXPECT_GE(stats.mBytesHighWatermark, stats.mBytesInUse);
+    EXPECT_GE(stats.mBlocksHighWatermark, before.mBlocksInUse + 2);
+
+    PacketBufferSlab::Release(large, kLargeSize);
+    PacketBufferSlab::Release(reused, 512);
+    stats = PacketBufferSlab::GetStats();
+    EXPECT_EQ(stats.mBlocksInUse, before.mBlocksInUse);
+    EXPECT_EQ(stats.mBytesInUse, before.mBytesInUse);
+
+    PacketBufferSlab::ResetHighWatermarks();
+    EXPECT_EQ(PacketBufferSlab::GetStats().mBlocksHighWatermark, before.mBlocksInUse);
+}
+
+TEST_F(TestSystemPacketBufferSlab, TestBlocksMoveBetweenThreads)
+{
+    constexpr size_t kBlockCount = 4 * CHIP_SYSTEM_CONFIG_PACKETBUFFER_SLAB_THREAD_CACHE_SIZE;
+    std::vector<void *> blocks(kBlockCount);
+    for (auto & block : blocks)
+    {
+        block = PacketBufferSlab::Allocate(1000);
+        ASSERT_NE(block, nullptr);
+    }
+
+    // Blocks freed by a thread overflow its cache into the shared cache, and the rest is flushed there when it exits.
+    std::thread releaser([&blocks] {
+        for (void * block : blocks)
+        {
+            PacketBufferSlab::Release(block, 1000);
+        }
+    });
+    releaser.join();
+
+    PacketBufferSlab::Stats before = PacketBufferSlab::GetStats();
+    for (auto & block : blocks)
+    {
+        block = PacketBufferSlab::Allocate(1000);
+        ASSERT_NE(block, nullptr);
+    }
+    PacketBufferSlab::Stats stats = PacketBufferSlab::GetStats();
+    EXPECT_EQ(stats.mHeapAllocations, before.mHeapAllocations);
+    EXPECT_GT(stats.mSharedCacheHits, before.mSharedCacheHits);
+
+    for (void * block : blocks)
+    {
+        PacketBufferSlab::Release(block, 1000);
+    }
+}
+
+std::atomic<int> sBackpressureCalls{ 0 };
+
+TEST_F(TestSystemPacketBufferSlab, TestSoftCap)
+{
+    const size_t inUse = PacketBufferSlab::GetStats().mBlocksInUse;
+    PacketBufferSlab::SetSoftCap(inUse + 2);
+    PacketBufferSlab::SetBackpressureHandler([] { sBackpressureCalls++; });
+    uint64_t softCapAllocations = PacketBufferSlab::GetStats().mSoftCapAllocations;
+
+    void * blocks[3];
+    for (auto & block : blocks)
+    {
+        block = PacketBufferSlab::Allocate(100);
+        ASSERT_NE(block, nullptr);
+    }
+
+    // The cap is soft: the third allocation succeeds but is reported.
+    EXPECT_TRUE(PacketBufferSlab::IsOverSoftCap());
+    EXPECT_EQ(sBackpressureCalls, 1);
+    EXPECT_EQ(PacketBufferSlab::GetStats().mSoftCapAllocations, softCapAllocations + 1);
+
+    PacketBufferSlab::Release(blocks[2], 100);
+    EXPECT_FALSE(PacketBufferSlab::IsOverSoftCap());
+    EXPECT_EQ(sBackpressureCalls, 2);
+
+    PacketBufferSlab::Release(blocks[1], 100);
+    PacketBufferSlab::Release(blocks[0], 100);
+    EXPECT_EQ(sBackpressureCalls, 2);
+
+    PacketBufferSlab::SetBackpressureHandler(nullptr);
+    PacketBufferSlab::SetSoftCap(CHIP_SYSTEM_CONFIG_PACKETBUFFER_SOFT_CAP);
+}
+
+} // namespace
+} // namespace System
+} // namespace chip
+
+#endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
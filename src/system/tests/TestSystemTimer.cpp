@@ -23,9 +23,11 @@
  *
  */
 
+#include <deque>
 #include <errno.h>
 #include <stdint.h>
 #include <string.h>
+#include <vector>
 
 #include <pw_unit_test/framework.h>
 
@@ -150,6 +152,11 @@ public:
 
 LayerImpl TestSystemTimer::mLayer;
 
+#if CHIP_SYSTEM_CONFIG_USE_EPOLL
+// The epoll CI configuration relies on these tests running against the epoll/timerfd event loop.
+static_assert(std::is_same<LayerImpl, LayerImplEpoll>::value, "CHIP_SYSTEM_CONFIG_USE_EPOLL builds must use LayerImplEpoll");
+#endif // CHIP_SYSTEM_CONFIG_USE_EPOLL
+
 static TestSystemTimer * gCurrentTestContext = nullptr;
 
 class ScopedGlobalTestContext
@@ -567,6 +574,139 @@ TEST_F(TestSystemTimer, CheckTimerPool)
     EXPECT_TRUE(SYSTEM_STATS_TEST_HIGH_WATER_MARK(Stats::kSystemLayer_NumTimers, 4));
 }
 
+// Test TimerWheel against the same sequence of operations as TimerList.
+TEST_F(TestSystemTimer, CheckTimerWheel)
+{
+    using Timer = TimerWheel::Node;
+    struct TestState
+    {
+        static void Increment(Layer * layer, void * state) {}
+        static void Reset(Layer * layer, void * state) {}
+    };
+    TestState testState;
+
+    using namespace Clock::Literals;
+    Timer timer0(mLayer, 111_ms, TestState::Increment, &testState);
+    Timer timer1(mLayer, 100_ms, TestState::Increment, &testState);
+    Timer timer2(mLayer, 202_ms, TestState::Reset, &testState);
+    Timer timer3(mLayer, 303_ms, TestState::Increment, &testState);
+    Timer timer4(mLayer, 100_ms, TestState::Increment, &timer4); // same time as timer1, added later
+    Timer timer5(mLayer, Clock::Timestamp(500000000), TestState::Increment, &timer5); // several wheel levels out
+
+    TimerWheel wheel;
+    EXPECT_EQ(wheel.Remove(nullptr), nullptr);
+    EXPECT_EQ(wheel.Remove(nullptr, nullptr), nullptr);
+    EXPECT_EQ(wheel.PopEarliest(), nullptr);
+    EXPECT_EQ(wheel.PopIfEarlier(500_ms), nullptr);
+    EXPECT_EQ(wheel.Earliest(), nullptr);
+    EXPECT_TRUE(wheel.Empty());
+
+    EXPECT_EQ(wheel.Add(&timer0), &timer0);
+    EXPECT_EQ(wheel.PopIfEarlier(10_ms), nullptr);
+    EXPECT_EQ(wheel.Add(&timer1), &timer1);
+    EXPECT_EQ(wheel.Add(&timer2), &timer1);
+    EXPECT_EQ(wheel.Add(&timer3), &timer1);
+    EXPECT_EQ(wheel.Add(&timer4), &timer1);
+    EXPECT_EQ(wheel.Add(&timer5), &timer1);
+    EXPECT_FALSE(wheel.Empty());
+
+    EXPECT_EQ(wheel.Remove(&timer1), &timer4);
+    EXPECT_EQ(wheel.Remove(TestState::Reset, &testState), &timer2);
+    EXPECT_EQ(wheel.Remove(TestState::Reset, &testState), nullptr);
+    // Among timers with the same callback and state, the earliest one is removed first.
+    EXPECT_EQ(wheel.Remove(TestState::Increment, &testState), &timer0);
+    EXPECT_EQ(wheel.Earliest(), &timer4);
+
+    // timer1 now comes after timer4, which has the same expiration time but was added first.
+    EXPECT_EQ(wheel.Add(&timer1), &timer4);
+    EXPECT_EQ(wheel.Add(&timer0), &timer4);
+    EXPECT_EQ(wheel.Add(&timer2), &timer4);
+
+    TimerList early = wheel.ExtractEarlier(200_ms); // wheel: (4 1 0 2 3 5) → (2 3 5) returns: (4 1 0)
+    EXPECT_EQ(early.PopEarliest(), &timer4);
+    EXPECT_EQ(early.PopEarliest(), &timer1);
+    EXPECT_EQ(early.PopEarliest(), &timer0);
+    EXPECT_EQ(early.PopEarliest(), nullptr);
+    EXPECT_EQ(wheel.Earliest(), &timer2);
+
+    early = wheel.ExtractEarlier(Clock::Timestamp(400000000));
+    EXPECT_EQ(early.PopEarliest(), &timer2);
+    EXPECT_EQ(early.PopEarliest(), &timer3);
+    EXPECT_EQ(early.PopEarliest(), nullptr);
+    EXPECT_EQ(wheel.Earliest(), &timer5);
+    EXPECT_EQ(wheel.PopIfEarlier(Clock::Timestamp(500000000)), nullptr);
+    EXPECT_EQ(wheel.PopIfEarlier(Clock::Timestamp(500000001)), &timer5);
+    EXPECT_TRUE(wheel.Empty());
+
+    // Timers that are already due when added (here because the clock went backwards) are kept aside and extracted
+    // once they are earlier than the requested time.
+    EXPECT_EQ(wheel.Add(&timer5), &timer5);
+    EXPECT_EQ(wheel.Add(&timer0), &timer0);
+    early = wheel.ExtractEarlier(100_ms);
+    EXPECT_EQ(early.PopEarliest(), nullptr);
+    early = wheel.ExtractEarlier(200_ms);
+    EXPECT_EQ(early.PopEarliest(), &timer0);
+    EXPECT_EQ(early.PopEarliest(), nullptr);
+    EXPECT_EQ(wheel.Earliest(), &timer5);
+
+    EXPECT_EQ(wheel.Add(&timer3), &timer3);
+    wheel.Clear();
+    EXPECT_TRUE(wheel.Empty());
+    EXPECT_EQ(wheel.Earliest(), nullptr);
+}
+
+// Run TimerList and TimerWheel through the same mix of timers, which should expire in time order and only once due.
+TEST_F(TestSystemTimer, CheckTimerQueuesAgree)
+{
+    constexpr size_t kTimerCount = 200;
+    struct TestState
+    {
+        static void Callback(Layer * layer, void * state) {}
+    };
+
+    // Distinct appState per timer, like per-subscription timers.
+    std::vector<uint8_t> states(kTimerCount);
+    std::deque<TimerWheel::Node> timers;
+    uint32_t random = 1;
+    for (size_t i = 0; i < kTimerCount; i++)
+    {
+        random = random * 1103515245u + 12345u;
+        // Spread between 1 s and 10 min, like liveness and retransmission timers.
+        timers.emplace_back(mLayer, Clock::Timestamp(1000 + (random >> 8) % 600000), TestState::Callback, &states[i]);
+    }
+
+    auto run = [&](auto & queue) {
+        for (auto & timer : timers)
+        {
+            queue.Add(&timer);
+        }
+        for (size_t i = 0; i < kTimerCount; i += 2)
+        {
+            EXPECT_EQ(queue.Remove(TestState::Callback, &states[i]), &timers[i]);
+        }
+        size_t fired                    = 0;
+        Clock::Timestamp lastAwakenTime = Clock::kZero;
+        for (uint64_t now = 0; now <= 602000; now += 10000)
+        {
+            TimerList expired = queue.ExtractEarlier(Clock::Timestamp(now));
+            for (auto * timer = expired.PopEarliest(); timer != nullptr; timer = expired.PopEarliest())
+            {
+                EXPECT_LT(timer->AwakenTime(), Clock::Timestamp(now));
+                EXPECT_GE(timer->AwakenTime(), lastAwakenTime);
+                lastAwakenTime = timer->AwakenTime();
+                fired++;
+            }
+        }
+        EXPECT_EQ(fired, kTimerCount / 2);
+        EXPECT_TRUE(queue.Empty());
+    };
+
+    TimerList list;
+    run(list);
+    TimerWheel wheel;
+    run(wheel);
+}
+
 TEST_F(TestSystemTimer, ExtendTimerToTest)
 {
     if (!LayerEvents<LayerImpl>::HasServiceEvents())
@@ -32,6 +32,7 @@
 #include <system/SystemLayerImpl.h>
 
 #if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
+#include <atomic>
 #include <pthread.h>
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 
@@ -110,6 +111,23 @@ TEST_F(TestSystemWakeEvent, TestConfirm)
     EXPECT_EQ(SelectWakeEvent(), 0);
 }
 
+TEST_F(TestSystemWakeEvent, TestCoalescedNotify)
+{
+    // Notifications while the event is set only need one Confirm() to clear it.
+    EXPECT_SUCCESS(mWakeEvent.Notify());
+    EXPECT_SUCCESS(mWakeEvent.Notify());
+    EXPECT_SUCCESS(mWakeEvent.Notify());
+    EXPECT_EQ(SelectWakeEvent(), 1);
+    mWakeEvent.Confirm();
+    EXPECT_EQ(SelectWakeEvent(), 0);
+
+    // ...and the event can be set again afterwards.
+    EXPECT_SUCCESS(mWakeEvent.Notify());
+    EXPECT_EQ(SelectWakeEvent(), 1);
+    mWakeEvent.Confirm();
+    EXPECT_EQ(SelectWakeEvent(), 0);
+}
+
 #if CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 void * WaitForEvent(void * aContext)
 {
@@ -129,6 +147,59 @@ TEST_F(TestSystemWakeEvent, TestBlockingSelect)
     EXPECT_EQ(0, pthread_join(tid, &selectResult));
     EXPECT_EQ(selectResult, reinterpret_cast<void *>(1));
 }
+
+struct NotifyStressContext
+{
+    static constexpr uint32_t kProducerCount          = 2;
+    static constexpr uint32_t kNotificationsPerThread = 20000;
+
+    TestSystemWakeEvent * test;
+    std::atomic<uint32_t> published{ 0 };
+};
+
+void * NotifyRepeatedly(void * aContext)
+{
+    auto * context = static_cast<NotifyStressContext *>(aContext);
+    for (uint32_t i = 0; i < NotifyStressContext::kNotificationsPerThread; i++)
+    {
+        context->published.fetch_add(1);
+        EXPECT_SUCCESS(context->test->mWakeEvent.Notify());
+    }
+    return nullptr;
+}
+
+TEST_F(TestSystemWakeEvent, TestConcurrentNotifyConfirm)
+{
+    // Notify() and Confirm() race as an event loop would: whatever the interleaving, the last notification must still
+    // wake the consumer, or work would be left unprocessed.
+    NotifyStressContext context;
+    context.test = this;
+
+    pthread_t producers[NotifyStressContext::kProducerCount];
+    for (auto & tid : producers)
+    {
+        EXPECT_EQ(0, pthread_create(&tid, nullptr, NotifyRepeatedly, &context));
+    }
+
+    constexpr uint32_t kTotal = NotifyStressContext::kProducerCount * NotifyStressContext::kNotificationsPerThread;
+    uint32_t seen             = 0;
+    while (seen < kTotal)
+    {
+        // A lost wakeup leaves the descriptor idle while notifications are unseen.
+        if (SelectWakeEvent(timeval{ 5, 0 }) != 1)
+        {
+            break;
+        }
+        mWakeEvent.Confirm();
+        seen = context.published.load();
+    }
+
+    for (auto & tid : producers)
+    {
+        EXPECT_EQ(0, pthread_join(tid, nullptr));
+    }
+    EXPECT_EQ(seen, kTotal);
+}
 #endif // CHIP_SYSTEM_CONFIG_POSIX_LOCKING
 
 TEST_F(TestSystemWakeEvent, TestClose)
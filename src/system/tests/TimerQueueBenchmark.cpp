@@ -0,0 +1,115 @@
+/*
+ *
+ *    Copyright (c) 2026 Project CHIP Authors
+ *    All rights reserved.
+ *
+ *    Licensed under the Apache License, Version 2.0 (the "License");
+ *    you may not use this file except in compliance with the License.
+ *    You may obtain a copy of the License at
+ *
+ *        http://www.apache.org/licenses/LICENSE-2.0
+ *
+ *    Unless required by applicable law or agreed to in writing, software
+ *    distributed under the License is distributed on an "AS IS" BASIS,
+ *    WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ *    See the License for the specific language governing permissions and
+ *    limitations under the License.
+ */
+
+/**
+ *    @file
+ *      Compares System::TimerList and System::TimerWheel with many active timers.
+ *
+ *      This is a manual performance check, not a unit test: it is not part of any test suite and only prints timings.
+ *      Build it with `ninja -C <out dir> src/system/tests:system-timer-queue-benchmark`.
+ */
+
+#include <deque>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <vector>
+
+#include <lib/support/CHIPMem.h>
+#include <system/SystemClock.h>
+#include <system/SystemLayerImpl.h>
+#include <system/SystemTimer.h>
+
+using namespace chip;
+using namespace chip::System;
+
+namespace {
+
+constexpr size_t kDefaultTimerCount = 10000;
+
+void OnTimerComplete(Layer * layer, void * state) {}
+
+template <typename Queue>
+bool Run(const char * name, Queue & queue, std::deque<TimerWheel::Node> & timers, std::vector<uint8_t> & states)
+{
+    const Clock::Microseconds64 start = SystemClock().GetMonotonicMicroseconds64();
+    for (auto & timer : timers)
+    {
+        queue.Add(&timer);
+    }
+    const Clock::Microseconds64 added = SystemClock().GetMonotonicMicroseconds64();
+    for (size_t i = 0; i < timers.size(); i += 2)
+    {
+        queue.Remove(OnTimerComplete, &states[i]);
+    }
+    const Clock::Microseconds64 cancelled = SystemClock().GetMonotonicMicroseconds64();
+
+    size_t fired = 0;
+    for (uint64_t now = 0; now <= 602000; now += 1000)
+    {
+        TimerList expired = queue.ExtractEarlier(Clock::Timestamp(now));
+        while (expired.PopEarliest() != nullptr)
+        {
+            fired++;
+        }
+    }
+    const Clock::Microseconds64 done = SystemClock().GetMonotonicMicroseconds64();
+
+    printf("%s with %u timers: add %u us, cancel %u us, expire %u us\n", name, static_cast<unsigned>(timers.size()),
+           static_cast<unsigned>((added - start).count()), static_cast<unsigned>((cancelled - added).count()),
+           static_cast<unsigned>((done - cancelled).count()));
+
+    // Every other timer was cancelled; the rest must all have fired.
+    return fired == (timers.size() + 1) / 2 && queue.Empty();
+}
+
+} // namespace
+
+int main(int argc, char * argv[])
+{
+    const size_t timerCount = (argc > 1) ? strtoul(argv[1], nullptr, 0) : kDefaultTimerCount;
+
+    if (Platform::MemoryInit() != CHIP_NO_ERROR)
+    {
+        fprintf(stderr, "Failed to initialize memory\n");
+        return EXIT_FAILURE;
+    }
+
+    // The queues only keep a reference to the layer, which does not need to be initialized.
+    LayerImpl layer;
+
+    // Distinct appState per timer, like per-subscription timers.
+    std::vector<uint8_t> states(timerCount);
+    std::deque<TimerWheel::Node> timers;
+    uint32_t random = 1;
+    for (size_t i = 0; i < timerCount; i++)
+    {
+        random = random * 1103515245u + 12345u;
+        // Spread between 1 s and 10 min, like liveness and retransmission timers.
+        timers.emplace_back(layer, Clock::Timestamp(1000 + (random >> 8) % 600000), OnTimerComplete, &states[i]);
+    }
+
+    bool ok = true;
+    TimerList list;
+    ok &= Run("TimerList", list, timers, states);
+    TimerWheel wheel;
+    ok &= Run("TimerWheel", wheel, timers, states);
+
+    Platform::MemoryShutdown();
+    return ok ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -55,6 +55,11 @@ CryptoContext::CryptoContext() : mKeyAvailable(false) {}
 
 CryptoContext::~CryptoContext()
 {
+#if CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+    mEncryptionCipher.Release();
+    mDecryptionCipher.Release();
+#endif // CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+
     if (mKeystore)
     {
         mKeystore->DestroyKey(mEncryptionKey);
@@ -87,6 +92,8 @@ CHIP_ERROR CryptoContext::InitFromSecret(SessionKeystore & keystore, const ByteS
     mSessionRole  = role;
     mKeystore     = &keystore;
 
+    InitCipherContexts();
+
     return CHIP_NO_ERROR;
 }
 
@@ -112,6 +119,8 @@ CHIP_ERROR CryptoContext::InitFromSecret(Crypto::SessionKeystore & keystore, con
     mSessionRole  = role;
     mKeystore     = &keystore;
 
+    InitCipherContexts();
+
     return CHIP_NO_ERROR;
 }
 
@@ -128,6 +137,26 @@ CHIP_ERROR CryptoContext::InitFromKeyPair(SessionKeystore & keystore, const Cryp
     return InitFromSecret(keystore, secret.Span(), salt, infoType, role);
 }
 
+void CryptoContext::InitCipherContexts()
+{
+#if CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+    // Failing to set up a cipher context is not fatal: Encrypt() and Decrypt() then fall back to
+    // the one-shot AES-CCM functions.
+    CHIP_ERROR err = mEncryptionCipher.Init(mEncryptionKey, kAESCCMNonceLen, CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
+    if (err == CHIP_NO_ERROR)
+    {
+        err = mDecryptionCipher.Init(mDecryptionKey, kAESCCMNonceLen, CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES);
+    }
+
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(SecureChannel, "Failed to set up session cipher contexts: %" CHIP_ERROR_FORMAT, err.Format());
+        mEncryptionCipher.Release();
+        mDecryptionCipher.Release();
+    }
+#endif // CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+}
+
 #if CHIP_CONFIG_SECURITY_TEST_MODE
 CHIP_ERROR CryptoContext::InitTestMode(Crypto::SessionKeystore & keystore, Crypto::Aes128KeyHandle & i2rKey,
                                        Crypto::Aes128KeyHandle & r2iKey)
@@ -219,8 +248,18 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(), output, tag, taglen));
+#if CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+        if (mEncryptionCipher.IsInitialized())
+        {
+            ReturnErrorOnFailure(
+                mEncryptionCipher.Encrypt(input, input_length, AAD, aadLen, nonce.data(), nonce.size(), output, tag, taglen));
+        }
+        else
+#endif // CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+        {
+            ReturnErrorOnFailure(AES_CCM_encrypt(input, input_length, AAD, aadLen, mEncryptionKey, nonce.data(), nonce.size(),
+                                                 output, tag, taglen));
+        }
     }
 
     mac.SetTag(tag, taglen);
@@ -228,6 +267,93 @@ CHIP_ERROR CryptoContext::Encrypt(const uint8_t * input, size_t input_length, ui
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR CryptoContext::EncryptBatch(EncryptBatchEntry * entries, size_t count)
+{
+    constexpr size_t kBatchSize = CHIP_CONFIG_SECURE_MESSAGE_ENCRYPT_BATCH_SIZE;
+    static_assert(kBatchSize > 0, "CHIP_CONFIG_SECURE_MESSAGE_ENCRYPT_BATCH_SIZE must be positive");
+
+    VerifyOrReturnError(entries != nullptr || count == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (size_t first = 0; first < count; first += kBatchSize)
+    {
+        AesCcmBatchEntry batch[kBatchSize];
+        EncryptBatchEntry * batched[kBatchSize];
+        uint8_t AAD[kBatchSize][kMaxAADLen];
+        uint8_t tags[kBatchSize][kMaxTagLen];
+        size_t batchCount = 0;
+
+        for (size_t i = first; i < count && i < first + kBatchSize; i++)
+        {
+            EncryptBatchEntry & entry = entries[i];
+
+            VerifyOrExit(entry.context != nullptr && entry.header != nullptr && entry.mac != nullptr,
+                         entry.result = CHIP_ERROR_INVALID_ARGUMENT);
+
+            // Group keys are behind the SymmetricKeyContext interface, which has no batch operation.
+            if (entry.context->mKeyContext != nullptr)
+            {
+                entry.result = entry.context->Encrypt(entry.input, entry.inputLength, entry.output, entry.nonce, *entry.header,
+                                                      *entry.mac);
+                continue;
+            }
+
+            {
+                const size_t taglen = entry.header->MICTagLength();
+                uint16_t aadLen     = sizeof(AAD[batchCount]);
+
+                VerifyOrDie(taglen <= kMaxTagLen);
+
+                VerifyOrExit(entry.input != nullptr, entry.result = CHIP_ERROR_INVALID_ARGUMENT);
+                VerifyOrExit(entry.inputLength > 0, entry.result = CHIP_ERROR_INVALID_ARGUMENT);
+                VerifyOrExit(entry.output != nullptr, entry.result = CHIP_ERROR_INVALID_ARGUMENT);
+                VerifyOrExit(entry.context->mKeyAvailable, entry.result = CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
+
+                entry.result = GetAdditionalAuthData(*entry.header, AAD[batchCount], aadLen);
+                SuccessOrExit(entry.result);
+
+                AesCcmBatchEntry & ccm = batch[batchCount];
+                ccm.key                = &entry.context->mEncryptionKey;
+#if CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+                ccm.context = &entry.context->mEncryptionCipher;
+#endif // CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+                ccm.input        = entry.input;
+                ccm.input_length = entry.inputLength;
+                ccm.aad          = AAD[batchCount];
+                ccm.aad_length   = aadLen;
+                ccm.nonce        = entry.nonce.data();
+                ccm.nonce_length = entry.nonce.size();
+                ccm.output       = entry.output;
+                ccm.tag          = tags[batchCount];
+                ccm.tag_length   = taglen;
+
+                batched[batchCount++] = &entry;
+            }
+
+        exit:
+            continue;
+        }
+
+        // Per-message errors are reported through the entries.
+        RETURN_SAFELY_IGNORED AES_CCM_encrypt_batch(batch, batchCount);
+
+        for (size_t i = 0; i < batchCount; i++)
+        {
+            batched[i]->result = batch[i].result;
+            if (batch[i].result == CHIP_NO_ERROR)
+            {
+                batched[i]->mac->SetTag(tags[i], batch[i].tag_length);
+            }
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        ReturnErrorOnFailure(entries[i].result);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, uint8_t * output, ConstNonceView nonce,
                                   const PacketHeader & header, const MessageAuthenticationCode & mac) const
 {
@@ -254,8 +380,18 @@ CHIP_ERROR CryptoContext::Decrypt(const uint8_t * input, size_t input_length, ui
     else
     {
         VerifyOrReturnError(mKeyAvailable, CHIP_ERROR_INVALID_USE_OF_SESSION_KEY);
-        ReturnErrorOnFailure(
-            AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(), nonce.size(), output));
+#if CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+        if (mDecryptionCipher.IsInitialized())
+        {
+            ReturnErrorOnFailure(
+                mDecryptionCipher.Decrypt(input, input_length, AAD, aadLen, tag, taglen, nonce.data(), nonce.size(), output));
+        }
+        else
+#endif // CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+        {
+            ReturnErrorOnFailure(AES_CCM_decrypt(input, input_length, AAD, aadLen, tag, taglen, mDecryptionKey, nonce.data(),
+                                                 nonce.size(), output));
+        }
     }
     return CHIP_NO_ERROR;
 }
@@ -131,6 +131,31 @@ public:
     CHIP_ERROR Encrypt(const uint8_t * input, size_t input_length, uint8_t * output, ConstNonceView nonce,
                        const PacketHeader & header, MessageAuthenticationCode & mac) const;
 
+    /** @brief One message of an EncryptBatch() call, the fields match the arguments of Encrypt(). */
+    struct EncryptBatchEntry
+    {
+        const CryptoContext * context = nullptr;
+        const uint8_t * input         = nullptr;
+        size_t inputLength            = 0;
+        uint8_t * output              = nullptr;
+        ConstNonceView nonce;
+        const PacketHeader * header     = nullptr;
+        MessageAuthenticationCode * mac = nullptr;
+        CHIP_ERROR result               = CHIP_NO_ERROR;
+    };
+
+    /**
+     * @brief
+     *   Encrypt several messages, possibly for different sessions, as Encrypt() does for each of them.
+     *
+     * Messages encrypted with session keys are passed to Crypto::AES_CCM_encrypt_batch() together,
+     * group messages are encrypted one at a time. The outcome of each message is stored in its
+     * `result`; a failed message does not stop the others.
+     *
+     * @return CHIP_NO_ERROR if every message was encrypted, otherwise the error of the first failed one.
+     */
+    static CHIP_ERROR EncryptBatch(EncryptBatchEntry * entries, size_t count);
+
     /**
      * @brief
      *   Decrypt the input data using keys established in the secure channel
@@ -160,6 +185,7 @@ public:
 
 private:
     CHIP_ERROR InitTestMode(Crypto::SessionKeystore & keystore, Crypto::Aes128KeyHandle & i2rKey, Crypto::Aes128KeyHandle & r2iKey);
+    void InitCipherContexts();
 
     SessionRole mSessionRole;
 
@@ -170,6 +196,12 @@ private:
     Crypto::SessionKeystore * mKeystore       = nullptr;
     Crypto::SymmetricKeyContext * mKeyContext = nullptr;
 
+#if CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+    // Cipher contexts holding the expanded mEncryptionKey and mDecryptionKey for the lifetime of the session.
+    mutable Crypto::Aes128CcmContext mEncryptionCipher;
+    mutable Crypto::Aes128CcmContext mDecryptionCipher;
+#endif // CHIP_CONFIG_SECURE_SESSION_CIPHER_CONTEXT_CACHE
+
     // Use unencrypted header as additional authenticated data (AAD) during encryption and decryption.
     // The encryption operations includes AAD when message authentication tag is generated. This tag
     // is used at the time of decryption to integrity check the received data.
@@ -58,6 +58,76 @@ CHIP_ERROR Encrypt(const CryptoContext & context, CryptoContext::ConstNonceView
     return CHIP_NO_ERROR;
 }
 
+CHIP_ERROR EncryptBatch(EncryptBatchEntry * entries, size_t count)
+{
+    constexpr size_t kBatchSize = CHIP_CONFIG_SECURE_MESSAGE_ENCRYPT_BATCH_SIZE;
+
+    VerifyOrReturnError(entries != nullptr || count == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (size_t first = 0; first < count; first += kBatchSize)
+    {
+        CryptoContext::EncryptBatchEntry batch[kBatchSize];
+        EncryptBatchEntry * batched[kBatchSize];
+        MessageAuthenticationCode macs[kBatchSize];
+        size_t batchCount = 0;
+
+        for (size_t i = first; i < count && i < first + kBatchSize; i++)
+        {
+            EncryptBatchEntry & entry = entries[i];
+
+            VerifyOrExit(entry.context != nullptr && entry.payloadHeader != nullptr && entry.packetHeader != nullptr &&
+                             entry.msgBuf != nullptr && !entry.msgBuf->IsNull(),
+                         entry.result = CHIP_ERROR_INVALID_ARGUMENT);
+            VerifyOrExit(!(*entry.msgBuf)->HasChainedBuffer(), entry.result = CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+            entry.result = entry.payloadHeader->EncodeBeforeData(*entry.msgBuf);
+            SuccessOrExit(entry.result);
+
+            batch[batchCount].context     = entry.context;
+            batch[batchCount].input       = (*entry.msgBuf)->Start();
+            batch[batchCount].inputLength = (*entry.msgBuf)->TotalLength();
+            batch[batchCount].output      = (*entry.msgBuf)->Start();
+            batch[batchCount].nonce       = entry.nonce;
+            batch[batchCount].header      = entry.packetHeader;
+            batch[batchCount].mac         = &macs[batchCount];
+            batched[batchCount++]         = &entry;
+
+        exit:
+            continue;
+        }
+
+        // Per-message errors are reported through the entries.
+        RETURN_SAFELY_IGNORED CryptoContext::EncryptBatch(batch, batchCount);
+
+        for (size_t i = 0; i < batchCount; i++)
+        {
+            EncryptBatchEntry & entry           = *batched[i];
+            System::PacketBufferHandle & msgBuf = *entry.msgBuf;
+
+            entry.result = batch[i].result;
+            if (entry.result == CHIP_NO_ERROR)
+            {
+                uint8_t * data  = msgBuf->Start();
+                size_t totalLen = msgBuf->TotalLength();
+                uint16_t taglen = 0;
+
+                entry.result = macs[i].Encode(*entry.packetHeader, &data[totalLen], msgBuf->AvailableDataLength(), &taglen);
+                if (entry.result == CHIP_NO_ERROR)
+                {
+                    msgBuf->SetDataLength(totalLen + taglen);
+                }
+            }
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        ReturnErrorOnFailure(entries[i].result);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
 CHIP_ERROR Decrypt(const CryptoContext & context, CryptoContext::ConstNonceView nonce, PayloadHeader & payloadHeader,
                    const PacketHeader & packetHeader, System::PacketBufferHandle & msg)
 {
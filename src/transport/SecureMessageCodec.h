@@ -53,6 +53,29 @@ namespace SecureMessageCodec {
 CHIP_ERROR Encrypt(const CryptoContext & context, CryptoContext::ConstNonceView nonce, PayloadHeader & payloadHeader,
                    PacketHeader & packetHeader, System::PacketBufferHandle & msgBuf);
 
+/** @brief One message of an EncryptBatch() call, the fields match the arguments of Encrypt(). */
+struct EncryptBatchEntry
+{
+    const CryptoContext * context = nullptr;
+    CryptoContext::ConstNonceView nonce;
+    PayloadHeader * payloadHeader       = nullptr;
+    PacketHeader * packetHeader         = nullptr;
+    System::PacketBufferHandle * msgBuf = nullptr;
+    CHIP_ERROR result                   = CHIP_NO_ERROR;
+};
+
+/**
+ * @brief
+ *  Attach the payload header to and encrypt several messages, as Encrypt() does for each of them,
+ *  using CryptoContext::EncryptBatch().
+ *
+ * @param[in,out] entries     The messages to encrypt. The outcome for each message is stored in its
+ *                            `result`; a failed message does not stop the others.
+ * @param[in] count           Number of entries.
+ * @return CHIP_NO_ERROR if every message was encrypted, otherwise the error of the first failed one.
+ */
+CHIP_ERROR EncryptBatch(EncryptBatchEntry * entries, size_t count);
+
 /**
  * @brief
  *  Decrypt the message, perform message integrity check, and decode the payload header,
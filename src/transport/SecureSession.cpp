@@ -40,12 +40,15 @@ void SecureSession::Activate(const ScopedNodeId & localNode, const ScopedNodeId
     VerifyOrDie(!((mSecureSessionType == Type::kCASE) &&
                   (!IsOperationalNodeId(peerNode.GetNodeId()) || !IsOperationalNodeId(localNode.GetNodeId()))));
 
+    ScopedNodeId previousPeer = GetPeer();
+
     mPeerNodeId          = peerNode.GetNodeId();
     mLocalNodeId         = localNode.GetNodeId();
     mPeerCATs            = peerCATs;
     mPeerSessionId       = peerSessionId;
     mRemoteSessionParams = sessionParameters;
     SetFabricIndex(peerNode.GetFabricIndex());
+    mTable.OnPeerChanged(this, previousPeer);
     MarkActiveRx(); // Initialize SessionTimestamp and ActiveTimestamp per spec.
 
     Retain(); // This ref is released inside MarkForEviction
@@ -57,6 +60,20 @@ void SecureSession::Activate(const ScopedNodeId & localNode, const ScopedNodeId
     ChipLogDetail(Inet, "SecureSession[%p]: Activated - Type:%d LSID:%d", this, to_underlying(mSecureSessionType), mLocalSessionId);
 }
 
+CHIP_ERROR SecureSession::AdoptFabricIndex(FabricIndex fabricIndex)
+{
+    // It's not legal to augment session type for non-PASE
+    if (mSecureSessionType != Type::kPASE)
+    {
+        return CHIP_ERROR_INVALID_ARGUMENT;
+    }
+
+    ScopedNodeId previousPeer = GetPeer();
+    SetFabricIndex(fabricIndex);
+    mTable.OnPeerChanged(this, previousPeer);
+    return CHIP_NO_ERROR;
+}
+
 const char * SecureSession::StateToString(State state) const
 {
     switch (state)
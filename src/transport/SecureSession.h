@@ -224,16 +224,7 @@ public:
 
     // Called when AddNOC has gone through sufficient success that we need to switch the
     // session to reflect a new fabric if it was a PASE session
-    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex)
-    {
-        // It's not legal to augment session type for non-PASE
-        if (mSecureSessionType != Type::kPASE)
-        {
-            return CHIP_ERROR_INVALID_ARGUMENT;
-        }
-        SetFabricIndex(fabricIndex);
-        return CHIP_NO_ERROR;
-    }
+    CHIP_ERROR AdoptFabricIndex(FabricIndex fabricIndex);
 
     System::Clock::Timestamp GetLastActivityTime() const { return mLastActivityTime; }
     System::Clock::Timestamp GetLastPeerActivityTime() const { return mLastPeerActivityTime; }
@@ -328,6 +319,7 @@ private:
     void MoveToState(State targetState);
 
     friend class SecureSessionDeleter;
+    friend class SecureSessionTable;
     friend class TestSecureSessionTable;
 
     SecureSessionTable & mTable;
@@ -351,6 +343,10 @@ private:
     SessionParameters mRemoteSessionParams;
     CryptoContext mCryptoContext;
     SessionMessageCounter mSessionMessageCounter;
+
+    // Intrusive bucket chains owned by SecureSessionTable, indexing this session by local session ID and by peer.
+    SecureSession * mNextByLocalSessionId = nullptr;
+    SecureSession * mNextByPeer           = nullptr;
 };
 
 } // namespace Transport
@@ -53,6 +53,10 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSessionForTest(Secure
 
     SecureSession * result = mEntries.CreateObject(*this, secureSessionType, localSessionId, localNodeId, peerNodeId, peerCATs,
                                                    peerSessionId, fabricIndex, config);
+    if (result != nullptr)
+    {
+        AddToIndexes(result);
+    }
     return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
 }
 
@@ -80,6 +84,7 @@ Optional<SessionHandle> SecureSessionTable::CreateNewSecureSession(SecureSession
     }
 
     VerifyOrReturnValue(allocated != nullptr, Optional<SessionHandle>::Missing());
+    AddToIndexes(allocated);
 
     rv             = MakeOptional<SessionHandle>(*allocated);
     mNextSessionId = sessionId.Value() == kMaxSessionID ? static_cast<uint16_t>(kUnsecuredSessionId + 1)
@@ -336,67 +341,104 @@ void SecureSessionTable::DefaultEvictionPolicy(EvictionPolicyContext & evictionC
     });
 }
 
+void SecureSessionTable::ReleaseSession(SecureSession * session)
+{
+    RemoveFromIndexes(session);
+    mEntries.ReleaseObject(session);
+}
+
+void SecureSessionTable::AddToIndexes(SecureSession * session)
+{
+    SecureSession *& localSessionIdHead = mLocalSessionIdIndex[LocalSessionIdBucket(session->GetLocalSessionId())];
+    session->mNextByLocalSessionId      = localSessionIdHead;
+    localSessionIdHead                  = session;
+
+    SecureSession *& peerHead = mPeerIndex[PeerBucket(session->GetPeer())];
+    session->mNextByPeer      = peerHead;
+    peerHead                  = session;
+}
+
+void SecureSessionTable::RemoveFromIndexes(SecureSession * session)
+{
+    for (SecureSession ** link = &mLocalSessionIdIndex[LocalSessionIdBucket(session->GetLocalSessionId())]; *link != nullptr;
+         link                  = &(*link)->mNextByLocalSessionId)
+    {
+        if (*link == session)
+        {
+            *link = session->mNextByLocalSessionId;
+            break;
+        }
+    }
+    session->mNextByLocalSessionId = nullptr;
+
+    for (SecureSession ** link = &mPeerIndex[PeerBucket(session->GetPeer())]; *link != nullptr; link = &(*link)->mNextByPeer)
+    {
+        if (*link == session)
+        {
+            *link = session->mNextByPeer;
+            break;
+        }
+    }
+    session->mNextByPeer = nullptr;
+}
+
+void SecureSessionTable::OnPeerChanged(SecureSession * session, const ScopedNodeId & previousPeer)
+{
+    size_t previousBucket = PeerBucket(previousPeer);
+    size_t newBucket      = PeerBucket(session->GetPeer());
+    VerifyOrReturn(previousBucket != newBucket);
+
+    for (SecureSession ** link = &mPeerIndex[previousBucket]; *link != nullptr; link = &(*link)->mNextByPeer)
+    {
+        if (*link == session)
+        {
+            *link = session->mNextByPeer;
+            break;
+        }
+    }
+
+    session->mNextByPeer = mPeerIndex[newBucket];
+    mPeerIndex[newBucket] = session;
+}
+
 Optional<SessionHandle> SecureSessionTable::FindSecureSessionByLocalKey(uint16_t localSessionId)
 {
-    SecureSession * result = nullptr;
-    mEntries.ForEachActiveObject([&](auto session) {
+    for (SecureSession * session = mLocalSessionIdIndex[LocalSessionIdBucket(localSessionId)]; session != nullptr;
+         session                 = session->mNextByLocalSessionId)
+    {
         if (session->GetLocalSessionId() == localSessionId)
         {
-            result = session;
-            return Loop::Break;
+            return MakeOptional<SessionHandle>(*session);
         }
-        return Loop::Continue;
-    });
-    return result != nullptr ? MakeOptional<SessionHandle>(*result) : Optional<SessionHandle>::Missing();
+    }
+    return Optional<SessionHandle>::Missing();
 }
 
 Optional<uint16_t> SecureSessionTable::FindUnusedSessionId()
 {
-    uint16_t candidate_base = 0;
-    uint64_t candidate_mask = 0;
-    for (uint32_t i = 0; i <= kMaxSessionID; i += 64)
+    uint16_t candidate = mNextSessionId;
+    for (uint32_t i = 0; i <= kMaxSessionID; i++, candidate++)
     {
-        // candidate_base is the base session ID we are searching from.
-        // We have a 64-bit mask anchored at this ID and iterate over the
-        // whole session table, setting bits in the mask for in-use IDs.
-        // If we can iterate through the entire session table and have
-        // any bits clear in the mask, we have available session IDs.
-        candidate_base = static_cast<uint16_t>(i + mNextSessionId);
-        candidate_mask = 0;
+        if (candidate == kUnsecuredSessionId)
         {
-            uint16_t shift = static_cast<uint16_t>(kUnsecuredSessionId - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift); // kUnsecuredSessionId is never available
-            }
+            continue; // kUnsecuredSessionId is never available
         }
-        mEntries.ForEachActiveObject([&](auto session) {
-            uint16_t shift = static_cast<uint16_t>(session->GetLocalSessionId() - candidate_base);
-            if (shift <= 63)
-            {
-                candidate_mask |= (1ULL << shift);
-            }
-            if (candidate_mask == UINT64_MAX)
+
+        bool inUse = false;
+        for (SecureSession * session = mLocalSessionIdIndex[LocalSessionIdBucket(candidate)]; session != nullptr;
+             session                 = session->mNextByLocalSessionId)
+        {
+            if (session->GetLocalSessionId() == candidate)
             {
-                return Loop::Break; // No bits clear means this bucket is full.
+                inUse = true;
+                break;
             }
-            return Loop::Continue;
-        });
-        if (candidate_mask != UINT64_MAX)
-        {
-            break; // Any bit clear means we have an available ID in this bucket.
         }
-    }
-    if (candidate_mask != UINT64_MAX)
-    {
-        uint16_t offset = 0;
-        while (candidate_mask & 1)
+
+        if (!inUse)
         {
-            candidate_mask >>= 1;
-            ++offset;
+            return MakeOptional<uint16_t>(candidate);
         }
-        uint16_t available = static_cast<uint16_t>(candidate_base + offset);
-        return MakeOptional<uint16_t>(available);
     }
 
     return NullOptional;
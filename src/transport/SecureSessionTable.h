@@ -29,6 +29,16 @@ namespace Transport {
 inline constexpr uint16_t kMaxSessionID       = UINT16_MAX;
 inline constexpr uint16_t kUnsecuredSessionId = 0;
 
+constexpr size_t ComputeSessionIndexBucketCount(size_t poolSize)
+{
+    size_t count = 1;
+    while (count < poolSize)
+    {
+        count <<= 1;
+    }
+    return count;
+}
+
 /**
  * Handles a set of sessions.
  *
@@ -76,7 +86,7 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> CreateNewSecureSession(SecureSession::Type secureSessionType, ScopedNodeId sessionEvictionHint);
 
-    void ReleaseSession(SecureSession * session) { mEntries.ReleaseObject(session); }
+    void ReleaseSession(SecureSession * session);
 
     template <typename Function>
     Loop ForEachSession(Function && function)
@@ -94,23 +104,51 @@ public:
     CHECK_RETURN_VALUE
     Optional<SessionHandle> FindSecureSessionByLocalKey(uint16_t localSessionId);
 
+    /**
+     * Call the provided function on every session (in any state) whose peer matches the provided ScopedNodeId.
+     *
+     * Sessions are looked up through the peer index, so the cost is proportional to the number of sessions
+     * sharing a bucket with the peer rather than to the size of the table. The function may release or
+     * evict any session, including the one it is called on.
+     */
+    template <typename Function>
+    Loop ForEachSessionForPeer(const ScopedNodeId & peer, Function && function)
+    {
+        SecureSession * session = mPeerIndex[PeerBucket(peer)];
+        while (session != nullptr)
+        {
+            if (session->GetPeer() != peer)
+            {
+                session = session->mNextByPeer;
+                continue;
+            }
+
+            // Hold a reference so the session stays in its bucket chain while the function runs.
+            SessionHandle ref(*session);
+            if (function(session) == Loop::Break)
+            {
+                return Loop::Break;
+            }
+            session = session->mNextByPeer;
+        }
+        return Loop::Finish;
+    }
+
     // Select SessionHolders which are pointing to a session with the same peer as the given session. Shift them to the given
     // session.
     // This is an internal API, using raw pointer to a session is allowed here.
     void NewerSessionAvailable(SecureSession * session)
     {
         VerifyOrDie(session->GetSecureSessionType() == SecureSession::Type::kCASE);
-        mEntries.ForEachActiveObject([&](SecureSession * oldSession) {
+        ForEachSessionForPeer(session->GetPeer(), [&](SecureSession * oldSession) {
             if (session == oldSession)
                 return Loop::Continue;
 
-            SessionHandle ref(*oldSession);
-
             // This will give all SessionHolders pointing to oldSession a chance to switch to the provided session
             //
             // See documentation for SessionDelegate::GetNewSessionHandlingPolicy about how session auto-shifting works, and how
             // to disable it for a specific SessionHolder in a specific scenario.
-            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE && oldSession->GetPeer() == session->GetPeer() &&
+            if (oldSession->GetSecureSessionType() == SecureSession::Type::kCASE &&
                 oldSession->GetPeerCATs() == session->GetPeerCATs())
             {
                 oldSession->NewerSessionAvailable(SessionHandle(*session));
@@ -121,8 +159,36 @@ public:
     }
 
 private:
+    friend class SecureSession;
     friend class TestSecureSessionTable;
 
+    // Number of buckets in each of the session indexes: the smallest power of two that is at least the pool size,
+    // so that chains stay at about one entry when the table is full.
+    static constexpr size_t kIndexBucketCount = ComputeSessionIndexBucketCount(CHIP_CONFIG_SECURE_SESSION_POOL_SIZE);
+
+    static size_t LocalSessionIdBucket(uint16_t localSessionId) { return localSessionId & (kIndexBucketCount - 1); }
+    static size_t PeerBucket(const ScopedNodeId & peer)
+    {
+        uint64_t key = peer.GetNodeId() ^ (static_cast<uint64_t>(peer.GetFabricIndex()) << 56);
+        return static_cast<size_t>((key * 0x9E3779B97F4A7C15ULL) >> 32) & (kIndexBucketCount - 1);
+    }
+
+    /**
+     * Add a newly allocated session to the local session ID and peer indexes.
+     */
+    void AddToIndexes(SecureSession * session);
+
+    /**
+     * Remove a session that is about to be released from the local session ID and peer indexes.
+     */
+    void RemoveFromIndexes(SecureSession * session);
+
+    /**
+     * Called by SecureSession whenever the result of GetPeer() changes (on Activate() or AdoptFabricIndex()),
+     * to move the session to the peer index bucket matching its new peer.
+     */
+    void OnPeerChanged(SecureSession * session, const ScopedNodeId & previousPeer);
+
     /**
      * This provides a sortable wrapper for a SecureSession object. A SecureSession
      * isn't directly sortable since it is not swappable (i.e meet criteria for ValueSwappable).
@@ -243,13 +309,10 @@ private:
     /**
      * Find an available session ID that is unused in the secure session table.
      *
-     * The search algorithm iterates over the session ID space in the outer loop
-     * and the session table in the inner loop to locate an available session ID
-     * from the starting mNextSessionId clue.
-     *
-     * The outer-loop considers 64 session IDs in each iteration to give a
-     * runtime complexity of O(CHIP_CONFIG_PEER_CONNECTION_POOL_SIZE^2/64).  Speed up could be
-     * achieved with a sorted session table or additional storage.
+     * Candidate IDs are probed in increasing order from the starting mNextSessionId
+     * clue, each probe being a lookup in the local session ID index. Since at most
+     * one probe fails per allocated session, this takes O(1) probes in the common
+     * case and O(number of sessions) in the worst case.
      *
      * @return an unused session ID if any is found, else NullOptional
      */
@@ -274,6 +337,11 @@ private:
 #endif
 
     uint16_t mNextSessionId = 0;
+
+    // Heads of the bucket chains indexing allocated sessions, linked through
+    // SecureSession::mNextByLocalSessionId and SecureSession::mNextByPeer respectively.
+    SecureSession * mLocalSessionIdIndex[kIndexBucketCount] = {};
+    SecureSession * mPeerIndex[kIndexBucketCount]           = {};
 };
 
 } // namespace Transport
@@ -174,12 +174,116 @@ void SessionManager::FabricRemoved(FabricIndex fabricIndex)
     TEMPORARY_RETURN_IGNORED gGroupPeerTable->FabricRemoved(fabricIndex);
 }
 
+CHIP_ERROR SessionManager::CheckMessageLength(const SessionHandle & sessionHandle, const System::PacketBufferHandle & message) const
+{
+    VerifyOrReturnError(!message->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+
+    if (sessionHandle->AllowsLargePayload())
+    {
+        VerifyOrReturnError(message->TotalLength() <= kMaxLargeAppMessageLen, CHIP_ERROR_MESSAGE_TOO_LONG);
+    }
+    else
+    {
+        VerifyOrReturnError(message->TotalLength() <= kMaxAppMessageLen, CHIP_ERROR_MESSAGE_TOO_LONG);
+    }
+
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SessionManager::PrepareSecureMessageHeader(SecureSession & session, PayloadHeader & payloadHeader,
+                                                      const System::PacketBufferHandle & message, PacketHeader & packetHeader,
+                                                      CryptoContext::NonceStorage & nonce)
+{
+    MessageCounter & counter = session.GetSessionMessageCounter().GetLocalMessageCounter();
+    uint32_t messageCounter;
+    ReturnErrorOnFailure(counter.AdvanceAndConsume(messageCounter));
+    packetHeader
+        .SetMessageCounter(messageCounter)        //
+        .SetSessionId(session.GetPeerSessionId()) //
+        .SetSessionType(Header::SessionType::kUnicastSession);
+
+    // Trace before any encryption
+    MATTER_LOG_MESSAGE_SEND(chip::Tracing::OutgoingMessageType::kSecureSession, &payloadHeader, &packetHeader,
+                            chip::ByteSpan(message->Start(), message->TotalLength()),
+                            /* totalMessageSize = */
+                            (packetHeader.EncodeSizeBytes() + payloadHeader.EncodeSizeBytes() + message->TotalLength() +
+                             packetHeader.MICTagLength()));
+    CHIP_TRACE_MESSAGE_SENT(payloadHeader, packetHeader, session.GetPeerAddress(), message->Start(), message->TotalLength());
+
+    return CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), messageCounter,
+                                     session.GetLocalScopedNodeId().GetNodeId());
+}
+
+#if CHIP_PROGRESS_LOGGING
+void SessionManager::LogMessageSent(const SessionHandle & sessionHandle, const PayloadHeader & payloadHeader,
+                                    const PacketHeader & packetHeader, const Transport::PeerAddress & destinationAddress,
+                                    NodeId sourceNodeId, NodeId destination, FabricIndex fabricIndex, size_t messageLength)
+{
+    CompressedFabricId compressedFabricId = kUndefinedCompressedFabricId;
+
+    if (fabricIndex != kUndefinedFabricIndex && mFabricTable != nullptr)
+    {
+        auto fabricInfo = mFabricTable->FindFabricWithIndex(fabricIndex);
+        if (fabricInfo)
+        {
+            compressedFabricId = fabricInfo->GetCompressedFabricId();
+        }
+    }
+
+    auto * protocolName = Protocols::GetProtocolName(payloadHeader.GetProtocolID());
+    auto * msgTypeName  = Protocols::GetMessageTypeName(payloadHeader.GetProtocolID(), payloadHeader.GetMessageType());
+
+    //
+    // 32-bit value maximum = 10 chars + text preamble (6) + trailer (1) + null (1) + 2 buffer = 20
+    //
+    char ackBuf[20];
+    ackBuf[0] = '\0';
+    if (payloadHeader.GetAckMessageCounter().HasValue())
+    {
+        snprintf(ackBuf, sizeof(ackBuf), " (Ack:" ChipLogFormatMessageCounter ")", payloadHeader.GetAckMessageCounter().Value());
+    }
+
+    char addressStr[Transport::PeerAddress::kMaxToStringSize] = { 0 };
+    destinationAddress.ToString(addressStr);
+
+    // Work around pigweed not allowing more than 14 format args in a log
+    // message when using tokenized logs.
+    char typeStr[4 + 1 + 2 + 1];
+    snprintf(typeStr, sizeof(typeStr), "%04X:%02X", payloadHeader.GetProtocolID().GetProtocolId(), payloadHeader.GetMessageType());
+
+    // More work around pigweed not allowing more than 14 format args in a log
+    // message when using tokenized logs.
+    // ChipLogFormatExchangeId logs the numeric exchange ID (at most 5 chars,
+    // since it's a uint16_t) and one char for initiator/responder.  Plus we
+    // need a null-terminator.
+    char exchangeStr[5 + 1 + 1];
+    snprintf(exchangeStr, sizeof(exchangeStr), ChipLogFormatExchangeId, ChipLogValueExchangeIdFromSentHeader(payloadHeader));
+
+    // More work around pigweed not allowing more than 14 format args in a log
+    // message when using tokenized logs.
+    // text(5) + source(16) + text(4) + fabricIndex(uint16_t, at most 5 chars) + text(1) + destination(16) + text(2) + compressed
+    // fabric id(4) + text(1) + null-terminator
+    char sourceDestinationStr[5 + 16 + 4 + 5 + 1 + 16 + 2 + 4 + 1 + 1];
+    snprintf(sourceDestinationStr, sizeof(sourceDestinationStr), "from " ChipLogFormatX64 " to %u:" ChipLogFormatX64 " [%04X]",
+             ChipLogValueX64(sourceNodeId), fabricIndex, ChipLogValueX64(destination), static_cast<uint16_t>(compressedFabricId));
+
+    //
+    // Legend that can be used to decode this log line can be found in messaging/README.md
+    //
+    ChipLogProgress(ExchangeManager,
+                    "<<< [E:%s S:%u M:" ChipLogFormatMessageCounter "%s] (%s) Msg TX %s [%s] --- Type %s (%s:%s) (B:%u)",
+                    exchangeStr, sessionHandle->SessionIdForLogging(), packetHeader.GetMessageCounter(), ackBuf,
+                    Transport::GetSessionTypeString(sessionHandle), sourceDestinationStr, addressStr, typeStr, protocolName,
+                    msgTypeName, static_cast<unsigned>(messageLength));
+}
+#endif // CHIP_PROGRESS_LOGGING
+
 CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, PayloadHeader & payloadHeader,
                                           System::PacketBufferHandle && message, EncryptedPacketBufferHandle & preparedMessage)
 {
     MATTER_TRACE_SCOPE("PrepareMessage", "SessionManager");
 
-    VerifyOrReturnError(!message->HasChainedBuffer(), CHIP_ERROR_INVALID_MESSAGE_LENGTH);
+    ReturnErrorOnFailure(CheckMessageLength(sessionHandle, message));
 
     bool headerEncoded = false;
     PacketHeader packetHeader;
@@ -189,15 +293,6 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
         packetHeader.SetSecureSessionControlMsg(true);
     }
 
-    if (sessionHandle->AllowsLargePayload())
-    {
-        VerifyOrReturnError(message->TotalLength() <= kMaxLargeAppMessageLen, CHIP_ERROR_MESSAGE_TOO_LONG);
-    }
-    else
-    {
-        VerifyOrReturnError(message->TotalLength() <= kMaxAppMessageLen, CHIP_ERROR_MESSAGE_TOO_LONG);
-    }
-
 #if CHIP_PROGRESS_LOGGING
     NodeId destination;
     FabricIndex fabricIndex;
@@ -325,30 +420,13 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
             return CHIP_ERROR_NOT_CONNECTED;
         }
 
-        MessageCounter & counter = session->GetSessionMessageCounter().GetLocalMessageCounter();
-        uint32_t messageCounter;
-        ReturnErrorOnFailure(counter.AdvanceAndConsume(messageCounter));
-        packetHeader
-            .SetMessageCounter(messageCounter)         //
-            .SetSessionId(session->GetPeerSessionId()) //
-            .SetSessionType(Header::SessionType::kUnicastSession);
-
-        destination_address           = session->GetPeerAddress();
-        CryptoContext & cryptoContext = session->GetCryptoContext();
-
-        // Trace before any encryption
-        MATTER_LOG_MESSAGE_SEND(chip::Tracing::OutgoingMessageType::kSecureSession, &payloadHeader, &packetHeader,
-                                chip::ByteSpan(message->Start(), message->TotalLength()),
-                                /* totalMessageSize = */
-                                (packetHeader.EncodeSizeBytes() + payloadHeader.EncodeSizeBytes() + message->TotalLength() +
-                                 packetHeader.MICTagLength()));
-        CHIP_TRACE_MESSAGE_SENT(payloadHeader, packetHeader, destination_address, message->Start(), message->TotalLength());
-
         CryptoContext::NonceStorage nonce;
-        sourceNodeId = session->GetLocalScopedNodeId().GetNodeId();
-        ReturnErrorOnFailure(CryptoContext::BuildNonce(nonce, packetHeader.GetSecurityFlags(), messageCounter, sourceNodeId));
+        ReturnErrorOnFailure(PrepareSecureMessageHeader(*session, payloadHeader, message, packetHeader, nonce));
+
+        destination_address = session->GetPeerAddress();
+        sourceNodeId        = session->GetLocalScopedNodeId().GetNodeId();
 
-        ReturnErrorOnFailure(SecureMessageCodec::Encrypt(cryptoContext, nonce, payloadHeader, packetHeader, message));
+        ReturnErrorOnFailure(SecureMessageCodec::Encrypt(session->GetCryptoContext(), nonce, payloadHeader, packetHeader, message));
 
 #if CHIP_PROGRESS_LOGGING
         destination = session->GetPeerNodeId();
@@ -408,67 +486,113 @@ CHIP_ERROR SessionManager::PrepareMessage(const SessionHandle & sessionHandle, P
     }
 
 #if CHIP_PROGRESS_LOGGING
-    CompressedFabricId compressedFabricId = kUndefinedCompressedFabricId;
+    LogMessageSent(sessionHandle, payloadHeader, packetHeader, destination_address, sourceNodeId, destination, fabricIndex,
+                   message->TotalLength());
+#endif
 
-    if (fabricIndex != kUndefinedFabricIndex && mFabricTable != nullptr)
+    preparedMessage = EncryptedPacketBufferHandle::MarkEncrypted(std::move(message));
+
+    CountMessagesSent(sessionHandle, payloadHeader);
+    return CHIP_NO_ERROR;
+}
+
+CHIP_ERROR SessionManager::PrepareMessages(PrepareBatchEntry * entries, size_t count)
+{
+    MATTER_TRACE_SCOPE("PrepareMessages", "SessionManager");
+
+    constexpr size_t kBatchSize = CHIP_CONFIG_SECURE_MESSAGE_ENCRYPT_BATCH_SIZE;
+
+    VerifyOrReturnError(entries != nullptr || count == 0, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (size_t first = 0; first < count; first += kBatchSize)
     {
-        auto fabricInfo = mFabricTable->FindFabricWithIndex(fabricIndex);
-        if (fabricInfo)
+        PacketHeader packetHeaders[kBatchSize];
+        CryptoContext::NonceStorage nonces[kBatchSize];
+        SecureMessageCodec::EncryptBatchEntry batch[kBatchSize];
+        PrepareBatchEntry * batched[kBatchSize];
+        size_t batchCount = 0;
+
+        for (size_t i = first; i < count && i < first + kBatchSize; i++)
         {
-            compressedFabricId = fabricInfo->GetCompressedFabricId();
-        }
-    }
+            PrepareBatchEntry & entry = entries[i];
 
-    auto * protocolName = Protocols::GetProtocolName(payloadHeader.GetProtocolID());
-    auto * msgTypeName  = Protocols::GetMessageTypeName(payloadHeader.GetProtocolID(), payloadHeader.GetMessageType());
+            VerifyOrExit(entry.session != nullptr && entry.payloadHeader != nullptr && !entry.message.IsNull(),
+                         entry.result = CHIP_ERROR_INVALID_ARGUMENT);
 
-    //
-    // 32-bit value maximum = 10 chars + text preamble (6) + trailer (1) + null (1) + 2 buffer = 20
-    //
-    char ackBuf[20];
-    ackBuf[0] = '\0';
-    if (payloadHeader.GetAckMessageCounter().HasValue())
-    {
-        snprintf(ackBuf, sizeof(ackBuf), " (Ack:" ChipLogFormatMessageCounter ")", payloadHeader.GetAckMessageCounter().Value());
-    }
+            if ((*entry.session)->GetSessionType() != Transport::Session::SessionType::kSecure)
+            {
+                entry.result =
+                    PrepareMessage(*entry.session, *entry.payloadHeader, std::move(entry.message), entry.preparedMessage);
+                continue;
+            }
 
-    char addressStr[Transport::PeerAddress::kMaxToStringSize] = { 0 };
-    destination_address.ToString(addressStr);
+            {
+                SecureSession * session    = (*entry.session)->AsSecureSession();
+                PacketHeader & packetHeader = packetHeaders[batchCount];
+                VerifyOrExit(session != nullptr, entry.result = CHIP_ERROR_NOT_CONNECTED);
 
-    // Work around pigweed not allowing more than 14 format args in a log
-    // message when using tokenized logs.
-    char typeStr[4 + 1 + 2 + 1];
-    snprintf(typeStr, sizeof(typeStr), "%04X:%02X", payloadHeader.GetProtocolID().GetProtocolId(), payloadHeader.GetMessageType());
+                // The slot may hold the header of an earlier entry that failed before being batched.
+                packetHeader = PacketHeader();
 
-    // More work around pigweed not allowing more than 14 format args in a log
-    // message when using tokenized logs.
-    // ChipLogFormatExchangeId logs the numeric exchange ID (at most 5 chars,
-    // since it's a uint16_t) and one char for initiator/responder.  Plus we
-    // need a null-terminator.
-    char exchangeStr[5 + 1 + 1];
-    snprintf(exchangeStr, sizeof(exchangeStr), ChipLogFormatExchangeId, ChipLogValueExchangeIdFromSentHeader(payloadHeader));
+                entry.result = CheckMessageLength(*entry.session, entry.message);
+                SuccessOrExit(entry.result);
 
-    // More work around pigweed not allowing more than 14 format args in a log
-    // message when using tokenized logs.
-    // text(5) + source(16) + text(4) + fabricIndex(uint16_t, at most 5 chars) + text(1) + destination(16) + text(2) + compressed
-    // fabric id(4) + text(1) + null-terminator
-    char sourceDestinationStr[5 + 16 + 4 + 5 + 1 + 16 + 2 + 4 + 1 + 1];
-    snprintf(sourceDestinationStr, sizeof(sourceDestinationStr), "from " ChipLogFormatX64 " to %u:" ChipLogFormatX64 " [%04X]",
-             ChipLogValueX64(sourceNodeId), fabricIndex, ChipLogValueX64(destination), static_cast<uint16_t>(compressedFabricId));
+                if (IsControlMessage(*entry.payloadHeader))
+                {
+                    packetHeader.SetSecureSessionControlMsg(true);
+                }
 
-    //
-    // Legend that can be used to decode this log line can be found in messaging/README.md
-    //
-    ChipLogProgress(ExchangeManager,
-                    "<<< [E:%s S:%u M:" ChipLogFormatMessageCounter "%s] (%s) Msg TX %s [%s] --- Type %s (%s:%s) (B:%u)",
-                    exchangeStr, sessionHandle->SessionIdForLogging(), packetHeader.GetMessageCounter(), ackBuf,
-                    Transport::GetSessionTypeString(sessionHandle), sourceDestinationStr, addressStr, typeStr, protocolName,
-                    msgTypeName, static_cast<unsigned>(message->TotalLength()));
-#endif
+                entry.result =
+                    PrepareSecureMessageHeader(*session, *entry.payloadHeader, entry.message, packetHeader, nonces[batchCount]);
+                SuccessOrExit(entry.result);
 
-    preparedMessage = EncryptedPacketBufferHandle::MarkEncrypted(std::move(message));
+                batch[batchCount].context       = &session->GetCryptoContext();
+                batch[batchCount].nonce         = CryptoContext::ConstNonceView(nonces[batchCount]);
+                batch[batchCount].payloadHeader = entry.payloadHeader;
+                batch[batchCount].packetHeader  = &packetHeader;
+                batch[batchCount].msgBuf        = &entry.message;
+                batched[batchCount++]           = &entry;
+            }
+
+        exit:
+            continue;
+        }
+
+        // Per-message errors are reported through the entries.
+        RETURN_SAFELY_IGNORED SecureMessageCodec::EncryptBatch(batch, batchCount);
+
+        for (size_t i = 0; i < batchCount; i++)
+        {
+            PrepareBatchEntry & entry = *batched[i];
+
+            entry.result = batch[i].result;
+            if (entry.result == CHIP_NO_ERROR)
+            {
+                entry.result = packetHeaders[i].EncodeBeforeData(entry.message);
+            }
+            if (entry.result != CHIP_NO_ERROR)
+            {
+                continue;
+            }
+
+#if CHIP_PROGRESS_LOGGING
+            SecureSession * session = (*entry.session)->AsSecureSession();
+            LogMessageSent(*entry.session, *entry.payloadHeader, packetHeaders[i], session->GetPeerAddress(),
+                           session->GetLocalScopedNodeId().GetNodeId(), session->GetPeerNodeId(), session->GetFabricIndex(),
+                           entry.message->TotalLength());
+#endif // CHIP_PROGRESS_LOGGING
+
+            entry.preparedMessage = EncryptedPacketBufferHandle::MarkEncrypted(std::move(entry.message));
+
+            CountMessagesSent(*entry.session, *entry.payloadHeader);
+        }
+    }
+
+    for (size_t i = 0; i < count; i++)
+    {
+        ReturnErrorOnFailure(entries[i].result);
+    }
 
-    CountMessagesSent(sessionHandle, payloadHeader);
     return CHIP_NO_ERROR;
 }
 
@@ -645,9 +769,8 @@ void SessionManager::ExpireAllSecureSessions()
 
 void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Optional<Transport::SecureSession::Type> & type)
 {
-    mSecureSessions.ForEachSession([&node, &type](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == node &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+    mSecureSessions.ForEachSessionForPeer(node, [&type](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             session->MarkAsDefunct();
         }
@@ -657,10 +780,10 @@ void SessionManager::MarkSessionsAsDefunct(const ScopedNodeId & node, const Opti
 
 void SessionManager::UpdateAllSessionsPeerAddress(const ScopedNodeId & node, const Transport::PeerAddress & addr)
 {
-    mSecureSessions.ForEachSession([&node, &addr](auto session) {
+    mSecureSessions.ForEachSessionForPeer(node, [&addr](auto session) {
         // Arguably we should only be updating active and defunct sessions, but there is no harm
         // in updating evicted sessions.
-        if (session->GetPeer() == node && Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
+        if (Transport::SecureSession::Type::kCASE == session->GetSecureSessionType())
         {
             session->SetPeerAddress(addr);
         }
@@ -1369,13 +1492,12 @@ Optional<SessionHandle> SessionManager::FindSecureSessionForNode(ScopedNodeId pe
     SecureSession * tcpSession = nullptr;
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
 
-    mSecureSessions.ForEachSession([&peerNodeId, &type, &mrpSession,
+    mSecureSessions.ForEachSessionForPeer(peerNodeId, [&type, &mrpSession,
 #if INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &tcpSession,
+                                                       &tcpSession,
 #endif // INET_CONFIG_ENABLE_TCP_ENDPOINT
-                                    &transportPayloadCapability](auto session) {
-        if (session->IsActiveSession() && session->GetPeer() == peerNodeId &&
-            (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
+                                                       &transportPayloadCapability](auto session) {
+        if (session->IsActiveSession() && (!type.HasValue() || type.Value() == session->GetSecureSessionType()))
         {
             if (transportPayloadCapability == TransportPayloadCapability::kMRPOrTCPCompatiblePayload ||
                 transportPayloadCapability == TransportPayloadCapability::kLargePayload)
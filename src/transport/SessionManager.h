@@ -165,6 +165,34 @@ public:
     CHIP_ERROR PrepareMessage(const SessionHandle & session, PayloadHeader & payloadHeader, System::PacketBufferHandle && msgBuf,
                               EncryptedPacketBufferHandle & encryptedMessage);
 
+    /** @brief One message of a PrepareMessages() call, the fields match the arguments of PrepareMessage(). */
+    struct PrepareBatchEntry
+    {
+        const SessionHandle * session = nullptr;
+        PayloadHeader * payloadHeader = nullptr;
+        System::PacketBufferHandle message;
+        EncryptedPacketBufferHandle preparedMessage;
+        CHIP_ERROR result = CHIP_NO_ERROR;
+    };
+
+    /**
+     * @brief
+     *   Prepare several messages as PrepareMessage() does for each of them.
+     *
+     * @details
+     *   This is meant for a caller that has several messages ready at once, e.g. one report per subscriber.
+     *   The interaction model does not use it yet: reports are built and sent one handler at a time through
+     *   the exchange layer, which calls PrepareMessage().
+     *
+     *   Messages on secure unicast sessions are encrypted together through SecureMessageCodec::EncryptBatch(),
+     *   in groups of CHIP_CONFIG_SECURE_MESSAGE_ENCRYPT_BATCH_SIZE. Other messages go through PrepareMessage().
+     *   The outcome of each message is stored in its `result`, and every entry that succeeded MUST be
+     *   followed by a send attempt with its `preparedMessage`, as for PrepareMessage().
+     *
+     * @return CHIP_NO_ERROR if every message was prepared, otherwise the error of the first failed one.
+     */
+    CHIP_ERROR PrepareMessages(PrepareBatchEntry * entries, size_t count);
+
     /**
      * @brief
      *   Send a prepared message to a currently connected peer.
@@ -217,12 +245,8 @@ public:
     template <typename Function>
     void ForEachMatchingSession(const ScopedNodeId & node, Function && function)
     {
-        mSecureSessions.ForEachSession([&](auto * session) {
-            if (session->GetPeer() == node)
-            {
-                function(session);
-            }
-
+        mSecureSessions.ForEachSessionForPeer(node, [&](auto * session) {
+            function(session);
             return Loop::Continue;
         });
     }
@@ -625,6 +649,22 @@ private:
             payloadHeader.HasMessageType(Protocols::SecureChannel::MsgType::MsgCounterSyncRsp);
     }
 
+    CHIP_ERROR CheckMessageLength(const SessionHandle & sessionHandle, const System::PacketBufferHandle & message) const;
+
+    /**
+     * @brief Fill in the packet header of a message on a secure unicast session and build its nonce,
+     * consuming a message counter value.
+     */
+    CHIP_ERROR PrepareSecureMessageHeader(Transport::SecureSession & session, PayloadHeader & payloadHeader,
+                                          const System::PacketBufferHandle & message, PacketHeader & packetHeader,
+                                          CryptoContext::NonceStorage & nonce);
+
+#if CHIP_PROGRESS_LOGGING
+    void LogMessageSent(const SessionHandle & sessionHandle, const PayloadHeader & payloadHeader, const PacketHeader & packetHeader,
+                        const Transport::PeerAddress & destinationAddress, NodeId sourceNodeId, NodeId destination,
+                        FabricIndex fabricIndex, size_t messageLength);
+#endif // CHIP_PROGRESS_LOGGING
+
     void CountMessagesReceived(const SessionHandle & sessionHandle, const PayloadHeader & payloadHeader);
     void CountMessagesSent(const SessionHandle & sessionHandle, const PayloadHeader & payloadHeader);
 };
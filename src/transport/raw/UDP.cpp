@@ -80,6 +80,9 @@ uint16_t UDP::GetBoundPort()
 
 void UDP::Close()
 {
+#if INET_CONFIG_UDP_IO_BATCH_SIZE > 1
+    DiscardPendingSends();
+#endif // INET_CONFIG_UDP_IO_BATCH_SIZE > 1
     mUDPEndPoint.Release();
     mState = State::kNotReady;
 }
@@ -100,8 +103,70 @@ CHIP_ERROR UDP::SendMessage(const Transport::PeerAddress & address, System::Pack
     // Drop the message and return. Free the buffer.
     CHIP_FAULT_INJECT(FaultInjection::kFault_DropOutgoingUDPMsg, msgBuf = nullptr; return CHIP_ERROR_CONNECTION_ABORTED;);
 
+#if INET_CONFIG_UDP_IO_BATCH_SIZE > 1
+    // Only consecutive messages to the same destination share a batch, so that messages still leave in
+    // the order they were sent.
+    if (mPendingSendCount > 0 &&
+        (mPendingSendInfo.DestAddress != addrInfo.DestAddress || mPendingSendInfo.DestPort != addrInfo.DestPort ||
+         mPendingSendInfo.Interface != addrInfo.Interface))
+    {
+        FlushPendingSends();
+    }
+
+    if (mPendingSendCount == 0)
+    {
+        ReturnErrorOnFailure(mUDPEndPoint->GetSystemLayer().ScheduleWork(FlushPendingSends, this));
+        mPendingSendInfo = addrInfo;
+    }
+
+    mPendingSends[mPendingSendCount++] = std::move(msgBuf);
+    if (mPendingSendCount == INET_CONFIG_UDP_IO_BATCH_SIZE)
+    {
+        FlushPendingSends();
+    }
+    return CHIP_NO_ERROR;
+#else
     return mUDPEndPoint->SendMsg(&addrInfo, std::move(msgBuf));
+#endif // INET_CONFIG_UDP_IO_BATCH_SIZE > 1
+}
+
+#if INET_CONFIG_UDP_IO_BATCH_SIZE > 1
+void UDP::FlushPendingSends(System::Layer * systemLayer, void * appState)
+{
+    static_cast<UDP *>(appState)->FlushPendingSends();
+}
+
+void UDP::FlushPendingSends()
+{
+    VerifyOrReturn(mPendingSendCount > 0);
+
+    // Called early when the batch is full or the destination changes: the scheduled flush is no longer needed.
+    mUDPEndPoint->GetSystemLayer().CancelTimer(FlushPendingSends, this);
+
+    const size_t count = mPendingSendCount;
+    size_t sentCount   = 0;
+    mPendingSendCount  = 0;
+
+    CHIP_ERROR err = mUDPEndPoint->SendMsgBatch(&mPendingSendInfo, mPendingSends, count, &sentCount);
+    if (err != CHIP_NO_ERROR)
+    {
+        ChipLogError(Inet, "Failed to send %u of %u UDP messages: %" CHIP_ERROR_FORMAT, static_cast<unsigned>(count - sentCount),
+                     static_cast<unsigned>(count), err.Format());
+    }
+}
+
+void UDP::DiscardPendingSends()
+{
+    VerifyOrReturn(mPendingSendCount > 0);
+
+    mUDPEndPoint->GetSystemLayer().CancelTimer(FlushPendingSends, this);
+    for (size_t i = 0; i < mPendingSendCount; i++)
+    {
+        mPendingSends[i] = nullptr;
+    }
+    mPendingSendCount = 0;
 }
+#endif // INET_CONFIG_UDP_IO_BATCH_SIZE > 1
 
 void UDP::OnUdpReceive(Inet::UDPEndPoint * endPoint, System::PacketBufferHandle && buffer, const Inet::IPPacketInfo * pktInfo)
 {
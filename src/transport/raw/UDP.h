@@ -120,6 +120,10 @@ public:
      */
     CHIP_ERROR Init(UdpListenParameters & params);
 
+#if INET_CONFIG_UDP_IO_BATCH_SIZE > 1
+    ~UDP() override { DiscardPendingSends(); }
+#endif // INET_CONFIG_UDP_IO_BATCH_SIZE > 1
+
     uint16_t GetBoundPort();
 
     /**
@@ -127,6 +131,15 @@ public:
      */
     void Close() override;
 
+    /**
+     * Send a message to a UDP peer.
+     *
+     * When INET_CONFIG_UDP_IO_BATCH_SIZE is greater than 1, the message is queued and sent at the end of the
+     * current pass of the event loop, together with the messages sent right after it to the same destination,
+     * through a single UDPEndPoint::SendMsgBatch(). This is what lets, for instance, the reports the engine
+     * produces for several subscriptions of the same controller leave in one system call. A failure to send a
+     * queued message is then only logged, as for any datagram lost on the way.
+     */
     CHIP_ERROR SendMessage(const Transport::PeerAddress & address, System::PacketBufferHandle && msgBuf) override;
 
     CHIP_ERROR MulticastGroupJoinLeave(const Transport::PeerAddress & address, bool join) override;
@@ -149,6 +162,16 @@ private:
 
     static void OnUdpError(Inet::UDPEndPoint * endPoint, CHIP_ERROR err, const Inet::IPPacketInfo * pktInfo);
 
+#if INET_CONFIG_UDP_IO_BATCH_SIZE > 1
+    static void FlushPendingSends(System::Layer * systemLayer, void * appState);
+    void FlushPendingSends();
+    void DiscardPendingSends();
+
+    Inet::IPPacketInfo mPendingSendInfo;                                     ///< Destination of the queued messages
+    System::PacketBufferHandle mPendingSends[INET_CONFIG_UDP_IO_BATCH_SIZE]; ///< Messages waiting for SendMsgBatch()
+    size_t mPendingSendCount = 0;                                            ///< Number of queued messages
+#endif // INET_CONFIG_UDP_IO_BATCH_SIZE > 1
+
     Inet::UDPEndPointHandle mUDPEndPoint;                                 ///< UDP socket used by the transport
     Inet::IPAddressType mUDPEndpointType = Inet::IPAddressType::kUnknown; ///< Socket listening type
     State mState                         = State::kNotReady;              ///< State of the UDP transport
@@ -72,6 +72,25 @@ public:
     }
 };
 
+// Records the message counters of the received messages, in order of arrival.
+class CounterRecordingDelegate : public TransportMgrDelegate
+{
+public:
+    static constexpr size_t kMaxMessages = INET_CONFIG_UDP_IO_BATCH_SIZE + 3;
+
+    void OnMessageReceived(const Transport::PeerAddress & source, System::PacketBufferHandle && msgBuf,
+                           Transport::MessageTransportContext * transCtxt = nullptr) override
+    {
+        PacketHeader packetHeader;
+        EXPECT_EQ(packetHeader.DecodeAndConsume(msgBuf), CHIP_NO_ERROR);
+        ASSERT_LT(mCount, kMaxMessages);
+        mCounters[mCount++] = packetHeader.GetMessageCounter();
+    }
+
+    uint32_t mCounters[kMaxMessages];
+    size_t mCount = 0;
+};
+
 } // namespace
 
 class TestUDP : public ::testing::Test
@@ -148,6 +167,42 @@ protected:
 
         EXPECT_EQ(ReceiveHandlerCallCount, 1);
     }
+
+    // Sends more messages back to back than fit in one batch, so that with INET_CONFIG_UDP_IO_BATCH_SIZE > 1 the
+    // transport flushes a full batch immediately and the rest from the event loop.
+    void CheckMessageBurstTest(const IPAddress & addr)
+    {
+        Transport::UDP udp;
+
+        EXPECT_SUCCESS(udp.Init(
+            Transport::UdpListenParameters(mIOContext->GetUDPEndPointManager()).SetAddressType(addr.Type()).SetListenPort(0)));
+
+        CounterRecordingDelegate delegate;
+        TransportMgrBase transportMgrBase;
+        transportMgrBase.SetSessionManager(&delegate);
+        EXPECT_SUCCESS(transportMgrBase.Init(&udp));
+
+        const auto peer = Transport::PeerAddress::UDP(addr, udp.GetBoundPort());
+        for (uint32_t i = 0; i < CounterRecordingDelegate::kMaxMessages; i++)
+        {
+            auto buffer = System::PacketBufferHandle::NewWithData(PAYLOAD, sizeof(PAYLOAD));
+            ASSERT_FALSE(buffer.IsNull());
+
+            PacketHeader header;
+            header.SetSourceNodeId(kSourceNodeId).SetDestinationNodeId(kDestinationNodeId).SetMessageCounter(kMessageCounter + i);
+            EXPECT_SUCCESS(header.EncodeBeforeData(buffer));
+            EXPECT_SUCCESS(udp.SendMessage(peer, std::move(buffer)));
+        }
+
+        mIOContext->DriveIOUntil(chip::System::Clock::Seconds16(1),
+                                 [&delegate]() { return delegate.mCount == CounterRecordingDelegate::kMaxMessages; });
+
+        ASSERT_EQ(delegate.mCount, CounterRecordingDelegate::kMaxMessages);
+        for (uint32_t i = 0; i < CounterRecordingDelegate::kMaxMessages; i++)
+        {
+            EXPECT_EQ(delegate.mCounters[i], kMessageCounter + i);
+        }
+    }
 };
 
 IOContext * TestUDP::mIOContext = nullptr;
@@ -164,6 +219,13 @@ TEST_F(TestUDP, CheckMessageTest4)
     IPAddress::FromString("127.0.0.1", addr);
     CheckMessageTest(addr);
 }
+
+TEST_F(TestUDP, CheckMessageBurstTest4)
+{
+    IPAddress addr;
+    IPAddress::FromString("127.0.0.1", addr);
+    CheckMessageBurstTest(addr);
+}
 #endif
 
 TEST_F(TestUDP, CheckSimpleInitTest6)
@@ -177,3 +239,10 @@ TEST_F(TestUDP, CheckMessageTest6)
     IPAddress::FromString("::1", addr);
     CheckMessageTest(addr);
 }
+
+TEST_F(TestUDP, CheckMessageBurstTest6)
+{
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CheckMessageBurstTest(addr);
+}
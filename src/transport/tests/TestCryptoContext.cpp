@@ -21,6 +21,7 @@
 #include <pw_unit_test/framework.h>
 
 #include <crypto/CHIPCryptoPAL.h>
+#include <crypto/DefaultSessionKeystore.h>
 #include <lib/core/CHIPCore.h>
 #include <lib/core/StringBuilderAdapters.h>
 #include <lib/support/CHIPMem.h>
@@ -69,4 +70,80 @@ TEST_F(TestGroupCryptoContext, TestBuildPrivacyNonce)
     }
 }
 
+
+TEST_F(TestGroupCryptoContext, TestEncryptBatchMatchesEncrypt)
+{
+    constexpr size_t kMessageCount  = 2 * CHIP_CONFIG_SECURE_MESSAGE_ENCRYPT_BATCH_SIZE + 1;
+    constexpr size_t kMessageLength = 40;
+
+    Crypto::DefaultSessionKeystore keystore;
+    const uint8_t secret[32] = { 0x01, 0x02, 0x03 };
+    CryptoContext initiators[2];
+    CryptoContext responders[2];
+    for (size_t i = 0; i < 2; i++)
+    {
+        const uint8_t salt[1] = { static_cast<uint8_t>(i) };
+        ASSERT_EQ(initiators[i].InitFromSecret(keystore, ByteSpan(secret), ByteSpan(salt),
+                                               CryptoContext::SessionInfoType::kSessionEstablishment,
+                                               CryptoContext::SessionRole::kInitiator),
+                  CHIP_NO_ERROR);
+        ASSERT_EQ(responders[i].InitFromSecret(keystore, ByteSpan(secret), ByteSpan(salt),
+                                               CryptoContext::SessionInfoType::kSessionEstablishment,
+                                               CryptoContext::SessionRole::kResponder),
+                  CHIP_NO_ERROR);
+    }
+
+    PacketHeader headers[kMessageCount];
+    CryptoContext::NonceStorage nonces[kMessageCount];
+    uint8_t messages[kMessageCount][kMessageLength];
+    uint8_t buffers[kMessageCount][kMessageLength];
+    MessageAuthenticationCode macs[kMessageCount];
+    CryptoContext::EncryptBatchEntry entries[kMessageCount];
+
+    for (size_t i = 0; i < kMessageCount; i++)
+    {
+        const uint32_t counter = static_cast<uint32_t>(i + 1);
+        headers[i].SetMessageCounter(counter).SetSessionId(static_cast<uint16_t>(i % 2 + 1));
+        ASSERT_EQ(CryptoContext::BuildNonce(nonces[i], 0, counter, 0), CHIP_NO_ERROR);
+        memset(messages[i], static_cast<int>(i), kMessageLength);
+        memcpy(buffers[i], messages[i], kMessageLength);
+
+        entries[i].context     = &initiators[i % 2];
+        entries[i].input       = buffers[i];
+        entries[i].inputLength = kMessageLength;
+        entries[i].output      = buffers[i];
+        entries[i].nonce       = CryptoContext::ConstNonceView(nonces[i]);
+        entries[i].header      = &headers[i];
+        entries[i].mac         = &macs[i];
+    }
+
+    // A bad entry fails on its own.
+    entries[1].input = nullptr;
+    EXPECT_EQ(CryptoContext::EncryptBatch(entries, kMessageCount), CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(entries[1].result, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (size_t i = 0; i < kMessageCount; i++)
+    {
+        if (i == 1)
+        {
+            continue;
+        }
+        EXPECT_EQ(entries[i].result, CHIP_NO_ERROR);
+
+        uint8_t expected[kMessageLength];
+        MessageAuthenticationCode expectedMac;
+        ASSERT_EQ(initiators[i % 2].Encrypt(messages[i], kMessageLength, expected, CryptoContext::ConstNonceView(nonces[i]),
+                                            headers[i], expectedMac),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(buffers[i], expected, kMessageLength), 0);
+        EXPECT_EQ(memcmp(macs[i].GetTag(), expectedMac.GetTag(), Crypto::CHIP_CRYPTO_AEAD_MIC_LENGTH_BYTES), 0);
+
+        uint8_t decrypted[kMessageLength];
+        ASSERT_EQ(responders[i % 2].Decrypt(buffers[i], kMessageLength, decrypted, CryptoContext::ConstNonceView(nonces[i]),
+                                            headers[i], macs[i]),
+                  CHIP_NO_ERROR);
+        EXPECT_EQ(memcmp(decrypted, messages[i], kMessageLength), 0);
+    }
+}
+
 } // namespace
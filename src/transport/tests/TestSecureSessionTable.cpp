@@ -43,6 +43,7 @@ public:
     static void TearDownTestSuite() { chip::Platform::MemoryShutdown(); }
 
     void ValidateSessionSorting();
+    void ValidateSessionIndexes();
 
 private:
     struct SessionParameters
@@ -452,6 +453,93 @@ void TestSecureSessionTable::ValidateSessionSorting()
     }
 }
 
+void TestSecureSessionTable::ValidateSessionIndexes()
+{
+    const ReliableMessageProtocolConfig config(System::Clock::Milliseconds32(0), System::Clock::Milliseconds32(0),
+                                               System::Clock::Milliseconds16(0));
+
+    SecureSessionTable table;
+    table.Init();
+
+    //
+    // Start allocating just below the wrap-around point, with the ID following it already taken, to
+    // make sure the allocator skips both kUnsecuredSessionId and in-use IDs.
+    //
+    table.mNextSessionId = kMaxSessionID;
+    auto blocker = table.CreateNewSecureSessionForTest(SecureSession::Type::kCASE, 1, 1, 2, CATValues(), 1, kFabric1, config);
+    ASSERT_TRUE(blocker.HasValue());
+
+    auto session1 = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    auto session2 = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    auto session3 = table.CreateNewSecureSession(SecureSession::Type::kCASE, ScopedNodeId());
+    ASSERT_TRUE(session1.HasValue() && session2.HasValue() && session3.HasValue());
+
+    SecureSession * sessions[] = { session1.Value()->AsSecureSession(), session2.Value()->AsSecureSession(),
+                                   session3.Value()->AsSecureSession() };
+    EXPECT_EQ(sessions[0]->GetLocalSessionId(), kMaxSessionID);
+    EXPECT_EQ(sessions[1]->GetLocalSessionId(), 2);
+    EXPECT_EQ(sessions[2]->GetLocalSessionId(), 3);
+
+    for (auto * session : sessions)
+    {
+        auto found = table.FindSecureSessionByLocalKey(session->GetLocalSessionId());
+        ASSERT_TRUE(found.HasValue());
+        EXPECT_EQ(found.Value()->AsSecureSession(), session);
+    }
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(4).HasValue());
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(kUnsecuredSessionId).HasValue());
+
+    auto countSessionsForPeer = [&table](const ScopedNodeId & peer) {
+        int count = 0;
+        table.ForEachSessionForPeer(peer, [&count, &peer](auto * session) {
+            EXPECT_TRUE(session->GetPeer() == peer);
+            count++;
+            return Loop::Continue;
+        });
+        return count;
+    };
+
+    // Sessions only show up under their peer once activated.
+    EXPECT_EQ(countSessionsForPeer(ScopedNodeId(2, kFabric1)), 1);
+    EXPECT_EQ(countSessionsForPeer(ScopedNodeId(3, kFabric1)), 0);
+
+    sessions[0]->Activate(ScopedNodeId(1, kFabric1), ScopedNodeId(2, kFabric1), CATValues(), 10, config);
+    sessions[1]->Activate(ScopedNodeId(1, kFabric1), ScopedNodeId(3, kFabric1), CATValues(), 11, config);
+    sessions[2]->Activate(ScopedNodeId(1, kFabric2), ScopedNodeId(2, kFabric2), CATValues(), 12, config);
+
+    EXPECT_EQ(countSessionsForPeer(ScopedNodeId(2, kFabric1)), 2);
+    EXPECT_EQ(countSessionsForPeer(ScopedNodeId(3, kFabric1)), 1);
+    EXPECT_EQ(countSessionsForPeer(ScopedNodeId(2, kFabric2)), 1);
+    EXPECT_EQ(countSessionsForPeer(ScopedNodeId(2, kFabric3)), 0);
+
+    // Evicting sessions from within the iteration must be safe, and released sessions must leave both indexes.
+    session1.ClearValue();
+    blocker.ClearValue();
+    table.ForEachSessionForPeer(ScopedNodeId(2, kFabric1), [](auto * session) {
+        session->MarkForEviction();
+        return Loop::Continue;
+    });
+
+    EXPECT_EQ(countSessionsForPeer(ScopedNodeId(2, kFabric1)), 0);
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(kMaxSessionID).HasValue());
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(1).HasValue());
+    EXPECT_TRUE(table.FindSecureSessionByLocalKey(2).HasValue());
+
+    sessions[1]->MarkForEviction();
+    sessions[2]->MarkForEviction();
+    session2.ClearValue();
+    session3.ClearValue();
+
+    EXPECT_EQ(countSessionsForPeer(ScopedNodeId(3, kFabric1)), 0);
+    EXPECT_EQ(countSessionsForPeer(ScopedNodeId(2, kFabric2)), 0);
+    EXPECT_FALSE(table.FindSecureSessionByLocalKey(2).HasValue());
+}
+
+TEST_F(TestSecureSessionTable, ValidateSessionIndexes)
+{
+    ValidateSessionIndexes();
+}
+
 TEST_F(TestSecureSessionTable, ValidateSessionSorting)
 {
     // This calls TestSecureSessionTable::ValidateSessionSorting instead of just doing the
@@ -341,6 +341,99 @@ TEST_F(TestSessionManager, SendEncryptedPacketTest)
     sessionManager.Shutdown();
 }
 
+TEST_F(TestSessionManager, SendBatchPreparedPacketsTest)
+{
+    constexpr size_t kMessageCount = 2 * CHIP_CONFIG_SECURE_MESSAGE_ENCRYPT_BATCH_SIZE + 1;
+
+    uint16_t payload_len = sizeof(PAYLOAD);
+
+    TestSessMgrCallback callback;
+    callback.LargeMessageSent = false;
+
+    IPAddress addr;
+    IPAddress::FromString("::1", addr);
+    CHIP_ERROR err = CHIP_NO_ERROR;
+
+    FabricTableHolder fabricTableHolder;
+    SessionManager sessionManager;
+    secure_channel::MessageCounterManager gMessageCounterManager;
+    chip::TestPersistentStorageDelegate deviceStorage;
+    chip::Crypto::DefaultSessionKeystore sessionKeystore;
+    FabricTable & fabricTable    = fabricTableHolder.GetFabricTable();
+    FabricIndex aliceFabricIndex = kUndefinedFabricIndex;
+    FabricIndex bobFabricIndex   = kUndefinedFabricIndex;
+
+    EXPECT_EQ(CHIP_NO_ERROR, fabricTableHolder.Init());
+    EXPECT_EQ(CHIP_NO_ERROR,
+              sessionManager.Init(&mContext.GetSystemLayer(), &mContext.GetTransportMgr(), &gMessageCounterManager, &deviceStorage,
+                                  &fabricTableHolder.GetFabricTable(), sessionKeystore));
+
+    sessionManager.SetMessageDelegate(&callback);
+
+    Transport::PeerAddress peer(Transport::PeerAddress::UDP(addr, CHIP_PORT));
+
+    err =
+        fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                          GetNodeA1CertAsset().mCert, GetNodeA1CertAsset().mKey, &aliceFabricIndex);
+    EXPECT_EQ(CHIP_NO_ERROR, err);
+
+    err = fabricTable.AddNewFabricForTestIgnoringCollisions(GetRootACertAsset().mCert, GetIAA1CertAsset().mCert,
+                                                            GetNodeA2CertAsset().mCert, GetNodeA2CertAsset().mKey, &bobFabricIndex);
+    EXPECT_EQ(CHIP_NO_ERROR, err);
+
+    SessionHolder aliceToBobSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(aliceToBobSession, 2,
+                                                      fabricTable.FindFabricWithIndex(bobFabricIndex)->GetNodeId(), 1,
+                                                      aliceFabricIndex, peer, CryptoContext::SessionRole::kInitiator);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    SessionHolder bobToAliceSession;
+    err = sessionManager.InjectPaseSessionWithTestKey(bobToAliceSession, 1,
+                                                      fabricTable.FindFabricWithIndex(aliceFabricIndex)->GetNodeId(), 2,
+                                                      bobFabricIndex, peer, CryptoContext::SessionRole::kResponder);
+    EXPECT_EQ(err, CHIP_NO_ERROR);
+
+    callback.ReceiveHandlerCallCount = 0;
+
+    PayloadHeader payloadHeader;
+    payloadHeader.SetExchangeID(0);
+    payloadHeader.SetMessageType(chip::Protocols::Echo::MsgType::EchoRequest);
+    payloadHeader.SetInitiator(true);
+
+    Optional<SessionHandle> session = aliceToBobSession.Get();
+    SessionManager::PrepareBatchEntry entries[kMessageCount];
+    for (auto & entry : entries)
+    {
+        entry.session       = &session.Value();
+        entry.payloadHeader = &payloadHeader;
+        entry.message       = chip::MessagePacketBuffer::NewWithData(PAYLOAD, payload_len);
+        EXPECT_FALSE(entry.message.IsNull());
+    }
+
+    // An entry without a payload header fails without affecting the others.
+    entries[1].payloadHeader = nullptr;
+
+    err = sessionManager.PrepareMessages(entries, kMessageCount);
+    EXPECT_EQ(err, CHIP_ERROR_INVALID_ARGUMENT);
+    EXPECT_EQ(entries[1].result, CHIP_ERROR_INVALID_ARGUMENT);
+
+    for (size_t i = 0; i < kMessageCount; i++)
+    {
+        if (i == 1)
+        {
+            continue;
+        }
+        EXPECT_EQ(entries[i].result, CHIP_NO_ERROR);
+        err = sessionManager.SendPreparedMessage(session.Value(), entries[i].preparedMessage);
+        EXPECT_EQ(err, CHIP_NO_ERROR);
+    }
+
+    mContext.DrainAndServiceIO();
+    EXPECT_EQ(callback.ReceiveHandlerCallCount, static_cast<int>(kMessageCount - 1));
+
+    sessionManager.Shutdown();
+}
+
 TEST_F(TestSessionManager, SendBadEncryptedPacketTest)
 {
     uint16_t payload_len = sizeof(PAYLOAD);